@@ -8,6 +8,7 @@
 #include "LRResource.h"
 #include "LRTypes.h"
 
+#include <string>
 #include <vector>
 
 namespace lrengine {
@@ -20,6 +21,14 @@ class LRTexture;
  * @brief 帧缓冲类
  * 
  * 支持离屏渲染和多重渲染目标(MRT)
+ *
+ * FrameBufferDescriptor::viewCount > 1 时为多视图帧缓冲：附加 Texture2DArray
+ * （立体渲染）或 TextureCube（立方体贴图捕获），一次绘制提交即渲染到所有层。
+ * 顶点着色器在 #version 之后插入 GetMultiviewShaderHeader()，用 LR_VIEW_ID
+ * 选择视图矩阵、LR_INSTANCE_ID 代替 gl_InstanceID，并在 main 中调用 LR_SET_LAYER()。
+ * 分层回退模式下实例数会乘以视图数，逐实例顶点属性的 divisor 也需乘以视图数。
+ * 后端不支持多视图（Metal，或OpenGL既无 GL_OVR_multiview2 也不能在顶点着色器写入
+ * gl_Layer）时，创建或附加纹理失败并报告 ErrorCode::NotSupported。
  */
 class LR_API LRFrameBuffer : public LRResource {
 public:
@@ -95,6 +104,24 @@ public:
      * @brief 获取颜色附件数量
      */
     uint32_t GetColorAttachmentCount() const { return static_cast<uint32_t>(mColorTextures.size()); }
+
+    /**
+     * @brief 获取视图数量
+     */
+    uint32_t GetViewCount() const { return mViewCount; }
+
+    /**
+     * @brief 获取多视图渲染方式（附加纹理后确定）
+     */
+    MultiviewMode GetMultiviewMode() const;
+
+    /**
+     * @brief 获取顶点着色器的多视图声明
+     *
+     * 定义 LR_VIEW_ID、LR_INSTANCE_ID 与 LR_SET_LAYER()，
+     * 同一份着色器可用于单视图、原生多视图和分层回退。
+     */
+    std::string GetMultiviewShaderHeader() const;
     
     /**
      * @brief 获取原生句柄
@@ -116,6 +143,7 @@ protected:
     IFrameBufferImpl* mImpl = nullptr;
     uint32_t mWidth = 0;
     uint32_t mHeight = 0;
+    uint32_t mViewCount = 1;
     std::vector<LRTexture*> mColorTextures;
     LRTexture* mDepthTexture = nullptr;
     LRTexture* mStencilTexture = nullptr;
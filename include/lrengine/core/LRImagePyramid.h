@@ -0,0 +1,179 @@
+/**
+ * @file LRImagePyramid.h
+ * @brief LREngine GPU 高斯/拉普拉斯金字塔
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRRenderTargetPool;
+class LRTexture;
+class LRFrameBuffer;
+class LRShader;
+class LRPipelineState;
+struct PooledRenderTarget;
+
+/**
+ * @brief 金字塔配置
+ */
+struct ImagePyramidDescriptor {
+    uint32_t maxLevels = 0;                      ///< 最大层数（含第 0 层，0 表示不限制）
+    uint32_t minLevelSize = 8;                   ///< 最粗层最短边的下限
+    PixelFormat format = PixelFormat::RGBA16F;   ///< 第 1 层起的存储格式（拉普拉斯带需要有符号浮点格式）
+};
+
+/**
+ * @brief GPU 图像金字塔
+ *
+ * 高斯层由 5×5 二项式核降采样得到（每层 9 次双线性采样的单遍绘制），
+ * 拉普拉斯带 L(i) = G(i) - Up(G(i+1))，最粗一层即最粗的高斯层；
+ * 重建 R(i) = L(i) + Up(R(i+1)) 与分解使用相同的双线性上采样，结果可精确还原。
+ *
+ * 第 0 层高斯即源纹理本身（持有引用，不拷贝）；其余各层与重建中间结果
+ * 都从渲染目标池获取，ReleaseLevels 后归还，多个效果（多频段融合、
+ * 局部色调映射、细节增强）可共享同一个池，也可复用同一次构建的金字塔。
+ *
+ * 着色器为 GLSL（OpenGL 3.3 / OpenGL ES 3.0）；Metal 后端的管线状态固定为
+ * BGRA8 颜色格式，暂不支持。
+ *
+ * 使用示例：
+ * @code
+ * LRImagePyramid pyramid;
+ * pyramid.Initialize(context, &targetPool, ImagePyramidDescriptor());
+ *
+ * pyramid.BuildGaussian(photoTexture);
+ * pyramid.BuildLaplacian();
+ * // 在 GetLaplacianTarget(i) 上增强细节……
+ * pyramid.Collapse(outputFrameBuffer);
+ * pyramid.ReleaseLevels();
+ * @endcode
+ */
+class LR_API LRImagePyramid {
+public:
+    LRImagePyramid() = default;
+    ~LRImagePyramid();
+
+    LRImagePyramid(const LRImagePyramid&) = delete;
+    LRImagePyramid& operator=(const LRImagePyramid&) = delete;
+
+    /**
+     * @brief 计算层数：逐层减半直到最短边将小于 minLevelSize
+     * @param width 第 0 层宽度
+     * @param height 第 0 层高度
+     * @param minLevelSize 最粗层最短边的下限
+     * @param maxLevels 最大层数（0 表示不限制）
+     * @return 层数（至少为 1）
+     */
+    static uint32_t SelectLevelCount(uint32_t width, uint32_t height, uint32_t minLevelSize, uint32_t maxLevels);
+
+    /**
+     * @brief 初始化（编译着色器）
+     * @param context 渲染上下文
+     * @param pool 渲染目标池（生命周期需长于金字塔）
+     * @param desc 配置
+     * @return 成功返回true
+     */
+    bool Initialize(LRRenderContext* context, LRRenderTargetPool* pool, const ImagePyramidDescriptor& desc);
+
+    /**
+     * @brief 构建高斯金字塔（会先归还上一次构建的各层）
+     * @param source 第 0 层（2D 纹理，需可线性过滤）
+     * @return 成功返回true
+     */
+    bool BuildGaussian(LRTexture* source);
+
+    /**
+     * @brief 由已构建的高斯金字塔计算拉普拉斯带
+     * @return 成功返回true
+     */
+    bool BuildLaplacian();
+
+    /**
+     * @brief 由拉普拉斯带重建图像
+     * @param target 输出帧缓冲（尺寸需与第 0 层一致）
+     * @return 成功返回true
+     */
+    bool Collapse(LRFrameBuffer* target);
+
+    /**
+     * @brief 归还各层渲染目标并释放对源纹理的引用
+     */
+    void ReleaseLevels();
+
+    /**
+     * @brief 释放着色器与所有层
+     */
+    void Release();
+
+    /**
+     * @brief 获取层数（未构建时为 0）
+     */
+    uint32_t GetLevelCount() const { return static_cast<uint32_t>(mLevelSizes.size()); }
+
+    /**
+     * @brief 获取层宽度
+     */
+    uint32_t GetLevelWidth(uint32_t level) const;
+
+    /**
+     * @brief 获取层高度
+     */
+    uint32_t GetLevelHeight(uint32_t level) const;
+
+    /**
+     * @brief 获取高斯层
+     */
+    LRTexture* GetGaussianLevel(uint32_t level) const;
+
+    /**
+     * @brief 获取拉普拉斯带（最后一层为最粗的高斯层）
+     */
+    LRTexture* GetLaplacianLevel(uint32_t level) const;
+
+    /**
+     * @brief 获取拉普拉斯带的帧缓冲，用于在重建前原地修改频段（最后一层为最粗的高斯层）
+     */
+    LRFrameBuffer* GetLaplacianTarget(uint32_t level) const;
+
+private:
+    struct LevelSize {
+        uint32_t width;
+        uint32_t height;
+    };
+
+    LRPipelineState* createPipeline(LRShader* fragmentShader, const char* debugName);
+    LRShader* createShader(ShaderStage stage, const char* body, const char* debugName);
+    void runPass(LRPipelineState* pipeline, LRTexture* first, LRTexture* second, LRFrameBuffer* target,
+                 uint32_t width, uint32_t height);
+    void releaseLaplacian();
+
+    LRRenderContext* mContext = nullptr;
+    LRRenderTargetPool* mPool = nullptr;
+    ImagePyramidDescriptor mDesc;
+
+    LRShader* mVertexShader = nullptr;
+    LRShader* mDownsampleShader = nullptr;
+    LRShader* mDifferenceShader = nullptr;
+    LRShader* mAddShader = nullptr;
+    LRPipelineState* mDownsamplePipeline = nullptr;
+    LRPipelineState* mDifferencePipeline = nullptr;   ///< 拉普拉斯分解
+    LRPipelineState* mAddPipeline = nullptr;          ///< 重建
+
+    LRTexture* mSource = nullptr;
+    std::vector<LevelSize> mLevelSizes;
+    std::vector<PooledRenderTarget*> mGaussian;       ///< 第 1 层起的高斯层
+    std::vector<PooledRenderTarget*> mLaplacian;      ///< 第 0 至 n-2 层的拉普拉斯带
+};
+
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,124 @@
+/**
+ * @file LRImageReducer.h
+ * @brief LREngine GPU 图像归约（自动曝光 / 自动白平衡统计）
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+struct ImageStatistics;
+}
+namespace render {
+
+// 前向声明
+class LRTexture;
+
+/**
+ * @brief 图像归约器配置
+ */
+struct ImageReducerDescriptor {
+    uint32_t readbackSize = 16;          ///< 回读 mip 的最大边长（16 时 RGBA8 约 1KB/帧）
+    uint32_t maxInFlight = 3;            ///< 最多同时在途的回读数（超过时 Submit 返回false）
+};
+
+/**
+ * @brief GPU 图像归约器
+ *
+ * 利用纹理的 mip 链在 GPU 上做盒式归约，只异步回读边长不超过
+ * readbackSize 的小 mip，再在 CPU 上计算统计量。回读延迟通常为
+ * 1-2 帧，Submit 与 Poll 均不阻塞。
+ *
+ * 支持 RGBA8、R8 和 RGB10A2 的 2D 纹理（OpenGL ES 仅 RGBA8），纹理需带足够的 mip 层（创建时 mipLevels 为 0 即完整 mip 链）。
+ * 平均值与全分辨率一致；最小/最大值与直方图基于块平均值，动态范围会被压缩。
+ *
+ * 注意：回读层不是第 0 层时，Submit 会对调用方的源纹理调用 GenerateMipmaps，
+ * 覆盖其第 1 层起的全部 mip 内容。源纹理的 mip 另有用途时应传入副本。
+ *
+ * 使用示例：
+ * @code
+ * LRImageReducer reducer;
+ * reducer.Initialize(ImageReducerDescriptor());
+ *
+ * // 每帧渲染到 sceneTexture 之后
+ * reducer.Submit(sceneTexture);
+ *
+ * utils::ImageStatistics stats;
+ * if (reducer.Poll(stats)) {
+ *     exposure = 0.18f / std::max(stats.meanLuma, 1e-3f);
+ * }
+ * @endcode
+ */
+class LR_API LRImageReducer {
+public:
+    LRImageReducer() = default;
+    ~LRImageReducer();
+
+    LRImageReducer(const LRImageReducer&) = delete;
+    LRImageReducer& operator=(const LRImageReducer&) = delete;
+
+    /**
+     * @brief 初始化
+     * @param desc 配置
+     * @return 成功返回true
+     */
+    bool Initialize(const ImageReducerDescriptor& desc);
+
+    /**
+     * @brief 提交一帧：生成 mip 链并发起小 mip 的异步回读
+     *
+     * 回读层大于 0 时会在源纹理上调用 GenerateMipmaps（改写其 mip 内容）。
+     * 回读完成前持有纹理引用。
+     *
+     * @param source 源纹理
+     * @return 成功返回true，在途回读已满或纹理不满足要求返回false
+     */
+    bool Submit(LRTexture* source);
+
+    /**
+     * @brief 取回已完成的回读（不阻塞）
+     *
+     * 多帧同时完成时只统计最新一帧。
+     *
+     * @param out 输出统计结果
+     * @return 有新结果返回true
+     */
+    bool Poll(utils::ImageStatistics& out);
+
+    /**
+     * @brief 等待并丢弃所有在途回读
+     */
+    void Release();
+
+    /**
+     * @brief 获取在途回读数
+     */
+    size_t GetPendingCount() const { return mPending.size(); }
+
+private:
+    struct PendingReadback {
+        LRTexture* texture = nullptr;
+        int32_t slot = -1;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        ImageFormat format = ImageFormat::RGBA8;
+    };
+
+    static uint32_t selectMipLevel(uint32_t width, uint32_t height, uint32_t maxSize);
+
+    ImageReducerDescriptor mDesc;
+    std::deque<PendingReadback> mPending;
+    std::vector<uint8_t> mScratch;             ///< 回读目标
+    std::vector<uint8_t> mLatest;              ///< 最新一帧已就绪的数据
+    bool mInitialized = false;
+};
+
+} // namespace render
+} // namespace lrengine
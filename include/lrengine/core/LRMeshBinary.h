@@ -0,0 +1,215 @@
+/**
+ * @file LRMeshBinary.h
+ * @brief LREngine 可直接上传的二进制网格格式及加载器
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lrengine {
+
+namespace utils {
+class AssetPackage;
+}
+
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRVertexBuffer;
+class LRIndexBuffer;
+
+/**
+ * @brief 网格二进制文件头（96 字节，小端序）
+ *
+ * 文件布局：
+ * | Header | Attribute[attributeCount] | SubMesh[subMeshCount] | 顶点数据(64对齐) | 索引数据(64对齐) |
+ *
+ * 顶点/索引数据即 BufferDescriptor::data 所需的原始字节，加载时不做任何解析或转换。
+ */
+struct MeshBinaryHeader {
+    uint32_t magic = 0;             ///< 'LRMB'
+    uint32_t version = 0;           ///< 格式版本
+    uint32_t vertexCount = 0;       ///< 顶点数量
+    uint32_t vertexStride = 0;      ///< 顶点步长
+    uint32_t indexCount = 0;        ///< 索引数量
+    uint8_t indexType = 0;          ///< IndexType
+    uint8_t attributeCount = 0;     ///< 顶点属性数量
+    uint16_t subMeshCount = 0;      ///< 子网格数量
+    uint32_t flags = 0;             ///< 保留标志
+    uint32_t attributesOffset = 0;  ///< 属性表偏移
+    uint32_t subMeshesOffset = 0;   ///< 子网格表偏移
+    uint32_t vertexDataOffset = 0;  ///< 顶点数据偏移
+    uint32_t vertexDataSize = 0;    ///< 顶点数据大小
+    uint32_t indexDataOffset = 0;   ///< 索引数据偏移
+    uint32_t indexDataSize = 0;     ///< 索引数据大小
+    float boundsMin[3] = {};        ///< 包围盒最小点
+    float boundsMax[3] = {};        ///< 包围盒最大点
+    uint8_t reserved[20] = {};
+};
+
+/**
+ * @brief 序列化的顶点属性（16 字节）
+ */
+struct MeshBinaryAttribute {
+    uint32_t location = 0;
+    uint32_t offset = 0;
+    uint32_t stride = 0;
+    uint8_t format = 0;             ///< VertexFormat
+    uint8_t normalized = 0;
+    uint16_t reserved = 0;
+};
+
+/**
+ * @brief 子网格区间（40 字节）
+ */
+struct MeshBinarySubMesh {
+    uint32_t indexStart = 0;        ///< 起始索引
+    uint32_t indexCount = 0;        ///< 索引数量
+    uint32_t materialID = 0;        ///< 材质ID
+    uint32_t reserved = 0;
+    float boundsMin[3] = {};        ///< 子网格包围盒最小点
+    float boundsMax[3] = {};        ///< 子网格包围盒最大点
+};
+
+static_assert(sizeof(MeshBinaryHeader) == 96, "MeshBinaryHeader must be 96 bytes");
+static_assert(sizeof(MeshBinaryAttribute) == 16, "MeshBinaryAttribute must be 16 bytes");
+static_assert(sizeof(MeshBinarySubMesh) == 40, "MeshBinarySubMesh must be 40 bytes");
+
+/**
+ * @brief 网格二进制的零拷贝视图
+ *
+ * 指针指向原始内存（映射文件或资源包），生命周期跟随数据源。
+ */
+struct MeshBinaryView {
+    const MeshBinaryHeader* header = nullptr;
+    const MeshBinaryAttribute* attributes = nullptr;
+    const MeshBinarySubMesh* subMeshes = nullptr;
+    const void* vertexData = nullptr;
+    const void* indexData = nullptr;
+
+    /**
+     * @brief 还原顶点布局描述符
+     */
+    VertexLayoutDescriptor GetVertexLayout() const;
+
+    /**
+     * @brief 获取索引类型
+     */
+    IndexType GetIndexType() const {
+        return header ? static_cast<IndexType>(header->indexType) : IndexType::UInt32;
+    }
+};
+
+/**
+ * @brief 网格序列化输入（离线转换工具使用）
+ */
+struct MeshBinarySource {
+    VertexLayoutDescriptor layout;
+    const void* vertexData = nullptr;
+    uint32_t vertexCount = 0;
+    const void* indexData = nullptr;
+    uint32_t indexCount = 0;
+    IndexType indexType = IndexType::UInt32;
+    std::vector<MeshBinarySubMesh> subMeshes;   ///< 为空时生成覆盖全部索引的单个子网格
+    float boundsMin[3] = {};
+    float boundsMax[3] = {};
+};
+
+/**
+ * @brief 已加载到GPU的网格
+ */
+struct LoadedMesh {
+    LRVertexBuffer* vertexBuffer = nullptr;
+    LRIndexBuffer* indexBuffer = nullptr;
+    std::vector<MeshBinarySubMesh> subMeshes;
+    uint32_t vertexCount = 0;
+    uint32_t indexCount = 0;
+    float boundsMin[3] = {};
+    float boundsMax[3] = {};
+
+    /**
+     * @brief 释放GPU缓冲
+     */
+    void Release();
+};
+
+/**
+ * @brief 网格二进制格式编解码
+ */
+class LR_API LRMeshBinary {
+public:
+    static constexpr uint32_t kMagic = 0x424D524C;   // 'LRMB'
+    static constexpr uint32_t kVersion = 1;
+    static constexpr uint32_t kDataAlignment = 64;
+
+    /**
+     * @brief 解析网格二进制（校验边界、顶点属性与子网格区间，不拷贝数据）
+     * @param data 数据起始地址
+     * @param size 数据大小
+     * @param out 输出视图
+     * @return 数据有效返回true
+     */
+    static bool Parse(const void* data, size_t size, MeshBinaryView& out);
+
+    /**
+     * @brief 序列化网格
+     * @param source 网格数据
+     * @param out 输出字节
+     * @return 成功返回true；属性越出顶点步长、子网格越界或结果超过 4GB 时返回false
+     */
+    static bool Serialize(const MeshBinarySource& source, std::vector<uint8_t>& out);
+
+private:
+    LRMeshBinary() = delete;
+};
+
+/**
+ * @brief 网格加载器
+ *
+ * 从映射文件或资源包直接创建 LRVertexBuffer/LRIndexBuffer，
+ * 运行时不做 OBJ/GLTF 解析或格式转换。
+ *
+ * 使用示例：
+ * @code
+ * LoadedMesh mesh;
+ * if (LRMeshLoader::LoadFromPackage(context, package, "meshes/cube", mesh)) {
+ *     context->SetVertexBuffer(mesh.vertexBuffer);
+ *     context->SetIndexBuffer(mesh.indexBuffer);
+ *     for (const auto& sub : mesh.subMeshes) {
+ *         context->DrawIndexed(sub.indexStart, sub.indexCount);
+ *     }
+ * }
+ * @endcode
+ */
+class LR_API LRMeshLoader {
+public:
+    /**
+     * @brief 从内存创建网格缓冲
+     */
+    static bool LoadFromMemory(LRRenderContext* context, const void* data, size_t size,
+                               LoadedMesh& out, const char* debugName = nullptr);
+
+    /**
+     * @brief 映射网格文件并创建缓冲
+     */
+    static bool LoadFromFile(LRRenderContext* context, const std::string& path, LoadedMesh& out);
+
+    /**
+     * @brief 从资源包加载网格（未压缩时零拷贝）
+     */
+    static bool LoadFromPackage(LRRenderContext* context, const utils::AssetPackage& package,
+                                const std::string& name, LoadedMesh& out);
+
+private:
+    LRMeshLoader() = delete;
+};
+
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,102 @@
+/**
+ * @file LRPartialUploader.h
+ * @brief LREngine 局部纹理上传（只上传变化区域）
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+#include "lrengine/utils/DirtyRegion.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRTexture;
+
+/**
+ * @brief 局部上传配置
+ */
+struct PartialUploadDescriptor {
+    uint32_t tileSize = 64;              ///< 变化检测块边长（像素）
+    float fullUploadThreshold = 0.6f;    ///< 变化面积占比超过该值时改为整帧上传
+};
+
+/**
+ * @brief 局部纹理上传器
+ *
+ * 保留已上传内容的 CPU 副本作为比较基准，逐块检测新帧的变化，
+ * 将变化块合并为矩形后通过 TextureRegion 子区域更新上传，并只把
+ * 变化区域写回副本。首帧、尺寸/格式变化或更换纹理时整帧上传。
+ *
+ * 支持 RGBA8、RGB10A2 和 RGBA16F 单平面图像，纹理格式与尺寸需与图像一致。
+ *
+ * 使用示例：
+ * @code
+ * LRPartialUploader uploader;
+ * uploader.Initialize(PartialUploadDescriptor());
+ *
+ * // 每帧
+ * uploader.Upload(screenTexture, captureFrame);
+ * @endcode
+ */
+class LR_API LRPartialUploader {
+public:
+    LRPartialUploader() = default;
+    ~LRPartialUploader() = default;
+
+    LRPartialUploader(const LRPartialUploader&) = delete;
+    LRPartialUploader& operator=(const LRPartialUploader&) = delete;
+
+    /**
+     * @brief 初始化
+     * @param desc 配置
+     * @return 成功返回true
+     */
+    bool Initialize(const PartialUploadDescriptor& desc);
+
+    /**
+     * @brief 上传一帧
+     * @param texture 目标纹理（2D，mip 0）
+     * @param image 图像数据
+     * @return 成功返回true
+     */
+    bool Upload(LRTexture* texture, const ImageDataDesc& image);
+
+    /**
+     * @brief 丢弃比较基准，下一帧整帧上传（纹理被其他途径修改后调用）
+     */
+    void Reset();
+
+    /**
+     * @brief 获取最近一帧上传的矩形（整帧上传时为覆盖全图的单个矩形）
+     */
+    const std::vector<utils::DirtyRect>& GetUploadedRects() const { return mRects; }
+
+    /**
+     * @brief 获取最近一帧上传的字节数
+     */
+    uint64_t GetUploadedBytes() const { return mUploadedBytes; }
+
+private:
+    bool uploadFull(LRTexture* texture, const ImageDataDesc& image, uint32_t bytesPerPixel);
+    void uploadRect(LRTexture* texture, const ImageDataDesc& image, const utils::DirtyRect& rect,
+                    uint32_t bytesPerPixel);
+
+    PartialUploadDescriptor mDesc;
+    std::vector<uint8_t> mShadow;              ///< 纹理当前内容的副本（紧密排列）
+    ImageDataDesc mShadowDesc;                 ///< 副本的图像描述
+    uint64_t mTextureID = 0;                   ///< 副本对应的纹理资源 ID
+    std::vector<uint8_t> mScratch;             ///< 矩形打包缓冲
+    utils::DirtyTileMap mTiles;
+    std::vector<utils::DirtyRect> mRects;
+    uint64_t mUploadedBytes = 0;
+    bool mInitialized = false;
+};
+
+} // namespace render
+} // namespace lrengine
@@ -25,7 +25,19 @@ enum class PlanarFormat : uint8_t {
     YUV420P,    // 3平面: Y(R8) + U(R8) + V(R8)
     NV12,       // 2平面: Y(R8) + UV(RG8)
     NV21,       // 2平面: Y(R8) + VU(RG8)
-    RGBA        // 1平面: RGBA8（兼容模式）
+    RGBA,       // 1平面: RGBA8（兼容模式）
+    P010,       // 2平面: Y(R16) + UV(RG16)，10 位样本高位对齐
+    P016,       // 2平面: Y(R16) + UV(RG16)
+    RGB10A2,    // 1平面: RGB10A2
+    RGBA16F     // 1平面: RGBA16F
+};
+
+/**
+ * @brief 平面纹理的存储布局
+ */
+enum class PlanarTextureLayout : uint8_t {
+    Separate,   // 每个平面一个纹理（默认）
+    Packed      // NV12/NV21：单个 R8 纹理，高度 × 1.5（Y 行在上，UV 行在下），整帧一次上传
 };
 
 /**
@@ -35,6 +47,7 @@ struct PlanarTextureDescriptor {
     uint32_t width = 0;
     uint32_t height = 0;
     PlanarFormat format = PlanarFormat::NV12;
+    PlanarTextureLayout layout = PlanarTextureLayout::Separate;  // Packed 仅支持 NV12/NV21 且宽高为偶数
     SamplerDescriptor sampler;
     const char* debugName = nullptr;
 };
@@ -45,6 +58,14 @@ struct PlanarTextureDescriptor {
  * 用于处理 YUV 等需要多个纹理对象的数据格式。
  * 每个平面对应一个独立的纹理对象。
  * 
+ * P010/P016 平面为 16 位归一化纹理，着色器采样结果与 NV12 一样位于 [0, 1]，
+ * 10/16 位数据无需在 CPU 上降为 8 位。设备不支持 R16/RG16（如缺少
+ * GL_EXT_texture_norm16 的 GLES）时改用 R16F/RG16F 平面，上传时在 CPU 上转换为半精度。
+ * 
+ * NV12/NV21 可使用 Packed 布局：内存布局与连续的 NV12 缓冲区相同，源数据连续且紧密排列时
+ * 直接整帧上传，否则先在 CPU 上拼接，每帧只有一次上传调用，适合驱动开销占主导的小分辨率视频流。
+ * 此时只有一个平面纹理，着色器通过 GetPackedSamplingSource() 提供的函数采样。
+ * 
  * 使用示例：
  * @code
  * PlanarTextureDescriptor desc;
@@ -90,7 +111,7 @@ public:
     
     /**
      * @brief 更新指定平面的数据
-     * @param planeIndex 平面索引
+     * @param planeIndex 平面索引（Packed 布局为逻辑平面：0 为 Y，1 为 UV）
      * @param data 像素数据
      * @param stride 行字节数（0表示紧密排列）
      */
@@ -100,6 +121,8 @@ public:
      * @brief 批量更新所有平面数据
      * @param planeData 各平面数据指针数组
      * @param strides 各平面行字节数数组（可选）
+     *
+     * Packed 布局同时给出 Y 与 UV 时合并为一次整帧上传。
      */
     void UpdateAllPlanes(const std::vector<const void*>& planeData,
                         const std::vector<uint32_t>& strides = {});
@@ -229,6 +252,26 @@ public:
      */
     ImageFormat GetImageFormat() const { return mImageFormat; }
     
+    /**
+     * @brief 获取存储布局
+     */
+    PlanarTextureLayout GetLayout() const { return mLayout; }
+    
+    /**
+     * @brief 获取 Packed 布局的 GLSL 采样函数源码（拼接到片段着色器中使用）
+     *
+     * 声明 uniform sampler2D uPackedYUV（打包纹理）与 uniform vec2 uPackedSize（图像宽高），
+     * 以及 vec3 SamplePackedYUV(vec2 uv)：返回 (Y, 色度字节 0, 色度字节 1)，NV12 为 (Y, U, V)，
+     * NV21 为 (Y, V, U)。Y 使用纹理过滤（需线性采样器），交织色度按最近点取样。
+     * 需要 GLSL 3.30 / GLSL ES 3.00（texelFetch）。
+     */
+    static const char* GetPackedSamplingSource();
+    
+    /**
+     * @brief 16 位平面是否以半精度纹理存储（R16/RG16 不受支持时的回退）
+     */
+    bool UsesHalfFloatPlanes() const { return mHalfFloatPlanes; }
+    
     /**
      * @brief 获取指定平面的尺寸
      * @param planeIndex 平面索引
@@ -279,6 +322,35 @@ private:
      */
     bool createPlanes(const PlanarTextureDescriptor& desc);
     
+    /**
+     * @brief 创建 Packed 布局的单个 R8 纹理
+     * @param desc 描述符
+     * @return 创建是否成功
+     */
+    bool createPackedPlane(const PlanarTextureDescriptor& desc);
+    
+    /**
+     * @brief 以一次上传更新 Packed 纹理（源不连续时先拼接到暂存缓冲）
+     * @param imageData NV12/NV21 图像
+     * @return 是否成功
+     */
+    bool uploadPacked(const ImageDataDesc& imageData);
+    
+    /**
+     * @brief 创建 16 位 YUV 平面（R16/RG16，失败时回退到 R16F/RG16F）
+     * @param desc 描述符
+     * @return 创建是否成功
+     */
+    bool create16BitPlanes(const PlanarTextureDescriptor& desc);
+    
+    /**
+     * @brief 将 16 位归一化样本转换为半精度后上传（半精度回退路径）
+     * @param planeIndex 平面索引
+     * @param data 16 位样本数据
+     * @param stride 行字节数（0表示紧密排列）
+     */
+    void uploadU16PlaneAsHalf(uint32_t planeIndex, const void* data, uint32_t stride);
+    
     /**
      * @brief 释放所有平面纹理
      */
@@ -290,8 +362,12 @@ private:
     uint32_t mWidth = 0;
     uint32_t mHeight = 0;
     PlanarFormat mFormat = PlanarFormat::NV12;
+    PlanarTextureLayout mLayout = PlanarTextureLayout::Separate;
     ImageFormat mImageFormat = ImageFormat::Unknown;
     uint32_t mBoundBaseSlot = 0;
+    bool mHalfFloatPlanes = false;
+    std::vector<uint16_t> mConvertScratch;  ///< 半精度回退的转换缓冲
+    std::vector<uint8_t> mPackScratch;      ///< Packed 布局的拼接缓冲
 };
 
 // 类型别名
@@ -7,10 +7,20 @@
 
 #include "LRDefines.h"
 #include "LRTypes.h"
+#include "LRResource.h"
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace lrengine {
+
+namespace utils {
+class ImageBufferPool;
+}
+
 namespace render {
 
 // 前向声明
@@ -125,6 +135,8 @@ public:
     
     /**
      * @brief 开始新帧
+     *
+     * 若有 RequestMemoryTrim 提交的回收请求，先在渲染线程执行 TrimMemory。
      */
     void BeginFrame();
     
@@ -205,6 +217,14 @@ public:
      */
     void SetTexture(LRTexture* texture, uint32_t slot);
     
+    /**
+     * @brief 使绑定缓存失效
+     * 
+     * Set*系列方法会跳过与当前绑定相同的对象。绕过引擎直接调用图形API
+     * （例如通过原生句柄）修改了绑定后，需要调用此方法强制下次重新绑定。
+     */
+    void InvalidateBindingCache();
+    
     // =========================================================================
     // 清除
     // =========================================================================
@@ -266,6 +286,17 @@ public:
      */
     void DrawIndexedInstanced(uint32_t indexStart, uint32_t indexCount, uint32_t instanceCount);
     
+    /**
+     * @brief 无顶点输入的绘制（顶点由着色器根据 gl_VertexID 生成，如全屏三角形）
+     * 
+     * OpenGL 后端会绑定空的默认VAO（Core Profile 下未绑定VAO的绘制无效），
+     * 之后需重新设置顶点缓冲区。
+     * 
+     * @param vertexStart 起始顶点
+     * @param vertexCount 顶点数量
+     */
+    void DrawWithoutVertexInput(uint32_t vertexStart, uint32_t vertexCount);
+    
     // =========================================================================
     // 同步
     // =========================================================================
@@ -280,6 +311,60 @@ public:
      */
     void Flush();
     
+    // =========================================================================
+    // 内存管理
+    // =========================================================================
+    
+    /**
+     * @brief 内存回收回调，返回释放的对象数量
+     */
+    using MemoryTrimHandler = std::function<size_t(MemoryTrimLevel level)>;
+    
+    /**
+     * @brief 按级别释放所有缓存和池中的空闲内存
+     * 
+     * 依次调用已注册的回收回调（ImageBufferPool、渲染目标池、纹理数组、流式纹理环等），
+     * 再通知后端释放其内部缓存。正在使用的资源不受影响。
+     * 
+     * 回调会释放 GPU 资源、等待栅栏，只能在渲染线程（上下文当前线程）调用。
+     * 系统内存警告通常在 UI 线程回调，此时应使用 RequestMemoryTrim。
+     * 
+     * @param level 回收级别
+     * @return 释放的对象总数
+     */
+    size_t TrimMemory(MemoryTrimLevel level);
+    
+    /**
+     * @brief 请求内存回收（线程安全）
+     * 
+     * 统一的内存压力入口（Android onTrimMemory / iOS 内存警告）：
+     * 只记录级别，下一次 BeginFrame 时在渲染线程执行 TrimMemory。
+     * 两帧之间的多次请求合并为其中最高的级别。
+     * 
+     * @param level 回收级别
+     */
+    void RequestMemoryTrim(MemoryTrimLevel level);
+    
+    /**
+     * @brief 注册内存回收回调
+     * @return 回调ID，用于注销
+     */
+    uint32_t RegisterMemoryTrimHandler(MemoryTrimHandler handler);
+    
+    /**
+     * @brief 注册图像缓冲池，TrimMemory 时调用 ImageBufferPool::Trim
+     * @return 回调ID，用于注销
+     * @note 池销毁前必须注销
+     */
+    uint32_t RegisterImageBufferPool(utils::ImageBufferPool* pool);
+    
+    /**
+     * @brief 注销内存回收回调
+     *
+     * 返回后该回调不会再被调用；若其他线程正在执行 TrimMemory，会等待其结束。
+     */
+    void UnregisterMemoryTrimHandler(uint32_t handlerID);
+    
     // =========================================================================
     // 查询
     // =========================================================================
@@ -298,6 +383,11 @@ public:
      * @brief 获取窗口高度
      */
     uint32_t GetHeight() const { return mHeight; }
+
+    /**
+     * @brief 获取2D纹理的最大边长
+     */
+    uint32_t GetMaxTextureSize() const;
     
     /**
      * @brief 激活当前上下文
@@ -309,6 +399,35 @@ private:
     bool Initialize(const RenderContextDescriptor& desc);
     void Shutdown();
     
+    /**
+     * @brief 某一范围的绑定版本变化时清空该范围的绑定缓存
+     */
+    void validateBindingCache(BindingScope scope);
+    
+    /**
+     * @brief 清空某一范围的绑定缓存并同步其版本号
+     */
+    void resetBindingCache(BindingScope scope);
+    
+private:
+    static constexpr uint32_t kMaxCachedVertexBuffers = 8;
+    static constexpr uint32_t kMaxCachedUniformBuffers = 16;
+    static constexpr uint32_t kMaxCachedTextures = 32;
+    
+    /**
+     * @brief 已绑定对象的资源ID（0表示未知）
+     * 
+     * 使用资源ID而非指针，避免释放后新对象复用同一地址导致误判。
+     */
+    struct BindingCache {
+        uint64_t pipelineState = 0;
+        uint64_t indexBuffer = 0;
+        uint64_t vertexState = 0;       ///< 顶点输入随缓冲区整体切换时（OpenGL VAO）的当前顶点缓冲区
+        uint64_t vertexBuffers[kMaxCachedVertexBuffers] = {};
+        uint64_t uniformBuffers[kMaxCachedUniformBuffers] = {};
+        uint64_t textures[kMaxCachedTextures] = {};
+    };
+    
 private:
     IRenderContextImpl* mImpl = nullptr;
     Backend mBackend = Backend::Unknown;
@@ -320,6 +439,18 @@ private:
     LRFrameBuffer* mCurrentFrameBuffer = nullptr;
     PrimitiveType mCurrentPrimitiveType = PrimitiveType::Triangles;
     IndexType mCurrentIndexType = IndexType::UInt32;
+    
+    // 绑定缓存
+    BindingCache mBindingCache;
+    uint64_t mBindingEpochs[static_cast<size_t>(BindingScope::Count)] = {};
+    bool mVertexStatePerBuffer = false;
+    
+    // 内存回收回调
+    std::vector<std::pair<uint32_t, MemoryTrimHandler>> mTrimHandlers;
+    uint32_t mNextTrimHandlerID = 1;
+    static constexpr int kNoPendingTrim = -1;
+    std::recursive_mutex mTrimMutex;                    ///< 回调执行期间持有，回调内可注册/注销
+    std::atomic<int> mPendingTrimLevel{kNoPendingTrim}; ///< RequestMemoryTrim 提交的最高级别
 };
 
 } // namespace render
@@ -0,0 +1,126 @@
+/**
+ * @file LRRenderTargetPool.h
+ * @brief LREngine 渲染目标池（按尺寸与格式复用离屏目标）
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRTexture;
+class LRFrameBuffer;
+
+/**
+ * @brief 池中的渲染目标（颜色纹理 + 帧缓冲，无深度）
+ *
+ * 纹理为单层 mip，采样器为线性过滤 + ClampToEdge。
+ */
+struct PooledRenderTarget {
+    LRTexture* texture = nullptr;
+    LRFrameBuffer* frameBuffer = nullptr;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    PixelFormat format = PixelFormat::RGBA8;
+};
+
+/**
+ * @brief 渲染目标池
+ *
+ * 多遍后处理（金字塔、模糊链等）每帧需要大量尺寸固定的中间目标，
+ * 池按尺寸与格式精确匹配复用，避免反复创建纹理和帧缓冲。
+ * 初始化时向渲染上下文注册内存回收回调，TrimMemory 会释放空闲目标。
+ *
+ * 只能在渲染线程使用。
+ *
+ * 使用示例：
+ * @code
+ * LRRenderTargetPool pool;
+ * pool.Initialize(context);
+ *
+ * PooledRenderTarget* half = pool.Acquire(width / 2, height / 2, PixelFormat::RGBA16F);
+ * context->BeginRenderPass(half->frameBuffer);
+ * // ...
+ * context->EndRenderPass();
+ * pool.Recycle(half);
+ * @endcode
+ */
+class LR_API LRRenderTargetPool {
+public:
+    LRRenderTargetPool() = default;
+    ~LRRenderTargetPool();
+
+    LRRenderTargetPool(const LRRenderTargetPool&) = delete;
+    LRRenderTargetPool& operator=(const LRRenderTargetPool&) = delete;
+
+    /**
+     * @brief 初始化并注册内存回收回调
+     * @param context 渲染上下文
+     * @return 成功返回true
+     */
+    bool Initialize(LRRenderContext* context);
+
+    /**
+     * @brief 获取渲染目标（优先复用空闲目标）
+     * @param width 宽度
+     * @param height 高度
+     * @param format 颜色格式
+     * @return 渲染目标，失败返回nullptr
+     */
+    PooledRenderTarget* Acquire(uint32_t width, uint32_t height, PixelFormat format);
+
+    /**
+     * @brief 归还渲染目标
+     */
+    void Recycle(PooledRenderTarget* target);
+
+    /**
+     * @brief 释放空闲目标
+     *
+     * Low 只释放自上次回收以来未被使用过的目标，其余级别释放所有空闲目标。
+     *
+     * @param level 回收级别
+     * @return 释放的目标数量
+     */
+    size_t Trim(MemoryTrimLevel level);
+
+    /**
+     * @brief 获取池中目标总数
+     */
+    size_t GetTargetCount() const { return mEntries.size(); }
+
+    /**
+     * @brief 获取空闲目标数量
+     */
+    size_t GetIdleCount() const;
+
+    /**
+     * @brief 释放所有目标并注销回收回调（使用中的目标也会被释放）
+     */
+    void Release();
+
+private:
+    struct Entry {
+        PooledRenderTarget target;
+        bool inUse = false;
+        bool usedSinceTrim = false;
+    };
+
+    static void destroyTarget(PooledRenderTarget& target);
+
+    LRRenderContext* mContext = nullptr;
+    uint32_t mTrimHandlerID = 0;
+    std::vector<std::unique_ptr<Entry>> mEntries;
+};
+
+} // namespace render
+} // namespace lrengine
@@ -14,6 +14,17 @@
 namespace lrengine {
 namespace render {
 
+/**
+ * @brief 绑定缓存的失效范围
+ */
+enum class BindingScope : uint8_t {
+    Pipeline,       ///< 着色器程序与管线状态
+    VertexInput,    ///< 顶点缓冲区与索引缓冲区（OpenGL 中即当前 VAO 及其索引缓冲绑定）
+    UniformBuffer,  ///< Uniform 缓冲区槽位
+    Texture,        ///< 纹理单元
+    Count
+};
+
 /**
  * @brief 渲染资源基类
  * 
@@ -74,6 +85,22 @@ public:
      */
     const std::string& GetDebugName() const { return mDebugName; }
     
+    /**
+     * @brief 获取某一范围的全局绑定版本号
+     * 
+     * 版本号变化时LRRenderContext丢弃该范围的绑定缓存，其它范围不受影响。
+     */
+    static uint64_t GetBindingEpoch(BindingScope scope);
+    
+    /**
+     * @brief 标记某一范围的后端绑定已被改变
+     * 
+     * 直接Bind资源时由前端调用；后端在创建、更新等操作中实际改写了当前绑定
+     * （如OpenGL非DSA路径的bind-to-edit）时由后端调用。不改变绑定的操作不应调用，
+     * 否则每次更新资源都会让绑定缓存失效。
+     */
+    static void InvalidateBindings(BindingScope scope);
+    
 protected:
     /**
      * @brief 构造函数（仅派生类可调用）
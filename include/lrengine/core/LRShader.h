@@ -128,6 +128,11 @@ public:
      */
     LRShader* GetFragmentShader() const { return mFragmentShader; }
     
+    /**
+     * @brief 获取平台实现
+     */
+    IShaderProgramImpl* GetImpl() const { return mImpl; }
+    
 protected:
     friend class LRRenderContext;
     
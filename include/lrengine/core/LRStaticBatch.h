@@ -0,0 +1,221 @@
+/**
+ * @file LRStaticBatch.h
+ * @brief LREngine 静态几何合批，在加载期合并不可移动物体的顶点与索引数据
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+#include "lrengine/math/Vec3.hpp"
+#include "lrengine/math/Mat4.hpp"
+
+#include <vector>
+#include <cstdint>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRVertexBuffer;
+class LRIndexBuffer;
+
+/**
+ * @brief 轴对齐包围盒
+ */
+struct StaticBatchBounds {
+    math::Vec3f min{0.0f, 0.0f, 0.0f};
+    math::Vec3f max{0.0f, 0.0f, 0.0f};
+    bool valid = false;
+
+    /**
+     * @brief 扩展包围盒以包含指定点
+     */
+    void Expand(const math::Vec3f& point);
+
+    /**
+     * @brief 扩展包围盒以包含另一个包围盒
+     */
+    void Expand(const StaticBatchBounds& other);
+
+    /**
+     * @brief 获取中心点
+     */
+    math::Vec3f GetCenter() const { return (min + max) * 0.5f; }
+};
+
+/**
+ * @brief 合批输入：一个静态网格实例
+ *
+ * 顶点数据按 StaticBatchOptions::layout 交错排列，
+ * 数据指针仅在 Build() 调用前需要保持有效。
+ */
+struct StaticMeshInstance {
+    const void* vertexData = nullptr;          // 交错顶点数据（模型空间）
+    uint32_t vertexCount = 0;                  // 顶点数量
+    const void* indexData = nullptr;           // 索引数据（为空时按顺序生成）
+    uint32_t indexCount = 0;                   // 索引数量
+    IndexType indexType = IndexType::UInt32;   // 输入索引类型
+    math::Mat4f worldMatrix;                   // 模型到世界空间变换
+    uint32_t materialID = 0;                   // 材质ID，相同材质合并为连续索引区间
+};
+
+/**
+ * @brief 合批选项
+ */
+struct StaticBatchOptions {
+    VertexLayoutDescriptor layout;             // 顶点布局（所有实例必须一致）
+    int32_t positionLocation = 0;              // 位置属性location（Float3/Float4）
+    int32_t normalLocation = -1;               // 法线属性location（Float3，-1表示无）
+    int32_t tangentLocation = -1;              // 切线属性location（Float3/Float4，-1表示无）
+    uint32_t maxChunkVertices = 65535;         // 每个合并块的最大顶点数
+    uint32_t maxChunkIndices = 0;              // 每个合并块的最大索引数（0表示不限制）
+    bool spatialSort = true;                   // 是否按空间位置排序实例以得到紧凑的块包围盒
+};
+
+/**
+ * @brief 合并块内某个材质的索引区间
+ */
+struct StaticBatchRange {
+    uint32_t materialID = 0;                   // 材质ID
+    uint32_t indexStart = 0;                   // 起始索引
+    uint32_t indexCount = 0;                   // 索引数量
+    StaticBatchBounds bounds;                  // 该区间的世界空间包围盒
+};
+
+/**
+ * @brief 合并块
+ *
+ * 每个块对应一对顶点/索引缓冲，块内按材质排列为连续的索引区间，
+ * 块包围盒用于视锥剔除。
+ */
+struct StaticBatchChunk {
+    std::vector<uint8_t> vertexData;           // 世界空间顶点数据
+    std::vector<uint8_t> indexData;            // 块内局部索引数据
+    uint32_t vertexCount = 0;                  // 顶点数量
+    uint32_t indexCount = 0;                   // 索引数量
+    IndexType indexType = IndexType::UInt16;   // 索引类型（顶点数不超过65536时为UInt16）
+    StaticBatchBounds bounds;                  // 块的世界空间包围盒
+    std::vector<StaticBatchRange> ranges;      // 按材质划分的索引区间
+
+    LRVertexBuffer* vertexBuffer = nullptr;    // GPU顶点缓冲（CreateBuffers后有效）
+    LRIndexBuffer* indexBuffer = nullptr;      // GPU索引缓冲（CreateBuffers后有效）
+};
+
+/**
+ * @brief 静态几何合批器
+ *
+ * 在加载期将共享材质的静态物体合并为少量大缓冲：
+ * - 顶点预变换到世界空间（位置、法线、切线）
+ * - 每个块内按材质保留连续的索引区间
+ * - 每个块和区间保留世界空间包围盒用于剔除
+ * - 块大小可配置，在剔除粒度与DrawCall数量之间取舍
+ *
+ * 使用示例：
+ * @code
+ * StaticBatchOptions options;
+ * options.layout = layout;
+ * options.normalLocation = 1;
+ * options.maxChunkVertices = 16384;
+ *
+ * LRStaticBatcher batcher(options);
+ * for (auto& obj : staticObjects) {
+ *     batcher.AddInstance(obj.mesh);
+ * }
+ * batcher.Build();
+ * batcher.CreateBuffers(context);
+ *
+ * for (const auto& chunk : batcher.GetChunks()) {
+ *     if (!frustum.Intersects(chunk.bounds)) continue;
+ *     context->SetVertexBuffer(chunk.vertexBuffer);
+ *     context->SetIndexBuffer(chunk.indexBuffer);
+ *     for (const auto& range : chunk.ranges) {
+ *         BindMaterial(range.materialID);
+ *         context->DrawIndexed(range.indexStart, range.indexCount);
+ *     }
+ * }
+ * @endcode
+ */
+class LR_API LRStaticBatcher {
+public:
+    LR_NONCOPYABLE(LRStaticBatcher);
+
+    explicit LRStaticBatcher(const StaticBatchOptions& options);
+    ~LRStaticBatcher();
+
+    /**
+     * @brief 添加一个静态网格实例
+     * @return 参数有效（含所有索引小于顶点数）返回true
+     */
+    bool AddInstance(const StaticMeshInstance& instance);
+
+    /**
+     * @brief 执行合批，生成世界空间合并块
+     * @return 成功返回true
+     */
+    bool Build();
+
+    /**
+     * @brief 为所有合并块创建GPU缓冲
+     *
+     * 缓冲已创建时直接返回true；释放过CPU数据后无法重建，
+     * 此时若缓冲已被 ReleaseBuffers 释放则返回false。
+     *
+     * @param context 渲染上下文
+     * @param releaseCPUData 创建后是否释放CPU侧数据
+     * @return 成功返回true
+     */
+    bool CreateBuffers(LRRenderContext* context, bool releaseCPUData = true);
+
+    /**
+     * @brief 释放GPU缓冲
+     */
+    void ReleaseBuffers();
+
+    /**
+     * @brief 清空实例和合并结果
+     */
+    void Clear();
+
+    /**
+     * @brief 获取合并块
+     */
+    const std::vector<StaticBatchChunk>& GetChunks() const { return mChunks; }
+
+    /**
+     * @brief 获取所有块的总包围盒
+     */
+    const StaticBatchBounds& GetBounds() const { return mBounds; }
+
+    /**
+     * @brief 获取已添加的实例数量
+     */
+    size_t GetInstanceCount() const { return mInstances.size(); }
+
+    /**
+     * @brief 获取选项
+     */
+    const StaticBatchOptions& GetOptions() const { return mOptions; }
+
+private:
+    struct PendingInstance {
+        StaticMeshInstance source;
+        StaticBatchBounds bounds;              // 世界空间包围盒
+        uint64_t sortKey = 0;                  // 空间排序键
+    };
+
+    const VertexAttribute* findAttribute(int32_t location) const;
+    bool validateLayout() const;
+    StaticBatchBounds computeWorldBounds(const StaticMeshInstance& instance) const;
+    void buildChunk(const std::vector<const PendingInstance*>& group);
+
+private:
+    StaticBatchOptions mOptions;
+    std::vector<PendingInstance> mInstances;
+    std::vector<StaticBatchChunk> mChunks;
+    StaticBatchBounds mBounds;
+};
+
+} // namespace render
+} // namespace lrengine
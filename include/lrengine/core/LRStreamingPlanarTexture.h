@@ -0,0 +1,145 @@
+/**
+ * @file LRStreamingPlanarTexture.h
+ * @brief LREngine 流式视频帧纹理环（避免上传到 GPU 仍在采样的纹理）
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRPlanarTexture.h"
+#include "LRTypes.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRFence;
+
+/**
+ * @brief 流式纹理环描述符
+ */
+struct StreamingPlanarTextureDescriptor {
+    PlanarTextureDescriptor planar;         ///< 环中每个平面纹理的描述
+    uint32_t ringSize = 3;                  ///< 纹理数量（2-8）
+    uint64_t waitTimeoutNs = 100000000;     ///< 等待 GPU 释放纹理的最长时间（纳秒）
+};
+
+/**
+ * @brief 流式平面纹理
+ *
+ * 每帧对同一纹理调用 LRPlanarTexture::UpdateFromImage 时，若 GPU 仍在采样上一帧，
+ * 驱动会隐式同步或复制纹理。本类维护 N 个平面纹理组成的环，每个纹理配一个栅栏：
+ * 上传新帧前，先在命令流中为当前纹理插入栅栏（此前提交的采样命令都在栅栏之前），
+ * 再切换到环中下一个纹理；该纹理的栅栏尚未触发时才在 CPU 上等待，并计入停顿次数。
+ * ringSize 足够大时上传总是落在 GPU 已用完的纹理上。
+ *
+ * 只能在渲染线程使用。
+ *
+ * 使用示例：
+ * @code
+ * StreamingPlanarTextureDescriptor desc;
+ * desc.planar.width = 1280;
+ * desc.planar.height = 720;
+ * desc.planar.format = PlanarFormat::NV12;
+ *
+ * LRStreamingPlanarTexture stream;
+ * stream.Initialize(context, desc);
+ *
+ * // 每帧
+ * stream.UpdateFromImage(frame);
+ * stream.GetCurrent()->BindAll(0);
+ * // ... 绘制 ...
+ * @endcode
+ */
+class LR_API LRStreamingPlanarTexture {
+public:
+    LRStreamingPlanarTexture() = default;
+    ~LRStreamingPlanarTexture();
+
+    LRStreamingPlanarTexture(const LRStreamingPlanarTexture&) = delete;
+    LRStreamingPlanarTexture& operator=(const LRStreamingPlanarTexture&) = delete;
+
+    /**
+     * @brief 创建纹理环
+     * @param context 渲染上下文
+     * @param desc 描述符
+     * @return 成功返回true
+     */
+    bool Initialize(LRRenderContext* context, const StreamingPlanarTextureDescriptor& desc);
+
+    /**
+     * @brief 上传新帧并将其设为当前纹理
+     *
+     * 调用前对当前纹理发出的采样命令视为上一帧的使用，由栅栏保护。
+     *
+     * @param imageData 图像数据（尺寸须与描述符一致）
+     * @param options 更新选项
+     * @return 成功返回true
+     */
+    bool UpdateFromImage(const ImageDataDesc& imageData,
+                         const LRPlanarTexture::UpdateFromImageOptions& options =
+                             LRPlanarTexture::UpdateFromImageOptions());
+
+    /**
+     * @brief 获取当前（最近一次上传的）纹理，尚未上传时返回nullptr
+     */
+    LRPlanarTexture* GetCurrent() const;
+
+    /**
+     * @brief 获取环中纹理数量
+     */
+    uint32_t GetRingSize() const { return static_cast<uint32_t>(mSlots.size()); }
+
+    /**
+     * @brief 获取上传前必须在 CPU 上等待 GPU 的次数（持续增长说明 ringSize 偏小）
+     */
+    uint64_t GetStallCount() const { return mStallCount; }
+
+    /**
+     * @brief 获取已上传的帧数
+     */
+    uint64_t GetFrameCount() const { return mFrameCount; }
+
+    /**
+     * @brief 内存回收：Moderate 释放 GPU 已用完的非当前纹理，Complete 等待 GPU 后释放全部非当前纹理
+     *
+     * Initialize 时已向渲染上下文注册，由 LRRenderContext::TrimMemory 调用；
+     * 释放的纹理在环再次轮到该位置时重建。
+     * @return 释放的平面纹理数量
+     */
+    size_t Trim(MemoryTrimLevel level);
+
+    /**
+     * @brief 释放所有纹理与栅栏
+     */
+    void Release();
+
+private:
+    struct Slot {
+        LRPlanarTexture* texture = nullptr;
+        LRFence* fence = nullptr;
+        bool fencePending = false;          ///< 已插入栅栏且尚未确认完成
+    };
+
+    /**
+     * @brief 确认槽位不再被 GPU 使用（必要时等待）
+     */
+    void waitForSlot(Slot& slot);
+
+    LRRenderContext* mContext = nullptr;
+    PlanarTextureDescriptor mPlanarDesc;    ///< 重建被回收的纹理时使用
+    std::vector<Slot> mSlots;
+    uint32_t mCurrent = 0;
+    bool mHasCurrent = false;
+    uint64_t mWaitTimeoutNs = 0;
+    uint64_t mStallCount = 0;
+    uint64_t mFrameCount = 0;
+    uint32_t mTrimHandlerID = 0;
+};
+
+} // namespace render
+} // namespace lrengine
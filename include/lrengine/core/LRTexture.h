@@ -45,6 +45,26 @@ public:
      */
     void Unbind();
     
+    /**
+     * @brief 发起异步回读（GPU 拷贝到回读缓冲，不阻塞 CPU）
+     *
+     * OpenGL 非DSA路径（GL 4.5 以下）会临时绑定纹理，使上下文的纹理绑定缓存失效；
+     * DSA 路径与 OpenGL ES（通过读帧缓冲）不改变纹理绑定。
+     *
+     * @param mipLevel mipmap 级别（仅支持 2D 纹理；OpenGL ES 仅支持 RGBA8）
+     * @return 回读槽位，失败返回 -1
+     */
+    int32_t BeginAsyncReadback(uint32_t mipLevel = 0);
+    
+    /**
+     * @brief 取回异步回读结果
+     * @param slot BeginAsyncReadback 返回的槽位
+     * @param dst 目标内存（纹理原生格式，行紧密排列），为空时只释放槽位
+     * @param wait 是否等待 GPU 拷贝完成
+     * @return 数据已就绪返回true（槽位随之释放），未就绪返回false
+     */
+    bool ResolveAsyncReadback(int32_t slot, void* dst, bool wait = false);
+    
     /**
      * @brief 获取宽度
      */
@@ -0,0 +1,160 @@
+/**
+ * @file LRTextureArray.h
+ * @brief LREngine 纹理数组分配器（材质纹理合批）
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRTexture;
+
+/**
+ * @brief 纹理数组分配器配置
+ */
+struct TextureArrayAllocatorDescriptor {
+    uint32_t layersPerPage = 64;         ///< 每个数组纹理的层数（GL/GLES 3.0 保证至少 256）
+    uint32_t mipLevels = 1;              ///< Mipmap层数
+    SamplerDescriptor sampler;           ///< 采样器配置（同页所有层共享）
+    const char* debugName = nullptr;
+};
+
+/**
+ * @brief 已分配的数组层
+ */
+struct TextureArrayLayer {
+    LRTexture* texture = nullptr;        ///< 所在数组纹理（由分配器持有）
+    uint32_t layer = 0;                  ///< 层索引，写入逐实例数据供着色器采样
+    uint32_t page = 0;                   ///< 内部页编号
+
+    bool IsValid() const { return texture != nullptr; }
+};
+
+/**
+ * @brief 纹理数组分配器
+ *
+ * 按 (宽, 高, 格式) 将材质纹理装入 Texture2DArray 的各层，每层通过
+ * TextureRegion::arrayLayer 单独上传。同一页内的纹理共享一次绑定，
+ * 仅纹理不同的绘制可合并为一次实例化绘制，层索引作为实例属性传入。
+ *
+ * 使用示例：
+ * @code
+ * LRTextureArrayAllocator allocator;
+ * allocator.Initialize(context, TextureArrayAllocatorDescriptor());
+ *
+ * TextureArrayLayer albedo;
+ * allocator.Allocate(512, 512, PixelFormat::RGBA8, pixels, albedo);
+ * context->SetTexture(albedo.texture, 0);
+ * instanceData[i].layer = static_cast<float>(albedo.layer);
+ * @endcode
+ *
+ * 着色器：
+ * @code
+ * uniform sampler2DArray uAlbedo;
+ * vec4 c = texture(uAlbedo, vec3(uv, vLayer));
+ * @endcode
+ */
+class LR_API LRTextureArrayAllocator {
+public:
+    LRTextureArrayAllocator() = default;
+    ~LRTextureArrayAllocator();
+
+    LRTextureArrayAllocator(const LRTextureArrayAllocator&) = delete;
+    LRTextureArrayAllocator& operator=(const LRTextureArrayAllocator&) = delete;
+
+    /**
+     * @brief 初始化
+     * @param context 渲染上下文
+     * @param desc 配置
+     * @return 成功返回true
+     */
+    bool Initialize(LRRenderContext* context, const TextureArrayAllocatorDescriptor& desc);
+
+    /**
+     * @brief 分配一层并上传图像
+     * @param width 图像宽度
+     * @param height 图像高度
+     * @param format 像素格式
+     * @param data 像素数据（可为nullptr，稍后调用Update上传）
+     * @param out 输出层信息
+     * @return 成功返回true
+     */
+    bool Allocate(uint32_t width, uint32_t height, PixelFormat format, const void* data,
+                  TextureArrayLayer& out);
+
+    /**
+     * @brief 更新已分配层的像素数据
+     * @param layer 已分配的层
+     * @param data 像素数据
+     * @param mipLevel Mipmap层级
+     */
+    void Update(const TextureArrayLayer& layer, const void* data, uint32_t mipLevel = 0);
+
+    /**
+     * @brief 释放一层，层可被后续分配复用
+     *
+     * 未分配、已释放或不属于本分配器的层设置 InvalidArgument 错误并忽略。
+     */
+    void Free(TextureArrayLayer& layer);
+
+    /**
+     * @brief 为所有页生成Mipmap（批量上传完成后调用一次）
+     */
+    void GenerateMipmaps();
+
+    /**
+     * @brief 内存回收：Moderate 及以上级别释放没有已分配层的页
+     *
+     * Initialize 时已向渲染上下文注册，由 LRRenderContext::TrimMemory 调用。
+     * @return 释放的数组纹理数量
+     */
+    size_t Trim(MemoryTrimLevel level);
+
+    /**
+     * @brief 释放所有数组纹理（之后需重新 Initialize）
+     */
+    void Release();
+
+    /**
+     * @brief 获取页（数组纹理）数量
+     */
+    size_t GetPageCount() const;
+
+    /**
+     * @brief 获取已分配层总数
+     */
+    uint32_t GetAllocatedLayerCount() const;
+
+private:
+    struct Page {
+        LRTexture* texture = nullptr;           ///< 为空表示该页已被回收，位置可复用
+        uint32_t width = 0;
+        uint32_t height = 0;
+        PixelFormat format = PixelFormat::RGBA8;
+        uint32_t nextLayer = 0;                 ///< 未使用过的最小层
+        std::vector<uint32_t> freeLayers;       ///< 释放后可复用的层
+        std::vector<uint8_t> allocated;         ///< 各层是否已分配
+        uint32_t allocatedCount = 0;            ///< 已分配层数
+    };
+
+    bool createPage(Page& page, uint32_t width, uint32_t height, PixelFormat format);
+    bool isAllocated(const TextureArrayLayer& layer) const;
+    static bool pageHasSpace(const Page& page, uint32_t layerCount);
+
+    LRRenderContext* mContext = nullptr;
+    TextureArrayAllocatorDescriptor mDesc;
+    std::vector<Page> mPages;
+    uint32_t mTrimHandlerID = 0;
+};
+
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,142 @@
+/**
+ * @file LRTiledImageProcessor.h
+ * @brief LREngine 大图分块 GPU 处理（图像超过最大纹理尺寸时使用）
+ */
+
+#pragma once
+
+#include "LRDefines.h"
+#include "LRTypes.h"
+#include "lrengine/utils/ImageTiling.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+
+// 前向声明
+class LRRenderContext;
+class LRTexture;
+class LRFrameBuffer;
+
+/**
+ * @brief 分块处理配置
+ */
+struct TiledImageDescriptor {
+    uint32_t maxTileSize = 2048;         ///< 带保护带的块边长上限（0 表示使用设备最大纹理尺寸），总会被限制到设备上限
+    uint32_t guardBand = 32;             ///< 每侧保护带宽度（不小于滤镜链的累计采样半径）
+};
+
+/**
+ * @brief 大图分块处理器
+ *
+ * 把大图切成带保护带的重叠块，逐块上传、执行滤镜链并回读，只把
+ * 每块的核心区拼接到输出。所有块尺寸统一，GPU 资源（两组源纹理与
+ * 渲染目标）在块之间轮换复用，峰值内存与图像尺寸无关：当前块渲染时
+ * 上一块的回读仍在进行，CPU 与 GPU 交替工作。
+ *
+ * 图像边缘外的保护带按边缘像素填充，滤镜以 ClampToEdge 采样时，
+ * 只要采样半径不超过 guardBand，结果与整图处理一致。
+ *
+ * 输入与输出均为 RGBA8（OpenGL ES 回读只支持 RGBA8）。需在帧之外调用。
+ *
+ * 使用示例：
+ * @code
+ * LRTiledImageProcessor processor;
+ * TiledImageDescriptor desc;
+ * desc.guardBand = blurRadius;
+ * processor.Initialize(context, desc);
+ *
+ * processor.Process(photo, result, [&](LRTexture* source, LRFrameBuffer* target,
+ *                                      const utils::ImageTileGrid& grid, uint32_t index) {
+ *     context->BeginRenderPass(target);
+ *     context->SetViewport(0, 0, grid.paddedWidth, grid.paddedHeight);
+ *     context->SetPipelineState(blurPipeline);
+ *     context->SetTexture(source, 0);
+ *     context->Draw(0, 3);
+ *     context->EndRenderPass();
+ *     return true;
+ * });
+ * @endcode
+ */
+class LR_API LRTiledImageProcessor {
+public:
+    /**
+     * @brief 逐块滤镜回调
+     *
+     * 从 source 读取带保护带的块，把结果渲染到 target（两者尺寸均为
+     * paddedWidth × paddedHeight）。多遍滤镜可使用调用方自备的中间目标，
+     * 由于块尺寸统一，中间目标可在块之间复用。返回false时中止处理。
+     */
+    using TileFilter = std::function<bool(LRTexture* source, LRFrameBuffer* target,
+                                          const utils::ImageTileGrid& grid, uint32_t index)>;
+
+    LRTiledImageProcessor() = default;
+    ~LRTiledImageProcessor();
+
+    LRTiledImageProcessor(const LRTiledImageProcessor&) = delete;
+    LRTiledImageProcessor& operator=(const LRTiledImageProcessor&) = delete;
+
+    /**
+     * @brief 初始化
+     * @param context 渲染上下文
+     * @param desc 配置
+     * @return 成功返回true
+     */
+    bool Initialize(LRRenderContext* context, const TiledImageDescriptor& desc);
+
+    /**
+     * @brief 分块处理一张图像
+     * @param input 输入图像（RGBA8）
+     * @param output 输出图像（RGBA8，尺寸与输入一致，平面指向可写内存）
+     * @param filter 逐块滤镜
+     * @return 成功返回true
+     */
+    bool Process(const ImageDataDesc& input, const ImageDataDesc& output, const TileFilter& filter);
+
+    /**
+     * @brief 分块处理图像缓冲区（自动加锁/解锁）
+     */
+    bool Process(utils::ImageBuffer* input, utils::ImageBuffer* output, const TileFilter& filter);
+
+    /**
+     * @brief 获取最近一次处理的分块网格
+     */
+    const utils::ImageTileGrid& GetTileGrid() const { return mGrid; }
+
+    /**
+     * @brief 获取实际使用的块边长上限
+     */
+    uint32_t GetMaxTileSize() const { return mMaxTileSize; }
+
+    /**
+     * @brief 释放 GPU 资源
+     */
+    void Release();
+
+private:
+    static constexpr uint32_t kSlotCount = 2;
+
+    bool prepareTargets(uint32_t width, uint32_t height);
+    void releaseTargets();
+    bool resolveTile(uint32_t slot, const ImageDataDesc& output);
+
+    LRRenderContext* mContext = nullptr;
+    TiledImageDescriptor mDesc;
+    uint32_t mMaxTileSize = 0;
+    utils::ImageTileGrid mGrid;
+
+    LRTexture* mSources[kSlotCount] = {};           ///< 上传的带保护带块
+    LRTexture* mTargetTextures[kSlotCount] = {};    ///< 渲染目标颜色附件
+    LRFrameBuffer* mTargets[kSlotCount] = {};
+    int32_t mReadbacks[kSlotCount] = {-1, -1};      ///< 在途回读槽位
+    uint32_t mReadbackTiles[kSlotCount] = {};       ///< 在途回读对应的块索引
+    uint32_t mTargetWidth = 0;
+    uint32_t mTargetHeight = 0;
+    std::vector<uint8_t> mTileData;                 ///< 取块与回读共用
+};
+
+} // namespace render
+} // namespace lrengine
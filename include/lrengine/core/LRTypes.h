@@ -180,8 +180,25 @@ enum class ShaderLanguage : uint8_t {
     HLSL     // DirectX着色器语言
 };
 
+/**
+ * @brief SPIR-V特化常量
+ */
+struct SpecializationConstant {
+    uint32_t id = 0;                           // constant_id
+    uint32_t value = 0;                        // 常量值（float/bool按位存储）
+};
+
 /**
  * @brief 着色器描述符
+ *
+ * language 为 SPIRV 时，source 指向SPIR-V字节码，sourceLength 为字节数。
+ * 后端不支持SPIR-V（GL 4.6 以下、GLES）时改为编译 fallbackSource（GLSL），
+ * 未提供回退源码则创建失败并报告 NotSupported。
+ *
+ * OpenGL 按名称查询 SPIR-V 的 Uniform 依赖模块中的 OpName 调试信息，
+ * 剥离调试信息（如 spirv-opt --strip-debug）后 GetUniformLocation 返回 -1。
+ * 此时应在着色器中用 layout(location = N) 声明显式位置并直接把 N 传给
+ * SetUniform*（仅限非分离程序），或改用 layout(binding = N) 的 Uniform 块。
  */
 struct ShaderDescriptor {
     ShaderStage stage = ShaderStage::Vertex;
@@ -190,6 +207,11 @@ struct ShaderDescriptor {
     size_t sourceLength = 0;                   // 源码长度（0表示以null结尾）
     const char* entryPoint = "main";           // 入口函数名
     const char* debugName = nullptr;           // 调试名称
+    bool separable = false;                    // 编译为独立阶段程序（GL 4.1+/ES 3.1+），
+                                               // 可与任意阶段组合而无需重新链接
+    const SpecializationConstant* specializationConstants = nullptr;  // SPIR-V特化常量
+    uint32_t specializationConstantCount = 0;                         // 特化常量数量
+    const char* fallbackSource = nullptr;      // SPIR-V不可用时使用的GLSL源码
 };
 
 // =============================================================================
@@ -246,7 +268,11 @@ enum class PixelFormat : uint8_t {
     ASTC_8x8,
     // ETC
     ETC2_RGB8,
-    ETC2_RGBA8
+    ETC2_RGBA8,
+    // 16位归一化颜色格式（追加在末尾，不改变已有枚举值）
+    R16,        // P010/P016 亮度平面
+    RG16,       // P010/P016 色度平面
+    RGBA16
 };
 
 /**
@@ -340,7 +366,12 @@ enum class ImageFormat : uint8_t {
     BGRA8,
     RGB8,
     GRAY8,
-    Unknown
+    Unknown,
+    // 以下格式追加在末尾，不改变已有枚举值
+    P010,       // 2平面 4:2:0，16位样本，高 10 位有效
+    P016,       // 2平面 4:2:0，16位样本
+    RGB10A2,    // 打包 32 位：R 0-9, G 10-19, B 20-29, A 30-31
+    RGBA16F     // 半精度浮点 RGBA
 };
 
 /**
@@ -428,6 +459,15 @@ struct DepthStencilAttachmentDescriptor {
     uint8_t clearStencil = 0;
 };
 
+/**
+ * @brief 多视图渲染方式
+ */
+enum class MultiviewMode : uint8_t {
+    None,      // 单视图
+    Native,    // GL_OVR_multiview2：一次绘制广播到所有视图（gl_ViewID_OVR）
+    Layered    // 分层附件 + 实例化：顶点着色器按实例写 gl_Layer（桌面GL回退）
+};
+
 /**
  * @brief 帧缓冲描述符
  */
@@ -435,6 +475,7 @@ struct FrameBufferDescriptor {
     uint32_t width = 0;
     uint32_t height = 0;
     uint32_t samples = 1;
+    uint32_t viewCount = 1;        // 视图数量（>1 时附件须为层数足够的 Texture2DArray 或 TextureCube）
     std::vector<ColorAttachmentDescriptor> colorAttachments;
     DepthStencilAttachmentDescriptor depthStencilAttachment;
     bool hasDepthStencil = true;
@@ -714,6 +755,17 @@ struct RenderContextDescriptor {
     const char* applicationName = "LREngine";
 };
 
+/**
+ * @brief 内存回收级别
+ *
+ * 对应 Android onTrimMemory 与 iOS 内存警告，级别越高释放越彻底。
+ */
+enum class MemoryTrimLevel : uint8_t {
+    Low,        // 内存偏低：释放长时间空闲的缓存对象
+    Moderate,   // 内存紧张/iOS内存警告：释放所有空闲的缓存对象
+    Complete    // 进入后台或即将被回收：释放所有可重建的资源
+};
+
 // =============================================================================
 // 资源句柄
 // =============================================================================
@@ -785,6 +837,9 @@ inline uint32_t GetPixelFormatSize(PixelFormat format) {
         case PixelFormat::RGB32F:       return 12;
         case PixelFormat::RGBA32F:      return 16;
         case PixelFormat::RGB10A2:      return 4;
+        case PixelFormat::R16:          return 2;
+        case PixelFormat::RG16:         return 4;
+        case PixelFormat::RGBA16:       return 8;
         case PixelFormat::Depth16:      return 2;
         case PixelFormat::Depth24:      return 3;
         case PixelFormat::Depth32F:     return 4;
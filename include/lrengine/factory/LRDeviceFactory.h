@@ -45,6 +45,17 @@ public:
      */
     static LRDeviceFactory* GetFactory(Backend backend);
     
+    /**
+     * @brief 注册自定义工厂
+     * 
+     * 注册后GetFactory对该后端返回此工厂（宿主自带的后端实现或测试替身），
+     * 传nullptr恢复内置工厂。工厂由调用方持有，须在创建渲染上下文前注册并保持有效。
+     * LRENGINE_STATIC_BACKEND构建中前端静态绑定到内置后端类型，不支持注册。
+     * 
+     * @return 注册成功返回true
+     */
+    static bool RegisterFactory(Backend backend, LRDeviceFactory* factory);
+    
 protected:
     LRDeviceFactory() = default;
 };
@@ -0,0 +1,271 @@
+/**
+ * @file AssetPackage.h
+ * @brief 内存映射资源包：哈希目录 + 对齐数据块，支持 O(1) 查找与零拷贝访问
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 资源类型
+ */
+enum class AssetType : uint16_t {
+    Raw = 0,              ///< 原始字节
+    Shader,               ///< 着色器源码或 SPIR-V
+    ProgramBinary,        ///< 驱动程序二进制（glGetProgramBinary）
+    Mesh,                 ///< 可直接上传的网格数据
+    CompressedTexture     ///< 压缩纹理（ETC2/ASTC/BC 等）
+};
+
+/**
+ * @brief 数据块压缩方式
+ */
+enum class AssetCompression : uint8_t {
+    None = 0,
+    LZ4 = 1               ///< LZ4 块格式
+};
+
+/**
+ * @brief 资源包文件头（64 字节，小端序）
+ *
+ * 文件布局：
+ * | Header | TOC（bucketCount 个 AssetEntry，开放寻址哈希表） | 名称字符串表 | 对齐数据块... |
+ */
+struct AssetPackageHeader {
+    uint32_t magic = 0;           ///< 'LRPK'
+    uint32_t version = 0;         ///< 格式版本
+    uint32_t entryCount = 0;      ///< 有效条目数量
+    uint32_t bucketCount = 0;     ///< 哈希桶数量（2 的幂）
+    uint64_t tocOffset = 0;       ///< 目录偏移
+    uint64_t stringsOffset = 0;   ///< 名称字符串表偏移
+    uint64_t stringsSize = 0;     ///< 名称字符串表大小
+    uint64_t fileSize = 0;        ///< 文件总大小（用于校验截断）
+    uint8_t reserved[16] = {};
+};
+
+/**
+ * @brief 资源目录条目（64 字节）
+ */
+struct AssetEntry {
+    uint64_t nameHash = 0;        ///< 名称哈希（0 表示空桶）
+    uint64_t offset = 0;          ///< 数据块文件偏移（按 alignment 对齐）
+    uint64_t storedSize = 0;      ///< 文件中存储的字节数
+    uint64_t size = 0;            ///< 解压后的字节数
+    uint32_t nameOffset = 0;      ///< 名称在字符串表中的偏移
+    uint32_t nameLength = 0;      ///< 名称长度
+    AssetType type = AssetType::Raw;
+    AssetCompression compression = AssetCompression::None;
+    uint8_t flags = 0;            ///< 用户标志
+    uint32_t alignment = 0;       ///< 数据块对齐
+    uint32_t params[4] = {};      ///< 类型相关参数（如纹理宽高/格式、程序二进制格式）
+};
+
+static_assert(sizeof(AssetPackageHeader) == 64, "AssetPackageHeader must be 64 bytes");
+static_assert(sizeof(AssetEntry) == 64, "AssetEntry must be 64 bytes");
+
+/**
+ * @brief 资源数据视图（指向映射内存，不拥有数据）
+ */
+struct AssetView {
+    const void* data = nullptr;
+    size_t size = 0;
+};
+
+/**
+ * @brief 资源包读取器
+ *
+ * 通过 mmap 打开单个资源包文件，启动时无需打开大量零散文件：
+ * - 名称查找为一次哈希 + 线性探测，O(1)
+ * - 未压缩数据块直接返回映射内存指针，零拷贝
+ * - LZ4 压缩块按需解压到调用方缓冲区
+ *
+ * 使用示例：
+ * @code
+ * AssetPackage package;
+ * package.Open("assets.lrpk");
+ *
+ * if (const AssetEntry* entry = package.Find("shaders/blit.vert")) {
+ *     AssetView view = package.GetView(entry);   // 未压缩：零拷贝
+ * }
+ * @endcode
+ */
+class LR_API AssetPackage {
+public:
+    static constexpr uint32_t kMagic = 0x4B50524C;   // 'LRPK'
+    static constexpr uint32_t kVersion = 1;
+
+    AssetPackage() = default;
+    ~AssetPackage();
+
+    AssetPackage(const AssetPackage&) = delete;
+    AssetPackage& operator=(const AssetPackage&) = delete;
+
+    /**
+     * @brief 打开资源包
+     * @param path 文件路径
+     * @return 成功返回true
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief 关闭资源包（之前返回的视图全部失效）
+     */
+    void Close();
+
+    /**
+     * @brief 是否已打开
+     */
+    bool IsOpen() const { return mHeader != nullptr; }
+
+    /**
+     * @brief 按名称查找资源
+     * @return 未找到返回nullptr
+     */
+    const AssetEntry* Find(const char* name) const;
+    const AssetEntry* Find(const std::string& name) const { return Find(name.c_str()); }
+
+    /**
+     * @brief 获取条目名称
+     */
+    std::string GetName(const AssetEntry* entry) const;
+
+    /**
+     * @brief 获取存储数据视图
+     *
+     * 未压缩条目即为资源内容本身；压缩条目返回压缩数据。
+     */
+    AssetView GetStoredView(const AssetEntry* entry) const;
+
+    /**
+     * @brief 获取未压缩资源的零拷贝视图
+     * @return 条目被压缩时返回空视图
+     */
+    AssetView GetView(const AssetEntry* entry) const;
+
+    /**
+     * @brief 读取（必要时解压）资源到调用方缓冲区
+     * @param dst 目标缓冲区，至少 entry->size 字节
+     * @param dstSize 目标缓冲区大小
+     * @return 成功返回true
+     */
+    bool Read(const AssetEntry* entry, void* dst, size_t dstSize) const;
+
+    /**
+     * @brief 读取（必要时解压）资源到新分配的数组
+     */
+    bool Read(const AssetEntry* entry, std::vector<uint8_t>& out) const;
+
+    /**
+     * @brief 获取条目数量
+     */
+    uint32_t GetEntryCount() const { return mHeader ? mHeader->entryCount : 0; }
+
+    /**
+     * @brief 遍历所有有效条目
+     */
+    std::vector<const AssetEntry*> GetEntries() const;
+
+    /**
+     * @brief 预读指定条目的数据（提示系统提前缺页）
+     */
+    void Prefetch(const AssetEntry* entry) const;
+
+    /**
+     * @brief 计算名称哈希（FNV-1a 64 位，结果保证非零）
+     */
+    static uint64_t HashName(const char* name, size_t length);
+
+private:
+    bool Validate() const;
+
+    MappedFile mFile;
+    const AssetPackageHeader* mHeader = nullptr;
+    const AssetEntry* mEntries = nullptr;
+    const char* mStrings = nullptr;
+};
+
+/**
+ * @brief 资源包写入器（离线打包工具使用）
+ */
+class LR_API AssetPackageWriter {
+public:
+    /**
+     * @brief 资源添加选项
+     */
+    struct AddOptions {
+        AssetType type = AssetType::Raw;
+        uint32_t alignment = 64;       ///< 数据块对齐（64 或 4096，须为 2 的幂）
+        bool compress = false;         ///< 是否尝试 LZ4 压缩（压缩无收益时保持原样）
+        uint8_t flags = 0;             ///< 用户标志
+        uint32_t params[4] = {};       ///< 类型相关参数
+    };
+
+    /**
+     * @brief 添加资源
+     * @param name 唯一名称
+     * @param data 数据
+     * @param size 数据大小
+     * @param options 添加选项
+     * @return 名称重复或参数无效时返回false
+     */
+    bool AddAsset(const std::string& name, const void* data, size_t size,
+                  const AddOptions& options);
+    bool AddAsset(const std::string& name, const void* data, size_t size) {
+        return AddAsset(name, data, size, AddOptions());
+    }
+
+    /**
+     * @brief 写出资源包文件
+     * @return 成功返回true
+     */
+    bool Write(const std::string& path) const;
+
+    /**
+     * @brief 获取已添加资源数量
+     */
+    size_t GetAssetCount() const { return mAssets.size(); }
+
+    /**
+     * @brief 清空
+     */
+    void Clear() { mAssets.clear(); }
+
+private:
+    struct PendingAsset {
+        std::string name;
+        uint64_t hash = 0;
+        AddOptions options;
+        AssetCompression compression = AssetCompression::None;
+        uint64_t size = 0;
+        std::vector<uint8_t> stored;
+    };
+
+    std::vector<PendingAsset> mAssets;
+};
+
+/**
+ * @brief LZ4 块压缩
+ * @param src 源数据
+ * @param srcSize 源数据大小
+ * @param out 输出（LZ4 块格式，不含帧头）
+ */
+LR_API void LZ4CompressBlock(const void* src, size_t srcSize, std::vector<uint8_t>& out);
+
+/**
+ * @brief LZ4 块解压（带边界检查）
+ * @return 输出恰好填满 dstSize 字节时返回true
+ */
+LR_API bool LZ4DecompressBlock(const void* src, size_t srcSize, void* dst, size_t dstSize);
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,67 @@
+/**
+ * @file ColorLut.h
+ * @brief CPU 3D LUT 调色（四面体插值）
+ *
+ * 表项以 4 × int16（R、G、B、填充）定点存储，R 轴相邻表项连续，单个表项一次 64 位读取；
+ * 每像素只访问四面体的 4 个顶点，创建时预计算的通道值 → 索引/权重表避免逐像素乘除。
+ * 加权求和 x86-64 使用 SSE2，ARM 使用 NEON，其余平台回退到标量实现；行间由 ParallelFor 并行。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 3D 颜色查找表
+ */
+struct ColorLut3D {
+    uint32_t size = 0;              ///< 每轴格点数（17、33 或 65）
+    std::vector<int16_t> table;     ///< size³ 个表项，每项 RGBX，值域 [0, 255 × 64]
+    std::vector<uint32_t> axis;     ///< 预计算的通道值 → 格点偏移与权重（R、G、B 各 256 项）
+};
+
+/**
+ * @brief 由浮点数据创建 3D LUT
+ *
+ * 数据按 .cube 文件顺序排列：R 变化最快，其次 G，最后 B；每格点 3 个 [0, 1] 浮点数（超出部分截断）。
+ *
+ * @param size 每轴格点数（仅支持 17、33、65）
+ * @param rgb size³ × 3 个浮点数
+ * @param out 输出查找表
+ * @return 成功返回true
+ */
+LR_API bool CreateColorLut3D(uint32_t size, const float* rgb, ColorLut3D& out);
+
+/**
+ * @brief 对紧密排列的 RGBA 像素套用 LUT（原地，alpha 保持不变）
+ */
+LR_API void ApplyColorLut3DToRGBA(const ColorLut3D& lut, uint8_t* rgba, uint32_t pixelCount);
+
+/**
+ * @brief 套用 LUT
+ *
+ * 支持 RGBA8、BGRA8、RGB8，源与目标尺寸和格式须相同，可以指向同一内存（原地处理）。
+ *
+ * @param src 源图像
+ * @param dst 目标图像（平面指向可写内存）
+ * @param lut 查找表
+ * @param maxThreads 最多参与的线程数（0 表示全部）
+ * @return 成功返回true
+ */
+LR_API bool ApplyColorLut3D(const ImageDataDesc& src, const ImageDataDesc& dst, const ColorLut3D& lut,
+                            uint32_t maxThreads = 0);
+
+/**
+ * @brief 对图像缓冲区原地套用 LUT（自动加锁/解锁）
+ */
+LR_API bool ApplyColorLut3D(ImageBuffer* image, const ColorLut3D& lut, uint32_t maxThreads = 0);
+
+} // namespace utils
+} // namespace lrengine
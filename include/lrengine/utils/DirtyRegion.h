@@ -0,0 +1,75 @@
+/**
+ * @file DirtyRegion.h
+ * @brief 分块变化检测与脏矩形合并（局部纹理更新）
+ *
+ * 逐块比较两帧 CPU 图像，块内发现第一个差异即跳过剩余行；
+ * x86-64 使用 SSE2，ARM 使用 NEON，其余平台回退到 memcmp。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 脏矩形（亮度像素坐标）
+ */
+struct DirtyRect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+/**
+ * @brief 分块变化图
+ */
+struct DirtyTileMap {
+    uint32_t tileSize = 0;              ///< 块边长（亮度像素）
+    uint32_t columns = 0;               ///< 块列数
+    uint32_t rows = 0;                  ///< 块行数
+    uint32_t dirtyCount = 0;            ///< 变化的块数
+    std::vector<uint8_t> dirty;         ///< 行优先，1 表示变化
+};
+
+/**
+ * @brief 检测两帧之间变化的块
+ *
+ * 两帧的尺寸与格式必须一致，行距可以不同。4:2:0 格式同时比较对应的色度区域。
+ *
+ * @param previous 上一帧
+ * @param current 当前帧
+ * @param tileSize 块边长（亮度像素，4:2:0 格式需为偶数）
+ * @param out 输出变化图
+ * @return 成功返回true
+ */
+LR_API bool DetectDirtyTiles(const ImageDataDesc& previous, const ImageDataDesc& current,
+                             uint32_t tileSize, DirtyTileMap& out);
+
+/**
+ * @brief 将变化的块合并为矩形
+ *
+ * 同一块行内相邻的块合并为横条，上下横条列范围相同时继续纵向合并；
+ * 矩形裁剪到图像边界。
+ *
+ * @param tiles 变化图
+ * @param width 图像宽度
+ * @param height 图像高度
+ * @param out 输出矩形（按左上角行优先排序）
+ */
+LR_API void MergeDirtyTiles(const DirtyTileMap& tiles, uint32_t width, uint32_t height,
+                            std::vector<DirtyRect>& out);
+
+/**
+ * @brief 计算矩形总面积（像素）
+ */
+LR_API uint64_t GetDirtyArea(const std::vector<DirtyRect>& rects);
+
+} // namespace utils
+} // namespace lrengine
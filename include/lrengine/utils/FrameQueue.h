@@ -0,0 +1,153 @@
+/**
+ * @file FrameQueue.h
+ * @brief 采集线程与渲染线程之间的有界帧队列
+ *
+ * 固定容量的环形队列，元素为池化的图像缓冲区及其时间戳，支持多生产者/单消费者
+ * （单生产者是其特例）。队列满时按丢帧策略处理，出队时统计排队延迟。
+ * 与 ImageBufferPool::AcquireWait 配合形成背压：被丢弃或已消费的帧归还到池中，
+ * 生产者在池耗尽时等待归还，而不是继续分配新的缓冲区。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBufferPool.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 队列满时的丢帧策略
+ */
+enum class FrameDropPolicy : uint8_t {
+    DropOldest,     ///< 丢弃最旧的帧，新帧入队（实时预览，延迟最低）
+    DropNewest,     ///< 丢弃新帧，保留已排队的帧
+    Block           ///< 生产者等待队列出现空位（不丢帧，如录制）
+};
+
+/**
+ * @brief 帧队列选项
+ */
+struct FrameQueueOptions {
+    uint32_t capacity = 3;                                  ///< 队列容量（至少为 1）
+    FrameDropPolicy dropPolicy = FrameDropPolicy::DropOldest;
+    uint64_t blockTimeoutMs = 100;                          ///< Block 策略下生产者最长等待时间（0 表示一直等待）
+};
+
+/**
+ * @brief 队列中的帧
+ */
+struct QueuedFrame {
+    ImageBufferPool::ImageBufferPtr buffer;
+    int64_t timestampUs = 0;        ///< 生产者提供的时间戳（如采集 PTS）
+    uint64_t enqueueTimeNs = 0;     ///< 入队时刻（steady_clock）
+    uint64_t sequence = 0;          ///< 入队序号（从 0 递增，含被丢弃的帧）
+};
+
+/**
+ * @brief 帧队列统计
+ */
+struct FrameQueueStats {
+    uint64_t pushedFrames = 0;      ///< 入队请求次数
+    uint64_t poppedFrames = 0;      ///< 出队帧数
+    uint64_t droppedFrames = 0;     ///< 因队列满（或 Block 超时）丢弃的帧数
+    uint64_t lastLatencyUs = 0;     ///< 最近一帧的排队延迟
+    uint64_t maxLatencyUs = 0;      ///< 最大排队延迟
+    double averageLatencyUs = 0.0;  ///< 平均排队延迟
+};
+
+/**
+ * @brief 有界帧队列
+ *
+ * 使用示例：
+ * @code
+ * // 采集线程
+ * auto buffer = pool.AcquireWait(desc, 50);  // 池耗尽时等待渲染线程归还
+ * if (buffer) { FillFrame(buffer); queue.Push(std::move(buffer), ptsUs); }
+ *
+ * // 渲染线程
+ * QueuedFrame frame;
+ * while (queue.Pop(frame, 16)) { Render(frame.buffer); frame.buffer.reset(); }
+ * @endcode
+ */
+class LR_API FrameQueue {
+public:
+    explicit FrameQueue(const FrameQueueOptions& options = FrameQueueOptions());
+    ~FrameQueue();
+
+    FrameQueue(const FrameQueue&) = delete;
+    FrameQueue& operator=(const FrameQueue&) = delete;
+
+    /**
+     * @brief 帧入队
+     *
+     * 队列满时按丢帧策略处理；被丢弃的缓冲区在锁外释放（归还到其来源池）。
+     *
+     * @param buffer 图像缓冲区
+     * @param timestampUs 时间戳
+     * @return 帧已入队返回true；被丢弃（DropNewest、Block 超时）或队列已关闭返回false
+     */
+    bool Push(ImageBufferPool::ImageBufferPtr buffer, int64_t timestampUs);
+
+    /**
+     * @brief 帧出队，队列为空时等待
+     * @param frame 输出帧
+     * @param timeoutMs 最长等待时间（0 表示不等待）
+     * @return 取得帧返回true；超时或队列已关闭且为空返回false
+     */
+    bool Pop(QueuedFrame& frame, uint64_t timeoutMs);
+
+    /**
+     * @brief 非阻塞出队
+     */
+    bool TryPop(QueuedFrame& frame) { return Pop(frame, 0); }
+
+    /**
+     * @brief 关闭队列：唤醒所有等待的线程，之后入队失败，出队取完剩余帧后失败
+     */
+    void Close();
+
+    /**
+     * @brief 丢弃队列中的所有帧（不计入丢帧统计）
+     */
+    void Clear();
+
+    bool IsClosed() const;
+    size_t GetSize() const;
+    uint32_t GetCapacity() const { return static_cast<uint32_t>(mSlots.size()); }
+
+    /**
+     * @brief 获取统计信息
+     */
+    FrameQueueStats GetStats() const;
+
+    /**
+     * @brief 清零统计信息
+     */
+    void ResetStats();
+
+private:
+    void pushLocked(ImageBufferPool::ImageBufferPtr buffer, int64_t timestampUs);
+
+    FrameQueueOptions mOptions;
+    std::vector<QueuedFrame> mSlots;    ///< 环形存储
+    size_t mHead = 0;                   ///< 最旧帧的位置
+    size_t mCount = 0;
+    uint64_t mNextSequence = 0;
+    bool mClosed = false;
+
+    FrameQueueStats mStats;
+    uint64_t mTotalLatencyUs = 0;
+
+    mutable std::mutex mMutex;
+    std::condition_variable mNotEmpty;
+    std::condition_variable mNotFull;
+};
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,186 @@
+/**
+ * @file FrameScheduler.h
+ * @brief 按呈现截止时间调度实时视频处理
+ *
+ * 处理流水线由若干阶段组成，每个阶段有一个或多个质量等级，并声明各等级的 CPU/GPU
+ * 开销估计；估计值随实际测得的 CPU/GPU 耗时持续修正（设备降频时开销上升，调度随之降级）。
+ * 每帧开始前按剩余时间选择各阶段的质量等级：预算不足时先降级、再跳过低优先级的可选阶段，
+ * 连必需阶段都来不及时丢弃该帧，而不是让延迟越积越多。降级立即生效，
+ * 升级则需要连续若干帧留有余量，避免画质来回跳变。
+ *
+ * 时间统一使用调用方提供的微秒时间戳（同一时钟，如 steady_clock 或采集 PTS 所在时钟）。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 处理阶段描述
+ */
+struct FrameStageDesc {
+    std::string name;
+    bool optional = true;           ///< 可选阶段可被整体跳过（等级 0）
+    uint32_t priority = 0;          ///< 优先级，预算不足时先降级低优先级阶段
+    std::vector<float> cpuCostUs;   ///< 各质量等级的初始 CPU 开销估计（微秒，从低到高，决定等级数）
+    std::vector<float> gpuCostUs;   ///< 各质量等级的初始 GPU 开销估计（可为空，缺省为 0）
+};
+
+/**
+ * @brief 调度器选项
+ */
+struct FrameSchedulerOptions {
+    int64_t safetyMarginUs = 2000;      ///< 为提交/合成预留的时间
+    float costSmoothing = 0.2f;         ///< 开销估计的指数平滑系数 (0, 1]
+    float upgradeHeadroom = 0.25f;      ///< 升级后仍须空余的预算比例
+    uint32_t upgradeStableFrames = 30;  ///< 连续多少帧留有余量后升一级
+    bool allowDrop = true;              ///< 必需阶段也来不及时是否丢帧
+};
+
+/**
+ * @brief 单帧调度结果
+ */
+struct FramePlan {
+    uint64_t frameId = 0;
+    bool drop = false;                  ///< 丢弃该帧（不处理、不呈现）
+    bool degraded = false;              ///< 至少一个阶段低于最高等级
+    int64_t deadlineUs = 0;
+    int64_t budgetUs = 0;               ///< 可用时间（已扣除安全余量）
+    float estimatedCostUs = 0.0f;       ///< 按所选等级估计的总开销
+    std::vector<uint32_t> stageLevels;  ///< 各阶段等级：0 表示跳过，1..N 为质量等级（从低到高）
+
+    bool IsStageEnabled(uint32_t stage) const {
+        return !drop && stage < stageLevels.size() && stageLevels[stage] > 0;
+    }
+};
+
+/**
+ * @brief 调度统计
+ */
+struct FrameSchedulerStats {
+    uint64_t plannedFrames = 0;
+    uint64_t droppedFrames = 0;
+    uint64_t degradedFrames = 0;
+    uint64_t completedFrames = 0;
+    uint64_t missedDeadlines = 0;       ///< 完成时已超过截止时间的帧数
+    int64_t lastLatenessUs = 0;         ///< 最近一帧完成时间与截止时间之差（负数表示提前）
+    int64_t maxLatenessUs = 0;
+};
+
+/**
+ * @brief 截止时间感知的帧调度器
+ *
+ * 使用示例：
+ * @code
+ * FrameScheduler scheduler;
+ * uint32_t beauty = scheduler.AddStage({"beauty", true, 1, {3000.0f, 8000.0f}, {1500.0f, 4000.0f}});
+ *
+ * FramePlan plan = scheduler.PlanFrame(NowUs(), frame.timestampUs + kLatencyUs);
+ * if (plan.drop) { return; }
+ * if (plan.IsStageEnabled(beauty)) {
+ *     RunBeauty(plan.stageLevels[beauty]);
+ *     scheduler.ReportCpuTime(beauty, plan.stageLevels[beauty], cpuUs);
+ * }
+ * scheduler.CompleteFrame(plan, NowUs());
+ * @endcode
+ *
+ * 各接口线程安全，GPU 耗时可在查询结果就绪后从其它线程上报。
+ */
+class LR_API FrameScheduler {
+public:
+    explicit FrameScheduler(const FrameSchedulerOptions& options = FrameSchedulerOptions());
+
+    /**
+     * @brief 添加处理阶段（按执行顺序）
+     * @return 阶段索引；描述无效（没有质量等级）返回 UINT32_MAX
+     */
+    uint32_t AddStage(const FrameStageDesc& desc);
+
+    /**
+     * @brief 获取阶段数量
+     */
+    uint32_t GetStageCount() const;
+
+    /**
+     * @brief 为一帧选择处理方案
+     * @param nowUs 当前时间
+     * @param deadlineUs 该帧的呈现截止时间
+     */
+    FramePlan PlanFrame(int64_t nowUs, int64_t deadlineUs);
+
+    /**
+     * @brief 上报阶段实际 CPU 耗时
+     * @param stage 阶段索引
+     * @param level 执行时的质量等级（1..N）
+     * @param us 耗时（微秒）
+     */
+    void ReportCpuTime(uint32_t stage, uint32_t level, float us);
+
+    /**
+     * @brief 上报阶段实际 GPU 耗时（如 GPU 计时查询结果）
+     */
+    void ReportGpuTime(uint32_t stage, uint32_t level, float us);
+
+    /**
+     * @brief 帧处理完成（未丢弃的帧调用）
+     * @param plan PlanFrame 返回的方案
+     * @param finishUs 完成时间（提交呈现的时刻）
+     */
+    void CompleteFrame(const FramePlan& plan, int64_t finishUs);
+
+    /**
+     * @brief 获取阶段某等级当前的开销估计（CPU + GPU，等级 0 为 0）
+     */
+    float GetEstimatedCostUs(uint32_t stage, uint32_t level) const;
+
+    /**
+     * @brief 获取阶段当前的目标等级
+     */
+    uint32_t GetTargetLevel(uint32_t stage) const;
+
+    FrameSchedulerStats GetStats() const;
+    void ResetStats();
+
+private:
+    // 单个处理器（CPU 或 GPU）上的开销估计
+    struct CostModel {
+        std::vector<float> declared;    ///< 声明的初始开销
+        std::vector<float> measured;    ///< 各等级的平滑实测值
+        std::vector<float> sampleScale; ///< 各等级最近一次实测时的 scale
+        std::vector<uint8_t> sampled;   ///< 等级是否已有实测
+        float scale = 1.0f;             ///< 实测/声明 比例，用于推算未执行或久未执行的等级
+
+        float estimate(uint32_t level) const;
+        void update(uint32_t level, float us, float smoothing);
+    };
+
+    struct Stage {
+        FrameStageDesc desc;
+        uint32_t levelCount = 0;
+        uint32_t targetLevel = 0;       ///< 当前目标等级（降级后保持，逐级恢复）
+        CostModel cpu;
+        CostModel gpu;
+    };
+
+    float estimateLocked(uint32_t stage, uint32_t level) const;
+    void upgradeLocked(int64_t budgetUs, float cost);
+
+    FrameSchedulerOptions mOptions;
+    std::vector<Stage> mStages;
+    std::vector<uint32_t> mDegradeOrder;    ///< 降级顺序（低优先级在前）
+    uint32_t mStableFrames = 0;
+    uint64_t mNextFrameId = 0;
+    FrameSchedulerStats mStats;
+    mutable std::mutex mMutex;
+};
+
+} // namespace utils
+} // namespace lrengine
@@ -2,6 +2,7 @@
 
 #include <lrengine/core/LRTypes.h>
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace lrengine {
@@ -72,20 +73,35 @@ protected:
 
 /**
  * @brief CPU 主机内存实现
+ *
+ * 既可以自行分配内存，也可以包装调用方已有的内存（解码器输出、网络缓冲等）而不复制：
+ * 包装时平面指针与行字节数直接取自 imageDesc，缓冲区析构时调用释放回调把内存交还给来源。
  */
 class HostMemoryBuffer : public ImageBuffer {
 public:
+    /**
+     * @brief 外部内存释放回调（缓冲区析构时调用一次）
+     */
+    using ReleaseCallback = std::function<void()>;
+
     /**
      * @brief 构造函数
      * @param imageDesc 图像描述
      * @param allocate 是否立即分配内存
      */
     explicit HostMemoryBuffer(const ImageDataDesc& imageDesc, bool allocate = true);
+
+    /**
+     * @brief 包装外部内存（不复制）
+     * @param imageDesc 图像描述，planes 指向调用方内存（stride 为 0 表示紧密排列）
+     * @param releaseCallback 释放回调（可为空）
+     */
+    HostMemoryBuffer(const ImageDataDesc& imageDesc, ReleaseCallback releaseCallback);
     ~HostMemoryBuffer() override;
 
     // ImageBuffer 接口实现
     const ImageDataDesc& GetImageDesc() const override { return mImageDesc; }
-    void* GetNativeBuffer() const override { return mData.get(); }
+    void* GetNativeBuffer() const override;
     bool Lock(bool readOnly = true) override;
     void Unlock() override;
     bool IsLocked() const override { return mIsLocked; }
@@ -98,6 +114,11 @@ public:
      */
     void* GetPlaneData(int planeIndex) const;
 
+    /**
+     * @brief 是否包装的是外部内存
+     */
+    bool IsExternal() const { return mExternal; }
+
 private:
     void AllocateMemory();
     void FreeMemory();
@@ -105,9 +126,54 @@ private:
     ImageDataDesc mImageDesc;
     std::unique_ptr<uint8_t[]> mData;   ///< 实际内存
     std::vector<size_t> mPlaneOffsets;  ///< 各平面在内存中的偏移量
+    ReleaseCallback mReleaseCallback;   ///< 外部内存的释放回调
+    bool mExternal = false;
     bool mIsLocked = false;
 };
 
+/**
+ * @brief 共享图像视图
+ *
+ * 引用另一个缓冲区的内存（可选裁剪区域），并持有其共享引用：
+ * 多个消费者可以各自持有视图，最后一个引用释放时底层缓冲区（及其释放回调）才会释放。
+ * 平面指针在创建时从底层缓冲区取得，因此底层平面地址须在视图生命周期内保持不变
+ * （HostMemoryBuffer 满足；平台缓冲区需在加锁期间创建并使用视图）。加锁/解锁转发给底层缓冲区。
+ */
+class SharedImageView : public ImageBuffer {
+public:
+    /**
+     * @brief 创建视图
+     * @param source 底层缓冲区
+     * @param x 裁剪区域左上角（4:2:0 格式须为偶数）
+     * @param y
+     * @param width 裁剪宽度（0 表示到右边界）
+     * @param height 裁剪高度（0 表示到下边界）
+     * @return 视图，参数无效时返回nullptr
+     */
+    static std::shared_ptr<SharedImageView> Create(std::shared_ptr<ImageBuffer> source, uint32_t x = 0,
+                                                   uint32_t y = 0, uint32_t width = 0, uint32_t height = 0);
+
+    // ImageBuffer 接口实现
+    const ImageDataDesc& GetImageDesc() const override { return mImageDesc; }
+    void* GetNativeBuffer() const override { return mSource->GetNativeBuffer(); }
+    bool Lock(bool readOnly = true) override { return mSource->Lock(readOnly); }
+    void Unlock() override { mSource->Unlock(); }
+    bool IsLocked() const override { return mSource->IsLocked(); }
+    BufferType GetBufferType() const override { return mSource->GetBufferType(); }
+
+    /**
+     * @brief 获取底层缓冲区
+     */
+    const std::shared_ptr<ImageBuffer>& GetSource() const { return mSource; }
+
+private:
+    SharedImageView(std::shared_ptr<ImageBuffer> source, const ImageDataDesc& desc)
+        : mSource(std::move(source)), mImageDesc(desc) {}
+
+    std::shared_ptr<ImageBuffer> mSource;
+    ImageDataDesc mImageDesc;
+};
+
 #ifdef __APPLE__
 /**
  * @brief iOS/macOS CVPixelBuffer 包装器
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <lrengine/utils/ImageBuffer.h>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -26,6 +27,7 @@ public:
         bool autoGrow = true;                       ///< 是否自动增长
         ImageBuffer::BufferType preferredType =     ///< 优先使用的缓冲区类型
             ImageBuffer::BufferType::HostMemory;
+        uint64_t idleTimeoutMs = 3000;              ///< Low 级回收时的空闲阈值
         
         PoolOptions() = default;
     };
@@ -46,6 +48,31 @@ public:
     using ImageBufferPtr = std::shared_ptr<ImageBuffer>;
     ImageBufferPtr Acquire(const ImageDataDesc& imageDesc);
 
+    /**
+     * @brief 获取缓冲区，池耗尽时等待其他缓冲区归还（生产者背压）
+     *
+     * 池已达到 maxPoolSize 且没有可用的兼容缓冲区时，先淘汰最久未用的不兼容空闲缓冲区
+     * （如分辨率切换后的旧尺寸），否则等待使用中的缓冲区归还，不会超出池容量分配。
+     *
+     * @param imageDesc 图像描述
+     * @param timeoutMs 最长等待时间（毫秒，0 表示不等待）
+     * @return 图像缓冲区智能指针，超时返回nullptr
+     */
+    ImageBufferPtr AcquireWait(const ImageDataDesc& imageDesc, uint64_t timeoutMs);
+
+    /**
+     * @brief 包装外部帧（不复制）
+     *
+     * 解码器、相机等来源的帧直接以其平面指针进入引擎，最后一个引用释放时调用 onReturn
+     * 把帧交还给来源，而不是放回本池。包装的帧计入 GetInUseCount()，
+     * 使池的占用统计覆盖所有在途帧，但不占用池容量。
+     *
+     * @param imageDesc 图像描述，planes 指向外部内存
+     * @param onReturn 归还回调（在无锁状态下调用，可为空）
+     * @return 图像缓冲区智能指针
+     */
+    ImageBufferPtr WrapExternal(const ImageDataDesc& imageDesc, HostMemoryBuffer::ReleaseCallback onReturn);
+
     /**
      * @brief 手动归还缓冲区到池中
      * @param buffer 要归还的缓冲区
@@ -68,6 +95,11 @@ public:
      */
     size_t GetInUseCount() const;
 
+    /**
+     * @brief 获取正在使用的外部帧数量（包含在 GetInUseCount() 中）
+     */
+    size_t GetExternalInUseCount() const;
+
     /**
      * @brief 获取池的总容量
      */
@@ -85,6 +117,14 @@ public:
      */
     void Preallocate(const ImageDataDesc& imageDesc, size_t count);
 
+    /**
+     * @brief 按内存回收级别释放空闲缓冲区
+     * @param level 回收级别（Low 仅释放空闲超过 idleTimeoutMs 的缓冲区）
+     * @return 释放的缓冲区数量
+     * @note 正在使用的缓冲区不受影响
+     */
+    size_t Trim(render::MemoryTrimLevel level);
+
 private:
     // 缓冲区包装结构
     struct BufferEntry {
@@ -98,6 +138,7 @@ private:
     };
 
     // 辅助方法
+    ImageBuffer* AcquireLocked(const ImageDataDesc& desc, bool evictIncompatible);
     bool IsCompatible(const ImageBuffer* buffer, const ImageDataDesc& desc) const;
     ImageBuffer* FindAvailableBuffer(const ImageDataDesc& desc);
     ImageBuffer* CreateNewBuffer(const ImageDataDesc& desc);
@@ -117,10 +158,28 @@ private:
         ImageBufferPool* mPool;
     };
 
+    // 外部帧删除器：更新计数后销毁包装（触发归还回调）
+    class ExternalDeleter {
+    public:
+        explicit ExternalDeleter(ImageBufferPool* pool) : mPool(pool) {}
+        void operator()(ImageBuffer* buffer) const {
+            if (mPool) {
+                mPool->ReleaseExternal();
+            }
+            delete buffer;
+        }
+    private:
+        ImageBufferPool* mPool;
+    };
+
+    void ReleaseExternal();
+
     PoolOptions mOptions;
     std::vector<BufferEntry> mBuffers;
     mutable std::mutex mMutex;
+    std::condition_variable mBufferReleased;    ///< 缓冲区归还通知（AcquireWait 等待）
     size_t mInUseCount = 0;
+    size_t mExternalInUseCount = 0;
 };
 
 /**
@@ -0,0 +1,77 @@
+/**
+ * @file ImageComposite.h
+ * @brief CPU 图像合成（水印、贴纸叠加）与 alpha 预乘
+ *
+ * 叠加图为 RGBA8/BGRA8，可直接合成到 RGBA8/BGRA8 或 NV12/NV21/YUV420P 图像中：
+ * YUV 目标逐像素写 Y 平面，色度按 2×2 块内混合结果的平均值写回（即按子采样的 alpha 合成），
+ * 不需要整帧转换为 RGBA。8 位乘法统一按 x/255 精确舍入；RGBA 路径 x86-64 使用 SSE2，
+ * ARM 使用 NEON，其余平台回退到标量实现；行间由 ParallelFor 并行。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstdint>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 混合模式（预乘 alpha 下的可分离混合）
+ */
+enum class CompositeBlendMode : uint8_t {
+    SourceOver,     ///< 源覆盖目标
+    Add,            ///< 相加（饱和）
+    Multiply,       ///< 正片叠底
+    Screen          ///< 滤色
+};
+
+/**
+ * @brief 合成选项
+ */
+struct CompositeOptions {
+    int32_t x = 0;                                          ///< 叠加图左上角在目标中的位置（可为负，超出部分裁掉）
+    int32_t y = 0;
+    CompositeBlendMode mode = CompositeBlendMode::SourceOver;
+    float opacity = 1.0f;                                   ///< 全局不透明度 [0, 1]
+    bool premultiplied = false;                             ///< 叠加图已预乘 alpha
+    uint32_t maxThreads = 0;                                ///< 最多参与的线程数（0 表示全部）
+};
+
+/**
+ * @brief 原地预乘 alpha（RGBA8/BGRA8）
+ * @param image 图像（平面指向可写内存）
+ * @return 成功返回true
+ */
+LR_API bool PremultiplyAlpha(const ImageDataDesc& image);
+
+/**
+ * @brief 原地反预乘 alpha（RGBA8/BGRA8，alpha 为 0 的像素置为全 0）
+ */
+LR_API bool UnpremultiplyAlpha(const ImageDataDesc& image);
+
+/**
+ * @brief 将叠加图合成到目标图像
+ *
+ * RGBA8/BGRA8 目标按预乘 alpha 处理（不透明图像两者相同）；YUV 目标视为不透明，
+ * 按目标的 colorSpace/range 换算。叠加图中 alpha 为 0 的色度块保持原值不变。
+ * 奇数宽/高的 YUV 目标中，边缘的一列/行亮度归入最后一个色度块；没有色度样本的目标（宽或高为 1）不做修改。
+ *
+ * @param overlay 叠加图（RGBA8/BGRA8）
+ * @param target 目标图像（平面指向可写内存）
+ * @param options 合成选项
+ * @return 成功返回true（叠加区域完全在目标外也返回true）
+ */
+LR_API bool CompositeImage(const ImageDataDesc& overlay, const ImageDataDesc& target,
+                           const CompositeOptions& options = CompositeOptions());
+
+/**
+ * @brief 将叠加图合成到图像缓冲区（自动加锁/解锁）
+ */
+LR_API bool CompositeImage(const ImageDataDesc& overlay, ImageBuffer* target,
+                           const CompositeOptions& options = CompositeOptions());
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,110 @@
+/**
+ * @file ImageConvert.h
+ * @brief 10 位 / 半精度图像格式转换
+ *
+ * 提供 P010/P016、RGB10A2 与 8 位格式及半精度浮点之间的转换内核。
+ * x86-64 使用 SSE2，ARM 使用 NEON，其余平台回退到标量实现。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lrengine {
+namespace utils {
+
+// =============================================================================
+// 标量辅助
+// =============================================================================
+
+/**
+ * @brief 单精度转半精度（就近舍入，溢出为无穷）
+ */
+LR_API uint16_t FloatToHalf(float value);
+
+/**
+ * @brief 半精度转单精度
+ */
+LR_API float HalfToFloat(uint16_t value);
+
+// =============================================================================
+// 行转换内核（count 为样本数或像素数，源与目标不得重叠）
+// =============================================================================
+
+/**
+ * @brief 16 位样本转 8 位（v / 257 四舍五入，适用于 P010/P016 → NV12）
+ */
+LR_API void ConvertU16ToU8(const uint16_t* src, uint8_t* dst, size_t count);
+
+/**
+ * @brief 8 位样本转 16 位（高位对齐）
+ * @param bitDepth 有效位数：10 对应 P010（低 6 位为 0），16 对应 P016
+ */
+LR_API void ConvertU8ToU16(const uint8_t* src, uint16_t* dst, size_t count, uint32_t bitDepth);
+
+/**
+ * @brief 16 位归一化样本转半精度（[0, 65535] → [0, 1]）
+ *
+ * 设备不支持 R16/RG16 纹理时，P010/P016 平面以 R16F/RG16F 上传。
+ */
+LR_API void ConvertU16ToHalf(const uint16_t* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief 半精度转 16 位归一化样本（钳制到 [0, 1]）
+ */
+LR_API void ConvertHalfToU16(const uint16_t* src, uint16_t* dst, size_t count);
+
+/**
+ * @brief RGB10A2 转 RGBA8
+ */
+LR_API void ConvertRGB10A2ToRGBA8(const uint32_t* src, uint8_t* dst, size_t pixelCount);
+
+/**
+ * @brief RGBA8 转 RGB10A2（位复制扩展，255 → 1023）
+ */
+LR_API void ConvertRGBA8ToRGB10A2(const uint8_t* src, uint32_t* dst, size_t pixelCount);
+
+/**
+ * @brief RGB10A2 转 RGBA16F
+ */
+LR_API void ConvertRGB10A2ToRGBA16F(const uint32_t* src, uint16_t* dst, size_t pixelCount);
+
+/**
+ * @brief RGBA16F 转 RGB10A2（钳制到 [0, 1]，不做色调映射）
+ */
+LR_API void ConvertRGBA16FToRGB10A2(const uint16_t* src, uint32_t* dst, size_t pixelCount);
+
+// =============================================================================
+// 整图转换
+// =============================================================================
+
+/**
+ * @brief 检查是否支持指定格式转换
+ *
+ * 支持：P010/P016 ↔ NV12、RGB10A2 ↔ RGBA8、RGB10A2 ↔ RGBA16F，
+ * 以及相同格式间的拷贝。
+ */
+LR_API bool IsConversionSupported(ImageFormat srcFormat, ImageFormat dstFormat);
+
+/**
+ * @brief 整图格式转换
+ * @param src 源图像
+ * @param dst 目标图像（宽高与源一致，平面指向可写内存，stride 为 0 表示紧密排列）
+ * @return 成功返回true
+ */
+LR_API bool ConvertImage(const ImageDataDesc& src, const ImageDataDesc& dst);
+
+/**
+ * @brief 整图格式转换到图像缓冲区（自动加锁/解锁）
+ * @param src 源图像
+ * @param dst 目标缓冲区
+ * @return 成功返回true
+ */
+LR_API bool ConvertImage(const ImageDataDesc& src, ImageBuffer* dst);
+
+} // namespace utils
+} // namespace lrengine
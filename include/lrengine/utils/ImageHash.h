@@ -0,0 +1,156 @@
+/**
+ * @file ImageHash.h
+ * @brief 图像内容哈希与分块差异检测（重复帧跳过）
+ *
+ * 哈希为 XXH3 风格的 64 位非加密哈希：64 字节条带 8 路并行累加，
+ * x86-64 使用 SSE2，ARM 使用 NEON，其余平台回退到标量实现。
+ * 结果与 XXH3 不兼容，只用于同一进程内的比较，不应持久化。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 整图哈希选项
+ */
+struct ImageHashOptions {
+    uint32_t rowStep = 1;               ///< 行步长，大于 1 时只哈希部分行（更快，但可能漏检细小变化）
+    uint64_t seed = 0;                  ///< 哈希种子
+};
+
+/**
+ * @brief 分块哈希网格
+ */
+struct BlockHashGrid {
+    uint32_t width = 0;                 ///< 图像宽度
+    uint32_t height = 0;                ///< 图像高度
+    ImageFormat format = ImageFormat::Unknown;
+    uint32_t blockSize = 0;             ///< 块边长（亮度像素）
+    uint32_t columns = 0;               ///< 块列数
+    uint32_t rows = 0;                  ///< 块行数
+    std::vector<uint64_t> hashes;       ///< 行优先的块哈希（包含对应色度区域）
+
+    /**
+     * @brief 清空网格
+     */
+    void Clear();
+};
+
+/**
+ * @brief 哈希连续内存
+ * @param data 数据
+ * @param size 字节数
+ * @param seed 哈希种子
+ * @return 64 位哈希
+ */
+LR_API uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+/**
+ * @brief 哈希图像所有平面（只包含有效像素，忽略行尾填充），尺寸与格式也参与哈希
+ * @param image 图像数据
+ * @param out 输出哈希
+ * @param options 哈希选项
+ * @return 格式受支持且数据有效返回true
+ */
+LR_API bool HashImage(const ImageDataDesc& image, uint64_t& out,
+                      const ImageHashOptions& options = ImageHashOptions());
+
+/**
+ * @brief 哈希图像缓冲区（自动加锁/解锁）
+ */
+LR_API bool HashImage(ImageBuffer* buffer, uint64_t& out,
+                      const ImageHashOptions& options = ImageHashOptions());
+
+/**
+ * @brief 计算分块哈希网格
+ * @param image 图像数据
+ * @param blockSize 块边长（亮度像素，4:2:0 格式需为偶数）
+ * @param out 输出网格
+ * @return 成功返回true
+ */
+LR_API bool ComputeBlockHashes(const ImageDataDesc& image, uint32_t blockSize, BlockHashGrid& out);
+
+/**
+ * @brief 比较两个分块哈希网格
+ * @param previous 上一帧网格
+ * @param current 当前帧网格
+ * @param changedMask 可选，输出每块是否变化（1 为变化），大小与 current.hashes 相同
+ * @return 变化的块数；尺寸、格式或块大小不一致时视为全部变化
+ */
+LR_API uint32_t DiffBlockHashes(const BlockHashGrid& previous, const BlockHashGrid& current,
+                                std::vector<uint8_t>* changedMask = nullptr);
+
+/**
+ * @brief 重复帧检测器
+ *
+ * 每帧只遍历一次像素：计算分块哈希，与上一帧逐块比较，整帧哈希由块哈希合成。
+ * 流水线可据此跳过未变化帧的上传与特效处理，或只处理变化的块。
+ *
+ * 使用示例：
+ * @code
+ * FrameDeduplicator dedup;
+ * if (!dedup.Update(frame)) {
+ *     return;  // 与上一帧相同，复用上次结果
+ * }
+ * for (size_t i = 0; i < dedup.GetChangedMask().size(); ++i) { ... }
+ * @endcode
+ */
+class LR_API FrameDeduplicator {
+public:
+    /**
+     * @param blockSize 块边长（亮度像素）
+     */
+    explicit FrameDeduplicator(uint32_t blockSize = 64);
+
+    /**
+     * @brief 输入新帧
+     * @param image 图像数据
+     * @return 与上一帧不同（或首帧、检测失败）返回true
+     */
+    bool Update(const ImageDataDesc& image);
+
+    /**
+     * @brief 清除历史，下一帧视为变化
+     */
+    void Reset();
+
+    /**
+     * @brief 获取最近一帧的整帧哈希
+     */
+    uint64_t GetFrameHash() const { return mFrameHash; }
+
+    /**
+     * @brief 获取最近一帧变化的块数
+     */
+    uint32_t GetChangedBlockCount() const { return mChangedBlocks; }
+
+    /**
+     * @brief 获取最近一帧的逐块变化标记
+     */
+    const std::vector<uint8_t>& GetChangedMask() const { return mChangedMask; }
+
+    /**
+     * @brief 获取最近一帧的分块哈希网格
+     */
+    const BlockHashGrid& GetBlockHashes() const { return mCurrent; }
+
+private:
+    uint32_t mBlockSize;
+    BlockHashGrid mPrevious;
+    BlockHashGrid mCurrent;
+    std::vector<uint8_t> mChangedMask;
+    uint64_t mFrameHash = 0;
+    uint32_t mChangedBlocks = 0;
+};
+
+} // namespace utils
+} // namespace lrengine
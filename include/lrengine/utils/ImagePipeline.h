@@ -0,0 +1,80 @@
+/**
+ * @file ImagePipeline.h
+ * @brief 融合的 CPU 图像处理流水线（格式转换 + 裁剪 + 旋转 + 缩放 + 曲线 + 3D LUT）
+ *
+ * 以输出块为单位执行：每块只把覆盖它的源区域转换为 RGBA 暂存（留在 L1/L2 缓存中），
+ * 随后直接重采样、套用曲线并写入输出，不产生整帧中间图像。各块由 ParallelFor 并行处理。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+#include "lrengine/utils/ColorLut.h"
+
+#include <cstdint>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 旋转角度（顺时针）
+ */
+enum class ImageRotation : uint8_t {
+    None,
+    Rotate90,
+    Rotate180,
+    Rotate270
+};
+
+/**
+ * @brief 重采样滤波
+ */
+enum class ResampleFilter : uint8_t {
+    Nearest,
+    Bilinear
+};
+
+/**
+ * @brief 流水线选项
+ *
+ * 处理顺序：裁剪源图 → 顺时针旋转 → 缩放到输出尺寸 → 曲线 → 3D LUT。
+ */
+struct ImagePipelineOptions {
+    uint32_t cropX = 0;                             ///< 裁剪区域（源图像素坐标）
+    uint32_t cropY = 0;
+    uint32_t cropWidth = 0;                         ///< 0 表示到源图右边界
+    uint32_t cropHeight = 0;                        ///< 0 表示到源图下边界
+    ImageRotation rotation = ImageRotation::None;   ///< 裁剪后的旋转
+    ResampleFilter filter = ResampleFilter::Bilinear;
+    const uint8_t* curves = nullptr;                ///< 可选逐通道曲线，768 字节（R、G、B 各 256 项）
+    const ColorLut3D* lut = nullptr;                ///< 可选 3D LUT
+    uint32_t tileSize = 64;                         ///< 输出块边长（像素）
+    uint32_t maxThreads = 0;                        ///< 最多参与的线程数（0 表示全部）
+};
+
+/**
+ * @brief 检查流水线是否支持指定的输入/输出格式
+ *
+ * 输入：YUV420P、NV12、NV21、RGBA8、BGRA8、RGB8、GRAY8；
+ * 输出：RGBA8、BGRA8、RGB8。YUV 按图像的 colorSpace/range 转换。
+ */
+LR_API bool IsImagePipelineSupported(ImageFormat srcFormat, ImageFormat dstFormat);
+
+/**
+ * @brief 执行融合流水线
+ * @param src 源图像（4:2:0 格式的色度平面按向下取整的尺寸读取，宽高至少为 2）
+ * @param dst 目标图像（尺寸即缩放目标，平面指向可写内存）
+ * @param options 选项
+ * @return 成功返回true
+ */
+LR_API bool RunImagePipeline(const ImageDataDesc& src, const ImageDataDesc& dst,
+                             const ImagePipelineOptions& options);
+
+/**
+ * @brief 执行融合流水线到图像缓冲区（自动加锁/解锁）
+ */
+LR_API bool RunImagePipeline(const ImageDataDesc& src, ImageBuffer* dst, const ImagePipelineOptions& options);
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,67 @@
+/**
+ * @file ImageStatistics.h
+ * @brief 图像统计（自动曝光 / 自动白平衡）
+ *
+ * 在子采样网格上统计亮度直方图、各通道最小/最大/平均值和灰度世界平均色。
+ * x86-64 使用 SSE2，ARM 使用 NEON，其余平台回退到标量实现。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstdint>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 统计选项
+ */
+struct ImageStatisticsOptions {
+    uint32_t gridStep = 4;              ///< 采样网格步长（行列相同，像素），1 表示全图
+    bool computeHistogram = true;       ///< 是否统计亮度直方图
+};
+
+/**
+ * @brief 统计结果（数值归一化到 [0, 1]）
+ *
+ * RGB 类格式的通道顺序为 RGBA（BGRA8 已重排），YUV 类格式为 Y/U/V，
+ * GRAY8 只有通道 0。16 位格式按高 8 位统计。
+ */
+struct ImageStatistics {
+    uint32_t lumaHistogram[256] = {};   ///< 亮度直方图
+    uint32_t sampleCount = 0;           ///< 参与统计的亮度样本数
+    float channelMin[4] = {};           ///< 各通道最小值
+    float channelMax[4] = {};           ///< 各通道最大值
+    float channelMean[4] = {};          ///< 各通道平均值
+    float meanLuma = 0.0f;              ///< 平均亮度（RGB 按 BT.709 权重，YUV 取 Y 平面）
+    float meanRGB[3] = {};              ///< 平均 RGB（灰度世界估计，YUV 按颜色空间换算）
+    float whiteBalanceGains[3] = {1.0f, 1.0f, 1.0f};  ///< 使平均色变为中性灰的增益（G 为 1）
+};
+
+/**
+ * @brief 统计图像
+ *
+ * 支持 GRAY8、NV12/NV21、YUV420P、P010/P016、RGBA8/BGRA8/RGB8 和 RGB10A2。
+ * 色度平面在自身分辨率上使用相同的网格步长。
+ *
+ * @param image 图像数据
+ * @param out 输出统计结果
+ * @param options 统计选项
+ * @return 格式受支持且数据有效返回true
+ */
+LR_API bool ComputeImageStatistics(const ImageDataDesc& image, ImageStatistics& out,
+                                   const ImageStatisticsOptions& options = ImageStatisticsOptions());
+
+/**
+ * @brief 由直方图计算亮度百分位
+ * @param stats 统计结果
+ * @param percentile 百分位 [0, 1]（0.5 为中位数）
+ * @return 归一化亮度
+ */
+LR_API float GetLumaPercentile(const ImageStatistics& stats, float percentile);
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,93 @@
+/**
+ * @file ImageTiling.h
+ * @brief 大图分块（带保护带的重叠块切分与拼接）
+ *
+ * 用于处理超过设备最大纹理尺寸的图像：把图像切成尺寸统一的块，
+ * 每块四周附带保护带供滤镜核采样，处理后只把核心区写回输出。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 单个块的核心区（图像像素坐标，块之间不重叠）
+ */
+struct ImageTile {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+/**
+ * @brief 分块网格
+ *
+ * 所有块的带保护带尺寸统一为 paddedWidth × paddedHeight，
+ * 因此 GPU 资源可在块之间复用；右/下边缘块的核心区可能更小，
+ * 超出图像的部分按边缘像素复制填充（与 ClampToEdge 采样一致）。
+ */
+struct ImageTileGrid {
+    uint32_t imageWidth = 0;            ///< 图像宽度
+    uint32_t imageHeight = 0;           ///< 图像高度
+    uint32_t tileWidth = 0;             ///< 核心区宽度（不含保护带）
+    uint32_t tileHeight = 0;            ///< 核心区高度（不含保护带）
+    uint32_t guardBand = 0;             ///< 每侧保护带宽度
+    uint32_t paddedWidth = 0;           ///< 带保护带的块宽度
+    uint32_t paddedHeight = 0;          ///< 带保护带的块高度
+    uint32_t columns = 0;               ///< 块列数
+    uint32_t rows = 0;                  ///< 块行数
+    std::vector<ImageTile> tiles;       ///< 行优先
+};
+
+/**
+ * @brief 计算分块网格
+ *
+ * 块数取满足尺寸上限的最小值，并在行/列内均分，避免出现很窄的边缘块。
+ *
+ * @param width 图像宽度
+ * @param height 图像高度
+ * @param maxTileSize 带保护带的块边长上限（通常为设备最大纹理尺寸），需大于 2 × guardBand
+ * @param guardBand 每侧保护带宽度（不小于滤镜链的累计采样半径）
+ * @param out 输出网格
+ * @return 成功返回true
+ */
+LR_API bool ComputeImageTiles(uint32_t width, uint32_t height, uint32_t maxTileSize, uint32_t guardBand,
+                              ImageTileGrid& out);
+
+/**
+ * @brief 取出带保护带的块
+ *
+ * 只支持单平面格式（RGBA8、BGRA8、RGB8、GRAY8、RGB10A2、RGBA16F）。
+ *
+ * @param image 源图像（尺寸需与网格一致）
+ * @param grid 分块网格
+ * @param index 块索引
+ * @param dst 输出，paddedWidth × paddedHeight 像素
+ * @param dstStride 输出行距（0 表示紧密排列）
+ * @return 成功返回true
+ */
+LR_API bool ExtractImageTile(const ImageDataDesc& image, const ImageTileGrid& grid, uint32_t index, void* dst,
+                             uint32_t dstStride = 0);
+
+/**
+ * @brief 把处理后块的核心区写回输出图像
+ * @param src 带保护带的块数据，paddedWidth × paddedHeight 像素
+ * @param srcStride 块数据行距（0 表示紧密排列）
+ * @param grid 分块网格
+ * @param index 块索引
+ * @param dst 输出图像（尺寸需与网格一致，平面指向可写内存）
+ * @return 成功返回true
+ */
+LR_API bool StoreImageTile(const void* src, uint32_t srcStride, const ImageTileGrid& grid, uint32_t index,
+                           const ImageDataDesc& dst);
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,80 @@
+/**
+ * @file MappedFile.h
+ * @brief 只读内存映射文件
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 只读内存映射文件
+ *
+ * POSIX 平台使用 mmap，Windows 使用 CreateFileMapping。
+ * 映射基址按页对齐，文件内按 64/4096 字节对齐的数据块在内存中同样对齐，
+ * 可以直接作为 BufferDescriptor::data 等上传源，无需拷贝。
+ */
+class LR_API MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief 映射文件
+     * @param path 文件路径
+     * @return 成功返回true
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief 解除映射并关闭文件
+     */
+    void Close();
+
+    /**
+     * @brief 是否已映射
+     */
+    bool IsOpen() const { return mData != nullptr; }
+
+    /**
+     * @brief 获取映射数据
+     */
+    const uint8_t* GetData() const { return mData; }
+
+    /**
+     * @brief 获取文件大小（字节）
+     */
+    size_t GetSize() const { return mSize; }
+
+    /**
+     * @brief 提示系统即将顺序访问指定区间（预读）
+     */
+    void Prefetch(size_t offset, size_t size) const;
+
+private:
+    void Reset();
+
+    const uint8_t* mData = nullptr;
+    size_t mSize = 0;
+#ifdef _WIN32
+    void* mFileHandle = nullptr;
+    void* mMappingHandle = nullptr;
+#else
+    int mFileDescriptor = -1;
+#endif
+};
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,37 @@
+/**
+ * @file ParallelFor.h
+ * @brief 轻量并行循环（CPU 图像处理的行/块并行）
+ *
+ * 全局工作线程池在首次使用时创建（硬件线程数 - 1 个），调用线程同样参与计算。
+ * 同一时刻只执行一个并行循环：池忙或在工作线程内嵌套调用时退化为串行执行，
+ * 因此不会死锁。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRDefines.h"
+
+#include <cstdint>
+#include <functional>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 并行执行 body(0) … body(count - 1)
+ *
+ * 索引按原子计数器动态分配，各索引的工作量可以不均匀。返回时所有索引均已执行完毕。
+ *
+ * @param count 索引数量
+ * @param body 循环体（需线程安全）
+ * @param maxThreads 最多参与的线程数（含调用线程，0 表示全部）
+ */
+LR_API void ParallelFor(uint32_t count, const std::function<void(uint32_t index)>& body, uint32_t maxThreads = 0);
+
+/**
+ * @brief 获取可参与并行循环的线程数（含调用线程）
+ */
+LR_API uint32_t GetParallelThreadCount();
+
+} // namespace utils
+} // namespace lrengine
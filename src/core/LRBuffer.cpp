@@ -6,10 +6,19 @@
 #include "lrengine/core/LRBuffer.h"
 #include "lrengine/core/LRError.h"
 #include "platform/interface/IBufferImpl.h"
+#include "platform/StaticBackend.h"
 
 namespace lrengine {
 namespace render {
 
+namespace {
+// 直接Bind缓冲区时影响的绑定缓存范围
+BindingScope GetBindingScope(BufferType type) {
+    return type == BufferType::Uniform || type == BufferType::Storage ? BindingScope::UniformBuffer
+                                                                       : BindingScope::VertexInput;
+}
+} // namespace
+
 // =============================================================================
 // LRBuffer
 // =============================================================================
@@ -18,7 +27,7 @@ LRBuffer::LRBuffer() : LRResource(ResourceType::Buffer) {}
 
 LRBuffer::~LRBuffer() {
     if (mImpl) {
-        mImpl->Destroy();
+        BackendCast(mImpl)->Destroy();
         delete mImpl;
         mImpl = nullptr;
     }
@@ -32,7 +41,7 @@ bool LRBuffer::Initialize(IBufferImpl* impl, const BufferDescriptor& desc) {
 
     mImpl = impl;
 
-    if (!mImpl->Create(desc)) {
+    if (!BackendCast(mImpl)->Create(desc)) {
         LR_SET_ERROR(ErrorCode::ResourceCreationFailed, "Failed to create buffer");
         delete mImpl;
         mImpl = nullptr;
@@ -62,7 +71,7 @@ void LRBuffer::UpdateData(const void* data, size_t size, size_t offset) {
         return;
     }
 
-    mImpl->UpdateData(data, size, offset);
+    BackendCast(mImpl)->UpdateData(data, size, offset);
 }
 
 void* LRBuffer::Map(MemoryAccess access) {
@@ -71,30 +80,32 @@ void* LRBuffer::Map(MemoryAccess access) {
         return nullptr;
     }
 
-    return mImpl->Map(access);
+    return BackendCast(mImpl)->Map(access);
 }
 
 void LRBuffer::Unmap() {
     if (mImpl && mIsValid) {
-        mImpl->Unmap();
+        BackendCast(mImpl)->Unmap();
     }
 }
 
 void LRBuffer::Bind() {
     if (mImpl && mIsValid) {
-        mImpl->Bind();
+        InvalidateBindings(GetBindingScope(mBufferType));
+        BackendCast(mImpl)->Bind();
     }
 }
 
 void LRBuffer::Unbind() {
     if (mImpl && mIsValid) {
-        mImpl->Unbind();
+        InvalidateBindings(GetBindingScope(mBufferType));
+        BackendCast(mImpl)->Unbind();
     }
 }
 
 ResourceHandle LRBuffer::GetNativeHandle() const {
     if (mImpl) {
-        return mImpl->GetNativeHandle();
+        return BackendCast(mImpl)->GetNativeHandle();
     }
     return ResourceHandle();
 }
@@ -119,7 +130,7 @@ void LRVertexBuffer::SetVertexLayout(const VertexLayoutDescriptor& layout) {
 
     // 将布局传递给平台实现
     if (mImpl) {
-        mImpl->SetVertexLayout(layout);
+        BackendCast(mImpl)->SetVertexLayout(layout);
     }
 }
 
@@ -37,9 +37,19 @@ bool LRFrameBuffer::Initialize(IFrameBufferImpl* impl, const FrameBufferDescript
         return false;
     }
 
-    mWidth   = desc.width;
-    mHeight  = desc.height;
-    mIsValid = true;
+    // 不支持多视图的后端（如Metal）按单视图创建，不能当作多视图帧缓冲使用
+    if (desc.viewCount > 1 && mImpl->GetViewCount() < desc.viewCount) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "Multiview framebuffers are not supported by this backend");
+        mImpl->Destroy();
+        delete mImpl;
+        mImpl = nullptr;
+        return false;
+    }
+
+    mWidth     = desc.width;
+    mHeight    = desc.height;
+    mViewCount = desc.viewCount > 1 ? desc.viewCount : 1;
+    mIsValid   = true;
 
     if (desc.debugName) {
         SetDebugName(desc.debugName);
@@ -116,6 +126,33 @@ void LRFrameBuffer::Clear(uint8_t flags, const float* color, float depth, uint8_
     }
 }
 
+MultiviewMode LRFrameBuffer::GetMultiviewMode() const {
+    return mImpl ? mImpl->GetMultiviewMode() : MultiviewMode::None;
+}
+
+std::string LRFrameBuffer::GetMultiviewShaderHeader() const {
+    const std::string views = std::to_string(mViewCount);
+
+    switch (GetMultiviewMode()) {
+        case MultiviewMode::Native:
+            return "#extension GL_OVR_multiview2 : require\n"
+                   "layout(num_views = " + views + ") in;\n"
+                   "#define LR_VIEW_ID int(gl_ViewID_OVR)\n"
+                   "#define LR_INSTANCE_ID gl_InstanceID\n"
+                   "#define LR_SET_LAYER()\n";
+        case MultiviewMode::Layered:
+            // 实例数已由上下文乘以视图数，实例号低位即视图索引
+            return "#extension GL_ARB_shader_viewport_layer_array : require\n"
+                   "#define LR_VIEW_ID (gl_InstanceID % " + views + ")\n"
+                   "#define LR_INSTANCE_ID (gl_InstanceID / " + views + ")\n"
+                   "#define LR_SET_LAYER() gl_Layer = LR_VIEW_ID\n";
+        default:
+            return "#define LR_VIEW_ID 0\n"
+                   "#define LR_INSTANCE_ID gl_InstanceID\n"
+                   "#define LR_SET_LAYER()\n";
+    }
+}
+
 LRTexture* LRFrameBuffer::GetColorTexture(uint32_t index) const {
     if (index < mColorTextures.size()) {
         return mColorTextures[index];
@@ -0,0 +1,356 @@
+/**
+ * @file LRImagePyramid.cpp
+ * @brief LREngine GPU 高斯/拉普拉斯金字塔实现
+ */
+
+#include "lrengine/core/LRImagePyramid.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRRenderTargetPool.h"
+#include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRFrameBuffer.h"
+#include "lrengine/core/LRShader.h"
+#include "lrengine/core/LRPipelineState.h"
+#include "lrengine/core/LRError.h"
+
+#include <algorithm>
+#include <string>
+
+namespace lrengine {
+namespace render {
+
+namespace {
+
+// 着色器正文不含版本声明：OpenGL 前置 330 core，OpenGL ES 由后端补充 300 es 与精度声明
+
+// 由 gl_VertexID 生成覆盖全屏的三角形，无需顶点缓冲
+const char* kFullscreenVertex = R"(
+out vec2 vUV;
+void main() {
+    vec2 p = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+    vUV = p;
+    gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+// 5×5 二项式核 [1 4 6 4 1]/16：每个方向合并为中心 6/16 与偏移 ±1.2 texel 的 5/16 两组双线性采样
+const char* kDownsampleFragment = R"(
+uniform sampler2D uFirst;
+in vec2 vUV;
+out vec4 fragColor;
+void main() {
+    vec2 o = 1.2 / vec2(textureSize(uFirst, 0));
+    const float wc = 0.375;
+    const float ws = 0.3125;
+    vec4 row0 = texture(uFirst, vUV + vec2(-o.x, -o.y)) * ws + texture(uFirst, vUV + vec2(0.0, -o.y)) * wc +
+                texture(uFirst, vUV + vec2(o.x, -o.y)) * ws;
+    vec4 row1 = texture(uFirst, vUV + vec2(-o.x, 0.0)) * ws + texture(uFirst, vUV) * wc +
+                texture(uFirst, vUV + vec2(o.x, 0.0)) * ws;
+    vec4 row2 = texture(uFirst, vUV + vec2(-o.x, o.y)) * ws + texture(uFirst, vUV + vec2(0.0, o.y)) * wc +
+                texture(uFirst, vUV + vec2(o.x, o.y)) * ws;
+    fragColor = row0 * ws + row1 * wc + row2 * ws;
+}
+)";
+
+// 拉普拉斯分解：精细层减去上采样的粗层
+const char* kDifferenceFragment = R"(
+uniform sampler2D uFirst;
+uniform sampler2D uSecond;
+in vec2 vUV;
+out vec4 fragColor;
+void main() {
+    fragColor = texture(uFirst, vUV) - texture(uSecond, vUV);
+}
+)";
+
+// 重建：频段加上上采样的粗层
+const char* kAddFragment = R"(
+uniform sampler2D uFirst;
+uniform sampler2D uSecond;
+in vec2 vUV;
+out vec4 fragColor;
+void main() {
+    fragColor = texture(uFirst, vUV) + texture(uSecond, vUV);
+}
+)";
+
+} // namespace
+
+LRImagePyramid::~LRImagePyramid() { Release(); }
+
+uint32_t LRImagePyramid::SelectLevelCount(uint32_t width, uint32_t height, uint32_t minLevelSize,
+                                          uint32_t maxLevels) {
+    uint32_t levels = 1;
+    uint32_t shortSide = std::min(width, height);
+    while ((maxLevels == 0 || levels < maxLevels) && (shortSide + 1) / 2 >= std::max(minLevelSize, 1u) &&
+           shortSide > 1) {
+        shortSide = (shortSide + 1) / 2;
+        ++levels;
+    }
+    return levels;
+}
+
+bool LRImagePyramid::Initialize(LRRenderContext* context, LRRenderTargetPool* pool,
+                                const ImagePyramidDescriptor& desc) {
+    if (!context || !pool) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render context or target pool is null");
+        return false;
+    }
+    if (context->GetBackend() != Backend::OpenGL && context->GetBackend() != Backend::OpenGLES) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "Image pyramid requires an OpenGL or OpenGL ES backend");
+        return false;
+    }
+
+    Release();
+    mContext = context;
+    mPool = pool;
+    mDesc = desc;
+
+    mVertexShader = createShader(ShaderStage::Vertex, kFullscreenVertex, "Pyramid_VS");
+    mDownsampleShader = createShader(ShaderStage::Fragment, kDownsampleFragment, "Pyramid_Downsample_FS");
+    mDifferenceShader = createShader(ShaderStage::Fragment, kDifferenceFragment, "Pyramid_Difference_FS");
+    mAddShader = createShader(ShaderStage::Fragment, kAddFragment, "Pyramid_Add_FS");
+    if (!mVertexShader || !mDownsampleShader || !mDifferenceShader || !mAddShader) {
+        Release();
+        return false;
+    }
+
+    mDownsamplePipeline = createPipeline(mDownsampleShader, "Pyramid_Downsample");
+    mDifferencePipeline = createPipeline(mDifferenceShader, "Pyramid_Difference");
+    mAddPipeline = createPipeline(mAddShader, "Pyramid_Add");
+    if (!mDownsamplePipeline || !mDifferencePipeline || !mAddPipeline) {
+        Release();
+        return false;
+    }
+    return true;
+}
+
+LRShader* LRImagePyramid::createShader(ShaderStage stage, const char* body, const char* debugName) {
+    std::string source;
+    if (mContext->GetBackend() == Backend::OpenGL) {
+        source = "#version 330 core\n";
+    }
+    source += body;
+
+    ShaderDescriptor desc;
+    desc.stage = stage;
+    desc.language = ShaderLanguage::GLSL;
+    desc.source = source.c_str();
+    desc.debugName = debugName;
+    return mContext->CreateShader(desc);
+}
+
+LRPipelineState* LRImagePyramid::createPipeline(LRShader* fragmentShader, const char* debugName) {
+    PipelineStateDescriptor desc;
+    desc.vertexShader = mVertexShader;
+    desc.fragmentShader = fragmentShader;
+    desc.depthStencilState.depthTestEnabled = false;
+    desc.depthStencilState.depthWriteEnabled = false;
+    desc.rasterizerState.cullMode = CullMode::None;
+    desc.primitiveType = PrimitiveType::Triangles;
+    desc.debugName = debugName;
+    return mContext->CreatePipelineState(desc);
+}
+
+void LRImagePyramid::runPass(LRPipelineState* pipeline, LRTexture* first, LRTexture* second,
+                             LRFrameBuffer* target, uint32_t width, uint32_t height) {
+    mContext->BeginRenderPass(target);
+    mContext->SetViewport(0, 0, static_cast<int32_t>(width), static_cast<int32_t>(height));
+    mContext->SetPipelineState(pipeline);
+
+    // 采样器单元在程序使用后设置
+    if (LRShaderProgram* program = pipeline->GetShaderProgram()) {
+        program->SetUniform("uFirst", 0);
+        if (second) {
+            program->SetUniform("uSecond", 1);
+        }
+    }
+    mContext->SetTexture(first, 0);
+    if (second) {
+        mContext->SetTexture(second, 1);
+    }
+
+    mContext->DrawWithoutVertexInput(0, 3);
+    mContext->EndRenderPass();
+}
+
+bool LRImagePyramid::BuildGaussian(LRTexture* source) {
+    if (!mContext) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Image pyramid not initialized");
+        return false;
+    }
+    if (!source || !source->IsValid() || source->GetTextureType() != TextureType::Texture2D) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Image pyramid requires a valid 2D texture");
+        return false;
+    }
+
+    ReleaseLevels();
+    source->AddRef();
+    mSource = source;
+
+    const uint32_t levels =
+        SelectLevelCount(source->GetWidth(), source->GetHeight(), mDesc.minLevelSize, mDesc.maxLevels);
+    mLevelSizes.push_back({source->GetWidth(), source->GetHeight()});
+    for (uint32_t level = 1; level < levels; ++level) {
+        const LevelSize& finer = mLevelSizes.back();
+        mLevelSizes.push_back({std::max(1u, (finer.width + 1) / 2), std::max(1u, (finer.height + 1) / 2)});
+    }
+
+    LRTexture* finer = source;
+    for (uint32_t level = 1; level < levels; ++level) {
+        const LevelSize& size = mLevelSizes[level];
+        PooledRenderTarget* target = mPool->Acquire(size.width, size.height, mDesc.format);
+        if (!target) {
+            ReleaseLevels();
+            return false;
+        }
+        mGaussian.push_back(target);
+        runPass(mDownsamplePipeline, finer, nullptr, target->frameBuffer, size.width, size.height);
+        finer = target->texture;
+    }
+    return true;
+}
+
+bool LRImagePyramid::BuildLaplacian() {
+    if (!mSource) {
+        LR_SET_ERROR(ErrorCode::InvalidState, "Gaussian pyramid has not been built");
+        return false;
+    }
+    if (mDesc.format != PixelFormat::RGBA16F && mDesc.format != PixelFormat::RGBA32F) {
+        LR_SET_ERROR(ErrorCode::InvalidState, "Laplacian bands require a signed floating-point format");
+        return false;
+    }
+
+    const uint32_t levels = GetLevelCount();
+    if (levels < 2) {
+        LR_SET_ERROR(ErrorCode::InvalidState, "Image is too small for a Laplacian pyramid");
+        return false;
+    }
+
+    releaseLaplacian();
+    for (uint32_t level = 0; level + 1 < levels; ++level) {
+        const LevelSize& size = mLevelSizes[level];
+        PooledRenderTarget* target = mPool->Acquire(size.width, size.height, mDesc.format);
+        if (!target) {
+            releaseLaplacian();
+            return false;
+        }
+        mLaplacian.push_back(target);
+        runPass(mDifferencePipeline, GetGaussianLevel(level), GetGaussianLevel(level + 1), target->frameBuffer,
+                size.width, size.height);
+    }
+    return true;
+}
+
+bool LRImagePyramid::Collapse(LRFrameBuffer* target) {
+    const uint32_t levels = GetLevelCount();
+    if (levels < 2 || mLaplacian.size() + 1 != levels) {
+        LR_SET_ERROR(ErrorCode::InvalidState, "Laplacian pyramid has not been built");
+        return false;
+    }
+    if (!target || target->GetWidth() != mLevelSizes[0].width || target->GetHeight() != mLevelSizes[0].height) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Collapse target must match level 0 size");
+        return false;
+    }
+
+    // 自粗向细逐层累加，中间结果用完即归还
+    LRTexture* coarser = GetLaplacianLevel(levels - 1);
+    PooledRenderTarget* previous = nullptr;
+    for (uint32_t level = levels - 1; level-- > 0;) {
+        const LevelSize& size = mLevelSizes[level];
+        PooledRenderTarget* result = nullptr;
+        LRFrameBuffer* output = target;
+        if (level > 0) {
+            result = mPool->Acquire(size.width, size.height, mDesc.format);
+            if (!result) {
+                mPool->Recycle(previous);
+                return false;
+            }
+            output = result->frameBuffer;
+        }
+
+        runPass(mAddPipeline, mLaplacian[level]->texture, coarser, output, size.width, size.height);
+        mPool->Recycle(previous);
+        previous = result;
+        coarser = result ? result->texture : nullptr;
+    }
+
+    return true;
+}
+
+uint32_t LRImagePyramid::GetLevelWidth(uint32_t level) const {
+    return level < mLevelSizes.size() ? mLevelSizes[level].width : 0;
+}
+
+uint32_t LRImagePyramid::GetLevelHeight(uint32_t level) const {
+    return level < mLevelSizes.size() ? mLevelSizes[level].height : 0;
+}
+
+LRTexture* LRImagePyramid::GetGaussianLevel(uint32_t level) const {
+    if (level == 0) {
+        return mSource;
+    }
+    return level - 1 < mGaussian.size() ? mGaussian[level - 1]->texture : nullptr;
+}
+
+LRTexture* LRImagePyramid::GetLaplacianLevel(uint32_t level) const {
+    if (level < mLaplacian.size()) {
+        return mLaplacian[level]->texture;
+    }
+    return level + 1 == GetLevelCount() ? GetGaussianLevel(level) : nullptr;
+}
+
+LRFrameBuffer* LRImagePyramid::GetLaplacianTarget(uint32_t level) const {
+    if (level < mLaplacian.size()) {
+        return mLaplacian[level]->frameBuffer;
+    }
+    if (level + 1 == GetLevelCount() && level > 0) {
+        return mGaussian[level - 1]->frameBuffer;
+    }
+    return nullptr;
+}
+
+void LRImagePyramid::releaseLaplacian() {
+    for (PooledRenderTarget* target : mLaplacian) {
+        mPool->Recycle(target);
+    }
+    mLaplacian.clear();
+}
+
+void LRImagePyramid::ReleaseLevels() {
+    if (mPool) {
+        releaseLaplacian();
+        for (PooledRenderTarget* target : mGaussian) {
+            mPool->Recycle(target);
+        }
+    }
+    mGaussian.clear();
+    mLevelSizes.clear();
+    if (mSource) {
+        mSource->Release();
+        mSource = nullptr;
+    }
+}
+
+void LRImagePyramid::Release() {
+    ReleaseLevels();
+
+    LRPipelineState** pipelines[] = {&mDownsamplePipeline, &mDifferencePipeline, &mAddPipeline};
+    for (LRPipelineState** pipeline : pipelines) {
+        if (*pipeline) {
+            (*pipeline)->Release();
+            *pipeline = nullptr;
+        }
+    }
+    LRShader** shaders[] = {&mVertexShader, &mDownsampleShader, &mDifferenceShader, &mAddShader};
+    for (LRShader** shader : shaders) {
+        if (*shader) {
+            (*shader)->Release();
+            *shader = nullptr;
+        }
+    }
+    mContext = nullptr;
+    mPool = nullptr;
+}
+
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,141 @@
+/**
+ * @file LRImageReducer.cpp
+ * @brief LREngine GPU 图像归约实现
+ */
+
+#include "lrengine/core/LRImageReducer.h"
+#include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRError.h"
+#include "lrengine/utils/ImageStatistics.h"
+
+#include <algorithm>
+
+namespace lrengine {
+namespace render {
+
+LRImageReducer::~LRImageReducer() { Release(); }
+
+bool LRImageReducer::Initialize(const ImageReducerDescriptor& desc) {
+    if (desc.readbackSize == 0 || desc.maxInFlight == 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid image reducer descriptor");
+        return false;
+    }
+
+    Release();
+    mDesc = desc;
+    mInitialized = true;
+    return true;
+}
+
+uint32_t LRImageReducer::selectMipLevel(uint32_t width, uint32_t height, uint32_t maxSize) {
+    uint32_t level = 0;
+    while (std::max(width >> level, height >> level) > maxSize) {
+        ++level;
+    }
+    return level;
+}
+
+bool LRImageReducer::Submit(LRTexture* source) {
+    if (!mInitialized) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Image reducer not initialized");
+        return false;
+    }
+    if (!source || !source->IsValid() || source->GetTextureType() != TextureType::Texture2D) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Image reducer requires a valid 2D texture");
+        return false;
+    }
+    if (mPending.size() >= mDesc.maxInFlight) {
+        return false;
+    }
+
+    PendingReadback pending;
+    switch (source->GetFormat()) {
+        case PixelFormat::RGBA8:
+            pending.format = ImageFormat::RGBA8;
+            break;
+        case PixelFormat::R8:
+            pending.format = ImageFormat::GRAY8;
+            break;
+        case PixelFormat::RGB10A2:
+            pending.format = ImageFormat::RGB10A2;
+            break;
+        default:
+            LR_SET_ERROR(ErrorCode::TextureFormatNotSupported, "Image reducer does not support this format");
+            return false;
+    }
+
+    const uint32_t width = source->GetWidth();
+    const uint32_t height = source->GetHeight();
+    const uint32_t level = selectMipLevel(width, height, mDesc.readbackSize);
+    if (level >= source->GetMipLevels()) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Texture has too few mip levels for reduction");
+        return false;
+    }
+
+    if (level > 0) {
+        source->GenerateMipmaps();
+    }
+    pending.slot = source->BeginAsyncReadback(level);
+    if (pending.slot < 0) {
+        return false;
+    }
+
+    pending.texture = source;
+    pending.width = std::max(1u, width >> level);
+    pending.height = std::max(1u, height >> level);
+    source->AddRef();
+    mPending.push_back(pending);
+    return true;
+}
+
+bool LRImageReducer::Poll(utils::ImageStatistics& out) {
+    // 多帧同时完成时只保留最新一帧的数据
+    ImageDataDesc latest;
+    while (!mPending.empty()) {
+        PendingReadback& pending = mPending.front();
+        const uint32_t bytesPerPixel = pending.format == ImageFormat::GRAY8 ? 1 : 4;
+        mScratch.resize(static_cast<size_t>(pending.width) * pending.height * bytesPerPixel);
+
+        LRError::ClearError();
+        const bool ready = pending.texture->ResolveAsyncReadback(pending.slot, mScratch.data());
+        if (!ready && !LRError::HasError()) {
+            // 按提交顺序完成，队首未就绪则后续也未就绪
+            break;
+        }
+
+        if (ready) {
+            mLatest.swap(mScratch);
+            latest.width = pending.width;
+            latest.height = pending.height;
+            latest.format = pending.format;
+            latest.range = ColorRange::Full;
+            latest.planes.assign(1, {mLatest.data(), pending.width * bytesPerPixel});
+        }
+
+        pending.texture->Release();
+        mPending.pop_front();
+    }
+
+    if (latest.planes.empty()) {
+        return false;
+    }
+
+    // 小 mip 逐像素统计
+    utils::ImageStatisticsOptions options;
+    options.gridStep = 1;
+    return utils::ComputeImageStatistics(latest, out, options);
+}
+
+void LRImageReducer::Release() {
+    for (PendingReadback& pending : mPending) {
+        pending.texture->ResolveAsyncReadback(pending.slot, nullptr, true);
+        pending.texture->Release();
+    }
+    mPending.clear();
+    mScratch.clear();
+    mLatest.clear();
+    mInitialized = false;
+}
+
+} // namespace render
+} // namespace lrengine
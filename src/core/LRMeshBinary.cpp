@@ -0,0 +1,330 @@
+/**
+ * @file LRMeshBinary.cpp
+ * @brief LREngine 二进制网格格式及加载器实现
+ */
+
+#include "lrengine/core/LRMeshBinary.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRBuffer.h"
+#include "lrengine/core/LRError.h"
+#include "lrengine/utils/AssetPackage.h"
+#include "lrengine/utils/MappedFile.h"
+#include "lrengine/utils/LRLog.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lrengine {
+namespace render {
+
+namespace {
+
+inline uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+inline uint32_t indexSize(IndexType type) {
+    return type == IndexType::UInt16 ? 2 : 4;
+}
+
+inline bool rangeValid(uint64_t offset, uint64_t length, size_t total) {
+    return offset <= total && length <= total - offset;
+}
+
+// 格式为已知 VertexFormat，且属性完整落在一个顶点步长内（属性步长为 0 时使用顶点步长）
+inline bool attributeValid(uint8_t format, uint32_t offset, uint32_t stride, uint32_t vertexStride) {
+    if (format > static_cast<uint8_t>(VertexFormat::UByte4Norm)) {
+        return false;
+    }
+    const uint32_t effectiveStride = stride != 0 ? stride : vertexStride;
+    return uint64_t(offset) + GetVertexFormatSize(static_cast<VertexFormat>(format)) <= effectiveStride;
+}
+
+} // namespace
+
+// =============================================================================
+// MeshBinaryView / LoadedMesh
+// =============================================================================
+
+VertexLayoutDescriptor MeshBinaryView::GetVertexLayout() const {
+    VertexLayoutDescriptor layout;
+    if (!header) {
+        return layout;
+    }
+    layout.stride = header->vertexStride;
+    layout.attributes.resize(header->attributeCount);
+    for (uint32_t i = 0; i < header->attributeCount; ++i) {
+        VertexAttribute& attr = layout.attributes[i];
+        attr.location = attributes[i].location;
+        attr.format = static_cast<VertexFormat>(attributes[i].format);
+        attr.offset = attributes[i].offset;
+        attr.stride = attributes[i].stride;
+        attr.normalized = attributes[i].normalized != 0;
+    }
+    return layout;
+}
+
+void LoadedMesh::Release() {
+    if (vertexBuffer) {
+        vertexBuffer->Release();
+        vertexBuffer = nullptr;
+    }
+    if (indexBuffer) {
+        indexBuffer->Release();
+        indexBuffer = nullptr;
+    }
+    subMeshes.clear();
+    vertexCount = 0;
+    indexCount = 0;
+}
+
+// =============================================================================
+// LRMeshBinary
+// =============================================================================
+
+bool LRMeshBinary::Parse(const void* data, size_t size, MeshBinaryView& out) {
+    out = MeshBinaryView();
+    if (!data || size < sizeof(MeshBinaryHeader)) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh binary is too small");
+        return false;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    const MeshBinaryHeader* header = reinterpret_cast<const MeshBinaryHeader*>(bytes);
+    if (header->magic != kMagic || header->version != kVersion) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh binary has invalid magic or version");
+        return false;
+    }
+
+    const uint64_t attributesSize = uint64_t(header->attributeCount) * sizeof(MeshBinaryAttribute);
+    const uint64_t subMeshesSize = uint64_t(header->subMeshCount) * sizeof(MeshBinarySubMesh);
+    const uint64_t expectedVertexSize = uint64_t(header->vertexCount) * header->vertexStride;
+    const uint64_t expectedIndexSize =
+        uint64_t(header->indexCount) * indexSize(static_cast<IndexType>(header->indexType));
+
+    if (header->indexType > static_cast<uint8_t>(IndexType::UInt32) ||
+        header->attributeCount == 0 || header->vertexStride == 0 ||
+        header->vertexDataSize != expectedVertexSize ||
+        header->indexDataSize != expectedIndexSize ||
+        header->attributesOffset % alignof(MeshBinaryAttribute) != 0 ||
+        header->subMeshesOffset % alignof(MeshBinarySubMesh) != 0 ||
+        !rangeValid(header->attributesOffset, attributesSize, size) ||
+        !rangeValid(header->subMeshesOffset, subMeshesSize, size) ||
+        !rangeValid(header->vertexDataOffset, header->vertexDataSize, size) ||
+        !rangeValid(header->indexDataOffset, header->indexDataSize, size)) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh binary has inconsistent layout");
+        return false;
+    }
+
+    const MeshBinaryAttribute* attributes =
+        reinterpret_cast<const MeshBinaryAttribute*>(bytes + header->attributesOffset);
+    for (uint32_t i = 0; i < header->attributeCount; ++i) {
+        if (!attributeValid(attributes[i].format, attributes[i].offset, attributes[i].stride,
+                            header->vertexStride)) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh binary has invalid vertex attribute");
+            return false;
+        }
+    }
+
+    const MeshBinarySubMesh* subMeshes =
+        reinterpret_cast<const MeshBinarySubMesh*>(bytes + header->subMeshesOffset);
+    for (uint32_t i = 0; i < header->subMeshCount; ++i) {
+        if (uint64_t(subMeshes[i].indexStart) + subMeshes[i].indexCount > header->indexCount) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh binary sub-mesh exceeds index range");
+            return false;
+        }
+    }
+
+    out.header = header;
+    out.attributes = attributes;
+    out.subMeshes = subMeshes;
+    out.vertexData = bytes + header->vertexDataOffset;
+    out.indexData = header->indexDataSize > 0 ? bytes + header->indexDataOffset : nullptr;
+    return true;
+}
+
+bool LRMeshBinary::Serialize(const MeshBinarySource& source, std::vector<uint8_t>& out) {
+    uint32_t stride = source.layout.stride;
+    if (stride == 0) {
+        for (const auto& attr : source.layout.attributes) {
+            stride = std::max(stride, attr.offset + GetVertexFormatSize(attr.format));
+        }
+    }
+
+    if (!source.vertexData || source.vertexCount == 0 || stride == 0 ||
+        source.layout.attributes.empty() || source.layout.attributes.size() > 255 ||
+        source.indexType > IndexType::UInt32 ||
+        (source.indexCount > 0 && !source.indexData) || source.subMeshes.size() > 65535) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid mesh source");
+        return false;
+    }
+    for (const auto& attr : source.layout.attributes) {
+        if (!attributeValid(static_cast<uint8_t>(attr.format), attr.offset, attr.stride, stride)) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh source has invalid vertex attribute");
+            return false;
+        }
+    }
+    for (const auto& sub : source.subMeshes) {
+        if (uint64_t(sub.indexStart) + sub.indexCount > source.indexCount) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh source sub-mesh exceeds index range");
+            return false;
+        }
+    }
+
+    // 文件内偏移与大小均为 32 位
+    const uint64_t tablesEnd = sizeof(MeshBinaryHeader) +
+                               source.layout.attributes.size() * sizeof(MeshBinaryAttribute) +
+                               std::max<size_t>(source.subMeshes.size(), 1) * sizeof(MeshBinarySubMesh);
+    const uint64_t vertexDataOffset = alignUp(tablesEnd, kDataAlignment);
+    const uint64_t vertexDataSize = uint64_t(source.vertexCount) * stride;
+    const uint64_t indexDataOffset = alignUp(vertexDataOffset + vertexDataSize, kDataAlignment);
+    const uint64_t indexDataSize = uint64_t(source.indexCount) * indexSize(source.indexType);
+    if (indexDataOffset + indexDataSize > UINT32_MAX) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Mesh source exceeds 4 GB binary limit");
+        return false;
+    }
+
+    std::vector<MeshBinarySubMesh> subMeshes = source.subMeshes;
+    if (subMeshes.empty()) {
+        MeshBinarySubMesh whole;
+        whole.indexStart = 0;
+        whole.indexCount = source.indexCount;
+        std::memcpy(whole.boundsMin, source.boundsMin, sizeof(whole.boundsMin));
+        std::memcpy(whole.boundsMax, source.boundsMax, sizeof(whole.boundsMax));
+        subMeshes.push_back(whole);
+    }
+
+    MeshBinaryHeader header;
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.vertexCount = source.vertexCount;
+    header.vertexStride = stride;
+    header.indexCount = source.indexCount;
+    header.indexType = static_cast<uint8_t>(source.indexType);
+    header.attributeCount = static_cast<uint8_t>(source.layout.attributes.size());
+    header.subMeshCount = static_cast<uint16_t>(subMeshes.size());
+    std::memcpy(header.boundsMin, source.boundsMin, sizeof(header.boundsMin));
+    std::memcpy(header.boundsMax, source.boundsMax, sizeof(header.boundsMax));
+
+    header.attributesOffset = sizeof(MeshBinaryHeader);
+    header.subMeshesOffset = header.attributesOffset +
+                             header.attributeCount * static_cast<uint32_t>(sizeof(MeshBinaryAttribute));
+    header.vertexDataOffset = static_cast<uint32_t>(vertexDataOffset);
+    header.vertexDataSize = static_cast<uint32_t>(vertexDataSize);
+    header.indexDataOffset = static_cast<uint32_t>(indexDataOffset);
+    header.indexDataSize = static_cast<uint32_t>(indexDataSize);
+
+    out.assign(static_cast<size_t>(indexDataOffset + indexDataSize), 0);
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    MeshBinaryAttribute* attributes =
+        reinterpret_cast<MeshBinaryAttribute*>(out.data() + header.attributesOffset);
+    for (size_t i = 0; i < source.layout.attributes.size(); ++i) {
+        const VertexAttribute& attr = source.layout.attributes[i];
+        attributes[i].location = attr.location;
+        attributes[i].offset = attr.offset;
+        attributes[i].stride = attr.stride;
+        attributes[i].format = static_cast<uint8_t>(attr.format);
+        attributes[i].normalized = attr.normalized ? 1 : 0;
+    }
+
+    std::memcpy(out.data() + header.subMeshesOffset, subMeshes.data(),
+                subMeshes.size() * sizeof(MeshBinarySubMesh));
+    std::memcpy(out.data() + header.vertexDataOffset, source.vertexData, header.vertexDataSize);
+    if (header.indexDataSize > 0) {
+        std::memcpy(out.data() + header.indexDataOffset, source.indexData, header.indexDataSize);
+    }
+    return true;
+}
+
+// =============================================================================
+// LRMeshLoader
+// =============================================================================
+
+bool LRMeshLoader::LoadFromMemory(LRRenderContext* context, const void* data, size_t size,
+                                  LoadedMesh& out, const char* debugName) {
+    out.Release();
+    if (!context) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render context is null");
+        return false;
+    }
+
+    MeshBinaryView view;
+    if (!LRMeshBinary::Parse(data, size, view)) {
+        return false;
+    }
+
+    BufferDescriptor vbDesc;
+    vbDesc.size = view.header->vertexDataSize;
+    vbDesc.usage = BufferUsage::Static;
+    vbDesc.type = BufferType::Vertex;
+    vbDesc.data = view.vertexData;
+    vbDesc.stride = view.header->vertexStride;
+    vbDesc.debugName = debugName;
+
+    out.vertexBuffer = context->CreateVertexBuffer(vbDesc);
+    if (!out.vertexBuffer) {
+        out.Release();
+        return false;
+    }
+    out.vertexBuffer->SetVertexLayout(view.GetVertexLayout());
+
+    if (view.indexData) {
+        BufferDescriptor ibDesc;
+        ibDesc.size = view.header->indexDataSize;
+        ibDesc.usage = BufferUsage::Static;
+        ibDesc.type = BufferType::Index;
+        ibDesc.data = view.indexData;
+        ibDesc.indexType = view.GetIndexType();
+        ibDesc.debugName = debugName;
+
+        out.indexBuffer = context->CreateIndexBuffer(ibDesc);
+        if (!out.indexBuffer) {
+            out.Release();
+            return false;
+        }
+    }
+
+    out.subMeshes.assign(view.subMeshes, view.subMeshes + view.header->subMeshCount);
+    out.vertexCount = view.header->vertexCount;
+    out.indexCount = view.header->indexCount;
+    std::memcpy(out.boundsMin, view.header->boundsMin, sizeof(out.boundsMin));
+    std::memcpy(out.boundsMax, view.header->boundsMax, sizeof(out.boundsMax));
+    return true;
+}
+
+bool LRMeshLoader::LoadFromFile(LRRenderContext* context, const std::string& path,
+                                LoadedMesh& out) {
+    utils::MappedFile file;
+    if (!file.Open(path)) {
+        LR_SET_ERROR(ErrorCode::FileNotFound, "Failed to map mesh file");
+        return false;
+    }
+    // 缓冲创建时数据已提交给驱动，映射随后即可释放
+    return LoadFromMemory(context, file.GetData(), file.GetSize(), out, path.c_str());
+}
+
+bool LRMeshLoader::LoadFromPackage(LRRenderContext* context, const utils::AssetPackage& package,
+                                   const std::string& name, LoadedMesh& out) {
+    const utils::AssetEntry* entry = package.Find(name);
+    if (!entry) {
+        LR_SET_ERROR(ErrorCode::ResourceNotFound, "Mesh not found in asset package");
+        return false;
+    }
+
+    utils::AssetView view = package.GetView(entry);
+    if (view.data) {
+        return LoadFromMemory(context, view.data, view.size, out, name.c_str());
+    }
+
+    // 压缩条目需要先解压
+    std::vector<uint8_t> bytes;
+    if (!package.Read(entry, bytes)) {
+        LR_SET_ERROR(ErrorCode::FileReadFailed, "Failed to decompress mesh");
+        return false;
+    }
+    return LoadFromMemory(context, bytes.data(), bytes.size(), out, name.c_str());
+}
+
+} // namespace render
+} // namespace lrengine
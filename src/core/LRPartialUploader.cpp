@@ -0,0 +1,160 @@
+/**
+ * @file LRPartialUploader.cpp
+ * @brief LREngine 局部纹理上传实现
+ */
+
+#include "lrengine/core/LRPartialUploader.h"
+#include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRError.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lrengine {
+namespace render {
+
+namespace {
+
+// 图像格式对应的纹理格式与每像素字节数（行长度保持 4 字节对齐）
+bool GetUploadFormat(ImageFormat format, PixelFormat& pixelFormat, uint32_t& bytesPerPixel) {
+    switch (format) {
+        case ImageFormat::RGBA8:
+            pixelFormat = PixelFormat::RGBA8;
+            bytesPerPixel = 4;
+            return true;
+        case ImageFormat::RGB10A2:
+            pixelFormat = PixelFormat::RGB10A2;
+            bytesPerPixel = 4;
+            return true;
+        case ImageFormat::RGBA16F:
+            pixelFormat = PixelFormat::RGBA16F;
+            bytesPerPixel = 8;
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+bool LRPartialUploader::Initialize(const PartialUploadDescriptor& desc) {
+    if (desc.tileSize == 0 || desc.fullUploadThreshold < 0.0f) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid partial upload descriptor");
+        return false;
+    }
+
+    Reset();
+    mDesc = desc;
+    mInitialized = true;
+    return true;
+}
+
+bool LRPartialUploader::Upload(LRTexture* texture, const ImageDataDesc& image) {
+    if (!mInitialized) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Partial uploader not initialized");
+        return false;
+    }
+    if (!texture || !texture->IsValid() || image.planes.empty() || !image.planes[0].data) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid texture or image data");
+        return false;
+    }
+
+    PixelFormat pixelFormat;
+    uint32_t bytesPerPixel = 0;
+    if (!GetUploadFormat(image.format, pixelFormat, bytesPerPixel) || texture->GetFormat() != pixelFormat ||
+        texture->GetTextureType() != TextureType::Texture2D) {
+        LR_SET_ERROR(ErrorCode::TextureFormatNotSupported, "Image format does not match texture");
+        return false;
+    }
+    if (texture->GetWidth() != image.width || texture->GetHeight() != image.height) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Image size does not match texture");
+        return false;
+    }
+
+    const bool hasBaseline = texture->GetResourceID() == mTextureID && mShadowDesc.width == image.width &&
+                             mShadowDesc.height == image.height && mShadowDesc.format == image.format;
+    if (!hasBaseline || !utils::DetectDirtyTiles(mShadowDesc, image, mDesc.tileSize, mTiles)) {
+        return uploadFull(texture, image, bytesPerPixel);
+    }
+
+    utils::MergeDirtyTiles(mTiles, image.width, image.height, mRects);
+    const uint64_t dirtyArea = utils::GetDirtyArea(mRects);
+    const uint64_t totalArea = static_cast<uint64_t>(image.width) * image.height;
+    if (static_cast<double>(dirtyArea) > mDesc.fullUploadThreshold * static_cast<double>(totalArea)) {
+        return uploadFull(texture, image, bytesPerPixel);
+    }
+
+    mUploadedBytes = 0;
+    for (const utils::DirtyRect& rect : mRects) {
+        uploadRect(texture, image, rect, bytesPerPixel);
+    }
+    return true;
+}
+
+bool LRPartialUploader::uploadFull(LRTexture* texture, const ImageDataDesc& image, uint32_t bytesPerPixel) {
+    const size_t rowBytes = static_cast<size_t>(image.width) * bytesPerPixel;
+    const size_t srcStride = image.planes[0].stride ? image.planes[0].stride : rowBytes;
+    mShadow.resize(rowBytes * image.height);
+
+    const uint8_t* src = static_cast<const uint8_t*>(image.planes[0].data);
+    if (srcStride == rowBytes) {
+        std::memcpy(mShadow.data(), src, mShadow.size());
+    } else {
+        for (uint32_t y = 0; y < image.height; ++y) {
+            std::memcpy(mShadow.data() + rowBytes * y, src + srcStride * y, rowBytes);
+        }
+    }
+
+    mShadowDesc.width = image.width;
+    mShadowDesc.height = image.height;
+    mShadowDesc.format = image.format;
+    mShadowDesc.planes.assign(1, {mShadow.data(), static_cast<uint32_t>(rowBytes)});
+    mTextureID = texture->GetResourceID();
+
+    texture->UpdateData(mShadow.data());
+
+    utils::DirtyRect full;
+    full.width = image.width;
+    full.height = image.height;
+    mRects.assign(1, full);
+    mUploadedBytes = mShadow.size();
+    return true;
+}
+
+void LRPartialUploader::uploadRect(LRTexture* texture, const ImageDataDesc& image,
+                                   const utils::DirtyRect& rect, uint32_t bytesPerPixel) {
+    const size_t rowBytes = static_cast<size_t>(image.width) * bytesPerPixel;
+    const size_t srcStride = image.planes[0].stride ? image.planes[0].stride : rowBytes;
+    const size_t rectRowBytes = static_cast<size_t>(rect.width) * bytesPerPixel;
+    const size_t offset = static_cast<size_t>(rect.x) * bytesPerPixel;
+    mScratch.resize(rectRowBytes * rect.height);
+
+    // 打包矩形并同步写回副本
+    const uint8_t* src = static_cast<const uint8_t*>(image.planes[0].data);
+    for (uint32_t row = 0; row < rect.height; ++row) {
+        const size_t y = rect.y + row;
+        const uint8_t* srcRow = src + srcStride * y + offset;
+        std::memcpy(mScratch.data() + rectRowBytes * row, srcRow, rectRowBytes);
+        std::memcpy(mShadow.data() + rowBytes * y + offset, srcRow, rectRowBytes);
+    }
+
+    TextureRegion region;
+    region.x = rect.x;
+    region.y = rect.y;
+    region.width = rect.width;
+    region.height = rect.height;
+    texture->UpdateData(mScratch.data(), &region);
+    mUploadedBytes += mScratch.size();
+}
+
+void LRPartialUploader::Reset() {
+    mShadow.clear();
+    mShadowDesc = ImageDataDesc();
+    mTextureID = 0;
+    mRects.clear();
+    mTiles = utils::DirtyTileMap();
+    mUploadedBytes = 0;
+}
+
+} // namespace render
+} // namespace lrengine
@@ -7,6 +7,7 @@
 #include "lrengine/core/LRShader.h"
 #include "lrengine/core/LRError.h"
 #include "platform/interface/IPipelineStateImpl.h"
+#include "platform/StaticBackend.h"
 
 namespace lrengine {
 namespace render {
@@ -15,7 +16,7 @@ LRPipelineState::LRPipelineState() : LRResource(ResourceType::PipelineState) {}
 
 LRPipelineState::~LRPipelineState() {
     if (mImpl) {
-        mImpl->Destroy();
+        BackendCast(mImpl)->Destroy();
         delete mImpl;
         mImpl = nullptr;
     }
@@ -37,7 +38,7 @@ bool LRPipelineState::Initialize(IPipelineStateImpl* impl,
     mRasterizerState   = desc.rasterizerState;
     mPrimitiveType     = desc.primitiveType;
 
-    if (!mImpl->Create(desc)) {
+    if (!BackendCast(mImpl)->Create(desc)) {
         LR_SET_ERROR(ErrorCode::PipelineCreationFailed, "Failed to create pipeline state");
         delete mImpl;
         mImpl = nullptr;
@@ -55,13 +56,14 @@ bool LRPipelineState::Initialize(IPipelineStateImpl* impl,
 
 void LRPipelineState::Apply() {
     if (mImpl && mIsValid) {
-        mImpl->Apply();
+        InvalidateBindings(BindingScope::Pipeline);
+        BackendCast(mImpl)->Apply();
     }
 }
 
 ResourceHandle LRPipelineState::GetNativeHandle() const {
     if (mImpl) {
-        return mImpl->GetNativeHandle();
+        return BackendCast(mImpl)->GetNativeHandle();
     }
     return ResourceHandle();
 }
@@ -6,12 +6,33 @@
 #include "lrengine/core/LRPlanarTexture.h"
 #include "lrengine/core/LRRenderContext.h"
 #include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRError.h"
 #include "lrengine/utils/ImageBufferPool.h"
+#include "lrengine/utils/ImageConvert.h"
 #include "platform/interface/ITextureImpl.h"
 
+#include <cstring>
+
 namespace lrengine {
 namespace render {
 
+namespace {
+
+// 图像至少有 count 个平面且各平面数据非空
+bool hasPlaneData(const ImageDataDesc& imageData, size_t count) {
+    if (imageData.planes.size() < count) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!imageData.planes[i].data) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 LRPlanarTexture::LRPlanarTexture()
     : LRResource(ResourceType::Texture)
     , mImageFormat(ImageFormat::Unknown) {
@@ -30,12 +51,17 @@ bool LRPlanarTexture::Initialize(LRRenderContext* context, const PlanarTextureDe
     mWidth = desc.width;
     mHeight = desc.height;
     mFormat = desc.format;
+    mLayout = desc.layout;
     
     switch (mFormat) {
         case PlanarFormat::YUV420P: mImageFormat = ImageFormat::YUV420P; break;
         case PlanarFormat::NV12:    mImageFormat = ImageFormat::NV12;    break;
         case PlanarFormat::NV21:    mImageFormat = ImageFormat::NV21;    break;
         case PlanarFormat::RGBA:    mImageFormat = ImageFormat::RGBA8;   break;
+        case PlanarFormat::P010:    mImageFormat = ImageFormat::P010;    break;
+        case PlanarFormat::P016:    mImageFormat = ImageFormat::P016;    break;
+        case PlanarFormat::RGB10A2: mImageFormat = ImageFormat::RGB10A2; break;
+        case PlanarFormat::RGBA16F: mImageFormat = ImageFormat::RGBA16F; break;
         default:                    mImageFormat = ImageFormat::Unknown; break;
     }
     
@@ -55,6 +81,10 @@ bool LRPlanarTexture::createPlanes(const PlanarTextureDescriptor& desc) {
     // 释放旧的平面
     releasePlanes();
     
+    if (desc.layout == PlanarTextureLayout::Packed) {
+        return createPackedPlane(desc);
+    }
+    
     switch (desc.format) {
         case PlanarFormat::YUV420P: {
             // Y 平面: 全尺寸 R8
@@ -156,6 +186,32 @@ bool LRPlanarTexture::createPlanes(const PlanarTextureDescriptor& desc) {
             break;
         }
         
+        case PlanarFormat::P010:
+        case PlanarFormat::P016:
+            return create16BitPlanes(desc);
+        
+        case PlanarFormat::RGB10A2:
+        case PlanarFormat::RGBA16F: {
+            // HDR 单平面
+            TextureDescriptor hdrDesc;
+            hdrDesc.width = desc.width;
+            hdrDesc.height = desc.height;
+            hdrDesc.depth = 1;
+            hdrDesc.type = TextureType::Texture2D;
+            hdrDesc.format = (desc.format == PlanarFormat::RGB10A2) ? PixelFormat::RGB10A2
+                                                                   : PixelFormat::RGBA16F;
+            hdrDesc.mipLevels = 1;
+            hdrDesc.sampler = desc.sampler;
+            hdrDesc.debugName = (desc.format == PlanarFormat::RGB10A2) ? "PlanarTexture_RGB10A2"
+                                                                      : "PlanarTexture_RGBA16F";
+            
+            auto* hdrTex = mContext->CreateTexture(hdrDesc);
+            if (!hdrTex) return false;
+            
+            mPlanes = {hdrTex};
+            break;
+        }
+        
         default:
             return false;
     }
@@ -163,6 +219,77 @@ bool LRPlanarTexture::createPlanes(const PlanarTextureDescriptor& desc) {
     return !mPlanes.empty();
 }
 
+bool LRPlanarTexture::createPackedPlane(const PlanarTextureDescriptor& desc) {
+    if ((desc.format != PlanarFormat::NV12 && desc.format != PlanarFormat::NV21) ||
+        (desc.width & 1) != 0 || (desc.height & 1) != 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Packed planar layout requires NV12/NV21 with even dimensions");
+        return false;
+    }
+    
+    // Y 行（宽 × 高）之后紧跟交织 UV 行（宽 × 高/2，每行 width 字节）
+    TextureDescriptor packedDesc;
+    packedDesc.width = desc.width;
+    packedDesc.height = desc.height + desc.height / 2;
+    packedDesc.depth = 1;
+    packedDesc.type = TextureType::Texture2D;
+    packedDesc.format = PixelFormat::R8;
+    packedDesc.mipLevels = 1;
+    packedDesc.sampler = desc.sampler;
+    packedDesc.debugName = (desc.format == PlanarFormat::NV12) ? "PlanarTexture_PackedNV12"
+                                                               : "PlanarTexture_PackedNV21";
+    
+    auto* packedTex = mContext->CreateTexture(packedDesc);
+    if (!packedTex) return false;
+    
+    mPlanes = {packedTex};
+    return true;
+}
+
+bool LRPlanarTexture::create16BitPlanes(const PlanarTextureDescriptor& desc) {
+    // Y 平面: 全尺寸 R16
+    TextureDescriptor yDesc;
+    yDesc.width = desc.width;
+    yDesc.height = desc.height;
+    yDesc.depth = 1;
+    yDesc.type = TextureType::Texture2D;
+    yDesc.format = PixelFormat::R16;
+    yDesc.mipLevels = 1;
+    yDesc.sampler = desc.sampler;
+    yDesc.debugName = "PlanarTexture_Y16";
+    
+    // UV 平面: 1/2 尺寸 RG16
+    TextureDescriptor uvDesc;
+    uvDesc.width = desc.width / 2;
+    uvDesc.height = desc.height / 2;
+    uvDesc.depth = 1;
+    uvDesc.type = TextureType::Texture2D;
+    uvDesc.format = PixelFormat::RG16;
+    uvDesc.mipLevels = 1;
+    uvDesc.sampler = desc.sampler;
+    uvDesc.debugName = "PlanarTexture_UV16";
+    
+    mHalfFloatPlanes = false;
+    auto* yTex = mContext->CreateTexture(yDesc);
+    if (!yTex) {
+        // 不支持 16 位归一化纹理，改用半精度平面（采样值范围相同）
+        yDesc.format = PixelFormat::R16F;
+        uvDesc.format = PixelFormat::RG16F;
+        yTex = mContext->CreateTexture(yDesc);
+        if (!yTex) return false;
+        mHalfFloatPlanes = true;
+        LRError::ClearError();
+    }
+    
+    auto* uvTex = mContext->CreateTexture(uvDesc);
+    if (!uvTex) {
+        delete yTex;
+        return false;
+    }
+    
+    mPlanes = {yTex, uvTex};
+    return true;
+}
+
 void LRPlanarTexture::releasePlanes() {
     for (auto* plane : mPlanes) {
         if (plane) {
@@ -179,8 +306,41 @@ LRTexture* LRPlanarTexture::GetPlaneTexture(uint32_t planeIndex) const {
     return mPlanes[planeIndex];
 }
 
-void LRPlanarTexture::UpdatePlaneData(uint32_t planeIndex, const void* data, uint32_t /*stride*/) {
-    if (planeIndex >= mPlanes.size() || !data) {
+void LRPlanarTexture::UpdatePlaneData(uint32_t planeIndex, const void* data, uint32_t stride) {
+    if (!data) {
+        return;
+    }
+    
+    if (mLayout == PlanarTextureLayout::Packed) {
+        // 逻辑平面 0/1 分别对应打包纹理的 Y 区域与 UV 区域（按逻辑平面更新时仍为两次上传）
+        if (planeIndex > 1 || mPlanes.empty()) {
+            return;
+        }
+        TextureRegion region;
+        region.y = planeIndex == 0 ? 0 : mHeight;
+        region.width = mWidth;
+        region.height = planeIndex == 0 ? mHeight : mHeight / 2;
+        
+        const void* src = data;
+        if (stride != 0 && stride != mWidth) {
+            const size_t rowBytes = mWidth;
+            mPackScratch.resize(rowBytes * region.height);
+            const uint8_t* srcRow = static_cast<const uint8_t*>(data);
+            for (uint32_t y = 0; y < region.height; ++y, srcRow += stride) {
+                std::memcpy(mPackScratch.data() + rowBytes * y, srcRow, rowBytes);
+            }
+            src = mPackScratch.data();
+        }
+        mPlanes[0]->UpdateData(src, &region);
+        return;
+    }
+    
+    if (planeIndex >= mPlanes.size()) {
+        return;
+    }
+    
+    if (mHalfFloatPlanes) {
+        uploadU16PlaneAsHalf(planeIndex, data, stride);
         return;
     }
     
@@ -188,9 +348,99 @@ void LRPlanarTexture::UpdatePlaneData(uint32_t planeIndex, const void* data, uin
     mPlanes[planeIndex]->UpdateData(data, nullptr);
 }
 
+void LRPlanarTexture::uploadU16PlaneAsHalf(uint32_t planeIndex, const void* data, uint32_t stride) {
+    if (planeIndex >= mPlanes.size() || !data) {
+        return;
+    }
+    
+    LRTexture* plane = mPlanes[planeIndex];
+    const uint32_t width = plane->GetWidth();
+    const uint32_t height = plane->GetHeight();
+    const size_t rowSamples = static_cast<size_t>(width) * (planeIndex == 0 ? 1 : 2);
+    const size_t srcStride = stride ? stride : rowSamples * sizeof(uint16_t);
+    
+    mConvertScratch.resize(rowSamples * height);
+    const uint8_t* srcRow = static_cast<const uint8_t*>(data);
+    for (uint32_t y = 0; y < height; ++y, srcRow += srcStride) {
+        utils::ConvertU16ToHalf(reinterpret_cast<const uint16_t*>(srcRow),
+                                mConvertScratch.data() + rowSamples * y, rowSamples);
+    }
+    plane->UpdateData(mConvertScratch.data(), nullptr);
+}
+
+bool LRPlanarTexture::uploadPacked(const ImageDataDesc& imageData) {
+    if (mPlanes.empty() || imageData.planes.size() < 2 || !imageData.planes[0].data || !imageData.planes[1].data) {
+        return false;
+    }
+    
+    const size_t rowBytes = mWidth;
+    const size_t yStride = imageData.planes[0].stride ? imageData.planes[0].stride : rowBytes;
+    const size_t uvStride = imageData.planes[1].stride ? imageData.planes[1].stride : rowBytes;
+    const uint8_t* yData = static_cast<const uint8_t*>(imageData.planes[0].data);
+    const uint8_t* uvData = static_cast<const uint8_t*>(imageData.planes[1].data);
+    
+    // 连续且紧密排列的 NV12 缓冲区与打包纹理内存布局一致，直接整帧上传
+    if (yStride == rowBytes && uvStride == rowBytes && uvData == yData + rowBytes * mHeight) {
+        mPlanes[0]->UpdateData(yData, nullptr);
+        return true;
+    }
+    
+    const uint32_t chromaRows = mHeight / 2;
+    mPackScratch.resize(rowBytes * (mHeight + chromaRows));
+    uint8_t* dst = mPackScratch.data();
+    for (uint32_t y = 0; y < mHeight; ++y, dst += rowBytes) {
+        std::memcpy(dst, yData + yStride * y, rowBytes);
+    }
+    for (uint32_t y = 0; y < chromaRows; ++y, dst += rowBytes) {
+        std::memcpy(dst, uvData + uvStride * y, rowBytes);
+    }
+    mPlanes[0]->UpdateData(mPackScratch.data(), nullptr);
+    return true;
+}
+
+const char* LRPlanarTexture::GetPackedSamplingSource() {
+    return R"(
+uniform sampler2D uPackedYUV;
+uniform vec2 uPackedSize;
+
+vec3 SamplePackedYUV(vec2 uv) {
+    // Y 区域占纹理的上 2/3，限制纵坐标避免线性过滤混入 UV 行
+    float packedHeight = uPackedSize.y * 1.5;
+    float yRow = clamp(uv.y * uPackedSize.y, 0.5, uPackedSize.y - 0.5);
+    float luma = texture(uPackedYUV, vec2(uv.x, yRow / packedHeight)).r;
+
+    // 色度像素 c 的两个字节位于第 (高 + c.y) 行的第 2c.x、2c.x + 1 列
+    ivec2 size = ivec2(uPackedSize);
+    ivec2 c = clamp(ivec2(uv * uPackedSize), ivec2(0), size - 1) / 2;
+    int row = size.y + c.y;
+    float c0 = texelFetch(uPackedYUV, ivec2(c.x * 2, row), 0).r;
+    float c1 = texelFetch(uPackedYUV, ivec2(c.x * 2 + 1, row), 0).r;
+    return vec3(luma, c0, c1);
+}
+)";
+}
+
 void LRPlanarTexture::UpdateAllPlanes(const std::vector<const void*>& planeData,
                                       const std::vector<uint32_t>& strides) {
-    size_t count = std::min(mPlanes.size(), planeData.size());
+    if (mLayout == PlanarTextureLayout::Packed) {
+        // Y 与 UV 同时给出时合并为一次整帧上传
+        if (planeData.size() >= 2 && planeData[0] && planeData[1]) {
+            ImageDataDesc imageData;
+            imageData.width = mWidth;
+            imageData.height = mHeight;
+            imageData.planes.resize(2);
+            for (size_t i = 0; i < 2; ++i) {
+                imageData.planes[i].data = planeData[i];
+                imageData.planes[i].stride = (i < strides.size()) ? strides[i] : 0;
+            }
+            uploadPacked(imageData);
+            return;
+        }
+    }
+    
+    // Packed 布局只有一个纹理，但仍按 Y/UV 两个逻辑平面更新
+    size_t logicalPlanes = (mLayout == PlanarTextureLayout::Packed) ? 2 : mPlanes.size();
+    size_t count = std::min(logicalPlanes, planeData.size());
     for (size_t i = 0; i < count; ++i) {
         if (planeData[i]) {
             uint32_t stride = (i < strides.size()) ? strides[i] : 0;
@@ -220,7 +470,13 @@ bool LRPlanarTexture::UpdateFromImage(const ImageDataDesc& imageData,
     switch (imageData.format) {
         case ImageFormat::NV12:
         case ImageFormat::NV21: {
-            if (imageData.planes.size() < 2 || mPlanes.size() < 2) {
+            if (mLayout == PlanarTextureLayout::Packed) {
+                if (!uploadPacked(imageData)) {
+                    return false;
+                }
+                break;
+            }
+            if (!hasPlaneData(imageData, 2) || mPlanes.size() < 2) {
                 return false;
             }
             UpdatePlaneData(0, imageData.planes[0].data, imageData.planes[0].stride);
@@ -228,7 +484,7 @@ bool LRPlanarTexture::UpdateFromImage(const ImageDataDesc& imageData,
             break;
         }
         case ImageFormat::YUV420P: {
-            if (imageData.planes.size() < 3 || mPlanes.size() < 3) {
+            if (!hasPlaneData(imageData, 3) || mPlanes.size() < 3) {
                 return false;
             }
             UpdatePlaneData(0, imageData.planes[0].data, imageData.planes[0].stride);
@@ -236,11 +492,32 @@ bool LRPlanarTexture::UpdateFromImage(const ImageDataDesc& imageData,
             UpdatePlaneData(2, imageData.planes[2].data, imageData.planes[2].stride);
             break;
         }
+        case ImageFormat::P010:
+        case ImageFormat::P016: {
+            // P010 低 6 位为 0，与 P016 共用 16 位平面
+            if (!hasPlaneData(imageData, 2) || mPlanes.size() < 2 ||
+                (mFormat != PlanarFormat::P010 && mFormat != PlanarFormat::P016)) {
+                return false;
+            }
+            UpdatePlaneData(0, imageData.planes[0].data, imageData.planes[0].stride);
+            UpdatePlaneData(1, imageData.planes[1].data, imageData.planes[1].stride);
+            break;
+        }
+        case ImageFormat::RGB10A2:
+        case ImageFormat::RGBA16F: {
+            PlanarFormat expected = (imageData.format == ImageFormat::RGB10A2) ? PlanarFormat::RGB10A2
+                                                                              : PlanarFormat::RGBA16F;
+            if (!hasPlaneData(imageData, 1) || mPlanes.empty() || mFormat != expected) {
+                return false;
+            }
+            UpdatePlaneData(0, imageData.planes[0].data, imageData.planes[0].stride);
+            break;
+        }
         case ImageFormat::RGBA8:
         case ImageFormat::BGRA8:
         case ImageFormat::RGB8:
         case ImageFormat::GRAY8: {
-            if (mPlanes.empty()) {
+            if (!hasPlaneData(imageData, 1) || mPlanes.empty()) {
                 return false;
             }
             UpdatePlaneData(0, imageData.planes[0].data, imageData.planes[0].stride);
@@ -329,6 +606,11 @@ bool LRPlanarTexture::Readback(ReadbackResult& outResult, const ReadbackOptions&
     if (!mIsValid || mPlanes.empty()) {
         return false;
     }
+    
+    // Packed 布局的单个纹理不是 RGBA 类平面，与多平面格式一样暂不支持回读
+    if (mLayout == PlanarTextureLayout::Packed) {
+        return false;
+    }
 
     // 确定目标格式（默认使用当前纹理格式）
     ImageFormat targetFormat = options.targetFormat;
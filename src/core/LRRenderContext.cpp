@@ -13,6 +13,7 @@
 #include "lrengine/core/LRFence.h"
 #include "lrengine/core/LRError.h"
 #include "lrengine/utils/LRLog.h"
+#include "lrengine/utils/ImageBufferPool.h"
 #include "lrengine/factory/LRDeviceFactory.h"
 #include "platform/interface/IRenderContextImpl.h"
 #include "platform/interface/IBufferImpl.h"
@@ -21,6 +22,10 @@
 #include "platform/interface/IFrameBufferImpl.h"
 #include "platform/interface/IPipelineStateImpl.h"
 #include "platform/interface/IFenceImpl.h"
+#include "platform/StaticBackend.h"
+
+#include <algorithm>
+#include <iterator>
 
 namespace lrengine {
 namespace render {
@@ -61,7 +66,7 @@ bool LRRenderContext::Initialize(const RenderContextDescriptor& desc) {
     }
 
     // 初始化
-    if (!mImpl->Initialize(desc)) {
+    if (!BackendCast(mImpl)->Initialize(desc)) {
         LR_SET_ERROR(ErrorCode::ContextCreationFailed, "Failed to initialize render context");
         delete mImpl;
         mImpl = nullptr;
@@ -72,12 +77,15 @@ bool LRRenderContext::Initialize(const RenderContextDescriptor& desc) {
     mWidth   = desc.width;
     mHeight  = desc.height;
 
+    mVertexStatePerBuffer = BackendCast(mImpl)->IsVertexStatePerBuffer();
+    InvalidateBindingCache();
+
     return true;
 }
 
 void LRRenderContext::Shutdown() {
     if (mImpl) {
-        mImpl->Shutdown();
+        BackendCast(mImpl)->Shutdown();
         delete mImpl;
         mImpl = nullptr;
     }
@@ -93,7 +101,7 @@ LRBuffer* LRRenderContext::CreateBuffer(const BufferDescriptor& desc) {
         return nullptr;
     }
 
-    IBufferImpl* impl = mImpl->CreateBufferImpl();
+    IBufferImpl* impl = BackendCast(mImpl)->CreateBufferImpl();
     if (!impl) {
         return nullptr;
     }
@@ -113,7 +121,7 @@ LRVertexBuffer* LRRenderContext::CreateVertexBuffer(const BufferDescriptor& desc
         return nullptr;
     }
 
-    IBufferImpl* impl = mImpl->CreateBufferImpl(BufferType::Vertex);
+    IBufferImpl* impl = BackendCast(mImpl)->CreateBufferImpl(BufferType::Vertex);
     if (!impl) {
         return nullptr;
     }
@@ -133,7 +141,7 @@ LRIndexBuffer* LRRenderContext::CreateIndexBuffer(const BufferDescriptor& desc)
         return nullptr;
     }
 
-    IBufferImpl* impl = mImpl->CreateBufferImpl(BufferType::Index);
+    IBufferImpl* impl = BackendCast(mImpl)->CreateBufferImpl(BufferType::Index);
     if (!impl) {
         return nullptr;
     }
@@ -153,7 +161,7 @@ LRUniformBuffer* LRRenderContext::CreateUniformBuffer(const BufferDescriptor& de
         return nullptr;
     }
 
-    IBufferImpl* impl = mImpl->CreateBufferImpl(BufferType::Uniform);
+    IBufferImpl* impl = BackendCast(mImpl)->CreateBufferImpl(BufferType::Uniform);
     if (!impl) {
         return nullptr;
     }
@@ -173,7 +181,7 @@ LRShader* LRRenderContext::CreateShader(const ShaderDescriptor& desc) {
         return nullptr;
     }
 
-    IShaderImpl* impl = mImpl->CreateShaderImpl();
+    IShaderImpl* impl = BackendCast(mImpl)->CreateShaderImpl();
     if (!impl) {
         return nullptr;
     }
@@ -195,7 +203,7 @@ LRShaderProgram* LRRenderContext::CreateShaderProgram(LRShader* vertexShader,
         return nullptr;
     }
 
-    IShaderProgramImpl* impl = mImpl->CreateShaderProgramImpl();
+    IShaderProgramImpl* impl = BackendCast(mImpl)->CreateShaderProgramImpl();
     if (!impl) {
         return nullptr;
     }
@@ -215,7 +223,7 @@ LRTexture* LRRenderContext::CreateTexture(const TextureDescriptor& desc) {
         return nullptr;
     }
 
-    ITextureImpl* impl = mImpl->CreateTextureImpl();
+    ITextureImpl* impl = BackendCast(mImpl)->CreateTextureImpl();
     if (!impl) {
         return nullptr;
     }
@@ -250,7 +258,7 @@ LRFrameBuffer* LRRenderContext::CreateFrameBuffer(const FrameBufferDescriptor& d
         return nullptr;
     }
 
-    IFrameBufferImpl* impl = mImpl->CreateFrameBufferImpl();
+    IFrameBufferImpl* impl = BackendCast(mImpl)->CreateFrameBufferImpl();
     if (!impl) {
         return nullptr;
     }
@@ -279,7 +287,7 @@ LRPipelineState* LRRenderContext::CreatePipelineState(const PipelineStateDescrip
         }
     }
 
-    IPipelineStateImpl* impl = mImpl->CreatePipelineStateImpl();
+    IPipelineStateImpl* impl = BackendCast(mImpl)->CreatePipelineStateImpl();
     if (!impl) {
         if (program) program->Release();
         return nullptr;
@@ -301,7 +309,7 @@ LRFence* LRRenderContext::CreateFence() {
         return nullptr;
     }
 
-    IFenceImpl* impl = mImpl->CreateFenceImpl();
+    IFenceImpl* impl = BackendCast(mImpl)->CreateFenceImpl();
     if (!impl) {
         return nullptr;
     }
@@ -320,20 +328,28 @@ LRFence* LRRenderContext::CreateFence() {
 // =============================================================================
 
 void LRRenderContext::BeginFrame() {
+    int pendingTrim = mPendingTrimLevel.exchange(kNoPendingTrim);
+    if (pendingTrim != kNoPendingTrim) {
+        TrimMemory(static_cast<MemoryTrimLevel>(pendingTrim));
+    }
+
+    InvalidateBindingCache();
     if (mImpl) {
-        mImpl->BeginFrame();
+        BackendCast(mImpl)->BeginFrame();
     }
 }
 
 void LRRenderContext::EndFrame() {
+    InvalidateBindingCache();
     if (mImpl) {
-        mImpl->EndFrame();
+        BackendCast(mImpl)->EndFrame();
     }
 }
 
 void LRRenderContext::Present() {
+    InvalidateBindingCache();
     if (mImpl) {
-        mImpl->SwapBuffers();
+        BackendCast(mImpl)->SwapBuffers();
     }
 }
 
@@ -344,10 +360,13 @@ void LRRenderContext::Present() {
 void LRRenderContext::BeginRenderPass(LRFrameBuffer* frameBuffer) {
     mCurrentFrameBuffer = frameBuffer;
 
+    // Metal等后端的绑定属于渲染通道编码器，新通道开始时全部失效
+    InvalidateBindingCache();
+
     // 调用后端实现（Metal后端会使用此方法创建渲染通道）
     if (mImpl) {
         IFrameBufferImpl* fbImpl = frameBuffer ? frameBuffer->GetImpl() : nullptr;
-        mImpl->BeginRenderPass(fbImpl);
+        BackendCast(mImpl)->BeginRenderPass(fbImpl);
     }
 
     // 注意：不再调用frameBuffer->Bind()，避免在Metal后端重复创建渲染通道
@@ -357,11 +376,12 @@ void LRRenderContext::BeginRenderPass(LRFrameBuffer* frameBuffer) {
 void LRRenderContext::EndRenderPass() {
     // 调用后端实现
     if (mImpl) {
-        mImpl->EndRenderPass();
+        BackendCast(mImpl)->EndRenderPass();
     }
 
     // 注意：不再调用frameBuffer->Unbind()，避免在Metal后端重复操作
     mCurrentFrameBuffer = nullptr;
+    InvalidateBindingCache();
 }
 
 // =============================================================================
@@ -370,81 +390,161 @@ void LRRenderContext::EndRenderPass() {
 
 void LRRenderContext::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height) {
     if (mImpl) {
-        mImpl->SetViewport(x, y, width, height);
+        BackendCast(mImpl)->SetViewport(x, y, width, height);
     }
 }
 
 void LRRenderContext::SetScissor(int32_t x, int32_t y, int32_t width, int32_t height) {
     if (mImpl) {
-        mImpl->SetScissor(x, y, width, height);
+        BackendCast(mImpl)->SetScissor(x, y, width, height);
     }
 }
 
 void LRRenderContext::SetPipelineState(LRPipelineState* pipelineState) {
     mCurrentPipelineState = pipelineState;
+    if (!pipelineState) {
+        return;
+    }
 
-    if (pipelineState) {
-        // pipelineState->Apply();     ///< TODO有点多余
-        mCurrentPrimitiveType = pipelineState->GetPrimitiveType();
+    validateBindingCache(BindingScope::Pipeline);
+    if (mBindingCache.pipelineState == pipelineState->GetResourceID()) {
+        return;
+    }
 
-        // 使用着色器程序
-        if (pipelineState->GetShaderProgram()) {
-            pipelineState->GetShaderProgram()->Use();
-        }
+    mCurrentPrimitiveType = pipelineState->GetPrimitiveType();
 
-        // 通知后端绑定管线状态
-        if (mImpl && pipelineState->GetImpl()) {
-            mImpl->BindPipelineState(pipelineState->GetImpl());
-        }
+    // 使用着色器程序（直接调用实现，不触发绑定版本变化）
+    LRShaderProgram* program = pipelineState->GetShaderProgram();
+    if (program && program->GetImpl()) {
+        BackendCast(program->GetImpl())->Use();
     }
+
+    // 通知后端绑定管线状态
+    if (mImpl && pipelineState->GetImpl()) {
+        BackendCast(mImpl)->BindPipelineState(pipelineState->GetImpl());
+    }
+    mBindingCache.pipelineState = pipelineState->GetResourceID();
 }
 
 void LRRenderContext::SetVertexBuffer(LRVertexBuffer* buffer, uint32_t slot) {
+    if (!buffer || !mImpl || !buffer->GetImpl()) {
+        return;
+    }
+
+    validateBindingCache(BindingScope::VertexInput);
+    const uint64_t id = buffer->GetResourceID();
+    // OpenGL的VAO属于缓冲区而非槽位：绑定任一槽位都会替换整个顶点输入状态
+    uint64_t* cached = nullptr;
+    if (mVertexStatePerBuffer) {
+        cached = &mBindingCache.vertexState;
+    } else if (slot < kMaxCachedVertexBuffers) {
+        cached = &mBindingCache.vertexBuffers[slot];
+    }
+    if (cached) {
+        if (*cached == id) {
+            return;
+        }
+        *cached = id;
+    }
+
     LR_LOG_TRACE_F("LRRenderContext::SetVertexBuffer: %p, slot=%u", buffer, slot);
-    if (buffer) {
-        // buffer->Bind(); //TODO 有点多余
+    BackendCast(mImpl)->BindVertexBuffer(buffer->GetImpl(), slot);
 
-        // 通知后端绑定顶点缓冲区
-        if (mImpl && buffer->GetImpl()) {
-            mImpl->BindVertexBuffer(buffer->GetImpl(), slot);
-        }
+    // 索引缓冲绑定属于VAO状态，切换VAO后需重新绑定
+    if (mVertexStatePerBuffer) {
+        mBindingCache.indexBuffer = 0;
     }
 }
 
 void LRRenderContext::SetIndexBuffer(LRIndexBuffer* buffer) {
-    if (buffer) {
-        // buffer->Bind();
-        mCurrentIndexType = buffer->GetIndexType();
+    if (!buffer) {
+        return;
+    }
 
-        // 通知后端绑定索引缓冲区
-        if (mImpl && buffer->GetImpl()) {
-            mImpl->BindIndexBuffer(buffer->GetImpl());
-        }
+    validateBindingCache(BindingScope::VertexInput);
+    mCurrentIndexType = buffer->GetIndexType();
+    if (mBindingCache.indexBuffer == buffer->GetResourceID()) {
+        return;
+    }
+
+    // 通知后端绑定索引缓冲区
+    if (mImpl && buffer->GetImpl()) {
+        BackendCast(mImpl)->BindIndexBuffer(buffer->GetImpl());
+        mBindingCache.indexBuffer = buffer->GetResourceID();
     }
 }
 
 void LRRenderContext::SetUniformBuffer(LRUniformBuffer* buffer, uint32_t slot) {
-    if (buffer) {
-        buffer->SetBindingPoint(slot);
-        buffer->Bind();
-        // 通知后端实现进行实际绑定
-        if (mImpl) {
-            mImpl->BindUniformBuffer(buffer->GetImpl(), slot);
+    if (!buffer || !mImpl) {
+        return;
+    }
+
+    validateBindingCache(BindingScope::UniformBuffer);
+    const uint64_t id = buffer->GetResourceID();
+    if (slot < kMaxCachedUniformBuffers) {
+        if (mBindingCache.uniformBuffers[slot] == id) {
+            return;
         }
+        mBindingCache.uniformBuffers[slot] = id;
     }
+
+    // 后端BindUniformBuffer已完成槽位绑定，无需再调用buffer->Bind()
+    buffer->SetBindingPoint(slot);
+    BackendCast(mImpl)->BindUniformBuffer(buffer->GetImpl(), slot);
 }
 
 void LRRenderContext::SetTexture(LRTexture* texture, uint32_t slot) {
-    LR_LOG_TRACE_F("LRRenderContext::SetTexture: %p, slot=%u", texture, slot);
-    if (texture) {
-        // texture->Bind(slot);
-        // 通知后端实现进行实际绑定
-        if (mImpl) {
-            mImpl->BindTexture(texture->GetImpl(), slot);
+    if (!texture || !mImpl) {
+        return;
+    }
+
+    validateBindingCache(BindingScope::Texture);
+    const uint64_t id = texture->GetResourceID();
+    if (slot < kMaxCachedTextures) {
+        if (mBindingCache.textures[slot] == id) {
+            return;
         }
+        mBindingCache.textures[slot] = id;
+    }
+
+    LR_LOG_TRACE_F("LRRenderContext::SetTexture: %p, slot=%u", texture, slot);
+    BackendCast(mImpl)->BindTexture(texture->GetImpl(), slot);
+}
+
+void LRRenderContext::InvalidateBindingCache() {
+    for (size_t i = 0; i < static_cast<size_t>(BindingScope::Count); ++i) {
+        resetBindingCache(static_cast<BindingScope>(i));
+    }
+}
+
+void LRRenderContext::validateBindingCache(BindingScope scope) {
+    if (mBindingEpochs[static_cast<size_t>(scope)] != LRResource::GetBindingEpoch(scope)) {
+        resetBindingCache(scope);
     }
 }
 
+void LRRenderContext::resetBindingCache(BindingScope scope) {
+    switch (scope) {
+        case BindingScope::Pipeline:
+            mBindingCache.pipelineState = 0;
+            break;
+        case BindingScope::VertexInput:
+            mBindingCache.indexBuffer = 0;
+            mBindingCache.vertexState = 0;
+            std::fill(std::begin(mBindingCache.vertexBuffers), std::end(mBindingCache.vertexBuffers), 0);
+            break;
+        case BindingScope::UniformBuffer:
+            std::fill(std::begin(mBindingCache.uniformBuffers), std::end(mBindingCache.uniformBuffers), 0);
+            break;
+        case BindingScope::Texture:
+            std::fill(std::begin(mBindingCache.textures), std::end(mBindingCache.textures), 0);
+            break;
+        default:
+            break;
+    }
+    mBindingEpochs[static_cast<size_t>(scope)] = LRResource::GetBindingEpoch(scope);
+}
+
 // =============================================================================
 // 清除
 // =============================================================================
@@ -452,19 +552,19 @@ void LRRenderContext::SetTexture(LRTexture* texture, uint32_t slot) {
 void LRRenderContext::ClearColor(float r, float g, float b, float a) {
     float color[4] = {r, g, b, a};
     if (mImpl) {
-        mImpl->Clear(ClearFlag_Color, color, 1.0f, 0);
+        BackendCast(mImpl)->Clear(ClearFlag_Color, color, 1.0f, 0);
     }
 }
 
 void LRRenderContext::ClearDepth(float depth) {
     if (mImpl) {
-        mImpl->Clear(ClearFlag_Depth, nullptr, depth, 0);
+        BackendCast(mImpl)->Clear(ClearFlag_Depth, nullptr, depth, 0);
     }
 }
 
 void LRRenderContext::ClearStencil(uint8_t stencil) {
     if (mImpl) {
-        mImpl->Clear(ClearFlag_Stencil, nullptr, 1.0f, stencil);
+        BackendCast(mImpl)->Clear(ClearFlag_Stencil, nullptr, 1.0f, stencil);
     }
 }
 
@@ -472,7 +572,7 @@ void LRRenderContext::Clear(uint8_t flags, float r, float g, float b, float a, f
     // LR_LOG_TRACE("LRRenderContext::Clear");
     float color[4] = {r, g, b, a};
     if (mImpl) {
-        mImpl->Clear(flags, color, depth, stencil);
+        BackendCast(mImpl)->Clear(flags, color, depth, stencil);
     }
 }
 
@@ -483,14 +583,22 @@ void LRRenderContext::Clear(uint8_t flags, float r, float g, float b, float a, f
 void LRRenderContext::Draw(uint32_t vertexStart, uint32_t vertexCount) {
     LR_LOG_TRACE_F("LRRenderContext::Draw: start=%u, count=%u", vertexStart, vertexCount);
     if (mImpl) {
-        mImpl->DrawArrays(mCurrentPrimitiveType, vertexStart, vertexCount);
+        BackendCast(mImpl)->DrawArrays(mCurrentPrimitiveType, vertexStart, vertexCount);
+    }
+}
+
+void LRRenderContext::DrawWithoutVertexInput(uint32_t vertexStart, uint32_t vertexCount) {
+    if (mImpl) {
+        BackendCast(mImpl)->DrawArraysWithoutVertexInput(mCurrentPrimitiveType, vertexStart, vertexCount);
+        // 后端可能切换了当前顶点输入状态（OpenGL 默认VAO）
+        resetBindingCache(BindingScope::VertexInput);
     }
 }
 
 void LRRenderContext::DrawIndexed(uint32_t indexStart, uint32_t indexCount) {
     if (mImpl) {
         size_t offset = indexStart * (mCurrentIndexType == IndexType::UInt16 ? 2 : 4);
-        mImpl->DrawElements(mCurrentPrimitiveType, indexCount, mCurrentIndexType, offset);
+        BackendCast(mImpl)->DrawElements(mCurrentPrimitiveType, indexCount, mCurrentIndexType, offset);
     }
 }
 
@@ -498,7 +606,7 @@ void LRRenderContext::DrawInstanced(uint32_t vertexStart,
                                     uint32_t vertexCount,
                                     uint32_t instanceCount) {
     if (mImpl) {
-        mImpl->DrawArraysInstanced(mCurrentPrimitiveType, vertexStart, vertexCount, instanceCount);
+        BackendCast(mImpl)->DrawArraysInstanced(mCurrentPrimitiveType, vertexStart, vertexCount, instanceCount);
     }
 }
 
@@ -507,7 +615,7 @@ void LRRenderContext::DrawIndexedInstanced(uint32_t indexStart,
                                            uint32_t instanceCount) {
     if (mImpl) {
         size_t offset = indexStart * (mCurrentIndexType == IndexType::UInt16 ? 2 : 4);
-        mImpl->DrawElementsInstanced(mCurrentPrimitiveType, indexCount, mCurrentIndexType, offset,
+        BackendCast(mImpl)->DrawElementsInstanced(mCurrentPrimitiveType, indexCount, mCurrentIndexType, offset,
                                      instanceCount);
     }
 }
@@ -518,19 +626,94 @@ void LRRenderContext::DrawIndexedInstanced(uint32_t indexStart,
 
 void LRRenderContext::WaitIdle() {
     if (mImpl) {
-        mImpl->WaitIdle();
+        BackendCast(mImpl)->WaitIdle();
     }
 }
 
 void LRRenderContext::Flush() {
     if (mImpl) {
-        mImpl->Flush();
+        BackendCast(mImpl)->Flush();
+    }
+}
+
+uint32_t LRRenderContext::GetMaxTextureSize() const {
+    return mImpl ? BackendCast(mImpl)->GetMaxTextureSize() : 0;
+}
+
+// =============================================================================
+// 内存管理
+// =============================================================================
+
+size_t LRRenderContext::TrimMemory(MemoryTrimLevel level) {
+    // 执行期间持锁，其他线程的 Unregister 返回后回调不会再被调用；
+    // 按ID逐个查找，回调中注册/注销（递归锁）不会使遍历失效
+    std::lock_guard<std::recursive_mutex> lock(mTrimMutex);
+    std::vector<uint32_t> handlerIDs;
+    handlerIDs.reserve(mTrimHandlers.size());
+    for (const auto& entry : mTrimHandlers) {
+        handlerIDs.push_back(entry.first);
+    }
+
+    size_t released = 0;
+    for (uint32_t id : handlerIDs) {
+        auto it = std::find_if(mTrimHandlers.begin(), mTrimHandlers.end(),
+                               [id](const std::pair<uint32_t, MemoryTrimHandler>& entry) { return entry.first == id; });
+        if (it == mTrimHandlers.end()) {
+            continue;
+        }
+        // 拷贝一份再调用，回调注销自身时不会销毁正在执行的函数对象
+        MemoryTrimHandler handler = it->second;
+        released += handler(level);
+    }
+
+    if (mImpl) {
+        released += BackendCast(mImpl)->TrimMemory(level);
+    }
+
+    LR_LOG_INFO_F("LRRenderContext::TrimMemory: level=%d, released %zu objects",
+                  static_cast<int>(level), released);
+    return released;
+}
+
+void LRRenderContext::RequestMemoryTrim(MemoryTrimLevel level) {
+    int requested = static_cast<int>(level);
+    int pending = mPendingTrimLevel.load();
+    while (pending < requested && !mPendingTrimLevel.compare_exchange_weak(pending, requested)) {
+    }
+}
+
+uint32_t LRRenderContext::RegisterMemoryTrimHandler(MemoryTrimHandler handler) {
+    if (!handler) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Memory trim handler is empty");
+        return 0;
+    }
+    std::lock_guard<std::recursive_mutex> lock(mTrimMutex);
+    uint32_t id = mNextTrimHandlerID++;
+    mTrimHandlers.emplace_back(id, std::move(handler));
+    return id;
+}
+
+uint32_t LRRenderContext::RegisterImageBufferPool(utils::ImageBufferPool* pool) {
+    if (!pool) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Image buffer pool is null");
+        return 0;
+    }
+    return RegisterMemoryTrimHandler([pool](MemoryTrimLevel level) { return pool->Trim(level); });
+}
+
+void LRRenderContext::UnregisterMemoryTrimHandler(uint32_t handlerID) {
+    std::lock_guard<std::recursive_mutex> lock(mTrimMutex);
+    for (auto it = mTrimHandlers.begin(); it != mTrimHandlers.end(); ++it) {
+        if (it->first == handlerID) {
+            mTrimHandlers.erase(it);
+            return;
+        }
     }
 }
 
 void LRRenderContext::MakeCurrent() {
     if (mImpl) {
-        mImpl->MakeCurrent();
+        BackendCast(mImpl)->MakeCurrent();
     }
 }
 
@@ -0,0 +1,159 @@
+/**
+ * @file LRRenderTargetPool.cpp
+ * @brief LREngine 渲染目标池实现
+ */
+
+#include "lrengine/core/LRRenderTargetPool.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRFrameBuffer.h"
+#include "lrengine/core/LRError.h"
+
+namespace lrengine {
+namespace render {
+
+LRRenderTargetPool::~LRRenderTargetPool() { Release(); }
+
+bool LRRenderTargetPool::Initialize(LRRenderContext* context) {
+    if (!context) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render context is null");
+        return false;
+    }
+
+    Release();
+    mContext = context;
+    mTrimHandlerID = mContext->RegisterMemoryTrimHandler([this](MemoryTrimLevel level) { return Trim(level); });
+    return true;
+}
+
+PooledRenderTarget* LRRenderTargetPool::Acquire(uint32_t width, uint32_t height, PixelFormat format) {
+    if (!mContext) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Render target pool not initialized");
+        return nullptr;
+    }
+    if (width == 0 || height == 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render target size must be non-zero");
+        return nullptr;
+    }
+
+    for (const std::unique_ptr<Entry>& entry : mEntries) {
+        const PooledRenderTarget& target = entry->target;
+        if (!entry->inUse && target.width == width && target.height == height && target.format == format) {
+            entry->inUse = true;
+            entry->usedSinceTrim = true;
+            return &entry->target;
+        }
+    }
+
+    TextureDescriptor textureDesc;
+    textureDesc.width = width;
+    textureDesc.height = height;
+    textureDesc.format = format;
+    textureDesc.mipLevels = 1;
+    textureDesc.sampler.minFilter = FilterMode::Linear;
+    textureDesc.sampler.magFilter = FilterMode::Linear;
+    textureDesc.sampler.wrapU = WrapMode::ClampToEdge;
+    textureDesc.sampler.wrapV = WrapMode::ClampToEdge;
+    textureDesc.debugName = "PooledRenderTarget";
+
+    FrameBufferDescriptor frameBufferDesc;
+    frameBufferDesc.width = width;
+    frameBufferDesc.height = height;
+    frameBufferDesc.hasDepthStencil = false;
+    ColorAttachmentDescriptor colorAttachment;
+    colorAttachment.format = format;
+    colorAttachment.loadOp = LoadOp::DontCare;
+    frameBufferDesc.colorAttachments.push_back(colorAttachment);
+    frameBufferDesc.debugName = "PooledRenderTarget";
+
+    std::unique_ptr<Entry> entry(new Entry());
+    PooledRenderTarget& target = entry->target;
+    target.width = width;
+    target.height = height;
+    target.format = format;
+    target.texture = mContext->CreateTexture(textureDesc);
+    target.frameBuffer = target.texture ? mContext->CreateFrameBuffer(frameBufferDesc) : nullptr;
+    if (!target.frameBuffer) {
+        destroyTarget(target);
+        return nullptr;
+    }
+
+    target.frameBuffer->AttachColorTexture(target.texture, 0);
+    if (!target.frameBuffer->IsComplete()) {
+        LR_SET_ERROR(ErrorCode::FrameBufferIncomplete, "Pooled render target is incomplete (format not renderable?)");
+        destroyTarget(target);
+        return nullptr;
+    }
+
+    entry->inUse = true;
+    entry->usedSinceTrim = true;
+    mEntries.push_back(std::move(entry));
+    return &mEntries.back()->target;
+}
+
+void LRRenderTargetPool::Recycle(PooledRenderTarget* target) {
+    if (!target) {
+        return;
+    }
+    for (const std::unique_ptr<Entry>& entry : mEntries) {
+        if (&entry->target == target) {
+            entry->inUse = false;
+            return;
+        }
+    }
+    LR_SET_ERROR(ErrorCode::InvalidArgument, "Render target does not belong to this pool");
+}
+
+size_t LRRenderTargetPool::Trim(MemoryTrimLevel level) {
+    size_t released = 0;
+    auto it = mEntries.begin();
+    while (it != mEntries.end()) {
+        Entry& entry = **it;
+        if (!entry.inUse && (level != MemoryTrimLevel::Low || !entry.usedSinceTrim)) {
+            destroyTarget(entry.target);
+            it = mEntries.erase(it);
+            ++released;
+        } else {
+            entry.usedSinceTrim = entry.inUse;
+            ++it;
+        }
+    }
+    return released;
+}
+
+size_t LRRenderTargetPool::GetIdleCount() const {
+    size_t count = 0;
+    for (const std::unique_ptr<Entry>& entry : mEntries) {
+        if (!entry->inUse) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void LRRenderTargetPool::destroyTarget(PooledRenderTarget& target) {
+    if (target.frameBuffer) {
+        target.frameBuffer->Release();
+        target.frameBuffer = nullptr;
+    }
+    if (target.texture) {
+        target.texture->Release();
+        target.texture = nullptr;
+    }
+}
+
+void LRRenderTargetPool::Release() {
+    for (const std::unique_ptr<Entry>& entry : mEntries) {
+        destroyTarget(entry->target);
+    }
+    mEntries.clear();
+
+    if (mContext && mTrimHandlerID != 0) {
+        mContext->UnregisterMemoryTrimHandler(mTrimHandlerID);
+    }
+    mTrimHandlerID = 0;
+    mContext = nullptr;
+}
+
+} // namespace render
+} // namespace lrengine
@@ -13,6 +13,8 @@ namespace render {
 namespace {
 // 全局资源ID计数器
 std::atomic<uint64_t> s_resourceIDCounter {1};
+// 各范围的全局绑定版本号
+std::atomic<uint64_t> s_bindingEpochs[static_cast<size_t>(BindingScope::Count)] = {};
 } // namespace
 
 LRResource::LRResource(ResourceType type)
@@ -64,5 +66,13 @@ uint64_t LRResource::GenerateResourceID() {
     return s_resourceIDCounter.fetch_add(1, std::memory_order_relaxed);
 }
 
+uint64_t LRResource::GetBindingEpoch(BindingScope scope) {
+    return s_bindingEpochs[static_cast<size_t>(scope)].load(std::memory_order_relaxed);
+}
+
+void LRResource::InvalidateBindings(BindingScope scope) {
+    s_bindingEpochs[static_cast<size_t>(scope)].fetch_add(1, std::memory_order_relaxed);
+}
+
 } // namespace render
 } // namespace lrengine
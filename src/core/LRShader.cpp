@@ -5,13 +5,17 @@
 
 #include "lrengine/core/LRShader.h"
 #include "lrengine/core/LRError.h"
+#include "lrengine/utils/LRLog.h"
 #include "platform/interface/IShaderImpl.h"
+#include "platform/StaticBackend.h"
 #include "lrengine/math/Vec2.hpp"
 #include "lrengine/math/Vec3.hpp"
 #include "lrengine/math/Vec4.hpp"
 #include "lrengine/math/Mat3.hpp"
 #include "lrengine/math/Mat4.hpp"
 
+#include <initializer_list>
+
 namespace lrengine {
 namespace render {
 
@@ -23,7 +27,7 @@ LRShader::LRShader() : LRResource(ResourceType::Shader) {}
 
 LRShader::~LRShader() {
     if (mImpl) {
-        mImpl->Destroy();
+        BackendCast(mImpl)->Destroy();
         delete mImpl;
         mImpl = nullptr;
     }
@@ -38,8 +42,24 @@ bool LRShader::Initialize(IShaderImpl* impl, const ShaderDescriptor& desc) {
     mImpl  = impl;
     mStage = desc.stage;
 
-    if (!mImpl->Compile(desc)) {
-        mCompileError = mImpl->GetCompileError();
+    // 后端不支持SPIR-V时改为编译GLSL回退源码
+    ShaderDescriptor compileDesc = desc;
+    if (desc.language == ShaderLanguage::SPIRV && !BackendCast(mImpl)->SupportsSPIRV()) {
+        if (desc.fallbackSource == nullptr) {
+            mCompileError = "SPIR-V is not supported by this backend and no GLSL fallback was provided";
+            LR_SET_ERROR(ErrorCode::NotSupported, mCompileError.c_str());
+            delete mImpl;
+            mImpl = nullptr;
+            return false;
+        }
+        LR_LOG_DEBUG("SPIR-V not supported by backend, compiling GLSL fallback");
+        compileDesc.language = ShaderLanguage::GLSL;
+        compileDesc.source = desc.fallbackSource;
+        compileDesc.sourceLength = 0;
+    }
+
+    if (!BackendCast(mImpl)->Compile(compileDesc)) {
+        mCompileError = BackendCast(mImpl)->GetCompileError();
         LR_SET_ERROR(ErrorCode::ShaderCompileFailed, mCompileError.c_str());
         delete mImpl;
         mImpl = nullptr;
@@ -55,13 +75,13 @@ bool LRShader::Initialize(IShaderImpl* impl, const ShaderDescriptor& desc) {
     return true;
 }
 
-bool LRShader::IsCompiled() const { return mImpl && mImpl->IsCompiled(); }
+bool LRShader::IsCompiled() const { return mImpl && BackendCast(mImpl)->IsCompiled(); }
 
 const char* LRShader::GetCompileError() const { return mCompileError.c_str(); }
 
 ResourceHandle LRShader::GetNativeHandle() const {
     if (mImpl) {
-        return mImpl->GetNativeHandle();
+        return BackendCast(mImpl)->GetNativeHandle();
     }
     return ResourceHandle();
 }
@@ -74,10 +94,17 @@ LRShaderProgram::LRShaderProgram() : LRResource(ResourceType::Shader) {}
 
 LRShaderProgram::~LRShaderProgram() {
     if (mImpl) {
-        mImpl->Destroy();
+        BackendCast(mImpl)->Destroy();
         delete mImpl;
         mImpl = nullptr;
     }
+
+    // 程序管线直接引用各阶段程序，着色器需在程序之后释放
+    for (LRShader* shader : {mVertexShader, mFragmentShader, mGeometryShader}) {
+        if (shader) {
+            shader->Release();
+        }
+    }
 }
 
 bool LRShaderProgram::Initialize(IShaderProgramImpl* impl,
@@ -112,25 +139,35 @@ bool LRShaderProgram::Initialize(IShaderProgramImpl* impl,
         shaderImpls.push_back(geometryShader->GetImpl());
     }
 
-    if (!mImpl->Link(shaderImpls.data(), static_cast<uint32_t>(shaderImpls.size()))) {
-        mLinkError = mImpl->GetLinkError();
+    if (!BackendCast(mImpl)->Link(shaderImpls.data(), static_cast<uint32_t>(shaderImpls.size()))) {
+        mLinkError = BackendCast(mImpl)->GetLinkError();
         LR_SET_ERROR(ErrorCode::ShaderLinkFailed, mLinkError.c_str());
         delete mImpl;
         mImpl = nullptr;
+        mVertexShader   = nullptr;
+        mFragmentShader = nullptr;
+        mGeometryShader = nullptr;
         return false;
     }
 
+    for (LRShader* shader : {mVertexShader, mFragmentShader, mGeometryShader}) {
+        if (shader) {
+            shader->AddRef();
+        }
+    }
+
     mIsValid = true;
     return true;
 }
 
-bool LRShaderProgram::IsLinked() const { return mImpl && mImpl->IsLinked(); }
+bool LRShaderProgram::IsLinked() const { return mImpl && BackendCast(mImpl)->IsLinked(); }
 
 const char* LRShaderProgram::GetLinkError() const { return mLinkError.c_str(); }
 
 void LRShaderProgram::Use() {
     if (mImpl && mIsValid) {
-        mImpl->Use();
+        InvalidateBindings(BindingScope::Pipeline);
+        BackendCast(mImpl)->Use();
     }
 }
 
@@ -146,7 +183,7 @@ int32_t LRShaderProgram::GetUniformLocation(const char* name) {
     }
 
     // 查询并缓存
-    int32_t location            = mImpl->GetUniformLocation(name);
+    int32_t location            = BackendCast(mImpl)->GetUniformLocation(name);
     mUniformLocationCache[name] = location;
     return location;
 }
@@ -154,35 +191,35 @@ int32_t LRShaderProgram::GetUniformLocation(const char* name) {
 void LRShaderProgram::SetUniform(const char* name, int32_t value) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniform1i(location, value);
+        BackendCast(mImpl)->SetUniform1i(location, value);
     }
 }
 
 void LRShaderProgram::SetUniform(const char* name, float value) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniform1f(location, value);
+        BackendCast(mImpl)->SetUniform1f(location, value);
     }
 }
 
 void LRShaderProgram::SetUniform(const char* name, float x, float y) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniform2f(location, x, y);
+        BackendCast(mImpl)->SetUniform2f(location, x, y);
     }
 }
 
 void LRShaderProgram::SetUniform(const char* name, float x, float y, float z) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniform3f(location, x, y, z);
+        BackendCast(mImpl)->SetUniform3f(location, x, y, z);
     }
 }
 
 void LRShaderProgram::SetUniform(const char* name, float x, float y, float z, float w) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniform4f(location, x, y, z, w);
+        BackendCast(mImpl)->SetUniform4f(location, x, y, z, w);
     }
 }
 
@@ -201,14 +238,14 @@ void LRShaderProgram::SetUniform(const char* name, const lrengine::math::Vec4f&
 void LRShaderProgram::SetUniformMatrix3(const char* name, const float* value, bool transpose) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniformMatrix3fv(location, value, transpose);
+        BackendCast(mImpl)->SetUniformMatrix3fv(location, value, transpose);
     }
 }
 
 void LRShaderProgram::SetUniformMatrix4(const char* name, const float* value, bool transpose) {
     int32_t location = GetUniformLocation(name);
     if (location >= 0 && mImpl) {
-        mImpl->SetUniformMatrix4fv(location, value, transpose);
+        BackendCast(mImpl)->SetUniformMatrix4fv(location, value, transpose);
     }
 }
 
@@ -226,7 +263,7 @@ void LRShaderProgram::SetUniformMatrix4(const char* name,
 
 ResourceHandle LRShaderProgram::GetNativeHandle() const {
     if (mImpl) {
-        return mImpl->GetNativeHandle();
+        return BackendCast(mImpl)->GetNativeHandle();
     }
     return ResourceHandle();
 }
@@ -0,0 +1,512 @@
+/**
+ * @file LRStaticBatch.cpp
+ * @brief LREngine 静态几何合批实现
+ */
+
+#include "lrengine/core/LRStaticBatch.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRBuffer.h"
+#include "lrengine/core/LRError.h"
+#include "lrengine/utils/LRLog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace lrengine {
+namespace render {
+
+namespace {
+
+/**
+ * @brief 将10位整数按位展开，用于构造Morton码
+ */
+uint64_t expandBits(uint32_t v) {
+    uint64_t x = v & 0x3FF;
+    x = (x | (x << 16)) & 0x030000FF;
+    x = (x | (x << 8))  & 0x0300F00F;
+    x = (x | (x << 4))  & 0x030C30C3;
+    x = (x | (x << 2))  & 0x09249249;
+    return x;
+}
+
+uint32_t quantize(float value, float minValue, float extent) {
+    if (extent <= 0.0f) {
+        return 0;
+    }
+    float t = (value - minValue) / extent;
+    t = std::min(std::max(t, 0.0f), 1.0f);
+    return static_cast<uint32_t>(t * 1023.0f);
+}
+
+math::Vec3f transformPoint(const math::Mat4f& m, const float* p) {
+    return math::Vec3f(
+        m.m_mat[0][0] * p[0] + m.m_mat[1][0] * p[1] + m.m_mat[2][0] * p[2] + m.m_mat[3][0],
+        m.m_mat[0][1] * p[0] + m.m_mat[1][1] * p[1] + m.m_mat[2][1] * p[2] + m.m_mat[3][1],
+        m.m_mat[0][2] * p[0] + m.m_mat[1][2] * p[1] + m.m_mat[2][2] * p[2] + m.m_mat[3][2]);
+}
+
+/**
+ * @brief 提取模型矩阵左上3x3（列主序）
+ */
+void extractLinear(const math::Mat4f& m, float out[9]) {
+    for (int c = 0; c < 3; ++c) {
+        for (int r = 0; r < 3; ++r) {
+            out[c * 3 + r] = m.m_mat[c][r];
+        }
+    }
+}
+
+/**
+ * @brief 计算法线矩阵（左上3x3的逆转置）
+ *
+ * 使用伴随矩阵代替显式求逆：cofactor(M) = det(M) * inverse(M)^T，
+ * 法线最终会归一化，只需按行列式符号修正方向，奇异矩阵也不会产生NaN。
+ */
+void computeNormalMatrix(const math::Mat4f& m, float out[9]) {
+    float a[9];
+    extractLinear(m, a);
+    // a[c * 3 + r]，c0/c1/c2为三列
+    const float* c0 = a;
+    const float* c1 = a + 3;
+    const float* c2 = a + 6;
+
+    // 伴随矩阵的各列为原矩阵两列的叉积
+    float n0[3] = {c1[1] * c2[2] - c1[2] * c2[1], c1[2] * c2[0] - c1[0] * c2[2], c1[0] * c2[1] - c1[1] * c2[0]};
+    float n1[3] = {c2[1] * c0[2] - c2[2] * c0[1], c2[2] * c0[0] - c2[0] * c0[2], c2[0] * c0[1] - c2[1] * c0[0]};
+    float n2[3] = {c0[1] * c1[2] - c0[2] * c1[1], c0[2] * c1[0] - c0[0] * c1[2], c0[0] * c1[1] - c0[1] * c1[0]};
+
+    float det = c0[0] * n0[0] + c0[1] * n0[1] + c0[2] * n0[2];
+    float sign = det < 0.0f ? -1.0f : 1.0f;
+
+    for (int i = 0; i < 3; ++i) {
+        out[0 + i] = n0[i] * sign;
+        out[3 + i] = n1[i] * sign;
+        out[6 + i] = n2[i] * sign;
+    }
+}
+
+void transformDirection(const float m[9], float* d) {
+    float x = m[0] * d[0] + m[3] * d[1] + m[6] * d[2];
+    float y = m[1] * d[0] + m[4] * d[1] + m[7] * d[2];
+    float z = m[2] * d[0] + m[5] * d[1] + m[8] * d[2];
+    float len = std::sqrt(x * x + y * y + z * z);
+    if (len > 1e-12f) {
+        float inv = 1.0f / len;
+        x *= inv;
+        y *= inv;
+        z *= inv;
+    }
+    d[0] = x;
+    d[1] = y;
+    d[2] = z;
+}
+
+} // namespace
+
+// =============================================================================
+// StaticBatchBounds
+// =============================================================================
+
+void StaticBatchBounds::Expand(const math::Vec3f& point) {
+    if (!valid) {
+        min = point;
+        max = point;
+        valid = true;
+        return;
+    }
+    min.x = std::min(min.x, point.x);
+    min.y = std::min(min.y, point.y);
+    min.z = std::min(min.z, point.z);
+    max.x = std::max(max.x, point.x);
+    max.y = std::max(max.y, point.y);
+    max.z = std::max(max.z, point.z);
+}
+
+void StaticBatchBounds::Expand(const StaticBatchBounds& other) {
+    if (!other.valid) {
+        return;
+    }
+    Expand(other.min);
+    Expand(other.max);
+}
+
+// =============================================================================
+// LRStaticBatcher
+// =============================================================================
+
+LRStaticBatcher::LRStaticBatcher(const StaticBatchOptions& options)
+    : mOptions(options) {
+    if (mOptions.layout.stride == 0) {
+        // 根据属性推导紧密排列的步长
+        uint32_t stride = 0;
+        for (const auto& attr : mOptions.layout.attributes) {
+            stride = std::max(stride, attr.offset + GetVertexFormatSize(attr.format));
+        }
+        mOptions.layout.stride = stride;
+    }
+    if (mOptions.maxChunkVertices == 0) {
+        mOptions.maxChunkVertices = 65535;
+    }
+}
+
+LRStaticBatcher::~LRStaticBatcher() {
+    ReleaseBuffers();
+}
+
+const VertexAttribute* LRStaticBatcher::findAttribute(int32_t location) const {
+    if (location < 0) {
+        return nullptr;
+    }
+    for (const auto& attr : mOptions.layout.attributes) {
+        if (attr.location == static_cast<uint32_t>(location)) {
+            return &attr;
+        }
+    }
+    return nullptr;
+}
+
+bool LRStaticBatcher::validateLayout() const {
+    const VertexAttribute* position = findAttribute(mOptions.positionLocation);
+    if (!position || (position->format != VertexFormat::Float3 &&
+                      position->format != VertexFormat::Float4)) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument,
+                     "Static batch requires a Float3/Float4 position attribute");
+        return false;
+    }
+
+    const VertexAttribute* normal = findAttribute(mOptions.normalLocation);
+    if (mOptions.normalLocation >= 0 && (!normal || normal->format != VertexFormat::Float3)) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Static batch normal attribute must be Float3");
+        return false;
+    }
+
+    const VertexAttribute* tangent = findAttribute(mOptions.tangentLocation);
+    if (mOptions.tangentLocation >= 0 &&
+        (!tangent || (tangent->format != VertexFormat::Float3 &&
+                      tangent->format != VertexFormat::Float4))) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument,
+                     "Static batch tangent attribute must be Float3/Float4");
+        return false;
+    }
+
+    for (const auto& attr : mOptions.layout.attributes) {
+        if (attr.offset + GetVertexFormatSize(attr.format) > mOptions.layout.stride) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument, "Vertex attribute exceeds layout stride");
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LRStaticBatcher::AddInstance(const StaticMeshInstance& instance) {
+    if (!instance.vertexData || instance.vertexCount == 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Static mesh instance has no vertex data");
+        return false;
+    }
+    if (instance.indexData && instance.indexCount == 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Static mesh instance has empty index data");
+        return false;
+    }
+    // 越界索引在重定位后会指向同一块内其它实例的顶点
+    for (uint32_t i = 0; instance.indexData && i < instance.indexCount; ++i) {
+        const uint32_t index = instance.indexType == IndexType::UInt16
+                                   ? static_cast<const uint16_t*>(instance.indexData)[i]
+                                   : static_cast<const uint32_t*>(instance.indexData)[i];
+        if (index >= instance.vertexCount) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument, "Static mesh index exceeds vertex count");
+            return false;
+        }
+    }
+
+    PendingInstance pending;
+    pending.source = instance;
+    if (!pending.source.indexData) {
+        pending.source.indexCount = instance.vertexCount;
+    }
+    mInstances.push_back(pending);
+    return true;
+}
+
+StaticBatchBounds LRStaticBatcher::computeWorldBounds(const StaticMeshInstance& instance) const {
+    StaticBatchBounds bounds;
+    const VertexAttribute* position = findAttribute(mOptions.positionLocation);
+    const uint8_t* src = static_cast<const uint8_t*>(instance.vertexData);
+    const uint32_t stride = mOptions.layout.stride;
+
+    for (uint32_t v = 0; v < instance.vertexCount; ++v) {
+        float p[3];
+        std::memcpy(p, src + static_cast<size_t>(v) * stride + position->offset, sizeof(p));
+        bounds.Expand(transformPoint(instance.worldMatrix, p));
+    }
+    return bounds;
+}
+
+bool LRStaticBatcher::Build() {
+    ReleaseBuffers();
+    mChunks.clear();
+    mBounds = StaticBatchBounds();
+
+    if (mInstances.empty()) {
+        return true;
+    }
+    if (!validateLayout()) {
+        return false;
+    }
+
+    // 计算每个实例的世界空间包围盒
+    for (auto& pending : mInstances) {
+        pending.bounds = computeWorldBounds(pending.source);
+        mBounds.Expand(pending.bounds);
+    }
+
+    // 按包围盒中心的Morton码排序，使相邻实例落入同一块，保证块包围盒紧凑
+    std::vector<const PendingInstance*> order;
+    order.reserve(mInstances.size());
+    for (auto& pending : mInstances) {
+        if (mOptions.spatialSort) {
+            math::Vec3f center = pending.bounds.GetCenter();
+            math::Vec3f extent = mBounds.max - mBounds.min;
+            uint32_t qx = quantize(center.x, mBounds.min.x, extent.x);
+            uint32_t qy = quantize(center.y, mBounds.min.y, extent.y);
+            uint32_t qz = quantize(center.z, mBounds.min.z, extent.z);
+            pending.sortKey = (expandBits(qx) << 2) | (expandBits(qy) << 1) | expandBits(qz);
+        }
+        order.push_back(&pending);
+    }
+    if (mOptions.spatialSort) {
+        std::stable_sort(order.begin(), order.end(),
+                         [](const PendingInstance* a, const PendingInstance* b) {
+                             return a->sortKey < b->sortKey;
+                         });
+    }
+
+    // 贪心切分：在不超过块容量的前提下尽量合并
+    std::vector<const PendingInstance*> group;
+    uint32_t groupVertices = 0;
+    uint32_t groupIndices = 0;
+    for (const PendingInstance* pending : order) {
+        uint32_t vertices = pending->source.vertexCount;
+        uint32_t indices = pending->source.indexCount;
+        bool overVertices = groupVertices + vertices > mOptions.maxChunkVertices;
+        bool overIndices = mOptions.maxChunkIndices > 0 &&
+                           groupIndices + indices > mOptions.maxChunkIndices;
+
+        if (!group.empty() && (overVertices || overIndices)) {
+            buildChunk(group);
+            group.clear();
+            groupVertices = 0;
+            groupIndices = 0;
+        }
+
+        // 超过块容量的单个实例独占一个块
+        group.push_back(pending);
+        groupVertices += vertices;
+        groupIndices += indices;
+    }
+    if (!group.empty()) {
+        buildChunk(group);
+    }
+
+    LR_LOG_INFO_F("Static batch built: %zu instances -> %zu chunks",
+                  mInstances.size(), mChunks.size());
+    return true;
+}
+
+void LRStaticBatcher::buildChunk(const std::vector<const PendingInstance*>& group) {
+    // 块内按材质稳定排序，使相同材质的索引连续
+    std::vector<const PendingInstance*> sorted(group);
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const PendingInstance* a, const PendingInstance* b) {
+                         return a->source.materialID < b->source.materialID;
+                     });
+
+    uint32_t totalVertices = 0;
+    uint32_t totalIndices = 0;
+    for (const PendingInstance* pending : sorted) {
+        totalVertices += pending->source.vertexCount;
+        totalIndices += pending->source.indexCount;
+    }
+
+    const uint32_t stride = mOptions.layout.stride;
+    const VertexAttribute* position = findAttribute(mOptions.positionLocation);
+    const VertexAttribute* normal = findAttribute(mOptions.normalLocation);
+    const VertexAttribute* tangent = findAttribute(mOptions.tangentLocation);
+
+    StaticBatchChunk chunk;
+    chunk.vertexCount = totalVertices;
+    chunk.indexCount = totalIndices;
+    chunk.indexType = totalVertices <= 65536 ? IndexType::UInt16 : IndexType::UInt32;
+    chunk.vertexData.resize(static_cast<size_t>(totalVertices) * stride);
+    chunk.indexData.resize(static_cast<size_t>(totalIndices) *
+                           (chunk.indexType == IndexType::UInt16 ? 2 : 4));
+
+    uint8_t* dstVertices = chunk.vertexData.data();
+    uint16_t* dstIndices16 = reinterpret_cast<uint16_t*>(chunk.indexData.data());
+    uint32_t* dstIndices32 = reinterpret_cast<uint32_t*>(chunk.indexData.data());
+
+    uint32_t baseVertex = 0;
+    uint32_t indexCursor = 0;
+
+    for (const PendingInstance* pending : sorted) {
+        const StaticMeshInstance& src = pending->source;
+
+        // 法线使用世界矩阵的逆转置，保证非均匀缩放下仍然正确
+        float linearMatrix[9];
+        float normalMatrix[9];
+        extractLinear(src.worldMatrix, linearMatrix);
+        computeNormalMatrix(src.worldMatrix, normalMatrix);
+
+        // 顶点：整体拷贝后原地变换位置/法线/切线
+        size_t bytes = static_cast<size_t>(src.vertexCount) * stride;
+        std::memcpy(dstVertices, src.vertexData, bytes);
+        for (uint32_t v = 0; v < src.vertexCount; ++v) {
+            uint8_t* vertex = dstVertices + static_cast<size_t>(v) * stride;
+
+            float p[3];
+            std::memcpy(p, vertex + position->offset, sizeof(p));
+            math::Vec3f world = transformPoint(src.worldMatrix, p);
+            p[0] = world.x;
+            p[1] = world.y;
+            p[2] = world.z;
+            std::memcpy(vertex + position->offset, p, sizeof(p));
+
+            if (normal) {
+                float n[3];
+                std::memcpy(n, vertex + normal->offset, sizeof(n));
+                transformDirection(normalMatrix, n);
+                std::memcpy(vertex + normal->offset, n, sizeof(n));
+            }
+            if (tangent) {
+                // 切线随模型矩阵变换，Float4的w分量（副切线符号）保持不变
+                float t[3];
+                std::memcpy(t, vertex + tangent->offset, sizeof(t));
+                transformDirection(linearMatrix, t);
+                std::memcpy(vertex + tangent->offset, t, sizeof(t));
+            }
+        }
+        dstVertices += bytes;
+
+        // 索引：重定位到块内顶点基址
+        if (chunk.ranges.empty() || chunk.ranges.back().materialID != src.materialID) {
+            StaticBatchRange range;
+            range.materialID = src.materialID;
+            range.indexStart = indexCursor;
+            chunk.ranges.push_back(range);
+        }
+        StaticBatchRange& range = chunk.ranges.back();
+
+        for (uint32_t i = 0; i < src.indexCount; ++i) {
+            uint32_t index = i;
+            if (src.indexData) {
+                if (src.indexType == IndexType::UInt16) {
+                    index = static_cast<const uint16_t*>(src.indexData)[i];
+                } else {
+                    index = static_cast<const uint32_t*>(src.indexData)[i];
+                }
+            }
+            uint32_t remapped = baseVertex + index;
+            if (chunk.indexType == IndexType::UInt16) {
+                dstIndices16[indexCursor] = static_cast<uint16_t>(remapped);
+            } else {
+                dstIndices32[indexCursor] = remapped;
+            }
+            ++indexCursor;
+        }
+
+        range.indexCount += src.indexCount;
+        range.bounds.Expand(pending->bounds);
+        chunk.bounds.Expand(pending->bounds);
+        baseVertex += src.vertexCount;
+    }
+
+    mChunks.push_back(std::move(chunk));
+}
+
+bool LRStaticBatcher::CreateBuffers(LRRenderContext* context, bool releaseCPUData) {
+    if (!context) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render context is null");
+        return false;
+    }
+
+    bool created = !mChunks.empty();
+    bool hasCPUData = true;
+    for (const auto& chunk : mChunks) {
+        created &= chunk.vertexBuffer != nullptr && chunk.indexBuffer != nullptr;
+        hasCPUData &= !chunk.vertexData.empty() && !chunk.indexData.empty();
+    }
+
+    // 缓冲已存在时重复调用不做任何事（重建须先 ReleaseBuffers，且保留了CPU数据）
+    if (created) {
+        return true;
+    }
+    if (!hasCPUData) {
+        LR_SET_ERROR(ErrorCode::ResourceInvalid, "Static batch chunk has no CPU data");
+        return false;
+    }
+
+    ReleaseBuffers();
+
+    for (size_t i = 0; i < mChunks.size(); ++i) {
+        StaticBatchChunk& chunk = mChunks[i];
+
+        BufferDescriptor vbDesc;
+        vbDesc.size = chunk.vertexData.size();
+        vbDesc.usage = BufferUsage::Static;
+        vbDesc.type = BufferType::Vertex;
+        vbDesc.data = chunk.vertexData.data();
+        vbDesc.stride = mOptions.layout.stride;
+        vbDesc.debugName = "StaticBatch_VB";
+
+        BufferDescriptor ibDesc;
+        ibDesc.size = chunk.indexData.size();
+        ibDesc.usage = BufferUsage::Static;
+        ibDesc.type = BufferType::Index;
+        ibDesc.data = chunk.indexData.data();
+        ibDesc.indexType = chunk.indexType;
+        ibDesc.debugName = "StaticBatch_IB";
+
+        chunk.vertexBuffer = context->CreateVertexBuffer(vbDesc);
+        chunk.indexBuffer = context->CreateIndexBuffer(ibDesc);
+        if (!chunk.vertexBuffer || !chunk.indexBuffer) {
+            LR_LOG_ERROR_F("Failed to create buffers for static batch chunk %zu", i);
+            ReleaseBuffers();
+            return false;
+        }
+        chunk.vertexBuffer->SetVertexLayout(mOptions.layout);
+
+        if (releaseCPUData) {
+            std::vector<uint8_t>().swap(chunk.vertexData);
+            std::vector<uint8_t>().swap(chunk.indexData);
+        }
+    }
+
+    if (releaseCPUData) {
+        // 源数据指针在合批后不再需要
+        mInstances.clear();
+    }
+    return true;
+}
+
+void LRStaticBatcher::ReleaseBuffers() {
+    for (auto& chunk : mChunks) {
+        if (chunk.vertexBuffer) {
+            chunk.vertexBuffer->Release();
+            chunk.vertexBuffer = nullptr;
+        }
+        if (chunk.indexBuffer) {
+            chunk.indexBuffer->Release();
+            chunk.indexBuffer = nullptr;
+        }
+    }
+}
+
+void LRStaticBatcher::Clear() {
+    ReleaseBuffers();
+    mInstances.clear();
+    mChunks.clear();
+    mBounds = StaticBatchBounds();
+}
+
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,148 @@
+/**
+ * @file LRStreamingPlanarTexture.cpp
+ * @brief LREngine 流式视频帧纹理环实现
+ */
+
+#include "lrengine/core/LRStreamingPlanarTexture.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRFence.h"
+#include "lrengine/core/LRError.h"
+#include "lrengine/utils/LRLog.h"
+
+namespace lrengine {
+namespace render {
+
+LRStreamingPlanarTexture::~LRStreamingPlanarTexture() { Release(); }
+
+bool LRStreamingPlanarTexture::Initialize(LRRenderContext* context, const StreamingPlanarTextureDescriptor& desc) {
+    Release();
+
+    if (!context) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render context is null");
+        return false;
+    }
+    if (desc.ringSize < 2 || desc.ringSize > 8) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Streaming texture ring size must be between 2 and 8");
+        return false;
+    }
+
+    mContext = context;
+    mPlanarDesc = desc.planar;
+    mWaitTimeoutNs = desc.waitTimeoutNs;
+    mSlots.resize(desc.ringSize);
+    for (Slot& slot : mSlots) {
+        slot.texture = context->CreatePlanarTexture(desc.planar);
+        slot.fence = context->CreateFence();
+        if (!slot.texture || !slot.fence) {
+            Release();
+            return false;
+        }
+    }
+    mTrimHandlerID = context->RegisterMemoryTrimHandler([this](MemoryTrimLevel level) { return Trim(level); });
+    return true;
+}
+
+bool LRStreamingPlanarTexture::UpdateFromImage(const ImageDataDesc& imageData,
+                                               const LRPlanarTexture::UpdateFromImageOptions& options) {
+    if (mSlots.empty()) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Streaming texture not initialized");
+        return false;
+    }
+
+    // 当前纹理的采样命令都已提交，插入栅栏标记其使用结束
+    if (mHasCurrent) {
+        Slot& current = mSlots[mCurrent];
+        current.fence->Signal();
+        current.fencePending = true;
+    }
+
+    const uint32_t next = mHasCurrent ? (mCurrent + 1) % static_cast<uint32_t>(mSlots.size()) : 0;
+    Slot& slot = mSlots[next];
+    waitForSlot(slot);
+
+    // 内存回收释放的纹理在再次使用时重建
+    if (!slot.texture) {
+        slot.texture = mContext->CreatePlanarTexture(mPlanarDesc);
+        if (!slot.texture) {
+            return false;
+        }
+    }
+
+    if (!slot.texture->UpdateFromImage(imageData, options)) {
+        return false;
+    }
+
+    mCurrent = next;
+    mHasCurrent = true;
+    ++mFrameCount;
+    return true;
+}
+
+void LRStreamingPlanarTexture::waitForSlot(Slot& slot) {
+    if (!slot.fencePending) {
+        return;
+    }
+
+    if (!slot.fence->IsSignaled()) {
+        ++mStallCount;
+        if (!slot.fence->Wait(mWaitTimeoutNs)) {
+            // 超时后仍然上传，由驱动负责同步（可能产生隐式等待）
+            LR_LOG_WARNING("LRStreamingPlanarTexture: GPU still using ring texture after timeout");
+        }
+    }
+    slot.fence->Reset();
+    slot.fencePending = false;
+}
+
+size_t LRStreamingPlanarTexture::Trim(MemoryTrimLevel level) {
+    // Low 级别保留整个环，避免下一帧重建纹理
+    if (level == MemoryTrimLevel::Low) {
+        return 0;
+    }
+
+    size_t released = 0;
+    for (uint32_t i = 0; i < mSlots.size(); ++i) {
+        Slot& slot = mSlots[i];
+        if (!slot.texture || (mHasCurrent && i == mCurrent)) {
+            continue;
+        }
+        // Moderate 只释放 GPU 已用完的纹理；Complete 等待 GPU 后全部释放
+        if (slot.fencePending && level == MemoryTrimLevel::Moderate && !slot.fence->IsSignaled()) {
+            continue;
+        }
+        waitForSlot(slot);
+        slot.texture->Release();
+        slot.texture = nullptr;
+        ++released;
+    }
+    return released;
+}
+
+LRPlanarTexture* LRStreamingPlanarTexture::GetCurrent() const {
+    return mHasCurrent ? mSlots[mCurrent].texture : nullptr;
+}
+
+void LRStreamingPlanarTexture::Release() {
+    for (Slot& slot : mSlots) {
+        if (slot.fence) {
+            slot.fence->Release();
+        }
+        if (slot.texture) {
+            slot.texture->Release();
+        }
+    }
+    mSlots.clear();
+
+    if (mContext && mTrimHandlerID != 0) {
+        mContext->UnregisterMemoryTrimHandler(mTrimHandlerID);
+    }
+    mTrimHandlerID = 0;
+    mContext = nullptr;
+    mCurrent = 0;
+    mHasCurrent = false;
+    mStallCount = 0;
+    mFrameCount = 0;
+}
+
+} // namespace render
+} // namespace lrengine
@@ -6,6 +6,7 @@
 #include "lrengine/core/LRTexture.h"
 #include "lrengine/core/LRError.h"
 #include "platform/interface/ITextureImpl.h"
+#include "platform/StaticBackend.h"
 
 namespace lrengine {
 namespace render {
@@ -14,7 +15,7 @@ LRTexture::LRTexture() : LRResource(ResourceType::Texture) {}
 
 LRTexture::~LRTexture() {
     if (mImpl) {
-        mImpl->Destroy();
+        BackendCast(mImpl)->Destroy();
         delete mImpl;
         mImpl = nullptr;
     }
@@ -28,7 +29,7 @@ bool LRTexture::Initialize(ITextureImpl* impl, const TextureDescriptor& desc) {
 
     mImpl = impl;
 
-    if (!mImpl->Create(desc)) {
+    if (!BackendCast(mImpl)->Create(desc)) {
         LR_SET_ERROR(ErrorCode::TextureCreationFailed, "Failed to create texture");
         delete mImpl;
         mImpl = nullptr;
@@ -40,7 +41,7 @@ bool LRTexture::Initialize(ITextureImpl* impl, const TextureDescriptor& desc) {
     mDepth       = desc.depth;
     mTextureType = desc.type;
     mFormat      = desc.format;
-    mMipLevels   = desc.mipLevels;
+    mMipLevels   = BackendCast(mImpl)->GetMipLevels();  // 后端已把 0 解析为完整 mip 链
     mSamples     = desc.sampleCount;
     mIsValid     = true;
 
@@ -57,31 +58,51 @@ void LRTexture::UpdateData(const void* data, const TextureRegion* region) {
         return;
     }
 
-    mImpl->UpdateData(data, 0, region);
+    BackendCast(mImpl)->UpdateData(data, region ? region->mipLevel : 0, region);
 }
 
 void LRTexture::GenerateMipmaps() {
     if (mImpl && mIsValid) {
-        mImpl->GenerateMipmaps();
+        BackendCast(mImpl)->GenerateMipmaps();
     }
 }
 
 void LRTexture::Bind(uint32_t slot) {
     mBoundSlot = slot;
     if (mImpl && mIsValid) {
-        mImpl->Bind(slot);
+        InvalidateBindings(BindingScope::Texture);
+        BackendCast(mImpl)->Bind(slot);
     }
 }
 
 void LRTexture::Unbind() {
     if (mImpl && mIsValid) {
-        mImpl->Unbind(mBoundSlot);
+        InvalidateBindings(BindingScope::Texture);
+        BackendCast(mImpl)->Unbind(mBoundSlot);
     }
 }
 
+int32_t LRTexture::BeginAsyncReadback(uint32_t mipLevel) {
+    if (!mImpl || !mIsValid) {
+        LR_SET_ERROR(ErrorCode::ResourceInvalid, "Texture is not valid");
+        return -1;
+    }
+
+    return BackendCast(mImpl)->BeginAsyncReadback(mipLevel);
+}
+
+bool LRTexture::ResolveAsyncReadback(int32_t slot, void* dst, bool wait) {
+    if (!mImpl || !mIsValid) {
+        LR_SET_ERROR(ErrorCode::ResourceInvalid, "Texture is not valid");
+        return false;
+    }
+
+    return BackendCast(mImpl)->ResolveAsyncReadback(slot, dst, wait);
+}
+
 ResourceHandle LRTexture::GetNativeHandle() const {
     if (mImpl) {
-        return mImpl->GetNativeHandle();
+        return BackendCast(mImpl)->GetNativeHandle();
     }
     return ResourceHandle();
 }
@@ -0,0 +1,230 @@
+/**
+ * @file LRTextureArray.cpp
+ * @brief LREngine 纹理数组分配器实现
+ */
+
+#include "lrengine/core/LRTextureArray.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRError.h"
+
+#include <algorithm>
+
+namespace lrengine {
+namespace render {
+
+LRTextureArrayAllocator::~LRTextureArrayAllocator() { Release(); }
+
+bool LRTextureArrayAllocator::Initialize(LRRenderContext* context,
+                                         const TextureArrayAllocatorDescriptor& desc) {
+    if (!context || desc.layersPerPage == 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid texture array allocator descriptor");
+        return false;
+    }
+
+    Release();
+    mContext = context;
+    mDesc = desc;
+    mDesc.mipLevels = std::max(1u, desc.mipLevels);
+    mTrimHandlerID = mContext->RegisterMemoryTrimHandler([this](MemoryTrimLevel level) { return Trim(level); });
+    return true;
+}
+
+bool LRTextureArrayAllocator::Allocate(uint32_t width, uint32_t height, PixelFormat format,
+                                       const void* data, TextureArrayLayer& out) {
+    out = TextureArrayLayer();
+    if (!mContext) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Texture array allocator not initialized");
+        return false;
+    }
+    if (width == 0 || height == 0) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid texture size");
+        return false;
+    }
+
+    // 查找尺寸/格式匹配且仍有空位的页；没有时优先复用已回收的页位置，保持已分配层的页编号不变
+    uint32_t pageIndex = static_cast<uint32_t>(mPages.size());
+    uint32_t emptySlot = static_cast<uint32_t>(mPages.size());
+    for (uint32_t i = 0; i < mPages.size(); ++i) {
+        const Page& page = mPages[i];
+        if (!page.texture) {
+            emptySlot = std::min(emptySlot, i);
+            continue;
+        }
+        if (page.width == width && page.height == height && page.format == format &&
+            pageHasSpace(page, mDesc.layersPerPage)) {
+            pageIndex = i;
+            break;
+        }
+    }
+
+    if (pageIndex == mPages.size()) {
+        pageIndex = emptySlot;
+        if (pageIndex == mPages.size()) {
+            mPages.emplace_back();
+        }
+        if (!createPage(mPages[pageIndex], width, height, format)) {
+            if (pageIndex + 1 == mPages.size()) {
+                mPages.pop_back();
+            }
+            return false;
+        }
+    }
+
+    Page& page = mPages[pageIndex];
+    uint32_t layer;
+    if (!page.freeLayers.empty()) {
+        layer = page.freeLayers.back();
+        page.freeLayers.pop_back();
+    } else {
+        layer = page.nextLayer++;
+    }
+
+    page.allocated[layer] = 1;
+    ++page.allocatedCount;
+
+    out.texture = page.texture;
+    out.layer = layer;
+    out.page = pageIndex;
+
+    if (data) {
+        Update(out, data, 0);
+    }
+    return true;
+}
+
+void LRTextureArrayAllocator::Update(const TextureArrayLayer& layer, const void* data,
+                                     uint32_t mipLevel) {
+    if (!isAllocated(layer) || !data) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid texture array layer");
+        return;
+    }
+
+    const Page& page = mPages[layer.page];
+    TextureRegion region;
+    region.width = std::max(1u, page.width >> mipLevel);
+    region.height = std::max(1u, page.height >> mipLevel);
+    region.depth = 1;
+    region.mipLevel = mipLevel;
+    region.arrayLayer = layer.layer;
+    page.texture->UpdateData(data, &region);
+}
+
+void LRTextureArrayAllocator::Free(TextureArrayLayer& layer) {
+    if (!isAllocated(layer)) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Texture array layer is not allocated by this allocator");
+        return;
+    }
+
+    Page& page = mPages[layer.page];
+    page.allocated[layer.layer] = 0;
+    --page.allocatedCount;
+    page.freeLayers.push_back(layer.layer);
+    layer = TextureArrayLayer();
+}
+
+void LRTextureArrayAllocator::GenerateMipmaps() {
+    if (mDesc.mipLevels <= 1) {
+        return;
+    }
+    for (auto& page : mPages) {
+        if (page.texture) {
+            page.texture->GenerateMipmaps();
+        }
+    }
+}
+
+size_t LRTextureArrayAllocator::Trim(MemoryTrimLevel level) {
+    // 空页没有记录空闲时长，Low 级别保留以免反复重建
+    if (level == MemoryTrimLevel::Low) {
+        return 0;
+    }
+
+    size_t released = 0;
+    for (auto& page : mPages) {
+        if (page.texture && page.allocatedCount == 0) {
+            page.texture->Release();
+            page = Page();
+            ++released;
+        }
+    }
+    // 末尾的空位置不再需要占位
+    while (!mPages.empty() && !mPages.back().texture) {
+        mPages.pop_back();
+    }
+    return released;
+}
+
+void LRTextureArrayAllocator::Release() {
+    for (auto& page : mPages) {
+        if (page.texture) {
+            page.texture->Release();
+        }
+    }
+    mPages.clear();
+
+    if (mContext && mTrimHandlerID != 0) {
+        mContext->UnregisterMemoryTrimHandler(mTrimHandlerID);
+    }
+    mTrimHandlerID = 0;
+    mContext = nullptr;
+}
+
+size_t LRTextureArrayAllocator::GetPageCount() const {
+    size_t count = 0;
+    for (const auto& page : mPages) {
+        if (page.texture) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint32_t LRTextureArrayAllocator::GetAllocatedLayerCount() const {
+    uint32_t count = 0;
+    for (const auto& page : mPages) {
+        count += page.allocatedCount;
+    }
+    return count;
+}
+
+bool LRTextureArrayAllocator::createPage(Page& page, uint32_t width, uint32_t height, PixelFormat format) {
+    TextureDescriptor desc;
+    desc.type = TextureType::Texture2DArray;
+    desc.width = width;
+    desc.height = height;
+    desc.depth = mDesc.layersPerPage;
+    desc.format = format;
+    desc.mipLevels = mDesc.mipLevels;
+    desc.sampler = mDesc.sampler;
+    desc.debugName = mDesc.debugName;
+
+    LRTexture* texture = mContext->CreateTexture(desc);
+    if (!texture) {
+        return false;
+    }
+
+    page = Page();
+    page.texture = texture;
+    page.allocated.assign(mDesc.layersPerPage, 0);
+    page.width = width;
+    page.height = height;
+    page.format = format;
+    return true;
+}
+
+bool LRTextureArrayAllocator::isAllocated(const TextureArrayLayer& layer) const {
+    if (!layer.IsValid() || layer.page >= mPages.size()) {
+        return false;
+    }
+    // 页被回收后可能已在同一位置重建，须同时核对纹理与层的分配状态
+    const Page& page = mPages[layer.page];
+    return page.texture == layer.texture && layer.layer < page.allocated.size() && page.allocated[layer.layer];
+}
+
+bool LRTextureArrayAllocator::pageHasSpace(const Page& page, uint32_t layerCount) {
+    return !page.freeLayers.empty() || page.nextLayer < layerCount;
+}
+
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,222 @@
+/**
+ * @file LRTiledImageProcessor.cpp
+ * @brief LREngine 大图分块 GPU 处理实现
+ */
+
+#include "lrengine/core/LRTiledImageProcessor.h"
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRTexture.h"
+#include "lrengine/core/LRFrameBuffer.h"
+#include "lrengine/core/LRError.h"
+
+#include <algorithm>
+
+namespace lrengine {
+namespace render {
+
+LRTiledImageProcessor::~LRTiledImageProcessor() { Release(); }
+
+bool LRTiledImageProcessor::Initialize(LRRenderContext* context, const TiledImageDescriptor& desc) {
+    if (!context) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Render context is null");
+        return false;
+    }
+
+    const uint32_t deviceMax = context->GetMaxTextureSize();
+    const uint32_t maxTileSize = desc.maxTileSize ? std::min(desc.maxTileSize, deviceMax) : deviceMax;
+    if (maxTileSize <= desc.guardBand * 2) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Guard band does not fit into the maximum tile size");
+        return false;
+    }
+
+    Release();
+    mContext = context;
+    mDesc = desc;
+    mMaxTileSize = maxTileSize;
+    return true;
+}
+
+bool LRTiledImageProcessor::Process(const ImageDataDesc& input, const ImageDataDesc& output,
+                                    const TileFilter& filter) {
+    if (!mContext) {
+        LR_SET_ERROR(ErrorCode::NotInitialized, "Tiled image processor not initialized");
+        return false;
+    }
+    if (!filter || input.planes.empty() || !input.planes[0].data || output.planes.empty() ||
+        !output.planes[0].data || input.width != output.width || input.height != output.height) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid tiled processing arguments");
+        return false;
+    }
+    if (input.format != ImageFormat::RGBA8 || output.format != ImageFormat::RGBA8) {
+        LR_SET_ERROR(ErrorCode::TextureFormatNotSupported, "Tiled processing requires RGBA8 images");
+        return false;
+    }
+    if (!utils::ComputeImageTiles(input.width, input.height, mMaxTileSize, mDesc.guardBand, mGrid)) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Failed to split image into tiles");
+        return false;
+    }
+    if (!prepareTargets(mGrid.paddedWidth, mGrid.paddedHeight)) {
+        return false;
+    }
+    mTileData.resize(static_cast<size_t>(mGrid.paddedWidth) * mGrid.paddedHeight * 4);
+
+    // 块 i 使用槽位 i % 2：渲染块 i 之前，同槽位块 i-2 的回读已在上一轮取回，
+    // 因此源纹理与渲染目标不会被 GPU 同时读写
+    bool success = true;
+    const uint32_t tileCount = static_cast<uint32_t>(mGrid.tiles.size());
+    for (uint32_t index = 0; index < tileCount && success; ++index) {
+        const uint32_t slot = index % kSlotCount;
+
+        utils::ExtractImageTile(input, mGrid, index, mTileData.data());
+        mSources[slot]->UpdateData(mTileData.data());
+
+        if (!filter(mSources[slot], mTargets[slot], mGrid, index)) {
+            success = false;
+            break;
+        }
+        mContext->Flush();
+
+        mReadbacks[slot] = mTargetTextures[slot]->BeginAsyncReadback(0);
+        mReadbackTiles[slot] = index;
+        if (mReadbacks[slot] < 0) {
+            LR_SET_ERROR(ErrorCode::NotSupported, "Tile readback is not supported by this backend");
+            success = false;
+            break;
+        }
+
+        const uint32_t previous = (slot + 1) % kSlotCount;
+        if (mReadbacks[previous] >= 0) {
+            success = resolveTile(previous, output);
+        }
+    }
+
+    for (uint32_t slot = 0; slot < kSlotCount; ++slot) {
+        if (mReadbacks[slot] < 0) {
+            continue;
+        }
+        if (success) {
+            success = resolveTile(slot, output);
+        } else {
+            mTargetTextures[slot]->ResolveAsyncReadback(mReadbacks[slot], nullptr, true);
+            mReadbacks[slot] = -1;
+        }
+    }
+    return success;
+}
+
+bool LRTiledImageProcessor::Process(utils::ImageBuffer* input, utils::ImageBuffer* output,
+                                    const TileFilter& filter) {
+    if (!input || !output) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Image buffer is null");
+        return false;
+    }
+    if (!input->Lock(true)) {
+        LR_SET_ERROR(ErrorCode::InvalidOperation, "Failed to lock input image buffer");
+        return false;
+    }
+    if (!output->Lock(false)) {
+        input->Unlock();
+        LR_SET_ERROR(ErrorCode::InvalidOperation, "Failed to lock output image buffer");
+        return false;
+    }
+
+    const bool result = Process(input->GetImageDesc(), output->GetImageDesc(), filter);
+    output->Unlock();
+    input->Unlock();
+    return result;
+}
+
+bool LRTiledImageProcessor::resolveTile(uint32_t slot, const ImageDataDesc& output) {
+    const int32_t readback = mReadbacks[slot];
+    mReadbacks[slot] = -1;
+    if (!mTargetTextures[slot]->ResolveAsyncReadback(readback, mTileData.data(), true)) {
+        LR_SET_ERROR(ErrorCode::InvalidOperation, "Failed to read back processed tile");
+        return false;
+    }
+    return utils::StoreImageTile(mTileData.data(), 0, mGrid, mReadbackTiles[slot], output);
+}
+
+bool LRTiledImageProcessor::prepareTargets(uint32_t width, uint32_t height) {
+    if (mTargets[0] && mTargetWidth == width && mTargetHeight == height) {
+        return true;
+    }
+    releaseTargets();
+
+    TextureDescriptor textureDesc;
+    textureDesc.width = width;
+    textureDesc.height = height;
+    textureDesc.format = PixelFormat::RGBA8;
+    textureDesc.mipLevels = 1;
+    textureDesc.sampler.minFilter = FilterMode::Linear;
+    textureDesc.sampler.magFilter = FilterMode::Linear;
+    textureDesc.sampler.wrapU = WrapMode::ClampToEdge;
+    textureDesc.sampler.wrapV = WrapMode::ClampToEdge;
+
+    FrameBufferDescriptor frameBufferDesc;
+    frameBufferDesc.width = width;
+    frameBufferDesc.height = height;
+    frameBufferDesc.hasDepthStencil = false;
+    ColorAttachmentDescriptor colorAttachment;
+    colorAttachment.format = PixelFormat::RGBA8;
+    colorAttachment.loadOp = LoadOp::DontCare;
+    frameBufferDesc.colorAttachments.push_back(colorAttachment);
+    frameBufferDesc.debugName = "TiledImage_Target";
+
+    for (uint32_t slot = 0; slot < kSlotCount; ++slot) {
+        textureDesc.debugName = "TiledImage_Source";
+        mSources[slot] = mContext->CreateTexture(textureDesc);
+        textureDesc.debugName = "TiledImage_TargetColor";
+        mTargetTextures[slot] = mContext->CreateTexture(textureDesc);
+        mTargets[slot] = mContext->CreateFrameBuffer(frameBufferDesc);
+        if (!mSources[slot] || !mTargetTextures[slot] || !mTargets[slot]) {
+            releaseTargets();
+            return false;
+        }
+
+        mTargets[slot]->AttachColorTexture(mTargetTextures[slot], 0);
+        if (!mTargets[slot]->IsComplete()) {
+            LR_SET_ERROR(ErrorCode::FrameBufferIncomplete, "Tile render target is incomplete");
+            releaseTargets();
+            return false;
+        }
+    }
+
+    mTargetWidth = width;
+    mTargetHeight = height;
+    return true;
+}
+
+void LRTiledImageProcessor::releaseTargets() {
+    for (uint32_t slot = 0; slot < kSlotCount; ++slot) {
+        if (mReadbacks[slot] >= 0 && mTargetTextures[slot]) {
+            mTargetTextures[slot]->ResolveAsyncReadback(mReadbacks[slot], nullptr, true);
+        }
+        mReadbacks[slot] = -1;
+
+        if (mTargets[slot]) {
+            mTargets[slot]->Release();
+            mTargets[slot] = nullptr;
+        }
+        if (mTargetTextures[slot]) {
+            mTargetTextures[slot]->Release();
+            mTargetTextures[slot] = nullptr;
+        }
+        if (mSources[slot]) {
+            mSources[slot]->Release();
+            mSources[slot] = nullptr;
+        }
+    }
+    mTargetWidth = 0;
+    mTargetHeight = 0;
+}
+
+void LRTiledImageProcessor::Release() {
+    releaseTargets();
+    mTileData.clear();
+    mTileData.shrink_to_fit();
+    mGrid = utils::ImageTileGrid();
+    mContext = nullptr;
+}
+
+} // namespace render
+} // namespace lrengine
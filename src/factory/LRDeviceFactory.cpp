@@ -22,7 +22,32 @@
 namespace lrengine {
 namespace render {
 
+namespace {
+// 自定义工厂（按后端类型索引）
+LRDeviceFactory* s_registeredFactories[static_cast<size_t>(Backend::Unknown)] = {};
+} // namespace
+
+bool LRDeviceFactory::RegisterFactory(Backend backend, LRDeviceFactory* factory) {
+#if defined(LRENGINE_STATIC_BACKEND)
+    LR_UNUSED(backend);
+    LR_UNUSED(factory);
+    LR_SET_ERROR(ErrorCode::NotSupported, "Custom factories are not supported with a static backend");
+    return false;
+#else
+    if (backend >= Backend::Unknown) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid backend");
+        return false;
+    }
+    s_registeredFactories[static_cast<size_t>(backend)] = factory;
+    return true;
+#endif
+}
+
 LRDeviceFactory* LRDeviceFactory::GetFactory(Backend backend) {
+    if (backend < Backend::Unknown && s_registeredFactories[static_cast<size_t>(backend)]) {
+        return s_registeredFactories[static_cast<size_t>(backend)];
+    }
+
     switch (backend) {
 #ifdef LRENGINE_ENABLE_OPENGL
         case Backend::OpenGL: {
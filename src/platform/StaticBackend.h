@@ -0,0 +1,126 @@
+/**
+ * @file StaticBackend.h
+ * @brief 单后端构建的静态绑定
+ *
+ * 定义 LRENGINE_STATIC_BACKEND 时（CMake 选项，要求只启用一个后端），
+ * BackendCast 把接口指针转换为该后端的具体类型。后端类声明为 final，
+ * 前端调用因此被编译器去虚化并可内联。
+ * 未定义时 BackendCast 原样返回接口指针，行为与多后端构建一致。
+ */
+
+#pragma once
+
+#include "platform/interface/IRenderContextImpl.h"
+#include "platform/interface/IBufferImpl.h"
+#include "platform/interface/IShaderImpl.h"
+#include "platform/interface/ITextureImpl.h"
+#include "platform/interface/IPipelineStateImpl.h"
+
+#if defined(LRENGINE_STATIC_BACKEND)
+#if defined(LRENGINE_ENABLE_OPENGL)
+#include "platform/opengl/ContextGL.h"
+#include "platform/opengl/BufferGL.h"
+#include "platform/opengl/ShaderGL.h"
+#include "platform/opengl/TextureGL.h"
+#include "platform/opengl/PipelineStateGL.h"
+#elif defined(LRENGINE_ENABLE_OPENGLES)
+#include "platform/gles/ContextGLES.h"
+#include "platform/gles/BufferGLES.h"
+#include "platform/gles/ShaderGLES.h"
+#include "platform/gles/TextureGLES.h"
+#include "platform/gles/PipelineStateGLES.h"
+#elif defined(LRENGINE_ENABLE_METAL)
+#include "platform/metal/ContextMTL.h"
+#include "platform/metal/BufferMTL.h"
+#include "platform/metal/ShaderMTL.h"
+#include "platform/metal/TextureMTL.h"
+#include "platform/metal/PipelineStateMTL.h"
+#else
+#error "LRENGINE_STATIC_BACKEND requires exactly one enabled backend"
+#endif
+#endif
+
+namespace lrengine {
+namespace render {
+
+/**
+ * @brief 接口类型到具体后端类型的映射（默认保持接口类型）
+ */
+template <typename Interface>
+struct BackendTraits {
+    using Type = Interface;
+};
+
+#if defined(LRENGINE_STATIC_BACKEND)
+
+namespace detail {
+#if defined(LRENGINE_ENABLE_OPENGL)
+using StaticRenderContext = RenderContextGL;
+using StaticBuffer = gl::BufferGL;
+using StaticShader = gl::ShaderGL;
+using StaticShaderProgram = gl::ShaderProgramGL;
+using StaticTexture = gl::TextureGL;
+using StaticPipelineState = gl::PipelineStateGL;
+#elif defined(LRENGINE_ENABLE_OPENGLES)
+using StaticRenderContext = RenderContextGLES;
+using StaticBuffer = gles::BufferGLES;
+using StaticShader = gles::ShaderGLES;
+using StaticShaderProgram = gles::ShaderProgramGLES;
+using StaticTexture = gles::TextureGLES;
+using StaticPipelineState = gles::PipelineStateGLES;
+#elif defined(LRENGINE_ENABLE_METAL)
+using StaticRenderContext = mtl::RenderContextMTL;
+using StaticBuffer = mtl::BufferMTL;
+using StaticShader = mtl::ShaderMTL;
+using StaticShaderProgram = mtl::ShaderProgramMTL;
+using StaticTexture = mtl::TextureMTL;
+using StaticPipelineState = mtl::PipelineStateMTL;
+#endif
+} // namespace detail
+
+template <>
+struct BackendTraits<IRenderContextImpl> {
+    using Type = detail::StaticRenderContext;
+};
+
+/**
+ * @note 缓冲有顶点/索引/Uniform三个子类，映射到公共基类；
+ *       基类中子类未覆盖的方法声明为 final，仍可去虚化
+ */
+template <>
+struct BackendTraits<IBufferImpl> {
+    using Type = detail::StaticBuffer;
+};
+
+template <>
+struct BackendTraits<IShaderImpl> {
+    using Type = detail::StaticShader;
+};
+
+template <>
+struct BackendTraits<IShaderProgramImpl> {
+    using Type = detail::StaticShaderProgram;
+};
+
+template <>
+struct BackendTraits<ITextureImpl> {
+    using Type = detail::StaticTexture;
+};
+
+template <>
+struct BackendTraits<IPipelineStateImpl> {
+    using Type = detail::StaticPipelineState;
+};
+
+#endif // LRENGINE_STATIC_BACKEND
+
+/**
+ * @brief 将接口指针转换为静态绑定的后端类型
+ */
+template <typename Interface>
+inline typename BackendTraits<Interface>::Type* BackendCast(Interface* impl) {
+    return static_cast<typename BackendTraits<Interface>::Type*>(impl);
+}
+
+} // namespace render
+} // namespace lrengine
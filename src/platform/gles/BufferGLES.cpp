@@ -5,6 +5,7 @@
 
 #include "BufferGLES.h"
 #include "lrengine/core/LRError.h"
+#include "lrengine/core/LRResource.h"
 #include "lrengine/utils/LRLog.h"
 
 #ifdef LRENGINE_ENABLE_OPENGLES
@@ -13,6 +14,13 @@ namespace lrengine {
 namespace render {
 namespace gles {
 
+// 通过绑定来编辑缓冲区；索引缓冲绑定属于当前VAO，需通知前端绑定缓存
+static void NotifyBindToEdit(GLenum target) {
+    if (target == GL_ELEMENT_ARRAY_BUFFER) {
+        LRResource::InvalidateBindings(BindingScope::VertexInput);
+    }
+}
+
 // ============================================================================
 // BufferGLES
 // ============================================================================
@@ -50,6 +58,7 @@ bool BufferGLES::Create(const BufferDescriptor& desc) {
     glBindBuffer(m_target, m_bufferID);
     glBufferData(m_target, m_size, desc.data, m_usage);
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
 
     LR_LOG_DEBUG_F("OpenGL ES Buffer created: ID=%u, size=%zu, type=%d", m_bufferID, m_size,
                    (int)desc.type);
@@ -83,6 +92,7 @@ void BufferGLES::UpdateData(const void* data, size_t size, size_t offset) {
     glBindBuffer(m_target, m_bufferID);
     glBufferSubData(m_target, offset, size, data);
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
 }
 
 void* BufferGLES::Map(MemoryAccess access) {
@@ -125,6 +135,7 @@ void* BufferGLES::Map(MemoryAccess access) {
 
     m_mapped = true;
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
     return ptr;
 }
 
@@ -147,6 +158,7 @@ void BufferGLES::Unmap() {
     }
 
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
     m_mapped = false;
 }
 
@@ -286,6 +298,7 @@ void VertexBufferGLES::SetVertexAttributes(const VertexAttribute* attributes, ui
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
+    LRResource::InvalidateBindings(BindingScope::VertexInput);
 
     LR_LOG_INFO_F("[BufferGLES] SetVertexAttributes completed: VAO=%u, count=%u", m_vao, count);
 }
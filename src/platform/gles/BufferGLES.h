@@ -25,15 +25,15 @@ public:
     // IBufferImpl接口
     bool Create(const BufferDescriptor& desc) override;
     void Destroy() override;
-    void UpdateData(const void* data, size_t size, size_t offset) override;
-    void* Map(MemoryAccess access) override;
-    void Unmap() override;
+    void UpdateData(const void* data, size_t size, size_t offset) final;
+    void* Map(MemoryAccess access) final;
+    void Unmap() final;
     void Bind() override;
     void Unbind() override;
-    ResourceHandle GetNativeHandle() const override;
-    size_t GetSize() const override;
-    BufferUsage GetUsage() const override;
-    BufferType GetType() const override;
+    ResourceHandle GetNativeHandle() const final;
+    size_t GetSize() const final;
+    BufferUsage GetUsage() const final;
+    BufferType GetType() const final;
 
     // OpenGL ES特有方法
     GLuint GetBufferID() const { return m_bufferID; }
@@ -56,7 +56,7 @@ protected:
 /**
  * @brief OpenGL ES顶点缓冲区实现（包含VAO管理）
  */
-class VertexBufferGLES : public BufferGLES {
+class VertexBufferGLES final : public BufferGLES {
 public:
     VertexBufferGLES();
     ~VertexBufferGLES() override;
@@ -79,7 +79,7 @@ private:
 /**
  * @brief OpenGL ES索引缓冲区实现
  */
-class IndexBufferGLES : public BufferGLES {
+class IndexBufferGLES final : public BufferGLES {
 public:
     IndexBufferGLES();
     ~IndexBufferGLES() override;
@@ -97,7 +97,7 @@ private:
 /**
  * @brief OpenGL ES Uniform缓冲区实现
  */
-class UniformBufferGLES : public BufferGLES {
+class UniformBufferGLES final : public BufferGLES {
 public:
     UniformBufferGLES();
     ~UniformBufferGLES() override;
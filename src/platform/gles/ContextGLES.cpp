@@ -107,15 +107,21 @@ IBufferImpl* RenderContextGLES::CreateBufferImpl(BufferType type) {
     }
 }
 
-IShaderImpl* RenderContextGLES::CreateShaderImpl() { return new gles::ShaderGLES(); }
+IShaderImpl* RenderContextGLES::CreateShaderImpl() {
+    return new gles::ShaderGLES(m_capabilities.hasProgramPipeline);
+}
 
 IShaderProgramImpl* RenderContextGLES::CreateShaderProgramImpl() {
     return new gles::ShaderProgramGLES();
 }
 
-ITextureImpl* RenderContextGLES::CreateTextureImpl() { return new gles::TextureGLES(); }
+ITextureImpl* RenderContextGLES::CreateTextureImpl() {
+    return new gles::TextureGLES(m_capabilities.hasTextureNorm16);
+}
 
-IFrameBufferImpl* RenderContextGLES::CreateFrameBufferImpl() { return new gles::FrameBufferGLES(); }
+IFrameBufferImpl* RenderContextGLES::CreateFrameBufferImpl() {
+    return new gles::FrameBufferGLES(m_capabilities.hasMultiview);
+}
 
 IPipelineStateImpl* RenderContextGLES::CreatePipelineStateImpl() {
     return new gles::PipelineStateGLES();
@@ -261,6 +267,14 @@ void RenderContextGLES::DrawArrays(PrimitiveType primitiveType,
     glDrawArrays(mode, vertexStart, vertexCount);
 }
 
+void RenderContextGLES::DrawArraysWithoutVertexInput(PrimitiveType primitiveType,
+                                                     uint32_t vertexStart,
+                                                     uint32_t vertexCount) {
+    // 绑定空的默认VAO，避免沿用上一个顶点缓冲区的属性状态
+    glBindVertexArray(m_defaultVAO);
+    DrawArrays(primitiveType, vertexStart, vertexCount);
+}
+
 void RenderContextGLES::DrawElements(PrimitiveType primitiveType,
                                      uint32_t indexCount,
                                      IndexType indexType,
@@ -349,6 +363,15 @@ void RenderContextGLES::WaitIdle() { glFinish(); }
 
 void RenderContextGLES::Flush() { glFlush(); }
 
+size_t RenderContextGLES::TrimMemory(MemoryTrimLevel level) {
+    // 着色器通常在启动时集中编译，之后释放编译器占用的内存（再次编译时驱动自动重新加载）
+    if (level != MemoryTrimLevel::Low) {
+        glReleaseShaderCompiler();
+    }
+    // 编译器资源不计入释放的对象数
+    return 0;
+}
+
 } // namespace render
 } // namespace lrengine
 
@@ -30,7 +30,7 @@ class FenceGLES;
 /**
  * @brief OpenGL ES渲染上下文实现
  */
-class RenderContextGLES : public IRenderContextImpl {
+class RenderContextGLES final : public IRenderContextImpl {
 public:
     RenderContextGLES();
     ~RenderContextGLES() override;
@@ -73,6 +73,9 @@ public:
 
     // 绘制
     void DrawArrays(PrimitiveType primitiveType, uint32_t vertexStart, uint32_t vertexCount) override;
+    void DrawArraysWithoutVertexInput(PrimitiveType primitiveType,
+                                      uint32_t vertexStart,
+                                      uint32_t vertexCount) override;
     void DrawElements(PrimitiveType primitiveType,
                       uint32_t indexCount,
                       IndexType indexType,
@@ -91,6 +94,13 @@ public:
     void WaitIdle() override;
     void Flush() override;
 
+    // 设备能力
+    uint32_t GetMaxTextureSize() const override {
+        return static_cast<uint32_t>(m_capabilities.maxTextureSize);
+    }
+    bool IsVertexStatePerBuffer() const override { return true; }
+    size_t TrimMemory(MemoryTrimLevel level) override;
+
     // =========================================================================
     // OpenGL ES特有方法
     // =========================================================================
@@ -17,7 +17,7 @@ namespace gles {
 /**
  * @brief OpenGL ES同步栅栏实现
  */
-class FenceGLES : public IFenceImpl {
+class FenceGLES final : public IFenceImpl {
 public:
     FenceGLES();
     ~FenceGLES() override;
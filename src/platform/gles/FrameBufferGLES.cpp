@@ -6,15 +6,40 @@
 #include "FrameBufferGLES.h"
 #include "TextureGLES.h"
 #include "lrengine/core/LRError.h"
+#include "lrengine/core/LRResource.h"
 #include "lrengine/utils/LRLog.h"
 
 #ifdef LRENGINE_ENABLE_OPENGLES
 
+#if defined(__ANDROID__)
+#include <EGL/egl.h>
+#include <GLES2/gl2ext.h>
+#endif
+
 namespace lrengine {
 namespace render {
 namespace gles {
 
-FrameBufferGLES::FrameBufferGLES()
+namespace {
+
+#if defined(__ANDROID__) && defined(GL_OVR_multiview)
+/**
+ * @brief 获取 glFramebufferTextureMultiviewOVR（扩展入口需通过EGL查询）
+ */
+PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC GetFramebufferTextureMultiview() {
+    static PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC s_proc =
+        reinterpret_cast<PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC>(
+            eglGetProcAddress("glFramebufferTextureMultiviewOVR"));
+    return s_proc;
+}
+#define LR_GLES_MULTIVIEW_AVAILABLE 1
+#else
+#define LR_GLES_MULTIVIEW_AVAILABLE 0
+#endif
+
+} // namespace
+
+FrameBufferGLES::FrameBufferGLES(bool supportsMultiview)
     : m_fbo(0)
     , m_depthTexture(0)
     , m_depthStencilRBO(0)
@@ -22,7 +47,9 @@ FrameBufferGLES::FrameBufferGLES()
     , m_height(0)
     , m_samples(1)
     , m_hasDepthStencil(false)
-    , m_depthFormat(PixelFormat::Depth24Stencil8) {}
+    , m_depthFormat(PixelFormat::Depth24Stencil8)
+    , m_viewCount(1)
+    , m_supportsMultiview(supportsMultiview && LR_GLES_MULTIVIEW_AVAILABLE) {}
 
 FrameBufferGLES::~FrameBufferGLES() { Destroy(); }
 
@@ -36,6 +63,12 @@ bool FrameBufferGLES::Create(const FrameBufferDescriptor& desc) {
     m_samples         = desc.samples;
     m_hasDepthStencil = desc.hasDepthStencil;
     m_depthFormat     = desc.depthStencilAttachment.format;
+    m_viewCount       = desc.viewCount > 1 ? desc.viewCount : 1;
+
+    if (m_viewCount > 1 && !m_supportsMultiview) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "OpenGL ES multiview requires GL_OVR_multiview2");
+        return false;
+    }
 
     // 创建帧缓冲对象
     glGenFramebuffers(1, &m_fbo);
@@ -44,6 +77,13 @@ bool FrameBufferGLES::Create(const FrameBufferDescriptor& desc) {
         return false;
     }
 
+    if (m_viewCount > 1) {
+        // 渲染缓冲不能作为多视图附件，附件由调用者以2D数组纹理附加
+        LR_LOG_DEBUG_F("OpenGL ES multiview FBO created: ID=%u, size=%ux%u, views=%u", m_fbo,
+                       m_width, m_height, m_viewCount);
+        return true;
+    }
+
     glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
 
     // 创建颜色附件
@@ -85,6 +125,7 @@ bool FrameBufferGLES::Create(const FrameBufferDescriptor& desc) {
         }
 
         glBindTexture(GL_TEXTURE_2D, 0);
+        LRResource::InvalidateBindings(BindingScope::Texture);
 
         // 设置绘制缓冲区
         if (drawBuffers.size() > 1) {
@@ -197,6 +238,7 @@ void FrameBufferGLES::Destroy() {
     }
 
     m_width = m_height = 0;
+    m_viewCount = 1;
 }
 
 void FrameBufferGLES::Bind() {
@@ -275,10 +317,16 @@ bool FrameBufferGLES::AttachColorTexture(ITextureImpl* texture, uint32_t index,
         return false;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, texGLES->GetTarget(),
-                           texGLES->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (m_viewCount > 1) {
+        if (!attachMultiview(GL_COLOR_ATTACHMENT0 + index, texGLES, mipLevel)) {
+            return false;
+        }
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, texGLES->GetTarget(),
+                               texGLES->GetTextureID(), mipLevel);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
 
     return true;
 }
@@ -294,10 +342,16 @@ bool FrameBufferGLES::AttachDepthTexture(ITextureImpl* texture, uint32_t mipLeve
         return false;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texGLES->GetTarget(),
-                           texGLES->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (m_viewCount > 1) {
+        if (!attachMultiview(GL_DEPTH_ATTACHMENT, texGLES, mipLevel)) {
+            return false;
+        }
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texGLES->GetTarget(),
+                               texGLES->GetTextureID(), mipLevel);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
 
     m_depthTexture = texGLES->GetTextureID();
     return true;
@@ -314,10 +368,16 @@ bool FrameBufferGLES::AttachStencilTexture(ITextureImpl* texture, uint32_t mipLe
         return false;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, texGLES->GetTarget(),
-                           texGLES->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (m_viewCount > 1) {
+        if (!attachMultiview(GL_STENCIL_ATTACHMENT, texGLES, mipLevel)) {
+            return false;
+        }
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, texGLES->GetTarget(),
+                               texGLES->GetTextureID(), mipLevel);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
 
     return true;
 }
@@ -333,15 +393,50 @@ bool FrameBufferGLES::AttachDepthStencilTexture(ITextureImpl* texture, uint32_t
         return false;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, texGLES->GetTarget(),
-                           texGLES->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (m_viewCount > 1) {
+        if (!attachMultiview(GL_DEPTH_STENCIL_ATTACHMENT, texGLES, mipLevel)) {
+            return false;
+        }
+    } else {
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, texGLES->GetTarget(),
+                               texGLES->GetTextureID(), mipLevel);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
 
     m_depthTexture = texGLES->GetTextureID();
     return true;
 }
 
+bool FrameBufferGLES::attachMultiview(GLenum attachment, TextureGLES* texture, uint32_t mipLevel) {
+    if (texture->GetType() != TextureType::Texture2DArray || texture->GetDepth() < m_viewCount) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument,
+                     "Multiview attachment must be a 2D array texture with enough layers");
+        return false;
+    }
+
+#if LR_GLES_MULTIVIEW_AVAILABLE
+    PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC framebufferTextureMultiview =
+        GetFramebufferTextureMultiview();
+    if (framebufferTextureMultiview == nullptr) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "glFramebufferTextureMultiviewOVR not available");
+        return false;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+    framebufferTextureMultiview(GL_FRAMEBUFFER, attachment, texture->GetTextureID(),
+                                static_cast<GLint>(mipLevel), 0,
+                                static_cast<GLsizei>(m_viewCount));
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return true;
+#else
+    (void)attachment;
+    (void)mipLevel;
+    LR_SET_ERROR(ErrorCode::NotSupported, "OpenGL ES multiview not available on this platform");
+    return false;
+#endif
+}
+
 void FrameBufferGLES::Clear(uint32_t flags, const float* color, float depth, uint8_t stencil) {
     GLbitfield clearMask = 0;
 
@@ -15,12 +15,20 @@ namespace lrengine {
 namespace render {
 namespace gles {
 
+class TextureGLES;
+
 /**
  * @brief OpenGL ES帧缓冲实现
+ *
+ * viewCount > 1 时使用 GL_OVR_multiview2，不创建内部附件，
+ * 颜色/深度附件须通过 Attach*Texture 附加 Texture2DArray。
  */
-class FrameBufferGLES : public IFrameBufferImpl {
+class FrameBufferGLES final : public IFrameBufferImpl {
 public:
-    FrameBufferGLES();
+    /**
+     * @param supportsMultiview 设备是否支持多视图（GLESCapabilities::hasMultiview）
+     */
+    explicit FrameBufferGLES(bool supportsMultiview = false);
     ~FrameBufferGLES() override;
 
     // IFrameBufferImpl接口
@@ -57,7 +65,14 @@ public:
      */
     void Invalidate(bool colorInvalid, bool depthInvalid, bool stencilInvalid);
 
+    uint32_t GetViewCount() const override { return m_viewCount; }
+    MultiviewMode GetMultiviewMode() const override {
+        return m_viewCount > 1 ? MultiviewMode::Native : MultiviewMode::None;
+    }
+
 private:
+    bool attachMultiview(GLenum attachment, TextureGLES* texture, uint32_t mipLevel);
+
     GLuint m_fbo;
     std::vector<GLuint> m_colorTextures;
     GLuint m_depthTexture;
@@ -67,6 +82,8 @@ private:
     uint32_t m_samples;
     bool m_hasDepthStencil;
     PixelFormat m_depthFormat;
+    uint32_t m_viewCount;
+    bool m_supportsMultiview;
 };
 
 } // namespace gles
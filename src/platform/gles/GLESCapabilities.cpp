@@ -147,6 +147,8 @@ void GLESCapabilities::DetectExtensions() {
 
     // 其他
     hasClipControl = HasExtension("GL_EXT_clip_control");
+    hasMultiview   = HasExtension("GL_OVR_multiview2");
+    hasTextureNorm16 = HasExtension("GL_EXT_texture_norm16");
 
     // 调试（可能通过扩展获得）
     if (!hasDebugOutput) {
@@ -98,6 +98,8 @@ public:
     bool hasBlendFuncExtended  = false; // 扩展混合函数 (GL_EXT_blend_func_extended)
     bool hasMultiDrawIndirect  = false; // 多重间接绘制 (GL_EXT_multi_draw_indirect)
     bool hasClipControl        = false; // 裁剪控制 (GL_EXT_clip_control)
+    bool hasMultiview          = false; // 多视图渲染 (GL_OVR_multiview2)
+    bool hasTextureNorm16      = false; // 16位归一化纹理 (GL_EXT_texture_norm16)
 
     // =========================================================================
     // 硬件限制
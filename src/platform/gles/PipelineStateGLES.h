@@ -20,7 +20,7 @@ namespace gles {
  * 注意：OpenGL ES不支持某些桌面OpenGL的功能，如：
  * - glPolygonMode（线框模式）
  */
-class PipelineStateGLES : public IPipelineStateImpl {
+class PipelineStateGLES final : public IPipelineStateImpl {
 public:
     PipelineStateGLES();
     ~PipelineStateGLES() override;
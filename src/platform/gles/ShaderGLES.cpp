@@ -19,7 +19,13 @@ namespace gles {
 // ShaderGLES
 // ============================================================================
 
-ShaderGLES::ShaderGLES() : m_shaderID(0), m_stage(ShaderStage::Vertex), m_compiled(false) {}
+ShaderGLES::ShaderGLES(bool supportsProgramPipeline)
+    : m_shaderID(0),
+      m_programID(0),
+      m_stage(ShaderStage::Vertex),
+      m_compiled(false),
+      m_separable(false),
+      m_supportsProgramPipeline(supportsProgramPipeline) {}
 
 ShaderGLES::~ShaderGLES() { Destroy(); }
 
@@ -95,7 +101,7 @@ std::string ShaderGLES::PreprocessGLSLES(const char* source, ShaderStage stage)
 }
 
 bool ShaderGLES::Compile(const ShaderDescriptor& desc) {
-    if (m_shaderID != 0) {
+    if (m_shaderID != 0 || m_programID != 0) {
         Destroy();
     }
 
@@ -110,6 +116,24 @@ bool ShaderGLES::Compile(const ShaderDescriptor& desc) {
         return false;
     }
 
+    // OpenGL ES 不支持SPIR-V，LRShader 已改为传入GLSL回退源码
+    if (desc.language == ShaderLanguage::SPIRV) {
+        m_compileError = "OpenGL ES does not support SPIR-V";
+        LR_SET_ERROR(ErrorCode::NotSupported, m_compileError.c_str());
+        return false;
+    }
+
+    // 预处理着色器源码（添加版本和精度声明）
+    std::string processedSource = PreprocessGLSLES(desc.source, desc.stage);
+
+    if (desc.separable) {
+        if (m_supportsProgramPipeline && LR_GLES_PROGRAM_PIPELINE_AVAILABLE) {
+            return compileSeparable(desc, processedSource);
+        }
+        // 设备不支持时退回普通着色器，由程序按传统方式链接
+        LR_LOG_WARNING("OpenGL ES program pipelines not supported, compiling as regular shader");
+    }
+
     GLenum shaderType = ToGLESShaderStage(desc.stage);
 
     m_shaderID = glCreateShader(shaderType);
@@ -119,9 +143,7 @@ bool ShaderGLES::Compile(const ShaderDescriptor& desc) {
         return false;
     }
 
-    // 预处理着色器源码（添加版本和精度声明）
-    std::string processedSource = PreprocessGLSLES(desc.source, desc.stage);
-    const char* sourcePtr       = processedSource.c_str();
+    const char* sourcePtr = processedSource.c_str();
 
     glShaderSource(m_shaderID, 1, &sourcePtr, nullptr);
     glCompileShader(m_shaderID);
@@ -160,12 +182,68 @@ bool ShaderGLES::Compile(const ShaderDescriptor& desc) {
     return true;
 }
 
+bool ShaderGLES::compileSeparable(const ShaderDescriptor& desc, const std::string& source) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    // glCreateShaderProgramv 编译并链接单阶段程序（GL_PROGRAM_SEPARABLE）
+    const char* sourcePtr = source.c_str();
+    m_programID = glCreateShaderProgramv(ToGLESShaderStage(desc.stage), 1, &sourcePtr);
+    if (m_programID == 0) {
+        m_compileError = "Failed to create separable shader program";
+        LR_SET_ERROR(ErrorCode::ShaderCompileFailed, m_compileError.c_str());
+        return false;
+    }
+
+    LR_LOG_DEBUG_F("OpenGL ES CreateShaderProgramv: stage=%d, name=%s", (int)desc.stage,
+                   desc.debugName ? desc.debugName : "unknown");
+
+    // 编译错误记录在程序的信息日志中
+    GLint success;
+    glGetProgramiv(m_programID, GL_LINK_STATUS, &success);
+
+    if (!success) {
+        GLint logLength;
+        glGetProgramiv(m_programID, GL_INFO_LOG_LENGTH, &logLength);
+
+        if (logLength > 0) {
+            std::vector<char> log(logLength);
+            glGetProgramInfoLog(m_programID, logLength, nullptr, log.data());
+            m_compileError = log.data();
+        } else {
+            m_compileError = "Unknown separable shader error";
+        }
+
+        LR_SET_ERROR(ErrorCode::ShaderCompileFailed, m_compileError.c_str());
+        LR_LOG_ERROR_F("OpenGL ES Separable Shader Failed: %s", m_compileError.c_str());
+        LR_LOG_DEBUG_F("Preprocessed source:\n%s", source.c_str());
+        glDeleteProgram(m_programID);
+        m_programID = 0;
+        return false;
+    }
+
+    m_separable = true;
+    m_compiled  = true;
+    m_compileError.clear();
+    return true;
+#else
+    (void)desc;
+    (void)source;
+    m_compileError = "Program pipelines not available";
+    LR_SET_ERROR(ErrorCode::NotSupported, m_compileError.c_str());
+    return false;
+#endif
+}
+
 void ShaderGLES::Destroy() {
     if (m_shaderID != 0) {
         glDeleteShader(m_shaderID);
         m_shaderID = 0;
     }
-    m_compiled = false;
+    if (m_programID != 0) {
+        glDeleteProgram(m_programID);
+        m_programID = 0;
+    }
+    m_compiled  = false;
+    m_separable = false;
 }
 
 bool ShaderGLES::IsCompiled() const { return m_compiled; }
@@ -176,7 +254,7 @@ ShaderStage ShaderGLES::GetStage() const { return m_stage; }
 
 ResourceHandle ShaderGLES::GetNativeHandle() const {
     ResourceHandle handle;
-    handle.glHandle = m_shaderID;
+    handle.glHandle = m_separable ? m_programID : m_shaderID;
     return handle;
 }
 
@@ -184,12 +262,12 @@ ResourceHandle ShaderGLES::GetNativeHandle() const {
 // ShaderProgramGLES
 // ============================================================================
 
-ShaderProgramGLES::ShaderProgramGLES() : m_programID(0), m_linked(false) {}
+ShaderProgramGLES::ShaderProgramGLES() : m_programID(0), m_pipelineID(0), m_linked(false) {}
 
 ShaderProgramGLES::~ShaderProgramGLES() { Destroy(); }
 
 bool ShaderProgramGLES::Link(IShaderImpl** shaders, uint32_t count) {
-    if (m_programID != 0) {
+    if (m_programID != 0 || m_pipelineID != 0) {
         Destroy();
     }
 
@@ -199,6 +277,27 @@ bool ShaderProgramGLES::Link(IShaderImpl** shaders, uint32_t count) {
         return false;
     }
 
+    // 分离模式的着色器没有着色器对象，只能组合为程序管线
+    uint32_t shaderCount    = 0;
+    uint32_t separableCount = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (shaders[i] != nullptr) {
+            ++shaderCount;
+            if (static_cast<ShaderGLES*>(shaders[i])->IsSeparable()) {
+                ++separableCount;
+            }
+        }
+    }
+
+    if (separableCount > 0) {
+        if (separableCount != shaderCount) {
+            m_linkError = "Cannot mix separable and non-separable shaders";
+            LR_SET_ERROR(ErrorCode::ShaderLinkFailed, m_linkError.c_str());
+            return false;
+        }
+        return linkPipeline(shaders, count);
+    }
+
     m_programID = glCreateProgram();
     if (m_programID == 0) {
         m_linkError = "Failed to create program object";
@@ -265,11 +364,73 @@ bool ShaderProgramGLES::Link(IShaderImpl** shaders, uint32_t count) {
     return true;
 }
 
+bool ShaderProgramGLES::linkPipeline(IShaderImpl** shaders, uint32_t count) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    glGenProgramPipelines(1, &m_pipelineID);
+    if (m_pipelineID == 0) {
+        m_linkError = "Failed to create program pipeline object";
+        LR_SET_ERROR(ErrorCode::ShaderLinkFailed, m_linkError.c_str());
+        return false;
+    }
+
+    // 各阶段程序已在编译时链接，这里只组合阶段
+    for (uint32_t i = 0; i < count; ++i) {
+        if (shaders[i] == nullptr) {
+            continue;
+        }
+
+        ShaderGLES* glesShader = static_cast<ShaderGLES*>(shaders[i]);
+        if (!glesShader->IsCompiled()) {
+            m_linkError = "Attempting to link with uncompiled shader";
+            LR_SET_ERROR(ErrorCode::ShaderLinkFailed, m_linkError.c_str());
+            Destroy();
+            return false;
+        }
+
+        glUseProgramStages(m_pipelineID, ToGLESShaderStageBit(glesShader->GetStage()),
+                           glesShader->GetSeparableProgram());
+        m_stagePrograms.push_back(glesShader->GetSeparableProgram());
+    }
+
+    LR_LOG_DEBUG_F("OpenGL ES ProgramPipeline: %d (%zu stages)", m_pipelineID,
+                   m_stagePrograms.size());
+
+    m_linked = true;
+    m_linkError.clear();
+    return true;
+#else
+    (void)shaders;
+    (void)count;
+    m_linkError = "Program pipelines not available";
+    LR_SET_ERROR(ErrorCode::NotSupported, m_linkError.c_str());
+    return false;
+#endif
+}
+
+template <typename Setter>
+void ShaderProgramGLES::forEachStageUniform(int32_t location, Setter&& setter) {
+    if (location < 0 || location >= static_cast<int32_t>(m_pipelineUniforms.size())) {
+        return;
+    }
+    for (const StageUniform& uniform : m_pipelineUniforms[location]) {
+        setter(uniform.program, uniform.location);
+    }
+}
+
 void ShaderProgramGLES::Destroy() {
     if (m_programID != 0) {
         glDeleteProgram(m_programID);
         m_programID = 0;
     }
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        glDeleteProgramPipelines(1, &m_pipelineID);
+        m_pipelineID = 0;
+    }
+#endif
+    m_stagePrograms.clear();
+    m_pipelineUniforms.clear();
+    m_pipelineUniformIndex.clear();
     m_linked = false;
 }
 
@@ -278,6 +439,15 @@ bool ShaderProgramGLES::IsLinked() const { return m_linked; }
 const char* ShaderProgramGLES::GetLinkError() const { return m_linkError.c_str(); }
 
 void ShaderProgramGLES::Use() {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        // 当前程序优先于程序管线，需先解绑
+        glUseProgram(0);
+        glBindProgramPipeline(m_pipelineID);
+        LR_LOG_DEBUG_F("[ShaderGLES] BindProgramPipeline: %d", m_pipelineID);
+        return;
+    }
+#endif
     if (m_programID != 0) {
         glUseProgram(m_programID);
         LR_LOG_INFO_F("[ShaderGLES] UseProgram: %d", m_programID);
@@ -295,6 +465,30 @@ void ShaderProgramGLES::Use() {
 }
 
 int32_t ShaderProgramGLES::GetUniformLocation(const char* name) {
+    if (m_pipelineID != 0 && name != nullptr) {
+        // 管线模式：location为Uniform表下标，记录该变量在各阶段程序中的位置
+        auto it = m_pipelineUniformIndex.find(name);
+        if (it != m_pipelineUniformIndex.end()) {
+            return it->second;
+        }
+
+        std::vector<StageUniform> stages;
+        for (GLuint program : m_stagePrograms) {
+            GLint location = glGetUniformLocation(program, name);
+            if (location >= 0) {
+                stages.push_back({program, location});
+            }
+        }
+        if (stages.empty()) {
+            return -1;
+        }
+
+        int32_t index = static_cast<int32_t>(m_pipelineUniforms.size());
+        m_pipelineUniforms.push_back(std::move(stages));
+        m_pipelineUniformIndex[name] = index;
+        return index;
+    }
+
     if (m_programID == 0 || name == nullptr) {
         LR_LOG_ERROR_F("[ShaderGLES] GetUniformLocation: invalid program(%d) or name(%s)",
                        m_programID, name ? name : "null");
@@ -307,42 +501,102 @@ int32_t ShaderProgramGLES::GetUniformLocation(const char* name) {
 }
 
 void ShaderProgramGLES::SetUniform1i(int32_t location, int32_t value) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform1i(program, loc, value);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform1i(location, value);
     }
 }
 
 void ShaderProgramGLES::SetUniform1f(int32_t location, float value) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform1f(program, loc, value);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform1f(location, value);
     }
 }
 
 void ShaderProgramGLES::SetUniform2f(int32_t location, float x, float y) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform2f(program, loc, x, y);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform2f(location, x, y);
     }
 }
 
 void ShaderProgramGLES::SetUniform3f(int32_t location, float x, float y, float z) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform3f(program, loc, x, y, z);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform3f(location, x, y, z);
     }
 }
 
 void ShaderProgramGLES::SetUniform4f(int32_t location, float x, float y, float z, float w) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform4f(program, loc, x, y, z, w);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform4f(location, x, y, z, w);
     }
 }
 
 void ShaderProgramGLES::SetUniformMatrix3fv(int32_t location, const float* value, bool transpose) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        if (value != nullptr) {
+            forEachStageUniform(location, [&](GLuint program, GLint loc) {
+                glProgramUniformMatrix3fv(program, loc, 1, transpose ? GL_TRUE : GL_FALSE, value);
+            });
+        }
+        return;
+    }
+#endif
     if (location >= 0 && value != nullptr) {
         glUniformMatrix3fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value);
     }
 }
 
 void ShaderProgramGLES::SetUniformMatrix4fv(int32_t location, const float* value, bool transpose) {
+#if LR_GLES_PROGRAM_PIPELINE_AVAILABLE
+    if (m_pipelineID != 0) {
+        if (value != nullptr) {
+            forEachStageUniform(location, [&](GLuint program, GLint loc) {
+                glProgramUniformMatrix4fv(program, loc, 1, transpose ? GL_TRUE : GL_FALSE, value);
+            });
+        }
+        return;
+    }
+#endif
     if (location >= 0 && value != nullptr) {
         // 检查当前绑定的program是否是此program
         GLint currentProgram = 0;
@@ -370,12 +624,26 @@ void ShaderProgramGLES::SetUniformMatrix4fv(int32_t location, const float* value
 
 ResourceHandle ShaderProgramGLES::GetNativeHandle() const {
     ResourceHandle handle;
-    handle.glHandle = m_programID;
+    handle.glHandle = m_pipelineID != 0 ? m_pipelineID : m_programID;
     return handle;
 }
 
 void ShaderProgramGLES::BindUniformBlock(const char* blockName, uint32_t bindingPoint) {
-    if (m_programID == 0 || blockName == nullptr) {
+    if (blockName == nullptr) {
+        return;
+    }
+
+    if (m_pipelineID != 0) {
+        for (GLuint program : m_stagePrograms) {
+            GLuint blockIndex = glGetUniformBlockIndex(program, blockName);
+            if (blockIndex != GL_INVALID_INDEX) {
+                glUniformBlockBinding(program, blockIndex, bindingPoint);
+            }
+        }
+        return;
+    }
+
+    if (m_programID == 0) {
         return;
     }
 
@@ -8,9 +8,18 @@
 #include "platform/interface/IShaderImpl.h"
 #include "TypeConverterGLES.h"
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #ifdef LRENGINE_ENABLE_OPENGLES
 
+// 头文件声明了ES 3.1入口时才编译程序管线路径
+#if defined(GL_ES_VERSION_3_1)
+#define LR_GLES_PROGRAM_PIPELINE_AVAILABLE 1
+#else
+#define LR_GLES_PROGRAM_PIPELINE_AVAILABLE 0
+#endif
+
 namespace lrengine {
 namespace render {
 namespace gles {
@@ -21,10 +30,16 @@ namespace gles {
  * 支持自动预处理GLSL ES着色器源码，包括：
  * - 自动添加版本声明 (#version 300 es)
  * - 自动添加精度声明 (precision)
+ *
+ * ShaderDescriptor::separable 且设备支持程序管线（ES 3.1+）时，
+ * 编译为独立阶段程序（glCreateShaderProgramv）。
  */
-class ShaderGLES : public IShaderImpl {
+class ShaderGLES final : public IShaderImpl {
 public:
-    ShaderGLES();
+    /**
+     * @param supportsProgramPipeline 设备是否支持程序管线（GLESCapabilities::hasProgramPipeline）
+     */
+    explicit ShaderGLES(bool supportsProgramPipeline = false);
     ~ShaderGLES() override;
 
     // IShaderImpl接口
@@ -38,6 +53,16 @@ public:
     // OpenGL ES特有方法
     GLuint GetShaderID() const { return m_shaderID; }
 
+    /**
+     * @brief 是否编译为独立阶段程序
+     */
+    bool IsSeparable() const { return m_separable; }
+
+    /**
+     * @brief 获取独立阶段程序对象（非分离模式下为0）
+     */
+    GLuint GetSeparableProgram() const { return m_programID; }
+
 private:
     /**
      * @brief 预处理GLSL ES着色器源码
@@ -47,16 +72,24 @@ private:
      */
     std::string PreprocessGLSLES(const char* source, ShaderStage stage);
 
+    bool compileSeparable(const ShaderDescriptor& desc, const std::string& source);
+
     GLuint m_shaderID;
+    GLuint m_programID;
     ShaderStage m_stage;
     bool m_compiled;
+    bool m_separable;
+    bool m_supportsProgramPipeline;
     std::string m_compileError;
 };
 
 /**
  * @brief OpenGL ES着色器程序实现
+ *
+ * 着色器均为分离模式时创建程序管线对象组合各阶段程序，不再链接，
+ * Uniform通过 glProgramUniform* 写入各阶段程序。
  */
-class ShaderProgramGLES : public IShaderProgramImpl {
+class ShaderProgramGLES final : public IShaderProgramImpl {
 public:
     ShaderProgramGLES();
     ~ShaderProgramGLES() override;
@@ -79,12 +112,31 @@ public:
 
     // OpenGL ES特有方法
     GLuint GetProgramID() const { return m_programID; }
+    GLuint GetPipelineID() const { return m_pipelineID; }
     void BindUniformBlock(const char* blockName, uint32_t bindingPoint);
 
 private:
+    /**
+     * @brief 管线模式下某个Uniform在各阶段程序中的位置
+     */
+    struct StageUniform {
+        GLuint program;
+        GLint location;
+    };
+
+    bool linkPipeline(IShaderImpl** shaders, uint32_t count);
+
+    template <typename Setter>
+    void forEachStageUniform(int32_t location, Setter&& setter);
+
     GLuint m_programID;
+    GLuint m_pipelineID;
     bool m_linked;
     std::string m_linkError;
+
+    std::vector<GLuint> m_stagePrograms;                         // 管线各阶段程序（由ShaderGLES持有）
+    std::vector<std::vector<StageUniform>> m_pipelineUniforms;   // 管线模式的Uniform表，下标即location
+    std::unordered_map<std::string, int32_t> m_pipelineUniformIndex;
 };
 
 } // namespace gles
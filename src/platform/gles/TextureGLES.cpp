@@ -5,9 +5,11 @@
 
 #include "TextureGLES.h"
 #include "lrengine/core/LRError.h"
+#include "lrengine/core/LRResource.h"
 #include "lrengine/utils/LRLog.h"
 
 #include <algorithm>
+#include <cstring>
 
 #ifdef LRENGINE_ENABLE_OPENGLES
 
@@ -23,11 +25,23 @@ namespace lrengine {
 namespace render {
 namespace gles {
 
+// 通过绑定到当前纹理单元来编辑纹理（非DSA路径），需通知前端绑定缓存
+static void NotifyBindToEdit() { LRResource::InvalidateBindings(BindingScope::Texture); }
+
+// 完整 mip 链的层数（到 1x1 为止）
+static uint32_t GetFullMipChainLength(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size >>= 1) {
+        ++levels;
+    }
+    return levels;
+}
+
 // ============================================================================
 // TextureGLES
 // ============================================================================
 
-TextureGLES::TextureGLES()
+TextureGLES::TextureGLES(bool supportsNorm16)
     : m_textureID(0)
     , m_target(GL_TEXTURE_2D)
     , m_internalFormat(GL_RGBA8)
@@ -38,7 +52,9 @@ TextureGLES::TextureGLES()
     , m_depth(1)
     , m_mipLevels(1)
     , m_type(TextureType::Texture2D)
-    , m_pixelFormat(PixelFormat::RGBA8) {}
+    , m_pixelFormat(PixelFormat::RGBA8)
+    , m_supportsNorm16(supportsNorm16)
+    , m_readFramebuffer(0) {}
 
 TextureGLES::~TextureGLES() { Destroy(); }
 
@@ -47,12 +63,19 @@ bool TextureGLES::Create(const TextureDescriptor& desc) {
         Destroy();
     }
 
+    if (!m_supportsNorm16 && (desc.format == PixelFormat::R16 || desc.format == PixelFormat::RG16 ||
+                              desc.format == PixelFormat::RGBA16)) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "16-bit normalized textures require GL_EXT_texture_norm16");
+        return false;
+    }
+
     m_type        = desc.type;
     m_pixelFormat = desc.format;
     m_width       = desc.width;
     m_height      = desc.height;
     m_depth       = desc.depth;
-    m_mipLevels   = desc.mipLevels;
+    // mipLevels 为 0 表示完整 mip 链
+    m_mipLevels   = desc.mipLevels != 0 ? desc.mipLevels : GetFullMipChainLength(desc.width, desc.height);
 
     m_target         = ToGLESTextureTarget(desc.type);
     m_internalFormat = ToGLESInternalFormat(desc.format);
@@ -66,6 +89,7 @@ bool TextureGLES::Create(const TextureDescriptor& desc) {
     }
 
     glBindTexture(m_target, m_textureID);
+    NotifyBindToEdit();
 
     // 根据纹理类型创建存储
     switch (m_type) {
@@ -189,6 +213,7 @@ void TextureGLES::SetSamplerParameters(const TextureDescriptor& desc) {
 }
 
 void TextureGLES::Destroy() {
+    releaseReadbacks();
     if (m_textureID != 0) {
         glDeleteTextures(1, &m_textureID);
         m_textureID = 0;
@@ -207,7 +232,15 @@ void TextureGLES::UpdateData(const void* data, uint32_t mipLevel, const TextureR
         return;
     }
 
+    // 立方体贴图须通过区域指定面；多采样纹理不能由CPU上传
+    if (m_type == TextureType::Texture2DMultisample ||
+        (region == nullptr && m_type == TextureType::TextureCube)) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "Texture update not supported for this texture type");
+        return;
+    }
+
     glBindTexture(m_target, m_textureID);
+    NotifyBindToEdit();
 
     if (region != nullptr) {
         // 更新子区域
@@ -219,13 +252,15 @@ void TextureGLES::UpdateData(const void* data, uint32_t mipLevel, const TextureR
 
             case TextureType::Texture3D:
             case TextureType::Texture2DArray:
-                glTexSubImage3D(m_target, mipLevel, region->x, region->y, region->z, region->width,
-                                region->height, region->depth, m_format, m_dataType, data);
+                glTexSubImage3D(m_target, mipLevel, region->x, region->y,
+                                region->z + region->arrayLayer, region->width, region->height,
+                                region->depth, m_format, m_dataType, data);
                 break;
 
             case TextureType::TextureCube:
-                glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + region->z, mipLevel, region->x,
-                                region->y, region->width, region->height, m_format, m_dataType, data);
+                glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + region->z + region->arrayLayer,
+                                mipLevel, region->x, region->y, region->width, region->height,
+                                m_format, m_dataType, data);
                 break;
 
             default:
@@ -235,7 +270,8 @@ void TextureGLES::UpdateData(const void* data, uint32_t mipLevel, const TextureR
         // 更新整个mip level
         uint32_t mipWidth  = std::max(1u, m_width >> mipLevel);
         uint32_t mipHeight = std::max(1u, m_height >> mipLevel);
-        uint32_t mipDepth  = std::max(1u, m_depth >> mipLevel);
+        // 数组层数不随mip级别减少
+        uint32_t mipDepth  = (m_type == TextureType::Texture2DArray) ? m_depth : std::max(1u, m_depth >> mipLevel);
 
         switch (m_type) {
             case TextureType::Texture2D:
@@ -268,6 +304,7 @@ void TextureGLES::GenerateMipmaps() {
     }
 
     glBindTexture(m_target, m_textureID);
+    NotifyBindToEdit();
     glGenerateMipmap(m_target);
     glBindTexture(m_target, 0);
 }
@@ -297,6 +334,124 @@ uint32_t TextureGLES::GetDepth() const { return m_depth; }
 TextureType TextureGLES::GetType() const { return m_type; }
 PixelFormat TextureGLES::GetFormat() const { return m_pixelFormat; }
 
+int32_t TextureGLES::BeginAsyncReadback(uint32_t mipLevel) {
+    if (m_textureID == 0 || m_type != TextureType::Texture2D || mipLevel >= m_mipLevels) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Async readback requires a valid 2D texture mip level");
+        return -1;
+    }
+
+    // OpenGL ES 没有 glGetTexImage，只能经帧缓冲 glReadPixels；
+    // GL_RGBA/GL_UNSIGNED_BYTE 是规范保证可读的组合
+    if (m_pixelFormat != PixelFormat::RGBA8) {
+        LR_SET_ERROR(ErrorCode::TextureFormatNotSupported, "OpenGL ES async readback requires RGBA8");
+        return -1;
+    }
+
+    const uint32_t mipWidth  = std::max(1u, m_width >> mipLevel);
+    const uint32_t mipHeight = std::max(1u, m_height >> mipLevel);
+    const GLsizeiptr size    = static_cast<GLsizeiptr>(mipWidth) * mipHeight * 4;
+
+    size_t slot = 0;
+    while (slot < m_readbacks.size() && m_readbacks[slot].fence != nullptr) {
+        ++slot;
+    }
+    if (slot == m_readbacks.size()) {
+        m_readbacks.emplace_back();
+    }
+    ReadbackSlot& readback = m_readbacks[slot];
+
+    if (m_readFramebuffer == 0) {
+        glGenFramebuffers(1, &m_readFramebuffer);
+    }
+    GLint previousFramebuffer = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_readFramebuffer);
+    glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_textureID,
+                           static_cast<GLint>(mipLevel));
+    if (glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+        LR_SET_ERROR(ErrorCode::FrameBufferIncomplete, "Readback framebuffer incomplete");
+        return -1;
+    }
+
+    if (readback.buffer == 0) {
+        glGenBuffers(1, &readback.buffer);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    if (readback.size != size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        readback.size = size;
+    }
+
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, static_cast<GLsizei>(mipWidth), static_cast<GLsizei>(mipHeight), GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (readback.fence == nullptr) {
+        LR_SET_ERROR(ErrorCode::FenceError, "Failed to create readback fence");
+        return -1;
+    }
+    return static_cast<int32_t>(slot);
+}
+
+bool TextureGLES::ResolveAsyncReadback(int32_t slot, void* dst, bool wait) {
+    if (slot < 0 || static_cast<size_t>(slot) >= m_readbacks.size() ||
+        m_readbacks[slot].fence == nullptr) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid readback slot");
+        return false;
+    }
+    ReadbackSlot& readback = m_readbacks[slot];
+
+    const GLenum result = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                           wait ? GL_TIMEOUT_IGNORED : 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+    if (result == GL_WAIT_FAILED) {
+        LR_SET_ERROR(ErrorCode::FenceError, "Readback fence wait failed");
+        return false;
+    }
+
+    if (dst != nullptr) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback.size, GL_MAP_READ_BIT);
+        if (mapped != nullptr) {
+            std::memcpy(dst, mapped, static_cast<size_t>(readback.size));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        if (mapped == nullptr) {
+            LR_SET_ERROR(ErrorCode::BufferMapFailed, "Failed to map readback buffer");
+            return false;
+        }
+    }
+    return true;
+}
+
+void TextureGLES::releaseReadbacks() {
+    for (ReadbackSlot& readback : m_readbacks) {
+        if (readback.fence != nullptr) {
+            glDeleteSync(readback.fence);
+        }
+        if (readback.buffer != 0) {
+            glDeleteBuffers(1, &readback.buffer);
+        }
+    }
+    m_readbacks.clear();
+    if (m_readFramebuffer != 0) {
+        glDeleteFramebuffers(1, &m_readFramebuffer);
+        m_readFramebuffer = 0;
+    }
+}
+
 // ============================================================================
 // SamplerGLES
 // ============================================================================
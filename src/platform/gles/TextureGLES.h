@@ -8,6 +8,8 @@
 #include "platform/interface/ITextureImpl.h"
 #include "TypeConverterGLES.h"
 
+#include <vector>
+
 #ifdef LRENGINE_ENABLE_OPENGLES
 
 namespace lrengine {
@@ -17,9 +19,12 @@ namespace gles {
 /**
  * @brief OpenGL ES纹理实现
  */
-class TextureGLES : public ITextureImpl {
+class TextureGLES final : public ITextureImpl {
 public:
-    TextureGLES();
+    /**
+     * @param supportsNorm16 设备是否支持 R16/RG16/RGBA16（GLESCapabilities::hasTextureNorm16）
+     */
+    explicit TextureGLES(bool supportsNorm16 = false);
     ~TextureGLES() override;
 
     // ITextureImpl接口
@@ -36,6 +41,8 @@ public:
     TextureType GetType() const override;
     PixelFormat GetFormat() const override;
     uint32_t GetMipLevels() const override { return m_mipLevels; }
+    int32_t BeginAsyncReadback(uint32_t mipLevel) override;
+    bool ResolveAsyncReadback(int32_t slot, void* dst, bool wait) override;
 
     // OpenGL ES特有方法
     GLuint GetTextureID() const { return m_textureID; }
@@ -43,6 +50,16 @@ public:
 
 private:
     void SetSamplerParameters(const TextureDescriptor& desc);
+    void releaseReadbacks();
+
+    /**
+     * @brief 异步回读槽位
+     */
+    struct ReadbackSlot {
+        GLuint buffer   = 0;        // 像素打包缓冲
+        GLsync fence    = nullptr;  // 拷贝完成栅栏，为空表示槽位空闲
+        GLsizeiptr size = 0;        // 缓冲大小（字节）
+    };
 
     GLuint m_textureID;
     GLenum m_target;
@@ -55,6 +72,9 @@ private:
     uint32_t m_mipLevels;
     TextureType m_type;
     PixelFormat m_pixelFormat;
+    bool m_supportsNorm16;  // 是否支持16位归一化格式
+    GLuint m_readFramebuffer;               // 回读用帧缓冲（按需创建）
+    std::vector<ReadbackSlot> m_readbacks;  // 异步回读槽位（按需增长，空闲时复用）
 };
 
 /**
@@ -51,6 +51,13 @@
 #define GL_STENCIL_INDEX 0x1901
 #endif
 
+// GL_EXT_texture_norm16 枚举（部分平台的 ES 3.x 头文件未包含 gl2ext.h）
+#ifndef GL_R16_EXT
+#define GL_R16_EXT    0x822A
+#define GL_RG16_EXT   0x822C
+#define GL_RGBA16_EXT 0x805B
+#endif
+
 // 前向声明
 namespace lrengine {
 namespace render {
@@ -120,6 +127,26 @@ inline GLenum ToGLESShaderStage(ShaderStage stage) {
     }
 }
 
+#ifdef GL_VERTEX_SHADER_BIT
+/**
+ * @brief 转换着色器阶段到程序管线阶段位（ES 3.1+）
+ */
+inline GLbitfield ToGLESShaderStageBit(ShaderStage stage) {
+    switch (stage) {
+        case ShaderStage::Vertex:
+            return GL_VERTEX_SHADER_BIT;
+        case ShaderStage::Fragment:
+            return GL_FRAGMENT_SHADER_BIT;
+#ifdef GL_COMPUTE_SHADER_BIT
+        case ShaderStage::Compute:
+            return GL_COMPUTE_SHADER_BIT;
+#endif
+        default:
+            return 0;
+    }
+}
+#endif
+
 /**
  * @brief 转换纹理类型到OpenGL ES目标
  */
@@ -176,6 +203,13 @@ inline GLenum ToGLESInternalFormat(PixelFormat format) {
             return GL_RGBA32F;
         case PixelFormat::RGB10A2:
             return GL_RGB10_A2;
+        // 16位归一化格式 (需要 GL_EXT_texture_norm16)
+        case PixelFormat::R16:
+            return GL_R16_EXT;
+        case PixelFormat::RG16:
+            return GL_RG16_EXT;
+        case PixelFormat::RGBA16:
+            return GL_RGBA16_EXT;
         // 深度/模板格式
         case PixelFormat::Depth16:
             return GL_DEPTH_COMPONENT16;
@@ -216,10 +250,12 @@ inline GLenum ToGLESInternalFormat(PixelFormat format) {
 inline GLenum ToGLESFormat(PixelFormat format) {
     switch (format) {
         case PixelFormat::R8:
+        case PixelFormat::R16:
         case PixelFormat::R16F:
         case PixelFormat::R32F:
             return GL_RED;
         case PixelFormat::RG8:
+        case PixelFormat::RG16:
         case PixelFormat::RG16F:
         case PixelFormat::RG32F:
             return GL_RG;
@@ -228,6 +264,7 @@ inline GLenum ToGLESFormat(PixelFormat format) {
         case PixelFormat::RGB32F:
             return GL_RGB;
         case PixelFormat::RGBA8:
+        case PixelFormat::RGBA16:
         case PixelFormat::RGBA16F:
         case PixelFormat::RGBA32F:
         case PixelFormat::RGB10A2:
@@ -270,6 +307,9 @@ inline GLenum ToGLESType(PixelFormat format) {
             return GL_FLOAT;
         case PixelFormat::RGB10A2:
             return GL_UNSIGNED_INT_2_10_10_10_REV;
+        case PixelFormat::R16:
+        case PixelFormat::RG16:
+        case PixelFormat::RGBA16:
         case PixelFormat::Depth16:
             return GL_UNSIGNED_SHORT;
         case PixelFormat::Depth24:
@@ -107,6 +107,16 @@ public:
      * @brief 获取颜色附件数量
      */
     virtual uint32_t GetColorAttachmentCount() const = 0;
+
+    /**
+     * @brief 获取视图数量
+     */
+    virtual uint32_t GetViewCount() const { return 1; }
+
+    /**
+     * @brief 获取多视图渲染方式（附加第一个纹理后确定）
+     */
+    virtual MultiviewMode GetMultiviewMode() const { return MultiviewMode::None; }
 };
 
 } // namespace render
@@ -190,6 +190,17 @@ public:
                             uint32_t vertexStart,
                             uint32_t vertexCount) = 0;
 
+    /**
+     * @brief 无顶点输入的绘制（顶点由着色器生成）
+     *
+     * 需要顶点数组对象的后端应先绑定一个空的顶点输入状态，默认与 DrawArrays 相同。
+     */
+    virtual void DrawArraysWithoutVertexInput(PrimitiveType primitiveType,
+                                              uint32_t vertexStart,
+                                              uint32_t vertexCount) {
+        DrawArrays(primitiveType, vertexStart, vertexCount);
+    }
+
     /**
      * @brief 索引绘制
      * @param primitiveType 图元类型
@@ -232,6 +243,37 @@ public:
      * @brief 刷新命令
      */
     virtual void Flush() = 0;
+
+    // =========================================================================
+    // 设备能力
+    // =========================================================================
+
+    /**
+     * @brief 获取2D纹理的最大边长（默认值为 OpenGL ES 规范保证的下限）
+     */
+    virtual uint32_t GetMaxTextureSize() const { return 2048; }
+
+    /**
+     * @brief 顶点输入状态是否随顶点缓冲区整体切换
+     *
+     * OpenGL后端每个顶点缓冲区各有一个VAO，BindVertexBuffer忽略槽位、整体替换
+     * 当前VAO（索引缓冲绑定也属于VAO）。此时绑定缓存按当前VAO而非槽位记录。
+     */
+    virtual bool IsVertexStatePerBuffer() const { return false; }
+
+    // =========================================================================
+    // 内存管理
+    // =========================================================================
+
+    /**
+     * @brief 按级别释放后端内部的空闲缓存（暂存环、状态对象缓存等）
+     * @param level 回收级别
+     * @return 释放的对象数量
+     */
+    virtual size_t TrimMemory(MemoryTrimLevel level) {
+        LR_UNUSED(level);
+        return 0;
+    }
 };
 
 } // namespace render
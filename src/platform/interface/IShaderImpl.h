@@ -24,6 +24,14 @@ public:
      */
     virtual bool Compile(const ShaderDescriptor& desc) = 0;
 
+    /**
+     * @brief 是否接受SPIR-V字节码
+     *
+     * 不支持时 LRShader 在调用 Compile 前改用 fallbackSource（GLSL），
+     * 后端收到的 language 不会是 SPIRV。
+     */
+    virtual bool SupportsSPIRV() const { return false; }
+
     /**
      * @brief 销毁着色器
      */
@@ -125,6 +125,31 @@ public:
         (void)mipLevel;
         return false;
     }
+
+    /**
+     * @brief 发起异步回读（GPU 拷贝到回读缓冲，不阻塞 CPU）
+     * @param mipLevel mipmap 级别（仅支持 2D 纹理）
+     * @return 回读槽位，不支持或失败返回 -1
+     */
+    virtual int32_t BeginAsyncReadback(uint32_t mipLevel) {
+        // 默认实现：不支持异步回读
+        (void)mipLevel;
+        return -1;
+    }
+
+    /**
+     * @brief 取回异步回读结果
+     * @param slot BeginAsyncReadback 返回的槽位
+     * @param dst 目标内存（纹理原生格式，行紧密排列），为空时只释放槽位
+     * @param wait 是否等待 GPU 拷贝完成
+     * @return 数据已就绪返回true（槽位随之释放），未就绪返回false
+     */
+    virtual bool ResolveAsyncReadback(int32_t slot, void* dst, bool wait) {
+        (void)slot;
+        (void)dst;
+        (void)wait;
+        return false;
+    }
 };
 
 } // namespace render
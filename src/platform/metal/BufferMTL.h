@@ -26,15 +26,15 @@ public:
     // IBufferImpl接口
     bool Create(const BufferDescriptor& desc) override;
     void Destroy() override;
-    void UpdateData(const void* data, size_t size, size_t offset) override;
-    void* Map(MemoryAccess access) override;
-    void Unmap() override;
-    void Bind() override;
-    void Unbind() override;
-    ResourceHandle GetNativeHandle() const override;
-    size_t GetSize() const override;
-    BufferUsage GetUsage() const override;
-    BufferType GetType() const override;
+    void UpdateData(const void* data, size_t size, size_t offset) final;
+    void* Map(MemoryAccess access) final;
+    void Unmap() final;
+    void Bind() final;
+    void Unbind() final;
+    ResourceHandle GetNativeHandle() const final;
+    size_t GetSize() const final;
+    BufferUsage GetUsage() const final;
+    BufferType GetType() const final;
 
     // Metal特有方法
     id<MTLBuffer> GetBuffer() const { return m_buffer; }
@@ -51,7 +51,7 @@ protected:
 /**
  * @brief Metal顶点缓冲区实现
  */
-class VertexBufferMTL : public BufferMTL {
+class VertexBufferMTL final : public BufferMTL {
 public:
     VertexBufferMTL(id<MTLDevice> device);
     ~VertexBufferMTL() override;
@@ -70,7 +70,7 @@ private:
 /**
  * @brief Metal索引缓冲区实现
  */
-class IndexBufferMTL : public BufferMTL {
+class IndexBufferMTL final : public BufferMTL {
 public:
     IndexBufferMTL(id<MTLDevice> device);
     ~IndexBufferMTL() override;
@@ -87,7 +87,7 @@ private:
 /**
  * @brief Metal Uniform缓冲区实现
  */
-class UniformBufferMTL : public BufferMTL {
+class UniformBufferMTL final : public BufferMTL {
 public:
     UniformBufferMTL(id<MTLDevice> device);
     ~UniformBufferMTL() override;
@@ -33,7 +33,7 @@ class RenderStateStackMTL;
 /**
  * @brief Metal渲染上下文实现
  */
-class RenderContextMTL : public IRenderContextImpl {
+class RenderContextMTL final : public IRenderContextImpl {
 public:
     RenderContextMTL();
     ~RenderContextMTL() override;
@@ -83,6 +83,8 @@ public:
     void WaitIdle() override;
     void Flush() override;
 
+    uint32_t GetMaxTextureSize() const override;
+
     void BeginFrame() override;
     void EndFrame() override;
 
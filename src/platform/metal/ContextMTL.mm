@@ -509,6 +509,20 @@ void RenderContextMTL::Flush() {
     // 在EndFrame时自动执行
 }
 
+uint32_t RenderContextMTL::GetMaxTextureSize() const {
+    #if TARGET_OS_IPHONE || TARGET_OS_IOS
+        // A9 及以后（Apple3 家族）支持 16384，更早的设备为 8192
+        if (@available(iOS 13.0, *)) {
+            if ([m_device supportsFamily:MTLGPUFamilyApple3]) {
+                return 16384;
+            }
+        }
+        return 8192;
+    #else
+        return 16384;
+    #endif
+}
+
 // =============================================================================
 // 帧控制
 // =============================================================================
@@ -20,7 +20,7 @@ namespace mtl {
  * 
  * 使用MTLSharedEvent实现GPU-CPU同步
  */
-class FenceMTL : public IFenceImpl {
+class FenceMTL final : public IFenceImpl {
 public:
     FenceMTL(id<MTLDevice> device);
     ~FenceMTL() override;
@@ -25,7 +25,7 @@ class RenderContextMTL;
  * Metal没有帧缓冲对象的概念，而是使用渲染通道描述符
  * 这个类管理渲染目标纹理并创建MTLRenderPassDescriptor
  */
-class FrameBufferMTL : public IFrameBufferImpl {
+class FrameBufferMTL final : public IFrameBufferImpl {
 public:
     // 移除context参数，解除循环依赖
     explicit FrameBufferMTL(id<MTLDevice> device);
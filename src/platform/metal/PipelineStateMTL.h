@@ -18,7 +18,7 @@ namespace mtl {
 /**
  * @brief Metal管线状态实现
  */
-class PipelineStateMTL : public IPipelineStateImpl {
+class PipelineStateMTL final : public IPipelineStateImpl {
 public:
     PipelineStateMTL(id<MTLDevice> device);
     ~PipelineStateMTL() override;
@@ -23,7 +23,7 @@ namespace mtl {
  * 注意：Metal不支持单独的着色器对象，
  * 这个类主要用于存储编译后的着色器函数
  */
-class ShaderMTL : public IShaderImpl {
+class ShaderMTL final : public IShaderImpl {
 public:
     ShaderMTL(id<MTLDevice> device);
     ~ShaderMTL() override;
@@ -56,7 +56,7 @@ private:
  * 
  * 管理顶点和片段着色器函数
  */
-class ShaderProgramMTL : public IShaderProgramImpl {
+class ShaderProgramMTL final : public IShaderProgramImpl {
 public:
     ShaderProgramMTL(id<MTLDevice> device);
     ~ShaderProgramMTL() override;
@@ -11,6 +11,8 @@
 
 #import <Metal/Metal.h>
 
+#include <vector>
+
 namespace lrengine {
 namespace render {
 namespace mtl {
@@ -18,7 +20,7 @@ namespace mtl {
 /**
  * @brief Metal纹理实现
  */
-class TextureMTL : public ITextureImpl {
+class TextureMTL final : public ITextureImpl {
 public:
     TextureMTL(id<MTLDevice> device);
     ~TextureMTL() override;
@@ -46,10 +48,21 @@ public:
 
     // 阶段 4 新增：Readback 接口
     bool ReadbackTo(utils::ImageBuffer* buffer, uint32_t mipLevel = 0) override;
+    int32_t BeginAsyncReadback(uint32_t mipLevel) override;
+    bool ResolveAsyncReadback(int32_t slot, void* dst, bool wait) override;
 
 private:
     bool CreateSampler(const SamplerDescriptor& desc);
 
+    /**
+     * @brief 异步回读槽位
+     */
+    struct ReadbackSlot {
+        id<MTLBuffer> buffer = nil;                // 共享存储回读缓冲
+        id<MTLCommandBuffer> commandBuffer = nil;  // 拷贝命令，为 nil 表示槽位空闲
+        size_t size = 0;                           // 有效数据大小（字节）
+    };
+
     id<MTLDevice> m_device;
     id<MTLTexture> m_texture;
     id<MTLSamplerState> m_sampler;
@@ -60,6 +73,9 @@ private:
     uint32_t m_mipLevels;
     TextureType m_type;
     PixelFormat m_format;
+
+    id<MTLCommandQueue> m_readbackQueue;    // 异步回读命令队列（按需创建）
+    std::vector<ReadbackSlot> m_readbacks;  // 异步回读槽位（按需增长，空闲时复用）
 };
 
 } // namespace mtl
@@ -26,6 +26,7 @@ TextureMTL::TextureMTL(id<MTLDevice> device)
     , m_mipLevels(1)
     , m_type(TextureType::Texture2D)
     , m_format(PixelFormat::RGBA8)
+    , m_readbackQueue(nil)
 {
 }
 
@@ -112,6 +113,14 @@ bool TextureMTL::Create(const TextureDescriptor& desc) {
 }
 
 void TextureMTL::Destroy() {
+    // 等待未完成的拷贝，避免命令缓冲引用已释放的纹理
+    for (ReadbackSlot& readback : m_readbacks) {
+        if (readback.commandBuffer) {
+            [readback.commandBuffer waitUntilCompleted];
+        }
+    }
+    m_readbacks.clear();
+    m_readbackQueue = nil;
     m_texture = nil;
     m_sampler = nil;
     m_width = 0;
@@ -147,6 +156,21 @@ void TextureMTL::UpdateData(const void* data, uint32_t mipLevel, const TextureRe
     uint32_t bytesPerRow = width * bytesPerPixel;
     uint32_t bytesPerImage = bytesPerRow * height;
 
+    // 数组纹理与立方体贴图按切片上传（z/arrayLayer 为起始切片，depth 为切片数）
+    if (m_type == TextureType::Texture2DArray || m_type == TextureType::TextureCube) {
+        uint32_t firstSlice = z + (region ? region->arrayLayer : 0);
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (uint32_t i = 0; i < depth; ++i) {
+            [m_texture replaceRegion:MTLRegionMake2D(x, y, width, height)
+                         mipmapLevel:mipLevel
+                               slice:firstSlice + i
+                           withBytes:bytes + static_cast<size_t>(i) * bytesPerImage
+                         bytesPerRow:bytesPerRow
+                       bytesPerImage:bytesPerImage];
+        }
+        return;
+    }
+
     MTLRegion mtlRegion = MTLRegionMake3D(x, y, z, width, height, depth);
     
     [m_texture replaceRegion:mtlRegion
@@ -325,6 +349,91 @@ bool TextureMTL::ReadbackTo(utils::ImageBuffer* buffer, uint32_t mipLevel) {
     return success;
 }
 
+int32_t TextureMTL::BeginAsyncReadback(uint32_t mipLevel) {
+    if (!m_texture || m_type != TextureType::Texture2D || mipLevel >= m_mipLevels) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Async readback requires a valid 2D texture mip level");
+        return -1;
+    }
+
+    const uint32_t bytesPerPixel = GetPixelFormatSize(m_format);
+    if (bytesPerPixel == 0 || IsDepthFormat(m_format)) {
+        LR_SET_ERROR(ErrorCode::TextureFormatNotSupported, "Async readback does not support this format");
+        return -1;
+    }
+    const uint32_t mipWidth = std::max(1u, m_width >> mipLevel);
+    const uint32_t mipHeight = std::max(1u, m_height >> mipLevel);
+    const size_t bytesPerRow = static_cast<size_t>(mipWidth) * bytesPerPixel;
+    const size_t size = bytesPerRow * mipHeight;
+
+    size_t slot = 0;
+    while (slot < m_readbacks.size() && m_readbacks[slot].commandBuffer) {
+        ++slot;
+    }
+    if (slot == m_readbacks.size()) {
+        m_readbacks.emplace_back();
+    }
+    ReadbackSlot& readback = m_readbacks[slot];
+
+    if (!readback.buffer || readback.buffer.length < size) {
+        readback.buffer = [m_device newBufferWithLength:size options:MTLResourceStorageModeShared];
+        if (!readback.buffer) {
+            LR_SET_ERROR(ErrorCode::OutOfMemory, "Failed to create readback buffer");
+            return -1;
+        }
+    }
+    readback.size = size;
+
+    if (!m_readbackQueue) {
+        m_readbackQueue = [m_device newCommandQueue];
+    }
+
+    // blit 拷贝到共享缓冲后立即提交，CPU 不等待
+    id<MTLCommandBuffer> commandBuffer = [m_readbackQueue commandBuffer];
+    id<MTLBlitCommandEncoder> blitEncoder = [commandBuffer blitCommandEncoder];
+    [blitEncoder copyFromTexture:m_texture
+                     sourceSlice:0
+                     sourceLevel:mipLevel
+                    sourceOrigin:MTLOriginMake(0, 0, 0)
+                      sourceSize:MTLSizeMake(mipWidth, mipHeight, 1)
+                        toBuffer:readback.buffer
+               destinationOffset:0
+          destinationBytesPerRow:bytesPerRow
+        destinationBytesPerImage:size];
+    [blitEncoder endEncoding];
+    [commandBuffer commit];
+
+    readback.commandBuffer = commandBuffer;
+    return static_cast<int32_t>(slot);
+}
+
+bool TextureMTL::ResolveAsyncReadback(int32_t slot, void* dst, bool wait) {
+    if (slot < 0 || static_cast<size_t>(slot) >= m_readbacks.size() ||
+        !m_readbacks[slot].commandBuffer) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid readback slot");
+        return false;
+    }
+    ReadbackSlot& readback = m_readbacks[slot];
+
+    if (wait) {
+        [readback.commandBuffer waitUntilCompleted];
+    }
+    const MTLCommandBufferStatus status = readback.commandBuffer.status;
+    if (status != MTLCommandBufferStatusCompleted && status != MTLCommandBufferStatusError) {
+        return false;
+    }
+
+    readback.commandBuffer = nil;
+    if (status == MTLCommandBufferStatusError) {
+        LR_SET_ERROR(ErrorCode::InvalidOperation, "Readback command buffer failed");
+        return false;
+    }
+
+    if (dst) {
+        std::memcpy(dst, readback.buffer.contents, readback.size);
+    }
+    return true;
+}
+
 } // namespace mtl
 } // namespace render
 } // namespace lrengine
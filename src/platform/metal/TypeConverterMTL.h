@@ -109,6 +109,12 @@ inline MTLPixelFormat ToMTLPixelFormat(PixelFormat format) {
             return MTLPixelFormatRGBA32Float;
         case PixelFormat::RGB10A2:
             return MTLPixelFormatRGB10A2Unorm;
+        case PixelFormat::R16:
+            return MTLPixelFormatR16Unorm;
+        case PixelFormat::RG16:
+            return MTLPixelFormatRG16Unorm;
+        case PixelFormat::RGBA16:
+            return MTLPixelFormatRGBA16Unorm;
 
         // 深度格式
         case PixelFormat::Depth16:
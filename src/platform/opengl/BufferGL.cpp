@@ -5,6 +5,7 @@
 
 #include "BufferGL.h"
 #include "lrengine/core/LRError.h"
+#include "lrengine/core/LRResource.h"
 #include "lrengine/utils/LRLog.h"
 
 #ifdef LRENGINE_ENABLE_OPENGL
@@ -13,6 +14,13 @@ namespace lrengine {
 namespace render {
 namespace gl {
 
+// 非DSA路径通过绑定来编辑缓冲区；索引缓冲绑定属于当前VAO，需通知前端绑定缓存
+static void NotifyBindToEdit(GLenum target) {
+    if (target == GL_ELEMENT_ARRAY_BUFFER) {
+        LRResource::InvalidateBindings(BindingScope::VertexInput);
+    }
+}
+
 // ============================================================================
 // BufferGL
 // ============================================================================
@@ -39,6 +47,18 @@ bool BufferGL::Create(const BufferDescriptor& desc) {
     m_target      = ToGLBufferTarget(desc.type);
     m_usage       = ToGLBufferUsage(desc.usage);
 
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glCreateBuffers(1, &m_bufferID);
+        if (m_bufferID == 0) {
+            LR_SET_ERROR(ErrorCode::ResourceCreationFailed, "Failed to create OpenGL buffer");
+            return false;
+        }
+        glNamedBufferData(m_bufferID, static_cast<GLsizeiptr>(m_size), desc.data, m_usage);
+        return true;
+    }
+#endif
+
     glGenBuffers(1, &m_bufferID);
     if (m_bufferID == 0) {
         LR_SET_ERROR(ErrorCode::ResourceCreationFailed, "Failed to generate OpenGL buffer");
@@ -48,6 +68,7 @@ bool BufferGL::Create(const BufferDescriptor& desc) {
     glBindBuffer(m_target, m_bufferID);
     glBufferData(m_target, static_cast<GLsizeiptr>(m_size), desc.data, m_usage);
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
 
     return true;
 }
@@ -73,9 +94,18 @@ void BufferGL::UpdateData(const void* data, size_t size, size_t offset) {
         return;
     }
 
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glNamedBufferSubData(m_bufferID, static_cast<GLintptr>(offset),
+                             static_cast<GLsizeiptr>(size), data);
+        return;
+    }
+#endif
+
     glBindBuffer(m_target, m_bufferID);
     glBufferSubData(m_target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
 }
 
 void* BufferGL::Map(MemoryAccess access) {
@@ -83,8 +113,18 @@ void* BufferGL::Map(MemoryAccess access) {
         return nullptr;
     }
 
-    glBindBuffer(m_target, m_bufferID);
-    void* ptr = glMapBufferRange(m_target, 0, static_cast<GLsizeiptr>(m_size), ToGLMapAccess(access));
+    void* ptr = nullptr;
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        ptr = glMapNamedBufferRange(m_bufferID, 0, static_cast<GLsizeiptr>(m_size),
+                                    ToGLMapAccess(access));
+    } else
+#endif
+    {
+        glBindBuffer(m_target, m_bufferID);
+        ptr = glMapBufferRange(m_target, 0, static_cast<GLsizeiptr>(m_size), ToGLMapAccess(access));
+        NotifyBindToEdit(m_target);
+    }
 
     if (ptr != nullptr) {
         m_mapped = true;
@@ -98,9 +138,18 @@ void BufferGL::Unmap() {
         return;
     }
 
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glUnmapNamedBuffer(m_bufferID);
+        m_mapped = false;
+        return;
+    }
+#endif
+
     glBindBuffer(m_target, m_bufferID);
     glUnmapBuffer(m_target);
     glBindBuffer(m_target, 0);
+    NotifyBindToEdit(m_target);
     m_mapped = false;
 }
 
@@ -134,8 +183,15 @@ VertexBufferGL::VertexBufferGL() : m_vao(0), m_stride(0) {}
 VertexBufferGL::~VertexBufferGL() { Destroy(); }
 
 bool VertexBufferGL::Create(const BufferDescriptor& desc) {
-    // 创建VAO
-    glGenVertexArrays(1, &m_vao);
+    // 创建VAO（DSA要求对象由glCreate*创建，glGen*的名字在首次绑定前不可用）
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glCreateVertexArrays(1, &m_vao);
+    } else
+#endif
+    {
+        glGenVertexArrays(1, &m_vao);
+    }
     if (m_vao == 0) {
         LR_SET_ERROR(ErrorCode::ResourceCreationFailed, "Failed to generate VAO");
         return false;
@@ -181,6 +237,13 @@ void VertexBufferGL::SetVertexAttributes(const VertexAttribute* attributes, uint
         return;
     }
 
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        setVertexAttributesDSA(attributes, count);
+        return;
+    }
+#endif
+
     glBindVertexArray(m_vao);
     BufferGL::Bind();
 
@@ -192,27 +255,60 @@ void VertexBufferGL::SetVertexAttributes(const VertexAttribute* attributes, uint
         GLenum type          = GetVertexFormatType(attr.format);
         GLint components     = GetVertexFormatComponents(attr.format);
         GLboolean normalized = IsVertexFormatNormalized(attr.format);
+        GLsizei stride       = static_cast<GLsizei>(attr.stride > 0 ? attr.stride : m_stride);
 
         // 整数类型使用glVertexAttribIPointer
         if (type == GL_INT || type == GL_UNSIGNED_INT || type == GL_SHORT ||
             type == GL_UNSIGNED_SHORT || type == GL_BYTE || type == GL_UNSIGNED_BYTE) {
             if (!normalized) {
-                glVertexAttribIPointer(attr.location, components, type,
-                                       static_cast<GLsizei>(m_stride),
+                glVertexAttribIPointer(attr.location, components, type, stride,
                                        reinterpret_cast<const void*>(
                                            static_cast<uintptr_t>(attr.offset)));
                 continue;
             }
         }
 
-        glVertexAttribPointer(attr.location, components, type, normalized,
-                              static_cast<GLsizei>(m_stride),
+        glVertexAttribPointer(attr.location, components, type, normalized, stride,
                               reinterpret_cast<const void*>(static_cast<uintptr_t>(attr.offset)));
     }
 
     glBindVertexArray(0);
     BufferGL::Unbind();
+    LRResource::InvalidateBindings(BindingScope::VertexInput);
+}
+
+#if LR_GL_DSA_AVAILABLE
+void VertexBufferGL::setVertexAttributesDSA(const VertexAttribute* attributes, uint32_t count) {
+    // 与glVertexAttribPointer等价：每个属性使用与其location同号的绑定点，偏移记在绑定点上
+    for (uint32_t i = 0; i < count; ++i) {
+        const VertexAttribute& attr = attributes[i];
+
+        GLenum type          = GetVertexFormatType(attr.format);
+        GLint components     = GetVertexFormatComponents(attr.format);
+        GLboolean normalized = IsVertexFormatNormalized(attr.format);
+
+        // 绑定点步长0表示每个顶点读同一元素，而非DSA路径的0表示按属性大小紧密排列
+        uint32_t stride = attr.stride > 0 ? attr.stride : m_stride;
+        if (stride == 0) {
+            stride = GetVertexFormatSize(attr.format);
+        }
+
+        const GLuint bindingIndex = attr.location;
+        glVertexArrayVertexBuffer(m_vao, bindingIndex, GetBufferID(),
+                                  static_cast<GLintptr>(attr.offset), static_cast<GLsizei>(stride));
+        glEnableVertexArrayAttrib(m_vao, attr.location);
+
+        bool isInteger = type == GL_INT || type == GL_UNSIGNED_INT || type == GL_SHORT ||
+                         type == GL_UNSIGNED_SHORT || type == GL_BYTE || type == GL_UNSIGNED_BYTE;
+        if (isInteger && !normalized) {
+            glVertexArrayAttribIFormat(m_vao, attr.location, components, type, 0);
+        } else {
+            glVertexArrayAttribFormat(m_vao, attr.location, components, type, normalized, 0);
+        }
+        glVertexArrayAttribBinding(m_vao, attr.location, bindingIndex);
+    }
 }
+#endif
 
 // ============================================================================
 // IndexBufferGL
@@ -7,6 +7,7 @@
 
 #include "platform/interface/IBufferImpl.h"
 #include "TypeConverterGL.h"
+#include "CapabilitiesGL.h"
 
 #ifdef LRENGINE_ENABLE_OPENGL
 
@@ -25,15 +26,15 @@ public:
     // IBufferImpl接口
     bool Create(const BufferDescriptor& desc) override;
     void Destroy() override;
-    void UpdateData(const void* data, size_t size, size_t offset) override;
-    void* Map(MemoryAccess access) override;
-    void Unmap() override;
+    void UpdateData(const void* data, size_t size, size_t offset) final;
+    void* Map(MemoryAccess access) final;
+    void Unmap() final;
     void Bind() override;
     void Unbind() override;
-    ResourceHandle GetNativeHandle() const override;
-    size_t GetSize() const override;
-    BufferUsage GetUsage() const override;
-    BufferType GetType() const override;
+    ResourceHandle GetNativeHandle() const final;
+    size_t GetSize() const final;
+    BufferUsage GetUsage() const final;
+    BufferType GetType() const final;
 
     // OpenGL特有方法
     GLuint GetBufferID() const { return m_bufferID; }
@@ -52,7 +53,7 @@ private:
 /**
  * @brief OpenGL顶点缓冲区实现（包含VAO管理）
  */
-class VertexBufferGL : public BufferGL {
+class VertexBufferGL final : public BufferGL {
 public:
     VertexBufferGL();
     ~VertexBufferGL() override;
@@ -68,6 +69,10 @@ public:
     GLuint GetVAO() const { return m_vao; }
 
 private:
+#if LR_GL_DSA_AVAILABLE
+    void setVertexAttributesDSA(const VertexAttribute* attributes, uint32_t count);
+#endif
+
     GLuint m_vao;
     uint32_t m_stride;
 };
@@ -75,7 +80,7 @@ private:
 /**
  * @brief OpenGL索引缓冲区实现
  */
-class IndexBufferGL : public BufferGL {
+class IndexBufferGL final : public BufferGL {
 public:
     IndexBufferGL();
     ~IndexBufferGL() override;
@@ -93,7 +98,7 @@ private:
 /**
  * @brief OpenGL Uniform缓冲区实现
  */
-class UniformBufferGL : public BufferGL {
+class UniformBufferGL final : public BufferGL {
 public:
     UniformBufferGL();
     ~UniformBufferGL() override;
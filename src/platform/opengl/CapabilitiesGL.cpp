@@ -0,0 +1,88 @@
+/**
+ * @file CapabilitiesGL.cpp
+ * @brief OpenGL能力检测实现
+ */
+
+#include "CapabilitiesGL.h"
+#include "lrengine/utils/LRLog.h"
+
+#ifdef LRENGINE_ENABLE_OPENGL
+
+namespace lrengine {
+namespace render {
+namespace gl {
+
+CapabilitiesGL& CapabilitiesGL::Get() {
+    static CapabilitiesGL s_capabilities;
+    return s_capabilities;
+}
+
+void CapabilitiesGL::Initialize() {
+    glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+    glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+
+    m_extensionsString.clear();
+    GLint numExtensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+    for (GLint i = 0; i < numExtensions; ++i) {
+        const char* ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (ext) {
+            m_extensionsString += ext;
+            m_extensionsString += " ";
+        }
+    }
+
+#if LR_GL_DSA_AVAILABLE
+    hasDirectStateAccess = majorVersion > 4 || (majorVersion == 4 && minorVersion >= 5) ||
+                           HasExtension("GL_ARB_direct_state_access");
+#else
+    hasDirectStateAccess = false;
+#endif
+
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    hasSeparateShaderObjects = majorVersion > 4 || (majorVersion == 4 && minorVersion >= 1) ||
+                               HasExtension("GL_ARB_separate_shader_objects");
+#else
+    hasSeparateShaderObjects = false;
+#endif
+
+    // GL_ARB_gl_spirv 的入口带ARB后缀，只在核心4.6下使用
+#if LR_GL_SPIRV_AVAILABLE
+    hasSPIRV = majorVersion > 4 || (majorVersion == 4 && minorVersion >= 6);
+#else
+    hasSPIRV = false;
+#endif
+
+#if LR_GL_MULTIVIEW_AVAILABLE
+    hasMultiview = HasExtension("GL_OVR_multiview2");
+#else
+    hasMultiview = false;
+#endif
+    hasVertexShaderLayer = HasExtension("GL_ARB_shader_viewport_layer_array") ||
+                           HasExtension("GL_AMD_vertex_shader_layer");
+
+    LR_LOG_INFO_F("OpenGL %d.%d, direct state access: %s, separate shader objects: %s, SPIR-V: %s",
+                  majorVersion, minorVersion, hasDirectStateAccess ? "yes" : "no",
+                  hasSeparateShaderObjects ? "yes" : "no", hasSPIRV ? "yes" : "no");
+    LR_LOG_INFO_F("OpenGL multiview: %s, vertex shader layer: %s", hasMultiview ? "yes" : "no",
+                  hasVertexShaderLayer ? "yes" : "no");
+}
+
+bool CapabilitiesGL::HasExtension(const char* extensionName) const {
+    if (!extensionName || m_extensionsString.empty()) {
+        return false;
+    }
+
+    // 确保完整匹配扩展名
+    std::string searchStr        = std::string(" ") + extensionName + " ";
+    std::string paddedExtensions = " " + m_extensionsString;
+
+    return paddedExtensions.find(searchStr) != std::string::npos;
+}
+
+} // namespace gl
+} // namespace render
+} // namespace lrengine
+
+#endif // LRENGINE_ENABLE_OPENGL
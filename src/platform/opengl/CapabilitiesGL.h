@@ -0,0 +1,132 @@
+/**
+ * @file CapabilitiesGL.h
+ * @brief OpenGL能力检测
+ */
+
+#pragma once
+
+#include "TypeConverterGL.h"
+#include <string>
+
+#ifdef LRENGINE_ENABLE_OPENGL
+
+// 头文件声明了GL 4.5入口时才编译DSA路径（macOS最高支持GL 4.1）
+#if defined(GL_VERSION_4_5)
+#define LR_GL_DSA_AVAILABLE 1
+#else
+#define LR_GL_DSA_AVAILABLE 0
+#endif
+
+// 分离着色器对象（程序管线）为GL 4.1核心功能
+#if defined(GL_VERSION_4_1)
+#define LR_GL_SEPARATE_SHADERS_AVAILABLE 1
+#else
+#define LR_GL_SEPARATE_SHADERS_AVAILABLE 0
+#endif
+
+// SPIR-V着色器（glSpecializeShader）为GL 4.6核心功能
+#if defined(GL_VERSION_4_6)
+#define LR_GL_SPIRV_AVAILABLE 1
+#else
+#define LR_GL_SPIRV_AVAILABLE 0
+#endif
+
+// 多视图（GL_OVR_multiview2）需要头文件声明扩展入口
+#if defined(GL_OVR_multiview)
+#define LR_GL_MULTIVIEW_AVAILABLE 1
+#else
+#define LR_GL_MULTIVIEW_AVAILABLE 0
+#endif
+
+namespace lrengine {
+namespace render {
+namespace gl {
+
+/**
+ * @brief OpenGL能力检测类
+ *
+ * 由RenderContextGL在初始化时填充，资源实现通过Get()查询。
+ */
+class CapabilitiesGL {
+public:
+    /**
+     * @brief 获取全局能力信息
+     */
+    static CapabilitiesGL& Get();
+
+    /**
+     * @brief 初始化能力检测
+     * @note 必须在OpenGL上下文创建后调用
+     */
+    void Initialize();
+
+    /**
+     * @brief 检查是否支持指定扩展
+     */
+    bool HasExtension(const char* extensionName) const;
+
+public:
+    int majorVersion = 3;                   // 主版本号
+    int minorVersion = 3;                   // 次版本号
+    int maxTextureSize = 2048;              // 2D纹理最大边长
+    bool hasDirectStateAccess = false;      // GL 4.5 或 GL_ARB_direct_state_access
+    bool hasSeparateShaderObjects = false;  // GL 4.1 或 GL_ARB_separate_shader_objects
+    bool hasSPIRV = false;                  // GL 4.6
+    bool hasMultiview = false;              // GL_OVR_multiview2
+    bool hasVertexShaderLayer = false;      // GL_ARB_shader_viewport_layer_array（分层多视图回退）
+
+private:
+    std::string m_extensionsString;
+};
+
+/**
+ * @brief 是否使用DSA（直接状态访问）路径
+ *
+ * DSA路径下资源的创建/更新不再修改当前绑定，不会干扰绘制状态。
+ */
+inline bool UseDSA() {
+#if LR_GL_DSA_AVAILABLE
+    return CapabilitiesGL::Get().hasDirectStateAccess;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief 是否支持分离着色器对象（程序管线）
+ */
+inline bool UseSeparateShaderObjects() {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    return CapabilitiesGL::Get().hasSeparateShaderObjects;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief 是否支持原生多视图渲染
+ */
+inline bool UseMultiview() {
+#if LR_GL_MULTIVIEW_AVAILABLE
+    return CapabilitiesGL::Get().hasMultiview;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief 是否支持SPIR-V着色器
+ */
+inline bool UseSPIRV() {
+#if LR_GL_SPIRV_AVAILABLE
+    return CapabilitiesGL::Get().hasSPIRV;
+#else
+    return false;
+#endif
+}
+
+} // namespace gl
+} // namespace render
+} // namespace lrengine
+
+#endif // LRENGINE_ENABLE_OPENGL
@@ -9,6 +9,7 @@
 #ifdef LRENGINE_ENABLE_OPENGL
 
 #include "BufferGL.h"
+#include "CapabilitiesGL.h"
 #include "ShaderGL.h"
 #include "TextureGL.h"
 #include "FrameBufferGL.h"
@@ -34,6 +35,9 @@ bool RenderContextGL::Initialize(const RenderContextDescriptor& desc) {
     // 注意：实际的OpenGL上下文创建需要平台特定代码（GLFW等）
     // 这里假设OpenGL上下文已经由外部创建并设置为当前
 
+    // 检测版本与扩展（决定是否启用DSA路径）
+    gl::CapabilitiesGL::Get().Initialize();
+
     // 创建默认VAO（OpenGL Core Profile需要）
     // 注意：不立即绑定，由VertexBuffer自己管理VAO
     glGenVertexArrays(1, &mDefaultVAO);
@@ -174,11 +178,18 @@ void RenderContextGL::BeginRenderPass(IFrameBufferImpl* frameBuffer) {
     glDepthMask(GL_TRUE);
     LR_LOG_TRACE("  Depth Write: Forced to ENABLED for Clear operation");
 
+    mInstanceMultiplier = 1;
+
     if (frameBuffer) {
         // 绑定离屏FBO，并设置视口
         frameBuffer->Bind();
         LR_LOG_TRACE_F("  Viewport: %ux%u (offscreen FBO)", frameBuffer->GetWidth(),
                        frameBuffer->GetHeight());
+
+        // 分层多视图：一次提交绘制所有视图，着色器按实例号写 gl_Layer
+        if (frameBuffer->GetMultiviewMode() == MultiviewMode::Layered) {
+            mInstanceMultiplier = frameBuffer->GetViewCount();
+        }
     } else {
         // 绑定默认framebuffer（屏幕）
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -190,6 +201,7 @@ void RenderContextGL::BeginRenderPass(IFrameBufferImpl* frameBuffer) {
 
 void RenderContextGL::EndRenderPass() {
     LR_LOG_TRACE("OpenGL EndRenderPass");
+    mInstanceMultiplier = 1;
     // OpenGL不需要显式结束渲染通道
     // 但为了确保多Pass渲染的同步，调用Flush确保命令提交
     glFlush();
@@ -202,9 +214,21 @@ void RenderContextGL::DrawArrays(PrimitiveType primitiveType,
     LR_LOG_TRACE_F("OpenGL DrawArrays: type=%d, start=%u, count=%u", (int)primitiveType,
                    vertexStart, vertexCount);
     GLenum mode = gl::ToGLPrimitiveType(primitiveType);
+    if (mInstanceMultiplier > 1) {
+        glDrawArraysInstanced(mode, vertexStart, vertexCount, mInstanceMultiplier);
+        return;
+    }
     glDrawArrays(mode, vertexStart, vertexCount);
 }
 
+void RenderContextGL::DrawArraysWithoutVertexInput(PrimitiveType primitiveType,
+                                                   uint32_t vertexStart,
+                                                   uint32_t vertexCount) {
+    // Core Profile 下绘制必须绑定VAO，空的默认VAO不启用任何属性
+    glBindVertexArray(mDefaultVAO);
+    DrawArrays(primitiveType, vertexStart, vertexCount);
+}
+
 void RenderContextGL::DrawElements(PrimitiveType primitiveType,
                                    uint32_t indexCount,
                                    IndexType indexType,
@@ -213,6 +237,11 @@ void RenderContextGL::DrawElements(PrimitiveType primitiveType,
                    (int)primitiveType, indexCount, (int)indexType, indexOffset);
     GLenum mode = gl::ToGLPrimitiveType(primitiveType);
     GLenum type = gl::ToGLIndexType(indexType);
+    if (mInstanceMultiplier > 1) {
+        glDrawElementsInstanced(mode, indexCount, type, reinterpret_cast<const void*>(indexOffset),
+                                mInstanceMultiplier);
+        return;
+    }
     glDrawElements(mode, indexCount, type, reinterpret_cast<const void*>(indexOffset));
 }
 
@@ -221,7 +250,7 @@ void RenderContextGL::DrawArraysInstanced(PrimitiveType primitiveType,
                                           uint32_t vertexCount,
                                           uint32_t instanceCount) {
     GLenum mode = gl::ToGLPrimitiveType(primitiveType);
-    glDrawArraysInstanced(mode, vertexStart, vertexCount, instanceCount);
+    glDrawArraysInstanced(mode, vertexStart, vertexCount, instanceCount * mInstanceMultiplier);
 }
 
 void RenderContextGL::DrawElementsInstanced(PrimitiveType primitiveType,
@@ -232,13 +261,32 @@ void RenderContextGL::DrawElementsInstanced(PrimitiveType primitiveType,
     GLenum mode = gl::ToGLPrimitiveType(primitiveType);
     GLenum type = gl::ToGLIndexType(indexType);
     glDrawElementsInstanced(mode, indexCount, type, reinterpret_cast<const void*>(indexOffset),
-                            instanceCount);
+                            instanceCount * mInstanceMultiplier);
 }
 
 void RenderContextGL::WaitIdle() { glFinish(); }
 
 void RenderContextGL::Flush() { glFlush(); }
 
+uint32_t RenderContextGL::GetMaxTextureSize() const {
+    return static_cast<uint32_t>(gl::CapabilitiesGL::Get().maxTextureSize);
+}
+
+size_t RenderContextGL::TrimMemory(MemoryTrimLevel level) {
+    // 着色器通常在启动时集中编译，之后释放编译器占用的内存（再次编译时驱动自动重新加载）
+#if defined(GL_VERSION_4_1)
+    const gl::CapabilitiesGL& caps = gl::CapabilitiesGL::Get();
+    if (level != MemoryTrimLevel::Low &&
+        (caps.majorVersion > 4 || (caps.majorVersion == 4 && caps.minorVersion >= 1))) {
+        glReleaseShaderCompiler();
+    }
+#else
+    LR_UNUSED(level);
+#endif
+    // 编译器资源不计入释放的对象数
+    return 0;
+}
+
 } // namespace render
 } // namespace lrengine
 
@@ -23,7 +23,7 @@ namespace render {
 /**
  * @brief OpenGL渲染上下文实现
  */
-class RenderContextGL : public IRenderContextImpl {
+class RenderContextGL final : public IRenderContextImpl {
 public:
     RenderContextGL();
     ~RenderContextGL() override;
@@ -58,6 +58,9 @@ public:
     void EndRenderPass() override;
 
     void DrawArrays(PrimitiveType primitiveType, uint32_t vertexStart, uint32_t vertexCount) override;
+    void DrawArraysWithoutVertexInput(PrimitiveType primitiveType,
+                                      uint32_t vertexStart,
+                                      uint32_t vertexCount) override;
     void DrawElements(PrimitiveType primitiveType,
                       uint32_t indexCount,
                       IndexType indexType,
@@ -75,6 +78,10 @@ public:
     void WaitIdle() override;
     void Flush() override;
 
+    uint32_t GetMaxTextureSize() const override;
+    bool IsVertexStatePerBuffer() const override { return true; }
+    size_t TrimMemory(MemoryTrimLevel level) override;
+
 private:
     void* mWindowHandle = nullptr;
     uint32_t mWidth     = 0;
@@ -83,6 +90,9 @@ private:
 
     // 默认VAO（OpenGL Core Profile需要）
     GLuint mDefaultVAO = 0;
+
+    // 分层多视图渲染通道中，每次绘制的实例数乘以视图数
+    uint32_t mInstanceMultiplier = 1;
 };
 
 } // namespace render
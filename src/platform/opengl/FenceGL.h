@@ -19,7 +19,7 @@ namespace gl {
  * 
  * 使用glFenceSync实现GPU-CPU同步
  */
-class FenceGL : public IFenceImpl {
+class FenceGL final : public IFenceImpl {
 public:
     FenceGL();
     ~FenceGL() override;
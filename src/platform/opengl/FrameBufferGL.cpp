@@ -5,6 +5,7 @@
 
 #include "FrameBufferGL.h"
 #include "TextureGL.h"
+#include "CapabilitiesGL.h"
 #include "lrengine/core/LRError.h"
 #include "lrengine/utils/LRLog.h"
 #ifdef LRENGINE_ENABLE_OPENGL
@@ -18,7 +19,13 @@ namespace gl {
 // ============================================================================
 
 FrameBufferGL::FrameBufferGL()
-    : m_fboID(0), m_width(0), m_height(0), m_hasDepth(false), m_hasStencil(false) {}
+    : m_fboID(0),
+      m_width(0),
+      m_height(0),
+      m_viewCount(1),
+      m_multiviewMode(MultiviewMode::None),
+      m_hasDepth(false),
+      m_hasStencil(false) {}
 
 FrameBufferGL::~FrameBufferGL() { Destroy(); }
 
@@ -27,10 +34,19 @@ bool FrameBufferGL::Create(const FrameBufferDescriptor& desc) {
         Destroy();
     }
 
-    m_width  = desc.width;
-    m_height = desc.height;
-
-    glGenFramebuffers(1, &m_fboID);
+    m_width         = desc.width;
+    m_height        = desc.height;
+    m_viewCount     = desc.viewCount > 1 ? desc.viewCount : 1;
+    m_multiviewMode = MultiviewMode::None;
+
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glCreateFramebuffers(1, &m_fboID);
+    } else
+#endif
+    {
+        glGenFramebuffers(1, &m_fboID);
+    }
     if (m_fboID == 0) {
         LR_SET_ERROR(ErrorCode::FrameBufferIncomplete, "Failed to create framebuffer");
         return false;
@@ -47,6 +63,8 @@ void FrameBufferGL::Destroy() {
     }
     m_drawBuffers.clear();
     m_width = m_height = 0;
+    m_viewCount     = 1;
+    m_multiviewMode = MultiviewMode::None;
     m_hasDepth = m_hasStencil = false;
 }
 
@@ -58,16 +76,9 @@ bool FrameBufferGL::AttachColorTexture(ITextureImpl* texture, uint32_t index, ui
 
     TextureGL* glTexture = static_cast<TextureGL*>(texture);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
-
     GLenum attachment = GL_COLOR_ATTACHMENT0 + index;
-
-    if (glTexture->GetType() == TextureType::TextureCube) {
-        // CubeMap需要特殊处理
-        glFramebufferTexture(GL_FRAMEBUFFER, attachment, glTexture->GetTextureID(), mipLevel);
-    } else {
-        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, glTexture->GetTarget(),
-                               glTexture->GetTextureID(), mipLevel);
+    if (!attachTexture(attachment, glTexture, mipLevel)) {
+        return false;
     }
 
     // 更新绘制缓冲区列表
@@ -78,8 +89,6 @@ bool FrameBufferGL::AttachColorTexture(ITextureImpl* texture, uint32_t index, ui
 
     LR_LOG_DEBUG_F("OpenGL Attach Color Texture: %d, Attachment: %d, FBO: %d",
                    glTexture->GetTextureID(), attachment, m_fboID);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
     return true;
 }
 
@@ -91,10 +100,9 @@ bool FrameBufferGL::AttachDepthTexture(ITextureImpl* texture, uint32_t mipLevel)
 
     TextureGL* glTexture = static_cast<TextureGL*>(texture);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, glTexture->GetTarget(),
-                           glTexture->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!attachTexture(GL_DEPTH_ATTACHMENT, glTexture, mipLevel)) {
+        return false;
+    }
 
     LR_LOG_DEBUG_F("OpenGL Attach Depth Texture: %d, FBO: %d", glTexture->GetTextureID(), m_fboID);
     m_hasDepth = true;
@@ -109,10 +117,9 @@ bool FrameBufferGL::AttachStencilTexture(ITextureImpl* texture, uint32_t mipLeve
 
     TextureGL* glTexture = static_cast<TextureGL*>(texture);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, glTexture->GetTarget(),
-                           glTexture->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!attachTexture(GL_STENCIL_ATTACHMENT, glTexture, mipLevel)) {
+        return false;
+    }
 
     m_hasStencil = true;
     return true;
@@ -126,10 +133,9 @@ bool FrameBufferGL::AttachDepthStencilTexture(ITextureImpl* texture, uint32_t mi
 
     TextureGL* glTexture = static_cast<TextureGL*>(texture);
 
-    glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, glTexture->GetTarget(),
-                           glTexture->GetTextureID(), mipLevel);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!attachTexture(GL_DEPTH_STENCIL_ATTACHMENT, glTexture, mipLevel)) {
+        return false;
+    }
 
     m_hasDepth   = true;
     m_hasStencil = true;
@@ -141,6 +147,12 @@ bool FrameBufferGL::IsComplete() const {
         return false;
     }
 
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        return glCheckNamedFramebufferStatus(m_fboID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    }
+#endif
+
     glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
     GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
@@ -148,6 +160,84 @@ bool FrameBufferGL::IsComplete() const {
     return status == GL_FRAMEBUFFER_COMPLETE;
 }
 
+bool FrameBufferGL::attachTexture(GLenum attachment, TextureGL* texture, uint32_t mipLevel) {
+    if (m_viewCount > 1) {
+        return attachMultiview(attachment, texture, mipLevel);
+    }
+
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glNamedFramebufferTexture(m_fboID, attachment, texture->GetTextureID(), mipLevel);
+        return true;
+    }
+#endif
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
+    if (texture->GetType() == TextureType::TextureCube) {
+        // CubeMap需要特殊处理
+        glFramebufferTexture(GL_FRAMEBUFFER, attachment, texture->GetTextureID(), mipLevel);
+    } else {
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, texture->GetTarget(),
+                               texture->GetTextureID(), mipLevel);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return true;
+}
+
+bool FrameBufferGL::attachMultiview(GLenum attachment, TextureGL* texture, uint32_t mipLevel) {
+    TextureType type = texture->GetType();
+    uint32_t layers  = type == TextureType::TextureCube ? 6 : texture->GetDepth();
+    if ((type != TextureType::Texture2DArray && type != TextureType::TextureCube) ||
+        layers < m_viewCount) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument,
+                     "Multiview attachment must be a 2D array or cube texture with enough layers");
+        return false;
+    }
+
+    // 第一个附件决定渲染方式：原生多视图只接受2D数组纹理
+    if (m_multiviewMode == MultiviewMode::None) {
+        const bool native = UseMultiview() && type == TextureType::Texture2DArray;
+        // 分层回退依赖顶点着色器写入 gl_Layer，驱动不支持时无法渲染到各层
+        if (!native && !CapabilitiesGL::Get().hasVertexShaderLayer) {
+            LR_SET_ERROR(ErrorCode::NotSupported,
+                         "Multiview requires GL_OVR_multiview2 or vertex shader layer output");
+            return false;
+        }
+        m_multiviewMode = native ? MultiviewMode::Native : MultiviewMode::Layered;
+        LR_LOG_DEBUG_F("OpenGL Framebuffer %d multiview: %s, views=%u", m_fboID,
+                       m_multiviewMode == MultiviewMode::Native ? "native" : "layered",
+                       m_viewCount);
+    }
+
+    if (m_multiviewMode == MultiviewMode::Native) {
+#if LR_GL_MULTIVIEW_AVAILABLE
+        if (type != TextureType::Texture2DArray) {
+            LR_SET_ERROR(ErrorCode::InvalidArgument,
+                         "Native multiview attachments must all be 2D array textures");
+            return false;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
+        glFramebufferTextureMultiviewOVR(GL_FRAMEBUFFER, attachment, texture->GetTextureID(),
+                                         mipLevel, 0, m_viewCount);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return true;
+#endif
+    }
+
+    // 分层附件：附加纹理的全部层，由顶点着色器写入的 gl_Layer 选择目标层
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glNamedFramebufferTexture(m_fboID, attachment, texture->GetTextureID(), mipLevel);
+        return true;
+    }
+#endif
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
+    glFramebufferTexture(GL_FRAMEBUFFER, attachment, texture->GetTextureID(), mipLevel);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return true;
+}
+
 void FrameBufferGL::Bind() {
     if (m_fboID != 0) {
         glBindFramebuffer(GL_FRAMEBUFFER, m_fboID);
@@ -20,7 +20,7 @@ class TextureGL;
 /**
  * @brief OpenGL帧缓冲实现
  */
-class FrameBufferGL : public IFrameBufferImpl {
+class FrameBufferGL final : public IFrameBufferImpl {
 public:
     FrameBufferGL();
     ~FrameBufferGL() override;
@@ -43,15 +43,22 @@ public:
     uint32_t GetWidth() const override;
     uint32_t GetHeight() const override;
     uint32_t GetColorAttachmentCount() const override;
+    uint32_t GetViewCount() const override { return m_viewCount; }
+    MultiviewMode GetMultiviewMode() const override { return m_multiviewMode; }
 
     // OpenGL特有方法
     GLuint GetFrameBufferID() const { return m_fboID; }
     void SetDrawBuffers();
 
 private:
+    bool attachTexture(GLenum attachment, TextureGL* texture, uint32_t mipLevel);
+    bool attachMultiview(GLenum attachment, TextureGL* texture, uint32_t mipLevel);
+
     GLuint m_fboID;
     uint32_t m_width;
     uint32_t m_height;
+    uint32_t m_viewCount;
+    MultiviewMode m_multiviewMode;
     std::vector<GLenum> m_drawBuffers;
     bool m_hasDepth;
     bool m_hasStencil;
@@ -60,7 +67,7 @@ private:
 /**
  * @brief 默认帧缓冲包装器（用于渲染到屏幕）
  */
-class DefaultFrameBufferGL : public IFrameBufferImpl {
+class DefaultFrameBufferGL final : public IFrameBufferImpl {
 public:
     DefaultFrameBufferGL(uint32_t width, uint32_t height);
     ~DefaultFrameBufferGL() override = default;
@@ -19,7 +19,7 @@ namespace gl {
  * 
  * OpenGL没有管线状态对象，此类用于管理和应用各种渲染状态
  */
-class PipelineStateGL : public IPipelineStateImpl {
+class PipelineStateGL final : public IPipelineStateImpl {
 public:
     PipelineStateGL();
     ~PipelineStateGL() override;
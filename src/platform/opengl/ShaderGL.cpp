@@ -18,16 +18,43 @@ namespace gl {
 // ShaderGL
 // ============================================================================
 
-ShaderGL::ShaderGL() : m_shaderID(0), m_stage(ShaderStage::Vertex), m_compiled(false) {}
+ShaderGL::ShaderGL()
+    : m_shaderID(0),
+      m_programID(0),
+      m_stage(ShaderStage::Vertex),
+      m_compiled(false),
+      m_separable(false),
+      m_spirv(false) {}
 
 ShaderGL::~ShaderGL() { Destroy(); }
 
 bool ShaderGL::Compile(const ShaderDescriptor& desc) {
-    if (m_shaderID != 0) {
+    if (m_shaderID != 0 || m_programID != 0) {
         Destroy();
     }
 
-    m_stage           = desc.stage;
+    m_stage = desc.stage;
+    m_spirv = false;
+
+    // 不支持SPIR-V时 LRShader 已改为传入GLSL回退源码
+    const char* source = desc.source;
+    if (desc.language == ShaderLanguage::SPIRV) {
+        if (UseSPIRV()) {
+            return compileSPIRV(desc);
+        }
+        m_compileError = "SPIR-V requires OpenGL 4.6";
+        LR_SET_ERROR(ErrorCode::NotSupported, m_compileError.c_str());
+        return false;
+    }
+
+    if (desc.separable) {
+        if (UseSeparateShaderObjects()) {
+            return compileSeparable(desc, source);
+        }
+        // 驱动不支持时退回普通着色器，由程序按传统方式链接
+        LR_LOG_WARNING("OpenGL separate shader objects not supported, compiling as regular shader");
+    }
+
     GLenum shaderType = ToGLShaderStage(desc.stage);
 
     m_shaderID = glCreateShader(shaderType);
@@ -37,13 +64,108 @@ bool ShaderGL::Compile(const ShaderDescriptor& desc) {
         return false;
     }
 
-    const char* sourcePtr = desc.source;
-    glShaderSource(m_shaderID, 1, &sourcePtr, nullptr);
+    glShaderSource(m_shaderID, 1, &source, nullptr);
     glCompileShader(m_shaderID);
 
     LR_LOG_DEBUG_F("OpenGL CompileShader: stage=%d, name=%s", (int)desc.stage,
                    desc.debugName ? desc.debugName : "unknown");
 
+    if (!checkCompileStatus()) {
+        return false;
+    }
+
+    m_compiled = true;
+    m_compileError.clear();
+    return true;
+}
+
+bool ShaderGL::compileSPIRV(const ShaderDescriptor& desc) {
+#if LR_GL_SPIRV_AVAILABLE
+    if (desc.source == nullptr || desc.sourceLength == 0 || desc.sourceLength % 4 != 0) {
+        m_compileError = "Invalid SPIR-V binary";
+        LR_SET_ERROR(ErrorCode::InvalidArgument, m_compileError.c_str());
+        return false;
+    }
+
+    m_shaderID = glCreateShader(ToGLShaderStage(desc.stage));
+    if (m_shaderID == 0) {
+        m_compileError = "Failed to create shader object";
+        LR_SET_ERROR(ErrorCode::ShaderCompileFailed, m_compileError.c_str());
+        return false;
+    }
+
+    // 载入字节码并特化，驱动不再解析GLSL
+    glShaderBinary(1, &m_shaderID, GL_SHADER_BINARY_FORMAT_SPIR_V, desc.source,
+                   static_cast<GLsizei>(desc.sourceLength));
+
+    std::vector<GLuint> constantIds(desc.specializationConstantCount);
+    std::vector<GLuint> constantValues(desc.specializationConstantCount);
+    for (uint32_t i = 0; i < desc.specializationConstantCount; ++i) {
+        constantIds[i]    = desc.specializationConstants[i].id;
+        constantValues[i] = desc.specializationConstants[i].value;
+    }
+
+    glSpecializeShader(m_shaderID, desc.entryPoint ? desc.entryPoint : "main",
+                       desc.specializationConstantCount, constantIds.data(),
+                       constantValues.data());
+
+    LR_LOG_DEBUG_F("OpenGL SpecializeShader: stage=%d, constants=%u, name=%s", (int)desc.stage,
+                   desc.specializationConstantCount, desc.debugName ? desc.debugName : "unknown");
+
+    if (!checkCompileStatus()) {
+        return false;
+    }
+    m_spirv = true;
+
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (desc.separable && UseSeparateShaderObjects()) {
+        // glCreateShaderProgramv 只接受源码，字节码需手动链接为分离程序
+        m_programID = glCreateProgram();
+        glProgramParameteri(m_programID, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        glAttachShader(m_programID, m_shaderID);
+        glLinkProgram(m_programID);
+        glDetachShader(m_programID, m_shaderID);
+        glDeleteShader(m_shaderID);
+        m_shaderID = 0;
+        return checkSeparableProgram();
+    }
+#endif
+
+    m_compiled = true;
+    m_compileError.clear();
+    return true;
+#else
+    (void)desc;
+    m_compileError = "SPIR-V shaders not available";
+    LR_SET_ERROR(ErrorCode::NotSupported, m_compileError.c_str());
+    return false;
+#endif
+}
+
+bool ShaderGL::compileSeparable(const ShaderDescriptor& desc, const char* source) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    // glCreateShaderProgramv 编译并链接单阶段程序（GL_PROGRAM_SEPARABLE）
+    m_programID = glCreateShaderProgramv(ToGLShaderStage(desc.stage), 1, &source);
+    if (m_programID == 0) {
+        m_compileError = "Failed to create separable shader program";
+        LR_SET_ERROR(ErrorCode::ShaderCompileFailed, m_compileError.c_str());
+        return false;
+    }
+
+    LR_LOG_DEBUG_F("OpenGL CreateShaderProgramv: stage=%d, name=%s", (int)desc.stage,
+                   desc.debugName ? desc.debugName : "unknown");
+
+    return checkSeparableProgram();
+#else
+    (void)desc;
+    (void)source;
+    m_compileError = "Separate shader objects not available";
+    LR_SET_ERROR(ErrorCode::NotSupported, m_compileError.c_str());
+    return false;
+#endif
+}
+
+bool ShaderGL::checkCompileStatus() {
     GLint success;
     glGetShaderiv(m_shaderID, GL_COMPILE_STATUS, &success);
 
@@ -65,8 +187,35 @@ bool ShaderGL::Compile(const ShaderDescriptor& desc) {
         m_shaderID = 0;
         return false;
     }
+    return true;
+}
 
-    m_compiled = true;
+bool ShaderGL::checkSeparableProgram() {
+    // 编译错误记录在程序的信息日志中
+    GLint success;
+    glGetProgramiv(m_programID, GL_LINK_STATUS, &success);
+
+    if (!success) {
+        GLint logLength;
+        glGetProgramiv(m_programID, GL_INFO_LOG_LENGTH, &logLength);
+
+        if (logLength > 0) {
+            std::vector<char> log(logLength);
+            glGetProgramInfoLog(m_programID, logLength, nullptr, log.data());
+            m_compileError = log.data();
+        } else {
+            m_compileError = "Unknown separable shader error";
+        }
+
+        LR_SET_ERROR(ErrorCode::ShaderCompileFailed, m_compileError.c_str());
+        LR_LOG_ERROR_F("OpenGL Separable Shader Failed: %s", m_compileError.c_str());
+        glDeleteProgram(m_programID);
+        m_programID = 0;
+        return false;
+    }
+
+    m_separable = true;
+    m_compiled  = true;
     m_compileError.clear();
     return true;
 }
@@ -76,7 +225,12 @@ void ShaderGL::Destroy() {
         glDeleteShader(m_shaderID);
         m_shaderID = 0;
     }
-    m_compiled = false;
+    if (m_programID != 0) {
+        glDeleteProgram(m_programID);
+        m_programID = 0;
+    }
+    m_compiled  = false;
+    m_separable = false;
 }
 
 bool ShaderGL::IsCompiled() const { return m_compiled; }
@@ -87,7 +241,7 @@ ShaderStage ShaderGL::GetStage() const { return m_stage; }
 
 ResourceHandle ShaderGL::GetNativeHandle() const {
     ResourceHandle handle;
-    handle.glHandle = m_shaderID;
+    handle.glHandle = m_separable ? m_programID : m_shaderID;
     return handle;
 }
 
@@ -95,14 +249,16 @@ ResourceHandle ShaderGL::GetNativeHandle() const {
 // ShaderProgramGL
 // ============================================================================
 
-ShaderProgramGL::ShaderProgramGL() : m_programID(0), m_linked(false) {}
+ShaderProgramGL::ShaderProgramGL()
+    : m_programID(0), m_pipelineID(0), m_linked(false), m_hasSPIRV(false) {}
 
 ShaderProgramGL::~ShaderProgramGL() { Destroy(); }
 
 bool ShaderProgramGL::Link(IShaderImpl** shaders, uint32_t count) {
-    if (m_programID != 0) {
+    if (m_programID != 0 || m_pipelineID != 0) {
         Destroy();
     }
+    m_hasSPIRV = false;
 
     if (shaders == nullptr || count == 0) {
         m_linkError = "No shaders provided";
@@ -110,6 +266,30 @@ bool ShaderProgramGL::Link(IShaderImpl** shaders, uint32_t count) {
         return false;
     }
 
+    // 分离模式的着色器没有着色器对象，只能组合为程序管线
+    uint32_t shaderCount    = 0;
+    uint32_t separableCount = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (shaders[i] != nullptr) {
+            ++shaderCount;
+            if (static_cast<ShaderGL*>(shaders[i])->IsSeparable()) {
+                ++separableCount;
+            }
+            if (static_cast<ShaderGL*>(shaders[i])->IsSPIRV()) {
+                m_hasSPIRV = true;
+            }
+        }
+    }
+
+    if (separableCount > 0) {
+        if (separableCount != shaderCount) {
+            m_linkError = "Cannot mix separable and non-separable shaders";
+            LR_SET_ERROR(ErrorCode::ShaderLinkFailed, m_linkError.c_str());
+            return false;
+        }
+        return linkPipeline(shaders, count);
+    }
+
     m_programID = glCreateProgram();
     if (m_programID == 0) {
         m_linkError = "Failed to create program object";
@@ -176,12 +356,75 @@ bool ShaderProgramGL::Link(IShaderImpl** shaders, uint32_t count) {
     return true;
 }
 
+bool ShaderProgramGL::linkPipeline(IShaderImpl** shaders, uint32_t count) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    glGenProgramPipelines(1, &m_pipelineID);
+    if (m_pipelineID == 0) {
+        m_linkError = "Failed to create program pipeline object";
+        LR_SET_ERROR(ErrorCode::ShaderLinkFailed, m_linkError.c_str());
+        return false;
+    }
+
+    // 各阶段程序已在编译时链接，这里只组合阶段
+    for (uint32_t i = 0; i < count; ++i) {
+        if (shaders[i] == nullptr) {
+            continue;
+        }
+
+        ShaderGL* glShader = static_cast<ShaderGL*>(shaders[i]);
+        if (!glShader->IsCompiled()) {
+            m_linkError = "Attempting to link with uncompiled shader";
+            LR_SET_ERROR(ErrorCode::ShaderLinkFailed, m_linkError.c_str());
+            Destroy();
+            return false;
+        }
+
+        glUseProgramStages(m_pipelineID, ToGLShaderStageBit(glShader->GetStage()),
+                           glShader->GetSeparableProgram());
+        m_stagePrograms.push_back(glShader->GetSeparableProgram());
+    }
+
+    LR_LOG_DEBUG_F("OpenGL ProgramPipeline: %d (%zu stages)", m_pipelineID,
+                   m_stagePrograms.size());
+
+    m_linked = true;
+    m_linkError.clear();
+    return true;
+#else
+    (void)shaders;
+    (void)count;
+    m_linkError = "Program pipelines not available";
+    LR_SET_ERROR(ErrorCode::NotSupported, m_linkError.c_str());
+    return false;
+#endif
+}
+
+template <typename Setter>
+void ShaderProgramGL::forEachStageUniform(int32_t location, Setter&& setter) {
+    if (location < 0 || location >= static_cast<int32_t>(m_pipelineUniforms.size())) {
+        return;
+    }
+    for (const StageUniform& uniform : m_pipelineUniforms[location]) {
+        setter(uniform.program, uniform.location);
+    }
+}
+
 void ShaderProgramGL::Destroy() {
     if (m_programID != 0) {
         glDeleteProgram(m_programID);
         m_programID = 0;
     }
-    m_linked = false;
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        glDeleteProgramPipelines(1, &m_pipelineID);
+        m_pipelineID = 0;
+    }
+#endif
+    m_stagePrograms.clear();
+    m_pipelineUniforms.clear();
+    m_pipelineUniformIndex.clear();
+    m_linked   = false;
+    m_hasSPIRV = false;
 }
 
 bool ShaderProgramGL::IsLinked() const { return m_linked; }
@@ -189,6 +432,15 @@ bool ShaderProgramGL::IsLinked() const { return m_linked; }
 const char* ShaderProgramGL::GetLinkError() const { return m_linkError.c_str(); }
 
 void ShaderProgramGL::Use() {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        // 当前程序优先于程序管线，需先解绑
+        glUseProgram(0);
+        glBindProgramPipeline(m_pipelineID);
+        LR_LOG_DEBUG_F("OpenGL BindProgramPipeline: %d", m_pipelineID);
+        return;
+    }
+#endif
     if (m_programID != 0) {
         glUseProgram(m_programID);
         LR_LOG_DEBUG_F("OpenGL UseProgram: %d", m_programID);
@@ -196,49 +448,151 @@ void ShaderProgramGL::Use() {
 }
 
 int32_t ShaderProgramGL::GetUniformLocation(const char* name) {
-    if (m_programID == 0 || name == nullptr) {
+    if (name == nullptr) {
         return -1;
     }
-    return glGetUniformLocation(m_programID, name);
+
+    if (m_pipelineID != 0) {
+        // 管线模式：location为Uniform表下标，记录该变量在各阶段程序中的位置
+        auto it = m_pipelineUniformIndex.find(name);
+        if (it != m_pipelineUniformIndex.end()) {
+            return it->second;
+        }
+
+        std::vector<StageUniform> stages;
+        for (GLuint program : m_stagePrograms) {
+            GLint location = glGetUniformLocation(program, name);
+            if (location >= 0) {
+                stages.push_back({program, location});
+            }
+        }
+        if (stages.empty()) {
+            warnMissingUniform(name);
+            return -1;
+        }
+
+        int32_t index = static_cast<int32_t>(m_pipelineUniforms.size());
+        m_pipelineUniforms.push_back(std::move(stages));
+        m_pipelineUniformIndex[name] = index;
+        return index;
+    }
+
+    if (m_programID == 0) {
+        return -1;
+    }
+    GLint location = glGetUniformLocation(m_programID, name);
+    if (location < 0) {
+        warnMissingUniform(name);
+    }
+    return location;
+}
+
+void ShaderProgramGL::warnMissingUniform(const char* name) const {
+    // SPIR-V 的Uniform名称来自 OpName，剥离调试信息后只能使用显式 location
+    if (m_hasSPIRV) {
+        LR_LOG_WARNING_F("OpenGL uniform '%s' not found in SPIR-V program; keep OpName debug info "
+                         "or use explicit layout(location) / uniform block bindings",
+                         name);
+    }
 }
 
 void ShaderProgramGL::SetUniform1i(int32_t location, int32_t value) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform1i(program, loc, value);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform1i(location, value);
     }
 }
 
 void ShaderProgramGL::SetUniform1f(int32_t location, float value) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform1f(program, loc, value);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform1f(location, value);
     }
 }
 
 void ShaderProgramGL::SetUniform2f(int32_t location, float x, float y) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform2f(program, loc, x, y);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform2f(location, x, y);
     }
 }
 
 void ShaderProgramGL::SetUniform3f(int32_t location, float x, float y, float z) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform3f(program, loc, x, y, z);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform3f(location, x, y, z);
     }
 }
 
 void ShaderProgramGL::SetUniform4f(int32_t location, float x, float y, float z, float w) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        forEachStageUniform(location, [&](GLuint program, GLint loc) {
+            glProgramUniform4f(program, loc, x, y, z, w);
+        });
+        return;
+    }
+#endif
     if (location >= 0) {
         glUniform4f(location, x, y, z, w);
     }
 }
 
 void ShaderProgramGL::SetUniformMatrix3fv(int32_t location, const float* value, bool transpose) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        if (value != nullptr) {
+            forEachStageUniform(location, [&](GLuint program, GLint loc) {
+                glProgramUniformMatrix3fv(program, loc, 1, transpose ? GL_TRUE : GL_FALSE, value);
+            });
+        }
+        return;
+    }
+#endif
     if (location >= 0 && value != nullptr) {
         glUniformMatrix3fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value);
     }
 }
 
 void ShaderProgramGL::SetUniformMatrix4fv(int32_t location, const float* value, bool transpose) {
+#if LR_GL_SEPARATE_SHADERS_AVAILABLE
+    if (m_pipelineID != 0) {
+        if (value != nullptr) {
+            forEachStageUniform(location, [&](GLuint program, GLint loc) {
+                glProgramUniformMatrix4fv(program, loc, 1, transpose ? GL_TRUE : GL_FALSE, value);
+            });
+        }
+        return;
+    }
+#endif
     if (location >= 0 && value != nullptr) {
         glUniformMatrix4fv(location, 1, transpose ? GL_TRUE : GL_FALSE, value);
     }
@@ -246,12 +600,26 @@ void ShaderProgramGL::SetUniformMatrix4fv(int32_t location, const float* value,
 
 ResourceHandle ShaderProgramGL::GetNativeHandle() const {
     ResourceHandle handle;
-    handle.glHandle = m_programID;
+    handle.glHandle = m_pipelineID != 0 ? m_pipelineID : m_programID;
     return handle;
 }
 
 void ShaderProgramGL::BindUniformBlock(const char* blockName, uint32_t bindingPoint) {
-    if (m_programID == 0 || blockName == nullptr) {
+    if (blockName == nullptr) {
+        return;
+    }
+
+    if (m_pipelineID != 0) {
+        for (GLuint program : m_stagePrograms) {
+            GLuint blockIndex = glGetUniformBlockIndex(program, blockName);
+            if (blockIndex != GL_INVALID_INDEX) {
+                glUniformBlockBinding(program, blockIndex, bindingPoint);
+            }
+        }
+        return;
+    }
+
+    if (m_programID == 0) {
         return;
     }
 
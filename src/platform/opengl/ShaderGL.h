@@ -6,8 +6,10 @@
 #pragma once
 
 #include "platform/interface/IShaderImpl.h"
-#include "TypeConverterGL.h"
+#include "CapabilitiesGL.h"
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #ifdef LRENGINE_ENABLE_OPENGL
 
@@ -17,14 +19,18 @@ namespace gl {
 
 /**
  * @brief OpenGL着色器实现
+ *
+ * 支持GLSL源码与SPIR-V字节码（GL 4.6，glShaderBinary + glSpecializeShader）。
+ * SPIR-V 模块需保留 OpName 才能按名称查询 Uniform，否则使用显式 location。
  */
-class ShaderGL : public IShaderImpl {
+class ShaderGL final : public IShaderImpl {
 public:
     ShaderGL();
     ~ShaderGL() override;
 
     // IShaderImpl接口
     bool Compile(const ShaderDescriptor& desc) override;
+    bool SupportsSPIRV() const override { return UseSPIRV(); }
     void Destroy() override;
     bool IsCompiled() const override;
     const char* GetCompileError() const override;
@@ -34,17 +40,45 @@ public:
     // OpenGL特有方法
     GLuint GetShaderID() const { return m_shaderID; }
 
+    /**
+     * @brief 是否编译为独立阶段程序（ShaderDescriptor::separable 且驱动支持）
+     */
+    bool IsSeparable() const { return m_separable; }
+
+    /**
+     * @brief 是否由SPIR-V字节码编译（GLSL回退源码不算）
+     */
+    bool IsSPIRV() const { return m_spirv; }
+
+    /**
+     * @brief 获取独立阶段程序对象（非分离模式下为0）
+     */
+    GLuint GetSeparableProgram() const { return m_programID; }
+
 private:
+    bool compileSPIRV(const ShaderDescriptor& desc);
+    bool compileSeparable(const ShaderDescriptor& desc, const char* source);
+    bool checkCompileStatus();
+    bool checkSeparableProgram();
+
     GLuint m_shaderID;
+    GLuint m_programID;
     ShaderStage m_stage;
     bool m_compiled;
+    bool m_separable;
+    bool m_spirv;
     std::string m_compileError;
 };
 
 /**
  * @brief OpenGL着色器程序实现
+ *
+ * 所有着色器都以分离模式编译时，不再链接程序，而是创建程序管线对象，
+ * 通过 glUseProgramStages 组合各阶段程序。每个阶段只编译链接一次，
+ * V 个顶点着色器与 F 个片段着色器组合只需 V+F 次链接。
+ * 管线模式下Uniform通过 glProgramUniform* 写入包含该变量的各阶段程序。
  */
-class ShaderProgramGL : public IShaderProgramImpl {
+class ShaderProgramGL final : public IShaderProgramImpl {
 public:
     ShaderProgramGL();
     ~ShaderProgramGL() override;
@@ -67,12 +101,33 @@ public:
 
     // OpenGL特有方法
     GLuint GetProgramID() const { return m_programID; }
+    GLuint GetPipelineID() const { return m_pipelineID; }
     void BindUniformBlock(const char* blockName, uint32_t bindingPoint);
 
 private:
+    /**
+     * @brief 管线模式下某个Uniform在各阶段程序中的位置
+     */
+    struct StageUniform {
+        GLuint program;
+        GLint location;
+    };
+
+    bool linkPipeline(IShaderImpl** shaders, uint32_t count);
+    void warnMissingUniform(const char* name) const;
+
+    template <typename Setter>
+    void forEachStageUniform(int32_t location, Setter&& setter);
+
     GLuint m_programID;
+    GLuint m_pipelineID;
     bool m_linked;
+    bool m_hasSPIRV;                                             // 含SPIR-V阶段，Uniform名称依赖OpName
     std::string m_linkError;
+
+    std::vector<GLuint> m_stagePrograms;                         // 管线各阶段程序（由ShaderGL持有）
+    std::vector<std::vector<StageUniform>> m_pipelineUniforms;   // 管线模式的Uniform表，下标即location
+    std::unordered_map<std::string, int32_t> m_pipelineUniformIndex;
 };
 
 } // namespace gl
@@ -5,9 +5,11 @@
 
 #include "TextureGL.h"
 #include "lrengine/core/LRError.h"
+#include "lrengine/core/LRResource.h"
 #include "lrengine/utils/LRLog.h"
 
 #include <algorithm>
+#include <cstring>
 
 #ifdef LRENGINE_ENABLE_OPENGL
 
@@ -50,6 +52,18 @@ static GLenum ToGLWrapMode(WrapMode mode) {
     }
 }
 
+// 通过绑定到当前纹理单元来编辑纹理（非DSA路径），需通知前端绑定缓存
+static void NotifyBindToEdit() { LRResource::InvalidateBindings(BindingScope::Texture); }
+
+// 完整 mip 链的层数（到 1x1 为止）
+static uint32_t GetFullMipChainLength(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    for (uint32_t size = std::max(width, height); size > 1; size >>= 1) {
+        ++levels;
+    }
+    return levels;
+}
+
 // ============================================================================
 // TextureGL
 // ============================================================================
@@ -79,7 +93,8 @@ bool TextureGL::Create(const TextureDescriptor& desc) {
     m_width       = desc.width;
     m_height      = desc.height;
     m_depth       = desc.depth;
-    m_mipLevels   = desc.mipLevels;
+    // mipLevels 为 0 表示完整 mip 链
+    m_mipLevels   = desc.mipLevels != 0 ? desc.mipLevels : GetFullMipChainLength(desc.width, desc.height);
 
     m_target         = ToGLTextureTarget(desc.type);
     m_internalFormat = ToGLInternalFormat(desc.format);
@@ -93,6 +108,7 @@ bool TextureGL::Create(const TextureDescriptor& desc) {
     }
 
     glBindTexture(m_target, m_textureID);
+    NotifyBindToEdit();
 
     // 根据纹理类型创建存储
     switch (m_type) {
@@ -204,6 +220,7 @@ void TextureGL::SetSamplerParameters(const TextureDescriptor& desc) {
 }
 
 void TextureGL::Destroy() {
+    releaseReadbacks();
     if (m_textureID != 0) {
         glDeleteTextures(1, &m_textureID);
         m_textureID = 0;
@@ -222,7 +239,22 @@ void TextureGL::UpdateData(const void* data, uint32_t mipLevel, const TextureReg
         return;
     }
 
+    // 立方体贴图须通过区域指定面；多采样纹理不能由CPU上传
+    if (m_type == TextureType::Texture2DMultisample ||
+        (region == nullptr && m_type == TextureType::TextureCube)) {
+        LR_SET_ERROR(ErrorCode::NotSupported, "Texture update not supported for this texture type");
+        return;
+    }
+
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        updateDataDSA(data, mipLevel, region);
+        return;
+    }
+#endif
+
     glBindTexture(m_target, m_textureID);
+    NotifyBindToEdit();
 
     if (region != nullptr) {
         // 更新子区域
@@ -234,13 +266,15 @@ void TextureGL::UpdateData(const void* data, uint32_t mipLevel, const TextureReg
 
             case TextureType::Texture3D:
             case TextureType::Texture2DArray:
-                glTexSubImage3D(m_target, mipLevel, region->x, region->y, region->z, region->width,
-                                region->height, region->depth, m_format, m_dataType, data);
+                glTexSubImage3D(m_target, mipLevel, region->x, region->y,
+                                region->z + region->arrayLayer, region->width, region->height,
+                                region->depth, m_format, m_dataType, data);
                 break;
 
             case TextureType::TextureCube:
-                glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + region->z, mipLevel, region->x,
-                                region->y, region->width, region->height, m_format, m_dataType, data);
+                glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + region->z + region->arrayLayer,
+                                mipLevel, region->x, region->y, region->width, region->height,
+                                m_format, m_dataType, data);
                 break;
 
             default:
@@ -250,7 +284,8 @@ void TextureGL::UpdateData(const void* data, uint32_t mipLevel, const TextureReg
         // 更新整个mip level
         uint32_t mipWidth  = std::max(1u, m_width >> mipLevel);
         uint32_t mipHeight = std::max(1u, m_height >> mipLevel);
-        uint32_t mipDepth  = std::max(1u, m_depth >> mipLevel);
+        // 数组层数不随mip级别减少
+        uint32_t mipDepth  = (m_type == TextureType::Texture2DArray) ? m_depth : std::max(1u, m_depth >> mipLevel);
 
         switch (m_type) {
             case TextureType::Texture2D:
@@ -282,13 +317,66 @@ void TextureGL::GenerateMipmaps() {
         return;
     }
 
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glGenerateTextureMipmap(m_textureID);
+        return;
+    }
+#endif
+
     glBindTexture(m_target, m_textureID);
+    NotifyBindToEdit();
     glGenerateMipmap(m_target);
     glBindTexture(m_target, 0);
 }
 
+#if LR_GL_DSA_AVAILABLE
+void TextureGL::updateDataDSA(const void* data, uint32_t mipLevel, const TextureRegion* region) {
+    uint32_t x = 0, y = 0, z = 0;
+    uint32_t width  = std::max(1u, m_width >> mipLevel);
+    uint32_t height = std::max(1u, m_height >> mipLevel);
+    uint32_t depth  = (m_type == TextureType::Texture2DArray) ? m_depth : std::max(1u, m_depth >> mipLevel);
+    if (region != nullptr) {
+        x      = region->x;
+        y      = region->y;
+        z      = region->z + region->arrayLayer;
+        width  = region->width;
+        height = region->height;
+        depth  = region->depth;
+    }
+
+    switch (m_type) {
+        case TextureType::Texture2D:
+            glTextureSubImage2D(m_textureID, mipLevel, x, y, width, height, m_format, m_dataType,
+                                data);
+            break;
+
+        case TextureType::Texture3D:
+        case TextureType::Texture2DArray:
+            glTextureSubImage3D(m_textureID, mipLevel, x, y, z, width, height, depth, m_format,
+                                m_dataType, data);
+            break;
+
+        case TextureType::TextureCube:
+            // DSA将立方体贴图视为6层数组，z为面索引（UpdateData已保证region非空）
+            glTextureSubImage3D(m_textureID, mipLevel, x, y, z, width, height, 1, m_format,
+                                m_dataType, data);
+            break;
+
+        default:
+            break;
+    }
+}
+#endif
+
 void TextureGL::Bind(uint32_t slot) {
     if (m_textureID != 0) {
+#if LR_GL_DSA_AVAILABLE
+        if (UseDSA()) {
+            glBindTextureUnit(slot, m_textureID);
+            return;
+        }
+#endif
         glActiveTexture(GL_TEXTURE0 + slot);
         glBindTexture(m_target, m_textureID);
         LR_LOG_DEBUG_F("OpenGL Bind Texture: %d", m_textureID);
@@ -312,6 +400,115 @@ uint32_t TextureGL::GetDepth() const { return m_depth; }
 TextureType TextureGL::GetType() const { return m_type; }
 PixelFormat TextureGL::GetFormat() const { return m_pixelFormat; }
 
+int32_t TextureGL::BeginAsyncReadback(uint32_t mipLevel) {
+    if (m_textureID == 0 || m_type != TextureType::Texture2D || mipLevel >= m_mipLevels) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Async readback requires a valid 2D texture mip level");
+        return -1;
+    }
+
+    const uint32_t bytesPerPixel = GetPixelFormatSize(m_pixelFormat);
+    if (bytesPerPixel == 0) {
+        LR_SET_ERROR(ErrorCode::TextureFormatNotSupported, "Async readback does not support compressed formats");
+        return -1;
+    }
+    const GLsizeiptr size = static_cast<GLsizeiptr>(std::max(1u, m_width >> mipLevel)) *
+                            std::max(1u, m_height >> mipLevel) * bytesPerPixel;
+
+    // 复用空闲槽位，否则新增
+    size_t slot = 0;
+    while (slot < m_readbacks.size() && m_readbacks[slot].fence != nullptr) {
+        ++slot;
+    }
+    if (slot == m_readbacks.size()) {
+        m_readbacks.emplace_back();
+    }
+    ReadbackSlot& readback = m_readbacks[slot];
+
+    if (readback.buffer == 0) {
+        glGenBuffers(1, &readback.buffer);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    if (readback.size != size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        readback.size = size;
+    }
+
+    // 绑定像素打包缓冲时，拷贝在 GPU 上排队，CPU 不等待
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+#if LR_GL_DSA_AVAILABLE
+    if (UseDSA()) {
+        glGetTextureImage(m_textureID, mipLevel, m_format, m_dataType, static_cast<GLsizei>(size),
+                          nullptr);
+    } else
+#endif
+    {
+        // 非DSA路径（如 macOS 的 GL 4.1）需绑定纹理才能读取，会改写当前纹理单元，
+        // 因此通知绑定缓存（Texture 范围）失效
+        glBindTexture(m_target, m_textureID);
+        NotifyBindToEdit();
+        glGetTexImage(m_target, mipLevel, m_format, m_dataType, nullptr);
+        glBindTexture(m_target, 0);
+    }
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if (readback.fence == nullptr) {
+        LR_SET_ERROR(ErrorCode::FenceError, "Failed to create readback fence");
+        return -1;
+    }
+    return static_cast<int32_t>(slot);
+}
+
+bool TextureGL::ResolveAsyncReadback(int32_t slot, void* dst, bool wait) {
+    if (slot < 0 || static_cast<size_t>(slot) >= m_readbacks.size() ||
+        m_readbacks[slot].fence == nullptr) {
+        LR_SET_ERROR(ErrorCode::InvalidArgument, "Invalid readback slot");
+        return false;
+    }
+    ReadbackSlot& readback = m_readbacks[slot];
+
+    const GLenum result = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                           wait ? GL_TIMEOUT_IGNORED : 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+        return false;
+    }
+
+    glDeleteSync(readback.fence);
+    readback.fence = nullptr;
+    if (result == GL_WAIT_FAILED) {
+        LR_SET_ERROR(ErrorCode::FenceError, "Readback fence wait failed");
+        return false;
+    }
+
+    if (dst != nullptr) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+        const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, readback.size, GL_MAP_READ_BIT);
+        if (mapped != nullptr) {
+            std::memcpy(dst, mapped, static_cast<size_t>(readback.size));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        if (mapped == nullptr) {
+            LR_SET_ERROR(ErrorCode::BufferMapFailed, "Failed to map readback buffer");
+            return false;
+        }
+    }
+    return true;
+}
+
+void TextureGL::releaseReadbacks() {
+    for (ReadbackSlot& readback : m_readbacks) {
+        if (readback.fence != nullptr) {
+            glDeleteSync(readback.fence);
+        }
+        if (readback.buffer != 0) {
+            glDeleteBuffers(1, &readback.buffer);
+        }
+    }
+    m_readbacks.clear();
+}
+
 // ============================================================================
 // SamplerGL
 // ============================================================================
@@ -7,6 +7,9 @@
 
 #include "platform/interface/ITextureImpl.h"
 #include "TypeConverterGL.h"
+#include "CapabilitiesGL.h"
+
+#include <vector>
 
 #ifdef LRENGINE_ENABLE_OPENGL
 
@@ -17,7 +20,7 @@ namespace gl {
 /**
  * @brief OpenGL纹理实现
  */
-class TextureGL : public ITextureImpl {
+class TextureGL final : public ITextureImpl {
 public:
     TextureGL();
     ~TextureGL() override;
@@ -35,6 +38,8 @@ public:
     uint32_t GetDepth() const override;
     TextureType GetType() const override;
     PixelFormat GetFormat() const override;
+    int32_t BeginAsyncReadback(uint32_t mipLevel) override;
+    bool ResolveAsyncReadback(int32_t slot, void* dst, bool wait) override;
 
     // OpenGL特有方法
     GLuint GetTextureID() const { return m_textureID; }
@@ -43,6 +48,19 @@ public:
 
 private:
     void SetSamplerParameters(const TextureDescriptor& desc);
+#if LR_GL_DSA_AVAILABLE
+    void updateDataDSA(const void* data, uint32_t mipLevel, const TextureRegion* region);
+#endif
+    void releaseReadbacks();
+
+    /**
+     * @brief 异步回读槽位
+     */
+    struct ReadbackSlot {
+        GLuint buffer   = 0;        // 像素打包缓冲
+        GLsync fence    = nullptr;  // 拷贝完成栅栏，为空表示槽位空闲
+        GLsizeiptr size = 0;        // 缓冲大小（字节）
+    };
 
     GLuint m_textureID;
     GLenum m_target;
@@ -55,6 +73,7 @@ private:
     uint32_t m_mipLevels;
     TextureType m_type;
     PixelFormat m_pixelFormat;
+    std::vector<ReadbackSlot> m_readbacks;  // 异步回读槽位（按需增长，空闲时复用）
 };
 
 /**
@@ -88,6 +88,32 @@ inline GLenum ToGLShaderStage(ShaderStage stage) {
     }
 }
 
+#ifdef GL_VERTEX_SHADER_BIT
+/**
+ * @brief 转换着色器阶段到程序管线阶段位（glUseProgramStages）
+ */
+inline GLbitfield ToGLShaderStageBit(ShaderStage stage) {
+    switch (stage) {
+        case ShaderStage::Vertex:
+            return GL_VERTEX_SHADER_BIT;
+        case ShaderStage::Fragment:
+            return GL_FRAGMENT_SHADER_BIT;
+        case ShaderStage::Geometry:
+            return GL_GEOMETRY_SHADER_BIT;
+#ifdef GL_COMPUTE_SHADER_BIT
+        case ShaderStage::Compute:
+            return GL_COMPUTE_SHADER_BIT;
+#endif
+        case ShaderStage::TessControl:
+            return GL_TESS_CONTROL_SHADER_BIT;
+        case ShaderStage::TessEval:
+            return GL_TESS_EVALUATION_SHADER_BIT;
+        default:
+            return 0;
+    }
+}
+#endif
+
 /**
  * @brief 转换纹理类型到OpenGL目标
  */
@@ -139,6 +165,12 @@ inline GLenum ToGLInternalFormat(PixelFormat format) {
             return GL_RGBA32F;
         case PixelFormat::RGB10A2:
             return GL_RGB10_A2;
+        case PixelFormat::R16:
+            return GL_R16;
+        case PixelFormat::RG16:
+            return GL_RG16;
+        case PixelFormat::RGBA16:
+            return GL_RGBA16;
         case PixelFormat::Depth16:
             return GL_DEPTH_COMPONENT16;
         case PixelFormat::Depth24:
@@ -162,10 +194,12 @@ inline GLenum ToGLInternalFormat(PixelFormat format) {
 inline GLenum ToGLFormat(PixelFormat format) {
     switch (format) {
         case PixelFormat::R8:
+        case PixelFormat::R16:
         case PixelFormat::R16F:
         case PixelFormat::R32F:
             return GL_RED;
         case PixelFormat::RG8:
+        case PixelFormat::RG16:
         case PixelFormat::RG16F:
         case PixelFormat::RG32F:
             return GL_RG;
@@ -174,6 +208,7 @@ inline GLenum ToGLFormat(PixelFormat format) {
         case PixelFormat::RGB32F:
             return GL_RGB;
         case PixelFormat::RGBA8:
+        case PixelFormat::RGBA16:
         case PixelFormat::RGBA16F:
         case PixelFormat::RGBA32F:
         case PixelFormat::RGB10A2:
@@ -216,6 +251,9 @@ inline GLenum ToGLType(PixelFormat format) {
             return GL_FLOAT;
         case PixelFormat::RGB10A2:
             return GL_UNSIGNED_INT_2_10_10_10_REV;
+        case PixelFormat::R16:
+        case PixelFormat::RG16:
+        case PixelFormat::RGBA16:
         case PixelFormat::Depth16:
             return GL_UNSIGNED_SHORT;
         case PixelFormat::Depth24:
@@ -0,0 +1,518 @@
+/**
+ * @file AssetPackage.cpp
+ * @brief 内存映射资源包实现
+ */
+
+#include "lrengine/utils/AssetPackage.h"
+#include "lrengine/utils/LRLog.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+constexpr size_t kLZ4MinMatch = 4;
+constexpr size_t kLZ4LastLiterals = 5;      // 块末尾至少5字节为字面量
+constexpr size_t kLZ4MatchSafeDistance = 12; // 最后一个匹配须在块末尾12字节之前开始
+constexpr uint32_t kLZ4HashBits = 12;
+constexpr size_t kLZ4MaxOffset = 65535;
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kLZ4HashBits);
+}
+
+void writeLength(std::vector<uint8_t>& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(length));
+}
+
+void emitSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalLength,
+                  size_t offset, size_t matchLength) {
+    size_t tokenPos = out.size();
+    out.push_back(0);
+
+    uint8_t token = 0;
+    if (literalLength >= 15) {
+        token = 0xF0;
+        writeLength(out, literalLength - 15);
+    } else {
+        token = static_cast<uint8_t>(literalLength << 4);
+    }
+    out.insert(out.end(), literals, literals + literalLength);
+
+    if (matchLength > 0) {
+        out.push_back(static_cast<uint8_t>(offset & 0xFF));
+        out.push_back(static_cast<uint8_t>((offset >> 8) & 0xFF));
+
+        size_t ml = matchLength - kLZ4MinMatch;
+        if (ml >= 15) {
+            token |= 0x0F;
+            writeLength(out, ml - 15);
+        } else {
+            token |= static_cast<uint8_t>(ml);
+        }
+    }
+    out[tokenPos] = token;
+}
+
+bool readLength(const uint8_t* src, size_t srcSize, size_t& ip, size_t& length) {
+    uint8_t b = 0;
+    do {
+        if (ip >= srcSize) {
+            return false;
+        }
+        b = src[ip++];
+        length += b;
+    } while (b == 255);
+    return true;
+}
+
+inline size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+inline bool isPowerOfTwo(uint32_t v) {
+    return v != 0 && (v & (v - 1)) == 0;
+}
+
+// [offset, offset + size) 是否位于 [0, limit) 内（不会溢出）
+inline bool isRangeInside(uint64_t offset, uint64_t size, uint64_t limit) {
+    return size <= limit && offset <= limit - size;
+}
+
+} // namespace
+
+// =============================================================================
+// LZ4 块格式
+// =============================================================================
+
+void LZ4CompressBlock(const void* srcData, size_t srcSize, std::vector<uint8_t>& out) {
+    const uint8_t* src = static_cast<const uint8_t*>(srcData);
+    out.clear();
+    out.reserve(srcSize + srcSize / 255 + 16);
+
+    if (srcSize < kLZ4MatchSafeDistance + 1) {
+        emitSequence(out, src, srcSize, 0, 0);
+        return;
+    }
+
+    std::vector<int64_t> table(size_t(1) << kLZ4HashBits, -1);
+    const size_t matchStartLimit = srcSize - kLZ4MatchSafeDistance;
+    const size_t matchEndLimit = srcSize - kLZ4LastLiterals;
+
+    size_t ip = 0;
+    size_t anchor = 0;
+    while (ip <= matchStartLimit) {
+        uint32_t sequence = read32(src + ip);
+        uint32_t h = hashSequence(sequence);
+        int64_t ref = table[h];
+        table[h] = static_cast<int64_t>(ip);
+
+        if (ref >= 0 && ip - static_cast<size_t>(ref) <= kLZ4MaxOffset &&
+            read32(src + ref) == sequence) {
+            size_t match = static_cast<size_t>(ref);
+            size_t length = kLZ4MinMatch;
+            while (ip + length < matchEndLimit && src[match + length] == src[ip + length]) {
+                ++length;
+            }
+            emitSequence(out, src + anchor, ip - anchor, ip - match, length);
+            ip += length;
+            anchor = ip;
+        } else {
+            ++ip;
+        }
+    }
+
+    emitSequence(out, src + anchor, srcSize - anchor, 0, 0);
+}
+
+bool LZ4DecompressBlock(const void* srcData, size_t srcSize, void* dstData, size_t dstSize) {
+    const uint8_t* src = static_cast<const uint8_t*>(srcData);
+    uint8_t* dst = static_cast<uint8_t*>(dstData);
+
+    size_t ip = 0;
+    size_t op = 0;
+    while (ip < srcSize) {
+        uint8_t token = src[ip++];
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(src, srcSize, ip, literalLength)) {
+            return false;
+        }
+        if (literalLength > srcSize - ip || literalLength > dstSize - op) {
+            return false;
+        }
+        std::memcpy(dst + op, src + ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        // 最后一个序列只有字面量
+        if (ip >= srcSize) {
+            break;
+        }
+
+        if (srcSize - ip < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(src[ip]) | (static_cast<size_t>(src[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) {
+            return false;
+        }
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !readLength(src, srcSize, ip, matchLength)) {
+            return false;
+        }
+        matchLength += kLZ4MinMatch;
+        if (matchLength > dstSize - op) {
+            return false;
+        }
+
+        // 匹配区间可能与输出重叠，逐字节拷贝
+        const uint8_t* match = dst + op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(dst + op, match, matchLength);
+        } else {
+            for (size_t i = 0; i < matchLength; ++i) {
+                dst[op + i] = match[i];
+            }
+        }
+        op += matchLength;
+    }
+    return op == dstSize;
+}
+
+// =============================================================================
+// AssetPackage
+// =============================================================================
+
+AssetPackage::~AssetPackage() {
+    Close();
+}
+
+uint64_t AssetPackage::HashName(const char* name, size_t length) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(name[i]);
+        hash *= 1099511628211ull;
+    }
+    // 0 保留为空桶标记
+    return hash != 0 ? hash : 1;
+}
+
+bool AssetPackage::Open(const std::string& path) {
+    Close();
+
+    if (!mFile.Open(path)) {
+        return false;
+    }
+
+    mHeader = reinterpret_cast<const AssetPackageHeader*>(mFile.GetData());
+    if (!Validate()) {
+        LR_LOG_ERROR_F("AssetPackage: invalid package %s", path.c_str());
+        Close();
+        return false;
+    }
+
+    mEntries = reinterpret_cast<const AssetEntry*>(mFile.GetData() + mHeader->tocOffset);
+    mStrings = reinterpret_cast<const char*>(mFile.GetData() + mHeader->stringsOffset);
+
+    LR_LOG_INFO_F("AssetPackage: opened %s (%u entries, %zu bytes)",
+                  path.c_str(), mHeader->entryCount, mFile.GetSize());
+    return true;
+}
+
+bool AssetPackage::Validate() const {
+    const size_t fileSize = mFile.GetSize();
+    if (fileSize < sizeof(AssetPackageHeader)) {
+        return false;
+    }
+    const AssetPackageHeader& h = *mHeader;
+    if (h.magic != kMagic || h.version != kVersion || h.fileSize != fileSize) {
+        return false;
+    }
+    if (!isPowerOfTwo(h.bucketCount) || h.entryCount > h.bucketCount) {
+        return false;
+    }
+    if (h.tocOffset % alignof(AssetEntry) != 0 ||
+        !isRangeInside(h.tocOffset, uint64_t(h.bucketCount) * sizeof(AssetEntry), fileSize) ||
+        !isRangeInside(h.stringsOffset, h.stringsSize, fileSize)) {
+        return false;
+    }
+
+    const AssetEntry* entries = reinterpret_cast<const AssetEntry*>(mFile.GetData() + h.tocOffset);
+    for (uint32_t i = 0; i < h.bucketCount; ++i) {
+        const AssetEntry& e = entries[i];
+        if (e.nameHash == 0) {
+            continue;
+        }
+        if (!isRangeInside(e.offset, e.storedSize, fileSize) ||
+            !isRangeInside(e.nameOffset, e.nameLength, h.stringsSize)) {
+            return false;
+        }
+        // 未压缩条目的存储大小必须等于数据大小，否则 Read/GetView 会越过调用方缓冲区
+        if (e.compression == AssetCompression::None ? e.storedSize != e.size
+                                                    : e.compression != AssetCompression::LZ4) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void AssetPackage::Close() {
+    mFile.Close();
+    mHeader = nullptr;
+    mEntries = nullptr;
+    mStrings = nullptr;
+}
+
+const AssetEntry* AssetPackage::Find(const char* name) const {
+    if (!mHeader || !name) {
+        return nullptr;
+    }
+
+    const size_t length = std::strlen(name);
+    const uint64_t hash = HashName(name, length);
+    const uint32_t mask = mHeader->bucketCount - 1;
+
+    // 线性探测：装载因子不超过 0.5，平均一次命中
+    for (uint32_t probe = 0; probe < mHeader->bucketCount; ++probe) {
+        const AssetEntry& entry = mEntries[(hash + probe) & mask];
+        if (entry.nameHash == 0) {
+            return nullptr;
+        }
+        if (entry.nameHash == hash && entry.nameLength == length &&
+            std::memcmp(mStrings + entry.nameOffset, name, length) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+std::string AssetPackage::GetName(const AssetEntry* entry) const {
+    if (!mHeader || !entry) {
+        return std::string();
+    }
+    return std::string(mStrings + entry->nameOffset, entry->nameLength);
+}
+
+AssetView AssetPackage::GetStoredView(const AssetEntry* entry) const {
+    AssetView view;
+    if (mHeader && entry) {
+        view.data = mFile.GetData() + entry->offset;
+        view.size = static_cast<size_t>(entry->storedSize);
+    }
+    return view;
+}
+
+AssetView AssetPackage::GetView(const AssetEntry* entry) const {
+    if (!entry || entry->compression != AssetCompression::None) {
+        return AssetView();
+    }
+    return GetStoredView(entry);
+}
+
+bool AssetPackage::Read(const AssetEntry* entry, void* dst, size_t dstSize) const {
+    if (!mHeader || !entry || !dst || dstSize < entry->size) {
+        return false;
+    }
+
+    AssetView stored = GetStoredView(entry);
+    switch (entry->compression) {
+        case AssetCompression::None:
+            std::memcpy(dst, stored.data, static_cast<size_t>(entry->size));
+            return true;
+        case AssetCompression::LZ4:
+            if (!LZ4DecompressBlock(stored.data, stored.size, dst,
+                                    static_cast<size_t>(entry->size))) {
+                LR_LOG_ERROR_F("AssetPackage: corrupt LZ4 block for %s",
+                               GetName(entry).c_str());
+                return false;
+            }
+            return true;
+    }
+    return false;
+}
+
+bool AssetPackage::Read(const AssetEntry* entry, std::vector<uint8_t>& out) const {
+    if (!entry) {
+        return false;
+    }
+    out.resize(static_cast<size_t>(entry->size));
+    return Read(entry, out.data(), out.size());
+}
+
+std::vector<const AssetEntry*> AssetPackage::GetEntries() const {
+    std::vector<const AssetEntry*> entries;
+    if (!mHeader) {
+        return entries;
+    }
+    entries.reserve(mHeader->entryCount);
+    for (uint32_t i = 0; i < mHeader->bucketCount; ++i) {
+        if (mEntries[i].nameHash != 0) {
+            entries.push_back(&mEntries[i]);
+        }
+    }
+    return entries;
+}
+
+void AssetPackage::Prefetch(const AssetEntry* entry) const {
+    if (mHeader && entry) {
+        mFile.Prefetch(static_cast<size_t>(entry->offset), static_cast<size_t>(entry->storedSize));
+    }
+}
+
+// =============================================================================
+// AssetPackageWriter
+// =============================================================================
+
+bool AssetPackageWriter::AddAsset(const std::string& name, const void* data, size_t size,
+                                  const AddOptions& options) {
+    if (name.empty() || (size > 0 && !data)) {
+        LR_LOG_ERROR("AssetPackageWriter: invalid asset");
+        return false;
+    }
+    if (!isPowerOfTwo(options.alignment)) {
+        LR_LOG_ERROR_F("AssetPackageWriter: alignment %u is not a power of two", options.alignment);
+        return false;
+    }
+
+    uint64_t hash = AssetPackage::HashName(name.data(), name.size());
+    for (const auto& asset : mAssets) {
+        if (asset.hash == hash && asset.name == name) {
+            LR_LOG_ERROR_F("AssetPackageWriter: duplicate asset %s", name.c_str());
+            return false;
+        }
+    }
+
+    PendingAsset asset;
+    asset.name = name;
+    asset.hash = hash;
+    asset.options = options;
+    asset.size = size;
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    if (options.compress && size > 0) {
+        LZ4CompressBlock(bytes, size, asset.stored);
+        if (asset.stored.size() < size) {
+            asset.compression = AssetCompression::LZ4;
+        } else {
+            asset.stored.clear();
+        }
+    }
+    if (asset.compression == AssetCompression::None) {
+        asset.stored.assign(bytes, bytes + size);
+    }
+
+    mAssets.push_back(std::move(asset));
+    return true;
+}
+
+bool AssetPackageWriter::Write(const std::string& path) const {
+    // 桶数量取 2 的幂且装载因子不超过 0.5
+    uint32_t bucketCount = 1;
+    while (bucketCount < mAssets.size() * 2) {
+        bucketCount <<= 1;
+    }
+
+    std::vector<AssetEntry> buckets(bucketCount);
+    std::string strings;
+
+    AssetPackageHeader header;
+    header.magic = AssetPackage::kMagic;
+    header.version = AssetPackage::kVersion;
+    header.entryCount = static_cast<uint32_t>(mAssets.size());
+    header.bucketCount = bucketCount;
+    header.tocOffset = sizeof(AssetPackageHeader);
+
+    for (const auto& asset : mAssets) {
+        strings += asset.name;
+    }
+    header.stringsOffset = header.tocOffset + uint64_t(bucketCount) * sizeof(AssetEntry);
+    header.stringsSize = strings.size();
+
+    // 布局数据块
+    uint64_t cursor = header.stringsOffset + header.stringsSize;
+    uint32_t nameOffset = 0;
+    std::vector<uint64_t> offsets;
+    offsets.reserve(mAssets.size());
+    for (const auto& asset : mAssets) {
+        cursor = alignUp(static_cast<size_t>(cursor), asset.options.alignment);
+        offsets.push_back(cursor);
+
+        AssetEntry entry;
+        entry.nameHash = asset.hash;
+        entry.offset = cursor;
+        entry.storedSize = asset.stored.size();
+        entry.size = asset.size;
+        entry.nameOffset = nameOffset;
+        entry.nameLength = static_cast<uint32_t>(asset.name.size());
+        entry.type = asset.options.type;
+        entry.compression = asset.compression;
+        entry.flags = asset.options.flags;
+        entry.alignment = asset.options.alignment;
+        std::memcpy(entry.params, asset.options.params, sizeof(entry.params));
+
+        uint32_t mask = bucketCount - 1;
+        uint32_t slot = static_cast<uint32_t>(asset.hash & mask);
+        while (buckets[slot].nameHash != 0) {
+            slot = (slot + 1) & mask;
+        }
+        buckets[slot] = entry;
+
+        nameOffset += entry.nameLength;
+        cursor += asset.stored.size();
+    }
+    header.fileSize = cursor;
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        LR_LOG_ERROR_F("AssetPackageWriter: failed to create %s", path.c_str());
+        return false;
+    }
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    ok = ok && std::fwrite(buckets.data(), sizeof(AssetEntry), buckets.size(), file) == buckets.size();
+    ok = ok && (strings.empty() || std::fwrite(strings.data(), 1, strings.size(), file) == strings.size());
+
+    uint64_t written = header.stringsOffset + header.stringsSize;
+    static const uint8_t kPadding[4096] = {};
+    for (size_t i = 0; ok && i < mAssets.size(); ++i) {
+        size_t padding = static_cast<size_t>(offsets[i] - written);
+        while (ok && padding > 0) {
+            size_t chunk = std::min(padding, sizeof(kPadding));
+            ok = std::fwrite(kPadding, 1, chunk, file) == chunk;
+            padding -= chunk;
+        }
+        const auto& stored = mAssets[i].stored;
+        ok = ok && (stored.empty() || std::fwrite(stored.data(), 1, stored.size(), file) == stored.size());
+        written = offsets[i] + stored.size();
+    }
+
+    ok = (std::fclose(file) == 0) && ok;
+    if (!ok) {
+        LR_LOG_ERROR_F("AssetPackageWriter: failed to write %s", path.c_str());
+        return false;
+    }
+
+    LR_LOG_INFO_F("AssetPackageWriter: wrote %s (%zu assets, %llu bytes)",
+                  path.c_str(), mAssets.size(), static_cast<unsigned long long>(header.fileSize));
+    return true;
+}
+
+} // namespace utils
+} // namespace lrengine
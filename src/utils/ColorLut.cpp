@@ -0,0 +1,249 @@
+/**
+ * @file ColorLut.cpp
+ * @brief CPU 3D LUT 调色实现
+ */
+
+#include "lrengine/utils/ColorLut.h"
+#include "lrengine/utils/ParallelFor.h"
+#include "SimdConfig.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+// 表项定点缩放：[0, 255] → [0, 255 × 64]，与 0-256 的权重相乘后右移 14 位
+constexpr int32_t kLutValueScale = 64;
+constexpr int kLutShift = 14;
+
+// 轴表项：高位为该轴格点的表项偏移，低 9 位为权重 [0, 256]
+constexpr uint32_t kFracBits = 9;
+constexpr uint32_t kFracMask = (1u << kFracBits) - 1;
+
+/**
+ * @brief 构建通道值 → (格点偏移, 权重) 表
+ *
+ * 通道值 255 落在最后一个格点上，改用倒数第二个格点加满权重，
+ * 保证四面体的所有顶点都在表内。
+ */
+void BuildAxis(uint32_t size, uint32_t entryStride, uint32_t* axis) {
+    for (uint32_t v = 0; v < 256; ++v) {
+        const uint32_t pos = (v * (size - 1) * 256 + 127) / 255;
+        uint32_t index = pos >> 8;
+        uint32_t frac = pos & 255;
+        if (index == size - 1) {
+            index = size - 2;
+            frac = 256;
+        }
+        axis[v] = ((index * entryStride) << kFracBits) | frac;
+    }
+}
+
+/**
+ * @brief 查找上下文
+ */
+struct LutContext {
+    const int16_t* table;
+    const uint32_t* axis;   ///< R、G、B 三轴
+    uint32_t strideG;       ///< G 轴相邻格点的表项距离
+    uint32_t strideB;       ///< B 轴相邻格点的表项距离
+};
+
+bool InitContext(const ColorLut3D& lut, LutContext& ctx) {
+    if (lut.size < 2 || lut.table.size() != static_cast<size_t>(lut.size) * lut.size * lut.size * 4 ||
+        lut.axis.size() != 768) {
+        return false;
+    }
+    ctx.table = lut.table.data();
+    ctx.axis = lut.axis.data();
+    ctx.strideG = lut.size;
+    ctx.strideB = lut.size * lut.size;
+    return true;
+}
+
+/**
+ * @brief 四面体插值查找一个像素
+ *
+ * 按三个分数的大小关系选择立方体内 6 个四面体之一，顶点为 c000、c1、c2、c111，
+ * 权重之和恒为 256。
+ */
+inline void Lookup(const LutContext& ctx, uint8_t r, uint8_t g, uint8_t b, uint8_t* rgb) {
+    const uint32_t ar = ctx.axis[r];
+    const uint32_t ag = ctx.axis[256 + g];
+    const uint32_t ab = ctx.axis[512 + b];
+    const uint32_t base = (ar >> kFracBits) + (ag >> kFracBits) + (ab >> kFracBits);
+    const int32_t fr = static_cast<int32_t>(ar & kFracMask);
+    const int32_t fg = static_cast<int32_t>(ag & kFracMask);
+    const int32_t fb = static_cast<int32_t>(ab & kFracMask);
+    const uint32_t sr = 1;
+    const uint32_t sg = ctx.strideG;
+    const uint32_t sb = ctx.strideB;
+
+    uint32_t o1, o2;
+    int32_t w0, w1, w2, w3;
+    if (fr >= fg) {
+        if (fg >= fb) {
+            o1 = sr; o2 = sr + sg; w0 = 256 - fr; w1 = fr - fg; w2 = fg - fb; w3 = fb;
+        } else if (fr >= fb) {
+            o1 = sr; o2 = sr + sb; w0 = 256 - fr; w1 = fr - fb; w2 = fb - fg; w3 = fg;
+        } else {
+            o1 = sb; o2 = sb + sr; w0 = 256 - fb; w1 = fb - fr; w2 = fr - fg; w3 = fg;
+        }
+    } else {
+        if (fb >= fg) {
+            o1 = sb; o2 = sb + sg; w0 = 256 - fb; w1 = fb - fg; w2 = fg - fr; w3 = fr;
+        } else if (fb >= fr) {
+            o1 = sg; o2 = sg + sb; w0 = 256 - fg; w1 = fg - fb; w2 = fb - fr; w3 = fr;
+        } else {
+            o1 = sg; o2 = sg + sr; w0 = 256 - fg; w1 = fg - fr; w2 = fr - fb; w3 = fb;
+        }
+    }
+
+    const int16_t* c0 = ctx.table + static_cast<size_t>(base) * 4;
+    const int16_t* c1 = c0 + static_cast<size_t>(o1) * 4;
+    const int16_t* c2 = c0 + static_cast<size_t>(o2) * 4;
+    const int16_t* c3 = c0 + static_cast<size_t>(sr + sg + sb) * 4;
+
+#if defined(LR_SIMD_SSE2)
+    // 相邻两个顶点交错后用 madd 一次完成两次乘加
+    const __m128i v01 = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c0)),
+                                           _mm_loadl_epi64(reinterpret_cast<const __m128i*>(c1)));
+    const __m128i v23 = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(c2)),
+                                           _mm_loadl_epi64(reinterpret_cast<const __m128i*>(c3)));
+    __m128i sum = _mm_add_epi32(_mm_madd_epi16(v01, _mm_set1_epi32((w1 << 16) | w0)),
+                                _mm_madd_epi16(v23, _mm_set1_epi32((w3 << 16) | w2)));
+    sum = _mm_srai_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << (kLutShift - 1))), kLutShift);
+    sum = _mm_packs_epi32(sum, sum);
+    const uint32_t packed = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(sum, sum)));
+    rgb[0] = static_cast<uint8_t>(packed);
+    rgb[1] = static_cast<uint8_t>(packed >> 8);
+    rgb[2] = static_cast<uint8_t>(packed >> 16);
+#elif defined(LR_SIMD_NEON)
+    int32x4_t sum = vmull_n_s16(vld1_s16(c0), static_cast<int16_t>(w0));
+    sum = vmlal_n_s16(sum, vld1_s16(c1), static_cast<int16_t>(w1));
+    sum = vmlal_n_s16(sum, vld1_s16(c2), static_cast<int16_t>(w2));
+    sum = vmlal_n_s16(sum, vld1_s16(c3), static_cast<int16_t>(w3));
+    const uint16x4_t narrow = vqrshrun_n_s32(sum, kLutShift);
+    const uint8x8_t bytes = vqmovn_u16(vcombine_u16(narrow, narrow));
+    rgb[0] = vget_lane_u8(bytes, 0);
+    rgb[1] = vget_lane_u8(bytes, 1);
+    rgb[2] = vget_lane_u8(bytes, 2);
+#else
+    for (int c = 0; c < 3; ++c) {
+        const int32_t sum = c0[c] * w0 + c1[c] * w1 + c2[c] * w2 + c3[c] * w3;
+        const int32_t value = (sum + (1 << (kLutShift - 1))) >> kLutShift;
+        rgb[c] = static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+    }
+#endif
+}
+
+/**
+ * @brief 处理一行
+ * @param bytesPerPixel 3 或 4
+ * @param swapRB 是否为 BGR 顺序
+ */
+void ApplyRow(const LutContext& ctx, const uint8_t* src, uint8_t* dst, uint32_t count, uint32_t bytesPerPixel,
+              bool swapRB) {
+    const int ri = swapRB ? 2 : 0;
+    const int bi = swapRB ? 0 : 2;
+    for (uint32_t x = 0; x < count; ++x, src += bytesPerPixel, dst += bytesPerPixel) {
+        uint8_t rgb[3];
+        Lookup(ctx, src[ri], src[1], src[bi], rgb);
+        if (bytesPerPixel == 4) {
+            dst[3] = src[3];
+        }
+        dst[ri] = rgb[0];
+        dst[1] = rgb[1];
+        dst[bi] = rgb[2];
+    }
+}
+
+} // namespace
+
+bool CreateColorLut3D(uint32_t size, const float* rgb, ColorLut3D& out) {
+    if ((size != 17 && size != 33 && size != 65) || !rgb) {
+        return false;
+    }
+
+    const size_t entries = static_cast<size_t>(size) * size * size;
+    out.size = size;
+    out.table.resize(entries * 4);
+    for (size_t i = 0; i < entries; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            const float value = std::min(std::max(rgb[i * 3 + c], 0.0f), 1.0f);
+            out.table[i * 4 + c] = static_cast<int16_t>(std::lround(value * 255.0f * kLutValueScale));
+        }
+        out.table[i * 4 + 3] = 0;
+    }
+
+    out.axis.resize(768);
+    BuildAxis(size, 1, out.axis.data());
+    BuildAxis(size, size, out.axis.data() + 256);
+    BuildAxis(size, size * size, out.axis.data() + 512);
+    return true;
+}
+
+void ApplyColorLut3DToRGBA(const ColorLut3D& lut, uint8_t* rgba, uint32_t pixelCount) {
+    LutContext ctx;
+    if (!rgba || !InitContext(lut, ctx)) {
+        return;
+    }
+    ApplyRow(ctx, rgba, rgba, pixelCount, 4, false);
+}
+
+bool ApplyColorLut3D(const ImageDataDesc& src, const ImageDataDesc& dst, const ColorLut3D& lut,
+                     uint32_t maxThreads) {
+    LutContext ctx;
+    if (!InitContext(lut, ctx)) {
+        return false;
+    }
+    if (src.format != dst.format || src.width != dst.width || src.height != dst.height || src.planes.empty() ||
+        dst.planes.empty() || !src.planes[0].data || !dst.planes[0].data) {
+        return false;
+    }
+
+    uint32_t bytesPerPixel = 0;
+    switch (src.format) {
+        case ImageFormat::RGBA8:
+        case ImageFormat::BGRA8:
+            bytesPerPixel = 4;
+            break;
+        case ImageFormat::RGB8:
+            bytesPerPixel = 3;
+            break;
+        default:
+            return false;
+    }
+
+    const bool swapRB = src.format == ImageFormat::BGRA8;
+    const size_t rowBytes = static_cast<size_t>(src.width) * bytesPerPixel;
+    const size_t srcStride = src.planes[0].stride ? src.planes[0].stride : rowBytes;
+    const size_t dstStride = dst.planes[0].stride ? dst.planes[0].stride : rowBytes;
+    const uint8_t* srcBase = static_cast<const uint8_t*>(src.planes[0].data);
+    uint8_t* dstBase = static_cast<uint8_t*>(const_cast<void*>(dst.planes[0].data));
+    const uint32_t width = src.width;
+
+    ParallelFor(
+        src.height,
+        [&](uint32_t y) {
+            ApplyRow(ctx, srcBase + srcStride * y, dstBase + dstStride * y, width, bytesPerPixel, swapRB);
+        },
+        maxThreads);
+    return true;
+}
+
+bool ApplyColorLut3D(ImageBuffer* image, const ColorLut3D& lut, uint32_t maxThreads) {
+    if (!image || !image->Lock(false)) {
+        return false;
+    }
+    const ImageDataDesc& desc = image->GetImageDesc();
+    const bool result = ApplyColorLut3D(desc, desc, lut, maxThreads);
+    image->Unlock();
+    return result;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,214 @@
+/**
+ * @file DirtyRegion.cpp
+ * @brief 分块变化检测与脏矩形合并实现
+ */
+
+#include "lrengine/utils/DirtyRegion.h"
+#include "ImageLayout.h"
+#include "SimdConfig.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+// 比较两段内存是否相同
+bool BytesEqual(const uint8_t* a, const uint8_t* b, size_t size) {
+    size_t i = 0;
+
+#if defined(LR_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 64 <= size; i += 64) {
+        const __m128i d0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        const __m128i d1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 16)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 16)));
+        const __m128i d2 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 32)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 32)));
+        const __m128i d3 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i + 48)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 48)));
+        const __m128i diff = _mm_or_si128(_mm_or_si128(d0, d1), _mm_or_si128(d2, d3));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, zero)) != 0xFFFF) {
+            return false;
+        }
+    }
+    for (; i + 16 <= size; i += 16) {
+        const __m128i diff = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(diff, zero)) != 0xFFFF) {
+            return false;
+        }
+    }
+#elif defined(LR_SIMD_NEON)
+    for (; i + 64 <= size; i += 64) {
+        const uint8x16_t d0 = veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i));
+        const uint8x16_t d1 = veorq_u8(vld1q_u8(a + i + 16), vld1q_u8(b + i + 16));
+        const uint8x16_t d2 = veorq_u8(vld1q_u8(a + i + 32), vld1q_u8(b + i + 32));
+        const uint8x16_t d3 = veorq_u8(vld1q_u8(a + i + 48), vld1q_u8(b + i + 48));
+        const uint64x2_t diff = vreinterpretq_u64_u8(vorrq_u8(vorrq_u8(d0, d1), vorrq_u8(d2, d3)));
+        if ((vgetq_lane_u64(diff, 0) | vgetq_lane_u64(diff, 1)) != 0) {
+            return false;
+        }
+    }
+    for (; i + 16 <= size; i += 16) {
+        const uint64x2_t diff = vreinterpretq_u64_u8(veorq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+        if ((vgetq_lane_u64(diff, 0) | vgetq_lane_u64(diff, 1)) != 0) {
+            return false;
+        }
+    }
+#endif
+
+    return std::memcmp(a + i, b + i, size - i) == 0;
+}
+
+/**
+ * @brief 合并中的矩形（块坐标，右/下边界不含）
+ */
+struct TileSpan {
+    uint32_t column0;
+    uint32_t column1;
+    uint32_t row0;
+    uint32_t row1;
+};
+
+} // namespace
+
+bool DetectDirtyTiles(const ImageDataDesc& previous, const ImageDataDesc& current, uint32_t tileSize,
+                      DirtyTileMap& out) {
+    out = DirtyTileMap();
+    ImagePlaneLayout layout;
+    if (tileSize == 0 || previous.width != current.width || previous.height != current.height ||
+        previous.format != current.format || !GetImagePlaneLayout(current.format, layout) ||
+        !HasPlaneData(previous, layout) || !HasPlaneData(current, layout)) {
+        return false;
+    }
+    if (layout.chromaSubsampled && (tileSize & 1)) {
+        return false;
+    }
+
+    out.tileSize = tileSize;
+    out.columns = (current.width + tileSize - 1) / tileSize;
+    out.rows = (current.height + tileSize - 1) / tileSize;
+    out.dirty.assign(static_cast<size_t>(out.columns) * out.rows, 0);
+
+    for (uint32_t ty = 0; ty < out.rows; ++ty) {
+        uint8_t* rowMask = out.dirty.data() + static_cast<size_t>(ty) * out.columns;
+        uint32_t clean = out.columns;
+
+        // 按行扫描整条块行，已判定变化的块不再比较
+        for (int plane = 0; plane < layout.count && clean > 0; ++plane) {
+            const uint32_t shift = GetPlaneShift(layout, plane);
+            const uint32_t planeWidth = current.width >> shift;
+            const uint32_t planeHeight = current.height >> shift;
+            const uint32_t planeTile = tileSize >> shift;
+            const uint32_t bytesPerPixel = layout.bytesPerPixel[plane];
+            const size_t previousStride = GetPlaneStride(previous, layout, plane);
+            const size_t currentStride = GetPlaneStride(current, layout, plane);
+            const uint8_t* previousBase = static_cast<const uint8_t*>(previous.planes[plane].data);
+            const uint8_t* currentBase = static_cast<const uint8_t*>(current.planes[plane].data);
+
+            const uint32_t yEnd = std::min(planeHeight, (ty + 1) * planeTile);
+            for (uint32_t y = ty * planeTile; y < yEnd && clean > 0; ++y) {
+                const uint8_t* previousRow = previousBase + previousStride * y;
+                const uint8_t* currentRow = currentBase + currentStride * y;
+                for (uint32_t tx = 0; tx < out.columns; ++tx) {
+                    const uint32_t xBegin = tx * planeTile;
+                    if (xBegin >= planeWidth) {
+                        break;
+                    }
+                    if (rowMask[tx]) {
+                        continue;
+                    }
+                    const size_t offset = static_cast<size_t>(xBegin) * bytesPerPixel;
+                    const size_t bytes = static_cast<size_t>(std::min(planeWidth, xBegin + planeTile) - xBegin) *
+                                         bytesPerPixel;
+                    if (!BytesEqual(previousRow + offset, currentRow + offset, bytes)) {
+                        rowMask[tx] = 1;
+                        --clean;
+                    }
+                }
+            }
+        }
+        out.dirtyCount += out.columns - clean;
+    }
+    return true;
+}
+
+void MergeDirtyTiles(const DirtyTileMap& tiles, uint32_t width, uint32_t height,
+                     std::vector<DirtyRect>& out) {
+    out.clear();
+    if (tiles.tileSize == 0 || tiles.dirty.size() < static_cast<size_t>(tiles.columns) * tiles.rows) {
+        return;
+    }
+
+    std::vector<TileSpan> spans;   // 已结束的矩形
+    std::vector<TileSpan> active;  // 可能继续向下延伸的矩形
+    std::vector<TileSpan> next;
+
+    for (uint32_t row = 0; row < tiles.rows; ++row) {
+        const uint8_t* rowMask = tiles.dirty.data() + static_cast<size_t>(row) * tiles.columns;
+        next.clear();
+
+        uint32_t column = 0;
+        while (column < tiles.columns) {
+            if (!rowMask[column]) {
+                ++column;
+                continue;
+            }
+            const uint32_t begin = column;
+            while (column < tiles.columns && rowMask[column]) {
+                ++column;
+            }
+
+            // 上一块行列范围相同的矩形向下延伸
+            TileSpan span = {begin, column, row, row + 1};
+            for (TileSpan& open : active) {
+                if (open.column0 == begin && open.column1 == column) {
+                    span.row0 = open.row0;
+                    open.column1 = 0;  // 标记为已延续
+                    break;
+                }
+            }
+            next.push_back(span);
+        }
+
+        for (const TileSpan& open : active) {
+            if (open.column1 != 0) {
+                spans.push_back(open);
+            }
+        }
+        active.swap(next);
+    }
+    spans.insert(spans.end(), active.begin(), active.end());
+
+    std::sort(spans.begin(), spans.end(), [](const TileSpan& a, const TileSpan& b) {
+        return a.row0 != b.row0 ? a.row0 < b.row0 : a.column0 < b.column0;
+    });
+
+    out.reserve(spans.size());
+    for (const TileSpan& span : spans) {
+        DirtyRect rect;
+        rect.x = span.column0 * tiles.tileSize;
+        rect.y = span.row0 * tiles.tileSize;
+        if (rect.x >= width || rect.y >= height) {
+            continue;
+        }
+        rect.width = std::min(width, span.column1 * tiles.tileSize) - rect.x;
+        rect.height = std::min(height, span.row1 * tiles.tileSize) - rect.y;
+        out.push_back(rect);
+    }
+}
+
+uint64_t GetDirtyArea(const std::vector<DirtyRect>& rects) {
+    uint64_t area = 0;
+    for (const DirtyRect& rect : rects) {
+        area += static_cast<uint64_t>(rect.width) * rect.height;
+    }
+    return area;
+}
+
+} // namespace utils
+} // namespace lrengine
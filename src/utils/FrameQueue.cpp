@@ -0,0 +1,170 @@
+/**
+ * @file FrameQueue.cpp
+ * @brief 有界帧队列实现
+ */
+
+#include "lrengine/utils/FrameQueue.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+uint64_t GetSteadyTimeNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+FrameQueue::FrameQueue(const FrameQueueOptions& options)
+    : mOptions(options) {
+    mSlots.resize(std::max<uint32_t>(options.capacity, 1));
+}
+
+FrameQueue::~FrameQueue() {
+    Close();
+    Clear();
+}
+
+bool FrameQueue::Push(ImageBufferPool::ImageBufferPtr buffer, int64_t timestampUs) {
+    if (!buffer) {
+        return false;
+    }
+
+    // 被挤出的旧帧在锁外释放：其删除器会归还到池并可能唤醒等待的生产者
+    ImageBufferPool::ImageBufferPtr evicted;
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (mClosed) {
+            return false;
+        }
+        mStats.pushedFrames++;
+
+        if (mCount == mSlots.size()) {
+            switch (mOptions.dropPolicy) {
+                case FrameDropPolicy::DropOldest:
+                    evicted = std::move(mSlots[mHead].buffer);
+                    mHead = (mHead + 1) % mSlots.size();
+                    mCount--;
+                    mStats.droppedFrames++;
+                    break;
+
+                case FrameDropPolicy::DropNewest:
+                    mStats.droppedFrames++;
+                    mNextSequence++;
+                    return false;
+
+                case FrameDropPolicy::Block: {
+                    auto hasRoom = [this]() { return mClosed || mCount < mSlots.size(); };
+                    if (mOptions.blockTimeoutMs == 0) {
+                        mNotFull.wait(lock, hasRoom);
+                    } else if (!mNotFull.wait_for(lock, std::chrono::milliseconds(mOptions.blockTimeoutMs),
+                                                  hasRoom)) {
+                        mStats.droppedFrames++;
+                        mNextSequence++;
+                        return false;
+                    }
+                    if (mClosed) {
+                        return false;
+                    }
+                    break;
+                }
+            }
+        }
+
+        pushLocked(std::move(buffer), timestampUs);
+    }
+    mNotEmpty.notify_one();
+    return true;
+}
+
+bool FrameQueue::Pop(QueuedFrame& frame, uint64_t timeoutMs) {
+    // 输出参数中残留的上一帧在锁外释放
+    ImageBufferPool::ImageBufferPtr previous = std::move(frame.buffer);
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        if (mCount == 0 && !mClosed && timeoutMs > 0) {
+            mNotEmpty.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                               [this]() { return mClosed || mCount > 0; });
+        }
+        if (mCount == 0) {
+            return false;
+        }
+
+        frame = std::move(mSlots[mHead]);
+        mSlots[mHead] = QueuedFrame();
+        mHead = (mHead + 1) % mSlots.size();
+        mCount--;
+
+        const uint64_t now = GetSteadyTimeNs();
+        const uint64_t latencyUs = now > frame.enqueueTimeNs ? (now - frame.enqueueTimeNs) / 1000 : 0;
+        mStats.poppedFrames++;
+        mStats.lastLatencyUs = latencyUs;
+        mStats.maxLatencyUs = std::max(mStats.maxLatencyUs, latencyUs);
+        mTotalLatencyUs += latencyUs;
+        mStats.averageLatencyUs = static_cast<double>(mTotalLatencyUs) / static_cast<double>(mStats.poppedFrames);
+    }
+    mNotFull.notify_one();
+    return true;
+}
+
+void FrameQueue::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mClosed = true;
+    }
+    mNotEmpty.notify_all();
+    mNotFull.notify_all();
+}
+
+void FrameQueue::Clear() {
+    std::vector<ImageBufferPool::ImageBufferPtr> released;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        released.reserve(mCount);
+        for (; mCount > 0; --mCount) {
+            released.push_back(std::move(mSlots[mHead].buffer));
+            mSlots[mHead] = QueuedFrame();
+            mHead = (mHead + 1) % mSlots.size();
+        }
+        mHead = 0;
+    }
+    mNotFull.notify_all();
+}
+
+bool FrameQueue::IsClosed() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mClosed;
+}
+
+size_t FrameQueue::GetSize() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCount;
+}
+
+FrameQueueStats FrameQueue::GetStats() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+void FrameQueue::ResetStats() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStats = FrameQueueStats();
+    mTotalLatencyUs = 0;
+}
+
+void FrameQueue::pushLocked(ImageBufferPool::ImageBufferPtr buffer, int64_t timestampUs) {
+    QueuedFrame& slot = mSlots[(mHead + mCount) % mSlots.size()];
+    slot.buffer = std::move(buffer);
+    slot.timestampUs = timestampUs;
+    slot.enqueueTimeNs = GetSteadyTimeNs();
+    slot.sequence = mNextSequence++;
+    mCount++;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,245 @@
+/**
+ * @file FrameScheduler.cpp
+ * @brief 截止时间感知的帧调度器实现
+ */
+
+#include "lrengine/utils/FrameScheduler.h"
+
+#include <algorithm>
+
+namespace lrengine {
+namespace utils {
+
+// =============================================================================
+// CostModel
+// =============================================================================
+
+float FrameScheduler::CostModel::estimate(uint32_t level) const {
+    if (level == 0 || level > declared.size()) {
+        return 0.0f;
+    }
+    const uint32_t index = level - 1;
+    if (!sampled[index]) {
+        return declared[index] * scale;
+    }
+    // 实测值按采样后整体比例的变化折算：降频时测得的等级在设备恢复后也随之回落
+    return sampleScale[index] > 0.0f ? measured[index] * (scale / sampleScale[index]) : measured[index];
+}
+
+void FrameScheduler::CostModel::update(uint32_t level, float us, float smoothing) {
+    if (level == 0 || level > declared.size() || us < 0.0f) {
+        return;
+    }
+    const uint32_t index = level - 1;
+
+    // 同一阶段各等级的开销大体按同一比例变化（如降频），据此推算其它等级
+    if (declared[index] > 0.0f) {
+        scale += smoothing * (us / declared[index] - scale);
+    }
+
+    if (sampled[index]) {
+        // 旧实测值先折算到当前比例再平滑
+        const float rescaled =
+            sampleScale[index] > 0.0f ? measured[index] * (scale / sampleScale[index]) : measured[index];
+        measured[index] = rescaled + smoothing * (us - rescaled);
+    } else {
+        measured[index] = us;
+        sampled[index] = 1;
+    }
+    sampleScale[index] = scale;
+}
+
+// =============================================================================
+// FrameScheduler
+// =============================================================================
+
+FrameScheduler::FrameScheduler(const FrameSchedulerOptions& options)
+    : mOptions(options) {
+    mOptions.costSmoothing = std::min(std::max(mOptions.costSmoothing, 0.01f), 1.0f);
+    mOptions.upgradeHeadroom = std::min(std::max(mOptions.upgradeHeadroom, 0.0f), 0.9f);
+}
+
+uint32_t FrameScheduler::AddStage(const FrameStageDesc& desc) {
+    if (desc.cpuCostUs.empty()) {
+        return UINT32_MAX;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Stage stage;
+    stage.desc = desc;
+    stage.levelCount = static_cast<uint32_t>(desc.cpuCostUs.size());
+    stage.targetLevel = stage.levelCount;
+
+    stage.cpu.declared = desc.cpuCostUs;
+    stage.gpu.declared = desc.gpuCostUs;
+    stage.gpu.declared.resize(stage.levelCount, 0.0f);
+    for (CostModel* model : {&stage.cpu, &stage.gpu}) {
+        model->measured.assign(stage.levelCount, 0.0f);
+        model->sampleScale.assign(stage.levelCount, 1.0f);
+        model->sampled.assign(stage.levelCount, 0);
+    }
+
+    const uint32_t index = static_cast<uint32_t>(mStages.size());
+    mStages.push_back(std::move(stage));
+
+    // 低优先级在前；同优先级时后添加的阶段先降级
+    mDegradeOrder.push_back(index);
+    std::stable_sort(mDegradeOrder.begin(), mDegradeOrder.end(), [this](uint32_t a, uint32_t b) {
+        const uint32_t pa = mStages[a].desc.priority;
+        const uint32_t pb = mStages[b].desc.priority;
+        return pa != pb ? pa < pb : a > b;
+    });
+    mStableFrames = 0;
+    return index;
+}
+
+uint32_t FrameScheduler::GetStageCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return static_cast<uint32_t>(mStages.size());
+}
+
+FramePlan FrameScheduler::PlanFrame(int64_t nowUs, int64_t deadlineUs) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    FramePlan plan;
+    plan.frameId = mNextFrameId++;
+    plan.deadlineUs = deadlineUs;
+    plan.budgetUs = deadlineUs - nowUs - mOptions.safetyMarginUs;
+    plan.stageLevels.resize(mStages.size());
+
+    float cost = 0.0f;
+    for (size_t i = 0; i < mStages.size(); ++i) {
+        plan.stageLevels[i] = mStages[i].targetLevel;
+        cost += estimateLocked(static_cast<uint32_t>(i), plan.stageLevels[i]);
+    }
+
+    // 第一轮把各阶段降到最低质量，第二轮再跳过可选阶段；均从低优先级开始
+    const float budget = static_cast<float>(plan.budgetUs);
+    for (int pass = 0; pass < 2 && cost > budget; ++pass) {
+        for (uint32_t index : mDegradeOrder) {
+            const Stage& stage = mStages[index];
+            const uint32_t minLevel = (pass == 1 && stage.desc.optional) ? 0u : 1u;
+            uint32_t& level = plan.stageLevels[index];
+            while (cost > budget && level > minLevel) {
+                cost -= estimateLocked(index, level) - estimateLocked(index, level - 1);
+                --level;
+            }
+        }
+    }
+
+    plan.estimatedCostUs = cost;
+    plan.drop = mOptions.allowDrop && cost > budget;
+    for (size_t i = 0; i < mStages.size(); ++i) {
+        plan.degraded |= plan.stageLevels[i] < mStages[i].levelCount;
+    }
+
+    mStats.plannedFrames++;
+    if (plan.drop) {
+        // 丢帧多因个别帧到达过晚，不据此调整目标等级
+        mStats.droppedFrames++;
+        mStableFrames = 0;
+        return plan;
+    }
+    if (plan.degraded) {
+        mStats.degradedFrames++;
+    }
+
+    bool lowered = false;
+    for (size_t i = 0; i < mStages.size(); ++i) {
+        if (plan.stageLevels[i] < mStages[i].targetLevel) {
+            mStages[i].targetLevel = plan.stageLevels[i];
+            lowered = true;
+        }
+    }
+    if (lowered) {
+        mStableFrames = 0;
+    } else {
+        upgradeLocked(plan.budgetUs, cost);
+    }
+    return plan;
+}
+
+void FrameScheduler::ReportCpuTime(uint32_t stage, uint32_t level, float us) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (stage < mStages.size()) {
+        mStages[stage].cpu.update(level, us, mOptions.costSmoothing);
+    }
+}
+
+void FrameScheduler::ReportGpuTime(uint32_t stage, uint32_t level, float us) {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (stage < mStages.size()) {
+        mStages[stage].gpu.update(level, us, mOptions.costSmoothing);
+    }
+}
+
+void FrameScheduler::CompleteFrame(const FramePlan& plan, int64_t finishUs) {
+    if (plan.drop) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    const int64_t lateness = finishUs - plan.deadlineUs;
+    mStats.completedFrames++;
+    mStats.lastLatenessUs = lateness;
+    mStats.maxLatenessUs = mStats.completedFrames == 1 ? lateness : std::max(mStats.maxLatenessUs, lateness);
+    if (lateness > 0) {
+        // 错过截止时间说明估计偏低，推迟下一次升级
+        mStats.missedDeadlines++;
+        mStableFrames = 0;
+    }
+}
+
+float FrameScheduler::GetEstimatedCostUs(uint32_t stage, uint32_t level) const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return stage < mStages.size() ? estimateLocked(stage, level) : 0.0f;
+}
+
+uint32_t FrameScheduler::GetTargetLevel(uint32_t stage) const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return stage < mStages.size() ? mStages[stage].targetLevel : 0;
+}
+
+FrameSchedulerStats FrameScheduler::GetStats() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+void FrameScheduler::ResetStats() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStats = FrameSchedulerStats();
+}
+
+float FrameScheduler::estimateLocked(uint32_t stage, uint32_t level) const {
+    const Stage& s = mStages[stage];
+    return s.cpu.estimate(level) + s.gpu.estimate(level);
+}
+
+void FrameScheduler::upgradeLocked(int64_t budgetUs, float cost) {
+    const float limit = static_cast<float>(budgetUs) * (1.0f - mOptions.upgradeHeadroom);
+    if (cost > limit) {
+        mStableFrames = 0;
+        return;
+    }
+    if (++mStableFrames < mOptions.upgradeStableFrames) {
+        return;
+    }
+
+    // 从高优先级阶段开始，升一级后仍留有余量才升级
+    for (auto it = mDegradeOrder.rbegin(); it != mDegradeOrder.rend(); ++it) {
+        Stage& stage = mStages[*it];
+        if (stage.targetLevel >= stage.levelCount) {
+            continue;
+        }
+        const float delta = estimateLocked(*it, stage.targetLevel + 1) - estimateLocked(*it, stage.targetLevel);
+        if (cost + delta <= limit) {
+            stage.targetLevel++;
+            break;
+        }
+    }
+    mStableFrames = 0;
+}
+
+} // namespace utils
+} // namespace lrengine
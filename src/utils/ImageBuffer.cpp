@@ -1,4 +1,5 @@
 #include <lrengine/utils/ImageBuffer.h>
+#include "ImageLayout.h"
 #include <cstring>
 #include <algorithm>
 
@@ -17,54 +18,6 @@ namespace utils {
 // HostMemoryBuffer 实现
 // =============================================================================
 
-namespace {
-    // 计算指定格式单个平面所需的内存大小
-    size_t CalculatePlaneSize(ImageFormat format, uint32_t width, uint32_t height, int planeIndex) {
-        switch (format) {
-            case ImageFormat::YUV420P:
-                if (planeIndex == 0) {
-                    return width * height; // Y 平面
-                } else {
-                    return (width / 2) * (height / 2); // U/V 平面
-                }
-            case ImageFormat::NV12:
-            case ImageFormat::NV21:
-                if (planeIndex == 0) {
-                    return width * height; // Y 平面
-                } else {
-                    return width * (height / 2); // UV 交织平面
-                }
-            case ImageFormat::RGBA8:
-            case ImageFormat::BGRA8:
-                return width * height * 4;
-            case ImageFormat::RGB8:
-                return width * height * 3;
-            case ImageFormat::GRAY8:
-                return width * height;
-            default:
-                return 0;
-        }
-    }
-
-    // 获取指定格式的平面数量
-    int GetPlaneCount(ImageFormat format) {
-        switch (format) {
-            case ImageFormat::YUV420P:
-                return 3; // Y, U, V
-            case ImageFormat::NV12:
-            case ImageFormat::NV21:
-                return 2; // Y, UV
-            case ImageFormat::RGBA8:
-            case ImageFormat::BGRA8:
-            case ImageFormat::RGB8:
-            case ImageFormat::GRAY8:
-                return 1;
-            default:
-                return 0;
-        }
-    }
-}
-
 HostMemoryBuffer::HostMemoryBuffer(const ImageDataDesc& imageDesc, bool allocate)
     : mImageDesc(imageDesc) {
     if (allocate) {
@@ -72,21 +25,45 @@ HostMemoryBuffer::HostMemoryBuffer(const ImageDataDesc& imageDesc, bool allocate
     }
 }
 
+HostMemoryBuffer::HostMemoryBuffer(const ImageDataDesc& imageDesc, ReleaseCallback releaseCallback)
+    : mImageDesc(imageDesc), mReleaseCallback(std::move(releaseCallback)), mExternal(true) {
+    // 未指定 stride 的平面按紧密排列补全，便于下游统一按 stride 访问
+    ImagePlaneLayout layout;
+    if (GetImagePlaneLayout(mImageDesc.format, layout)) {
+        const int count = std::min(layout.count, static_cast<int>(mImageDesc.planes.size()));
+        for (int i = 0; i < count; ++i) {
+            auto& plane = mImageDesc.planes[i];
+            if (plane.stride == 0) {
+                plane.stride = static_cast<uint32_t>(GetPlaneStride(mImageDesc, layout, i));
+            }
+        }
+    }
+}
+
 HostMemoryBuffer::~HostMemoryBuffer() {
     FreeMemory();
 }
 
+void* HostMemoryBuffer::GetNativeBuffer() const {
+    if (mExternal) {
+        return mImageDesc.planes.empty() ? nullptr : const_cast<void*>(mImageDesc.planes[0].data);
+    }
+    return mData.get();
+}
+
 void HostMemoryBuffer::AllocateMemory() {
     FreeMemory();
 
-    int planeCount = GetPlaneCount(mImageDesc.format);
-    if (planeCount == 0) {
+    ImagePlaneLayout layout;
+    if (!GetImagePlaneLayout(mImageDesc.format, layout)) {
         return;
     }
+    const int planeCount = layout.count;
 
     // 计算总内存大小和各平面偏移
     size_t totalSize = 0;
     mPlaneOffsets.resize(planeCount);
+    std::vector<uint32_t> strides(planeCount);
 
     for (int i = 0; i < planeCount; ++i) {
         mPlaneOffsets[i] = totalSize;
@@ -94,37 +71,18 @@ void HostMemoryBuffer::AllocateMemory() {
         if (i < static_cast<int>(mImageDesc.planes.size())) {
             stride = mImageDesc.planes[i].stride;
         }
-        
+
+        const uint32_t shift = GetPlaneShift(layout, i);
+        const uint32_t width = mImageDesc.width >> shift;
+        const uint32_t height = mImageDesc.height >> shift;
+
         // 如果没有指定 stride，计算默认值
         if (stride == 0) {
-            uint32_t width = mImageDesc.width;
-            if (i > 0 && (mImageDesc.format == ImageFormat::YUV420P ||
-                         mImageDesc.format == ImageFormat::NV12 ||
-                         mImageDesc.format == ImageFormat::NV21)) {
-                width = mImageDesc.width / 2;
-            }
-            switch (mImageDesc.format) {
-                case ImageFormat::RGBA8:
-                case ImageFormat::BGRA8:
-                    stride = width * 4;
-                    break;
-                case ImageFormat::RGB8:
-                    stride = width * 3;
-                    break;
-                default:
-                    stride = width;
-                    break;
-            }
+            stride = width * layout.bytesPerPixel[i];
         }
+        strides[i] = stride;
 
-        uint32_t height = mImageDesc.height;
-        if (i > 0 && (mImageDesc.format == ImageFormat::YUV420P ||
-                     mImageDesc.format == ImageFormat::NV12 ||
-                     mImageDesc.format == ImageFormat::NV21)) {
-            height = mImageDesc.height / 2;
-        }
-
-        totalSize += stride * height;
+        totalSize += static_cast<size_t>(stride) * height;
     }
 
     // 分配内存
@@ -135,7 +93,7 @@ void HostMemoryBuffer::AllocateMemory() {
     mImageDesc.planes.resize(planeCount);
     for (int i = 0; i < planeCount; ++i) {
         mImageDesc.planes[i].data = mData.get() + mPlaneOffsets[i];
-        // stride 已在上面计算过，这里需要重新设置
+        mImageDesc.planes[i].stride = strides[i];
     }
 }
 
@@ -143,6 +101,13 @@ void HostMemoryBuffer::FreeMemory() {
     mData.reset();
     mPlaneOffsets.clear();
     mImageDesc.planes.clear();
+
+    // 外部内存交还给来源（只调用一次）
+    if (mReleaseCallback) {
+        ReleaseCallback callback = std::move(mReleaseCallback);
+        mReleaseCallback = nullptr;
+        callback();
+    }
 }
 
 bool HostMemoryBuffer::Lock(bool readOnly) {
@@ -156,12 +121,84 @@ void HostMemoryBuffer::Unlock() {
 }
 
 void* HostMemoryBuffer::GetPlaneData(int planeIndex) const {
+    if (mExternal) {
+        if (planeIndex < 0 || planeIndex >= static_cast<int>(mImageDesc.planes.size())) {
+            return nullptr;
+        }
+        return const_cast<void*>(mImageDesc.planes[planeIndex].data);
+    }
     if (planeIndex < 0 || planeIndex >= static_cast<int>(mPlaneOffsets.size())) {
         return nullptr;
     }
     return mData.get() + mPlaneOffsets[planeIndex];
 }
 
+// =============================================================================
+// SharedImageView 实现
+// =============================================================================
+
+std::shared_ptr<SharedImageView> SharedImageView::Create(std::shared_ptr<ImageBuffer> source, uint32_t x,
+                                                         uint32_t y, uint32_t width, uint32_t height) {
+    if (!source) {
+        return nullptr;
+    }
+
+    const ImageDataDesc& sourceDesc = source->GetImageDesc();
+    if (x >= sourceDesc.width || y >= sourceDesc.height) {
+        return nullptr;
+    }
+    if (width == 0) {
+        width = sourceDesc.width - x;
+    }
+    if (height == 0) {
+        height = sourceDesc.height - y;
+    }
+    if (width > sourceDesc.width - x || height > sourceDesc.height - y) {
+        return nullptr;
+    }
+
+    ImagePlaneLayout layout;
+    if (!GetImagePlaneLayout(sourceDesc.format, layout) ||
+        static_cast<int>(sourceDesc.planes.size()) < layout.count) {
+        return nullptr;
+    }
+    const int planeCount = layout.count;
+    const bool subsampled = layout.chromaSubsampled;
+    // 4:2:0 的色度样本覆盖 2×2 像素，裁剪起点须对齐到色度样本
+    if (subsampled && ((x | y) & 1u) != 0) {
+        return nullptr;
+    }
+
+    ImageDataDesc desc = sourceDesc;
+    desc.width = width;
+    desc.height = height;
+    desc.planes.resize(planeCount);
+    for (int i = 0; i < planeCount; ++i) {
+        const auto& plane = sourceDesc.planes[i];
+        if (!plane.data) {
+            return nullptr;
+        }
+
+        uint32_t planeX = x;
+        uint32_t planeY = y;
+        uint32_t planeWidth = sourceDesc.width;
+        if (i > 0 && subsampled) {
+            planeX /= 2;
+            planeY /= 2;
+            planeWidth /= 2;
+        }
+
+        const uint32_t bytesPerPixel = layout.bytesPerPixel[i];
+        const uint32_t stride = plane.stride != 0 ? plane.stride : planeWidth * bytesPerPixel;
+        desc.planes[i].data = static_cast<const uint8_t*>(plane.data)
+                              + static_cast<size_t>(planeY) * stride
+                              + static_cast<size_t>(planeX) * bytesPerPixel;
+        desc.planes[i].stride = stride;
+    }
+
+    return std::shared_ptr<SharedImageView>(new SharedImageView(std::move(source), desc));
+}
+
 // =============================================================================
 // CVPixelBufferWrapper 实现 (iOS/macOS)
 // =============================================================================
@@ -210,6 +247,18 @@ void CVPixelBufferWrapper::ExtractImageDesc() {
             mImageDesc.range = (pixelFormat == kCVPixelFormatType_420YpCbCr8BiPlanarFullRange)
                                    ? ColorRange::Full : ColorRange::Video;
             break;
+        case kCVPixelFormatType_420YpCbCr10BiPlanarVideoRange:
+        case kCVPixelFormatType_420YpCbCr10BiPlanarFullRange:
+            mImageDesc.format = ImageFormat::P010;
+            mImageDesc.colorSpace = ColorSpace::BT2020;
+            mImageDesc.range = (pixelFormat == kCVPixelFormatType_420YpCbCr10BiPlanarFullRange)
+                                   ? ColorRange::Full : ColorRange::Video;
+            break;
+        case kCVPixelFormatType_64RGBAHalf:
+            mImageDesc.format = ImageFormat::RGBA16F;
+            mImageDesc.colorSpace = ColorSpace::BT2020;
+            mImageDesc.range = ColorRange::Full;
+            break;
         case kCVPixelFormatType_32BGRA:
             mImageDesc.format = ImageFormat::BGRA8;
             mImageDesc.colorSpace = ColorSpace::BT709;
@@ -242,6 +291,14 @@ void CVPixelBufferWrapper::CreatePixelBuffer() {
                          ? kCVPixelFormatType_420YpCbCr8BiPlanarFullRange
                          : kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange;
             break;
+        case ImageFormat::P010:
+            pixelFormat = (mImageDesc.range == ColorRange::Full)
+                         ? kCVPixelFormatType_420YpCbCr10BiPlanarFullRange
+                         : kCVPixelFormatType_420YpCbCr10BiPlanarVideoRange;
+            break;
+        case ImageFormat::RGBA16F:
+            pixelFormat = kCVPixelFormatType_64RGBAHalf;
+            break;
         case ImageFormat::BGRA8:
             pixelFormat = kCVPixelFormatType_32BGRA;
             break;
@@ -372,6 +429,16 @@ void HardwareBufferWrapper::ExtractImageDesc() {
             mImageDesc.colorSpace = ColorSpace::BT709;
             mImageDesc.range = ColorRange::Video;
             break;
+        case AHARDWAREBUFFER_FORMAT_R10G10B10A2_UNORM:
+            mImageDesc.format = ImageFormat::RGB10A2;
+            mImageDesc.colorSpace = ColorSpace::BT2020;
+            mImageDesc.range = ColorRange::Full;
+            break;
+        case AHARDWAREBUFFER_FORMAT_R16G16B16A16_FLOAT:
+            mImageDesc.format = ImageFormat::RGBA16F;
+            mImageDesc.colorSpace = ColorSpace::BT2020;
+            mImageDesc.range = ColorRange::Full;
+            break;
         default:
             mImageDesc.format = ImageFormat::Unknown;
             break;
@@ -388,6 +455,12 @@ void HardwareBufferWrapper::CreateHardwareBuffer() {
         case ImageFormat::YUV420P:
             format = AHARDWAREBUFFER_FORMAT_Y8Cb8Cr8_420;
             break;
+        case ImageFormat::RGB10A2:
+            format = AHARDWAREBUFFER_FORMAT_R10G10B10A2_UNORM;
+            break;
+        case ImageFormat::RGBA16F:
+            format = AHARDWAREBUFFER_FORMAT_R16G16B16A16_FLOAT;
+            break;
         default:
             // 不支持的格式
             return;
@@ -28,25 +28,8 @@ ImageBufferPool::~ImageBufferPool() {
 ImageBufferPool::ImageBufferPtr ImageBufferPool::Acquire(const ImageDataDesc& imageDesc) {
     std::lock_guard<std::mutex> lock(mMutex);
 
-    // 查找可用的兼容缓冲区
-    ImageBuffer* buffer = FindAvailableBuffer(imageDesc);
-
-    // 如果没有找到，尝试创建新缓冲区
-    if (!buffer && (mOptions.autoGrow || mBuffers.size() < mOptions.maxPoolSize)) {
-        buffer = CreateNewBuffer(imageDesc);
-    }
-
+    ImageBuffer* buffer = AcquireLocked(imageDesc, false);
     if (buffer) {
-        // 标记为使用中
-        for (auto& entry : mBuffers) {
-            if (entry.buffer.get() == buffer) {
-                entry.inUse = true;
-                entry.lastUsedTime = GetCurrentTimeMs();
-                mInUseCount++;
-                break;
-            }
-        }
-
         // 返回带自定义删除器的智能指针
         return ImageBufferPtr(buffer, BufferDeleter(this));
     }
@@ -54,6 +37,34 @@ ImageBufferPool::ImageBufferPtr ImageBufferPool::Acquire(const ImageDataDesc& im
     return nullptr;
 }
 
+ImageBufferPool::ImageBufferPtr ImageBufferPool::AcquireWait(const ImageDataDesc& imageDesc, uint64_t timeoutMs) {
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    ImageBuffer* buffer = AcquireLocked(imageDesc, true);
+    while (!buffer && mBufferReleased.wait_until(lock, deadline) != std::cv_status::timeout) {
+        buffer = AcquireLocked(imageDesc, true);
+    }
+
+    return buffer ? ImageBufferPtr(buffer, BufferDeleter(this)) : nullptr;
+}
+
+ImageBufferPool::ImageBufferPtr ImageBufferPool::WrapExternal(const ImageDataDesc& imageDesc,
+                                                             HostMemoryBuffer::ReleaseCallback onReturn) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExternalInUseCount++;
+    }
+    return ImageBufferPtr(new HostMemoryBuffer(imageDesc, std::move(onReturn)), ExternalDeleter(this));
+}
+
+void ImageBufferPool::ReleaseExternal() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mExternalInUseCount > 0) {
+        mExternalInUseCount--;
+    }
+}
+
 void ImageBufferPool::Release(ImageBuffer* buffer) {
     if (!buffer) {
         return;
@@ -82,6 +93,8 @@ void ImageBufferPool::Release(ImageBuffer* buffer) {
     if (mBuffers.size() > mOptions.maxPoolSize) {
         TrimExcessBuffers();
     }
+
+    mBufferReleased.notify_all();
 }
 
 void ImageBufferPool::Clear() {
@@ -116,7 +129,12 @@ size_t ImageBufferPool::GetAvailableCount() const {
 
 size_t ImageBufferPool::GetInUseCount() const {
     std::lock_guard<std::mutex> lock(mMutex);
-    return mInUseCount;
+    return mInUseCount + mExternalInUseCount;
+}
+
+size_t ImageBufferPool::GetExternalInUseCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mExternalInUseCount;
 }
 
 size_t ImageBufferPool::GetCapacity() const {
@@ -144,10 +162,72 @@ void ImageBufferPool::Preallocate(const ImageDataDesc& imageDesc, size_t count)
     }
 }
 
+size_t ImageBufferPool::Trim(render::MemoryTrimLevel level) {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const uint64_t now = GetCurrentTimeMs();
+    size_t released = 0;
+
+    auto it = mBuffers.begin();
+    while (it != mBuffers.end()) {
+        bool idle = !it->inUse;
+        bool expired = now - it->lastUsedTime >= mOptions.idleTimeoutMs;
+        if (idle && (level != render::MemoryTrimLevel::Low || expired)) {
+            it = mBuffers.erase(it);
+            ++released;
+        } else {
+            ++it;
+        }
+    }
+
+    if (level == render::MemoryTrimLevel::Complete) {
+        // 连同预留的条目存储一起释放
+        mBuffers.shrink_to_fit();
+    }
+    return released;
+}
+
 // =============================================================================
 // 私有辅助方法
 // =============================================================================
 
+ImageBuffer* ImageBufferPool::AcquireLocked(const ImageDataDesc& desc, bool evictIncompatible) {
+    // 查找可用的兼容缓冲区
+    ImageBuffer* buffer = FindAvailableBuffer(desc);
+
+    // 池已满时淘汰最久未用的不兼容空闲缓冲区，为新尺寸/格式腾出位置
+    if (!buffer && evictIncompatible && mBuffers.size() >= mOptions.maxPoolSize) {
+        auto victim = mBuffers.end();
+        for (auto it = mBuffers.begin(); it != mBuffers.end(); ++it) {
+            if (!it->inUse && (victim == mBuffers.end() || it->lastUsedTime < victim->lastUsedTime)) {
+                victim = it;
+            }
+        }
+        if (victim != mBuffers.end()) {
+            mBuffers.erase(victim);
+        }
+    }
+
+    // 如果没有找到，尝试创建新缓冲区
+    if (!buffer && (mOptions.autoGrow || mBuffers.size() < mOptions.maxPoolSize)) {
+        buffer = CreateNewBuffer(desc);
+    }
+
+    if (buffer) {
+        // 标记为使用中
+        for (auto& entry : mBuffers) {
+            if (entry.buffer.get() == buffer) {
+                entry.inUse = true;
+                entry.lastUsedTime = GetCurrentTimeMs();
+                mInUseCount++;
+                break;
+            }
+        }
+    }
+
+    return buffer;
+}
+
 bool ImageBufferPool::IsCompatible(const ImageBuffer* buffer, const ImageDataDesc& desc) const {
     if (!buffer) {
         return false;
@@ -0,0 +1,503 @@
+/**
+ * @file ImageComposite.cpp
+ * @brief CPU 图像合成实现
+ */
+
+#include "lrengine/utils/ImageComposite.h"
+#include "lrengine/utils/ParallelFor.h"
+#include "ImageLayout.h"
+#include "SimdConfig.h"
+#include "YUVMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+// x / 255 的精确舍入（x ≤ 255 × 255）
+inline uint32_t Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+#if defined(LR_SIMD_SSE2)
+inline __m128i Div255SSE2(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// 每像素的 alpha 广播到 4 个 16 位通道
+inline __m128i BroadcastAlphaSSE2(__m128i p) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(p, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+inline __m128i SwapRBSSE2(__m128i p) {
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(p, _MM_SHUFFLE(3, 0, 1, 2)), _MM_SHUFFLE(3, 0, 1, 2));
+}
+#elif defined(LR_SIMD_NEON)
+inline uint8x8_t Div255NEON(uint16x8_t x) { return vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8); }
+#endif
+
+/**
+ * @brief 叠加图一行 → 预乘并乘以不透明度的 RGBA
+ * @param opacity 不透明度 [0, 255]
+ * @param premultiplied 源已预乘
+ * @param swapRB 交换 R/B（叠加图与目标通道顺序不同）
+ */
+void PrepareRow(const uint8_t* src, uint8_t* dst, uint32_t count, uint32_t opacity, bool premultiplied,
+                bool swapRB) {
+    uint32_t x = 0;
+
+#if defined(LR_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i o = _mm_set1_epi16(static_cast<int16_t>(opacity));
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    auto prepare = [&](__m128i v) {
+        if (swapRB) {
+            v = SwapRBSSE2(v);
+        }
+        if (premultiplied) {
+            return Div255SSE2(_mm_mullo_epi16(v, o));
+        }
+        const __m128i alpha = Div255SSE2(_mm_mullo_epi16(BroadcastAlphaSSE2(v), o));
+        const __m128i color = Div255SSE2(_mm_mullo_epi16(v, alpha));
+        return _mm_or_si128(_mm_andnot_si128(alphaMask, color), _mm_and_si128(alphaMask, alpha));
+    };
+    for (; x + 4 <= count; x += 4) {
+        const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+        const __m128i lo = prepare(_mm_unpacklo_epi8(p, zero));
+        const __m128i hi = prepare(_mm_unpackhi_epi8(p, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(LR_SIMD_NEON)
+    const uint8x8_t o = vdup_n_u8(static_cast<uint8_t>(opacity));
+    for (; x + 8 <= count; x += 8) {
+        uint8x8x4_t p = vld4_u8(src + x * 4);
+        if (swapRB) {
+            const uint8x8_t r = p.val[0];
+            p.val[0] = p.val[2];
+            p.val[2] = r;
+        }
+        if (premultiplied) {
+            for (int c = 0; c < 4; ++c) {
+                p.val[c] = Div255NEON(vmull_u8(p.val[c], o));
+            }
+        } else {
+            const uint8x8_t alpha = Div255NEON(vmull_u8(p.val[3], o));
+            for (int c = 0; c < 3; ++c) {
+                p.val[c] = Div255NEON(vmull_u8(p.val[c], alpha));
+            }
+            p.val[3] = alpha;
+        }
+        vst4_u8(dst + x * 4, p);
+    }
+#endif
+
+    const int ri = swapRB ? 2 : 0;
+    const int bi = swapRB ? 0 : 2;
+    for (; x < count; ++x) {
+        const uint8_t* s = src + x * 4;
+        uint8_t* d = dst + x * 4;
+        const uint32_t r = s[ri];
+        const uint32_t g = s[1];
+        const uint32_t b = s[bi];
+        if (premultiplied) {
+            d[0] = static_cast<uint8_t>(Div255(r * opacity));
+            d[1] = static_cast<uint8_t>(Div255(g * opacity));
+            d[2] = static_cast<uint8_t>(Div255(b * opacity));
+            d[3] = static_cast<uint8_t>(Div255(s[3] * opacity));
+        } else {
+            const uint32_t alpha = Div255(s[3] * opacity);
+            d[0] = static_cast<uint8_t>(Div255(r * alpha));
+            d[1] = static_cast<uint8_t>(Div255(g * alpha));
+            d[2] = static_cast<uint8_t>(Div255(b * alpha));
+            d[3] = static_cast<uint8_t>(alpha);
+        }
+    }
+}
+
+/**
+ * @brief 单个通道的混合（s、d 为预乘值，sa、da 为各自 alpha）
+ */
+template <CompositeBlendMode Mode>
+inline uint8_t BlendChannel(uint32_t s, uint32_t d, uint32_t sa, uint32_t da) {
+    uint32_t value;
+    if constexpr (Mode == CompositeBlendMode::SourceOver) {
+        value = s + Div255(d * (255 - sa));
+    } else if constexpr (Mode == CompositeBlendMode::Add) {
+        value = s + d;
+    } else if constexpr (Mode == CompositeBlendMode::Multiply) {
+        value = Div255(s * d) + Div255(s * (255 - da)) + Div255(d * (255 - sa));
+    } else {
+        value = s + d - Div255(s * d);
+    }
+    return static_cast<uint8_t>(std::min(value, 255u));
+}
+
+template <CompositeBlendMode Mode>
+inline void BlendPixel(const uint8_t* s, uint8_t* d) {
+    const uint32_t sa = s[3];
+    const uint32_t da = d[3];
+    for (int c = 0; c < 4; ++c) {
+        d[c] = BlendChannel<Mode>(s[c], d[c], sa, da);
+    }
+}
+
+/**
+ * @brief 预乘的叠加行混合到目标行（通道顺序相同）
+ */
+template <CompositeBlendMode Mode>
+void BlendRow(const uint8_t* src, uint8_t* dst, uint32_t count) {
+    uint32_t x = 0;
+
+#if defined(LR_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i full = _mm_set1_epi16(255);
+    auto blend = [&](__m128i s, __m128i d) {
+        if constexpr (Mode == CompositeBlendMode::SourceOver) {
+            return _mm_add_epi16(s, Div255SSE2(_mm_mullo_epi16(d, _mm_sub_epi16(full, BroadcastAlphaSSE2(s)))));
+        } else if constexpr (Mode == CompositeBlendMode::Multiply) {
+            const __m128i sd = Div255SSE2(_mm_mullo_epi16(s, d));
+            const __m128i s1 = Div255SSE2(_mm_mullo_epi16(s, _mm_sub_epi16(full, BroadcastAlphaSSE2(d))));
+            const __m128i d1 = Div255SSE2(_mm_mullo_epi16(d, _mm_sub_epi16(full, BroadcastAlphaSSE2(s))));
+            return _mm_add_epi16(_mm_add_epi16(sd, s1), d1);
+        } else {
+            return _mm_sub_epi16(_mm_add_epi16(s, d), Div255SSE2(_mm_mullo_epi16(s, d)));
+        }
+    };
+    for (; x + 4 <= count; x += 4) {
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x * 4));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + x * 4));
+        __m128i result;
+        if constexpr (Mode == CompositeBlendMode::Add) {
+            result = _mm_adds_epu8(s, d);
+        } else {
+            const __m128i lo = blend(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+            const __m128i hi = blend(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+            result = _mm_packus_epi16(lo, hi);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), result);
+    }
+#elif defined(LR_SIMD_NEON)
+    for (; x + 8 <= count; x += 8) {
+        const uint8x8x4_t s = vld4_u8(src + x * 4);
+        uint8x8x4_t d = vld4_u8(dst + x * 4);
+        const uint8x8_t sa = s.val[3];
+        const uint8x8_t da = d.val[3];
+        for (int c = 0; c < 4; ++c) {
+            const uint8x8_t sc = s.val[c];
+            const uint8x8_t dc = d.val[c];
+            if constexpr (Mode == CompositeBlendMode::SourceOver) {
+                d.val[c] = vqadd_u8(sc, Div255NEON(vmull_u8(dc, vmvn_u8(sa))));
+            } else if constexpr (Mode == CompositeBlendMode::Add) {
+                d.val[c] = vqadd_u8(sc, dc);
+            } else if constexpr (Mode == CompositeBlendMode::Multiply) {
+                const uint16x8_t sum = vaddl_u8(Div255NEON(vmull_u8(sc, dc)), Div255NEON(vmull_u8(sc, vmvn_u8(da))));
+                d.val[c] = vqmovn_u16(vaddw_u8(sum, Div255NEON(vmull_u8(dc, vmvn_u8(sa)))));
+            } else {
+                const uint16x8_t sum = vaddl_u8(sc, dc);
+                d.val[c] = vqmovn_u16(vsubw_u8(sum, Div255NEON(vmull_u8(sc, dc))));
+            }
+        }
+        vst4_u8(dst + x * 4, d);
+    }
+#endif
+
+    for (; x < count; ++x) {
+        BlendPixel<Mode>(src + x * 4, dst + x * 4);
+    }
+}
+
+using BlendRowFunc = void (*)(const uint8_t*, uint8_t*, uint32_t);
+using BlendPixelFunc = void (*)(const uint8_t*, uint8_t*);
+
+BlendRowFunc GetBlendRow(CompositeBlendMode mode) {
+    switch (mode) {
+        case CompositeBlendMode::Add: return &BlendRow<CompositeBlendMode::Add>;
+        case CompositeBlendMode::Multiply: return &BlendRow<CompositeBlendMode::Multiply>;
+        case CompositeBlendMode::Screen: return &BlendRow<CompositeBlendMode::Screen>;
+        default: return &BlendRow<CompositeBlendMode::SourceOver>;
+    }
+}
+
+BlendPixelFunc GetBlendPixel(CompositeBlendMode mode) {
+    switch (mode) {
+        case CompositeBlendMode::Add: return &BlendPixel<CompositeBlendMode::Add>;
+        case CompositeBlendMode::Multiply: return &BlendPixel<CompositeBlendMode::Multiply>;
+        case CompositeBlendMode::Screen: return &BlendPixel<CompositeBlendMode::Screen>;
+        default: return &BlendPixel<CompositeBlendMode::SourceOver>;
+    }
+}
+
+/**
+ * @brief 反预乘一行：c × 255 / a 精确舍入（倒数表代替除法）
+ */
+void UnpremultiplyRow(uint8_t* pixels, uint32_t count) {
+    // ceil(2^24 / a)：分子不超过 65152，乘法误差小于 1/a，结果与整数除法一致
+    static const std::vector<uint32_t> s_reciprocal = [] {
+        std::vector<uint32_t> table(256, 0);
+        for (uint32_t a = 1; a < 256; ++a) {
+            table[a] = ((1u << 24) + a - 1) / a;
+        }
+        return table;
+    }();
+
+    for (uint32_t x = 0; x < count; ++x, pixels += 4) {
+        const uint32_t alpha = pixels[3];
+        if (alpha == 255) {
+            continue;
+        }
+        if (alpha == 0) {
+            pixels[0] = pixels[1] = pixels[2] = 0;
+            continue;
+        }
+        const uint64_t reciprocal = s_reciprocal[alpha];
+        for (int c = 0; c < 3; ++c) {
+            const uint64_t value = ((pixels[c] * 255u + alpha / 2) * reciprocal) >> 24;
+            pixels[c] = static_cast<uint8_t>(std::min<uint64_t>(value, 255));
+        }
+    }
+}
+
+inline bool IsRGBA(ImageFormat format) { return format == ImageFormat::RGBA8 || format == ImageFormat::BGRA8; }
+
+inline size_t RowStride(const ImageDataDesc& image) {
+    return image.planes[0].stride ? image.planes[0].stride : static_cast<size_t>(image.width) * 4;
+}
+
+/**
+ * @brief 就地处理 RGBA 图像的每一行
+ */
+template <typename Fn>
+bool ForEachRGBARow(const ImageDataDesc& image, Fn fn) {
+    if (!IsRGBA(image.format) || image.planes.empty() || !image.planes[0].data) {
+        return false;
+    }
+    uint8_t* base = static_cast<uint8_t*>(const_cast<void*>(image.planes[0].data));
+    const size_t stride = RowStride(image);
+    const uint32_t width = image.width;
+    ParallelFor(image.height, [&](uint32_t y) { fn(base + stride * y, width); });
+    return true;
+}
+
+/**
+ * @brief 叠加区域（目标坐标）
+ */
+struct CompositeRegion {
+    uint32_t x0, y0, x1, y1;    ///< 目标中的 [x0, x1) × [y0, y1)
+    uint32_t overlayX;          ///< x0 对应的叠加图列
+    uint32_t overlayY;          ///< y0 对应的叠加图行
+};
+
+bool ComputeRegion(const ImageDataDesc& overlay, const ImageDataDesc& target, int32_t x, int32_t y,
+                   CompositeRegion& out) {
+    const int64_t left = std::max<int64_t>(x, 0);
+    const int64_t top = std::max<int64_t>(y, 0);
+    const int64_t right = std::min<int64_t>(static_cast<int64_t>(x) + overlay.width, target.width);
+    const int64_t bottom = std::min<int64_t>(static_cast<int64_t>(y) + overlay.height, target.height);
+    if (left >= right || top >= bottom) {
+        return false;
+    }
+    out.x0 = static_cast<uint32_t>(left);
+    out.y0 = static_cast<uint32_t>(top);
+    out.x1 = static_cast<uint32_t>(right);
+    out.y1 = static_cast<uint32_t>(bottom);
+    out.overlayX = static_cast<uint32_t>(left - x);
+    out.overlayY = static_cast<uint32_t>(top - y);
+    return true;
+}
+
+void CompositeRGBA(const ImageDataDesc& overlay, const ImageDataDesc& target, const CompositeRegion& region,
+                   uint32_t opacity, const CompositeOptions& options) {
+    const BlendRowFunc blend = GetBlendRow(options.mode);
+    const bool swapRB = overlay.format != target.format;
+    const uint32_t width = region.x1 - region.x0;
+    const size_t overlayStride = RowStride(overlay);
+    const size_t targetStride = RowStride(target);
+    const uint8_t* overlayBase = static_cast<const uint8_t*>(overlay.planes[0].data) +
+                                 overlayStride * region.overlayY + static_cast<size_t>(region.overlayX) * 4;
+    uint8_t* targetBase = static_cast<uint8_t*>(const_cast<void*>(target.planes[0].data)) +
+                          targetStride * region.y0 + static_cast<size_t>(region.x0) * 4;
+
+    ParallelFor(
+        region.y1 - region.y0,
+        [&](uint32_t row) {
+            thread_local std::vector<uint8_t> prepared;
+            prepared.resize(static_cast<size_t>(width) * 4);
+            PrepareRow(overlayBase + overlayStride * row, prepared.data(), width, opacity, options.premultiplied,
+                       swapRB);
+            blend(prepared.data(), targetBase + targetStride * row, width);
+        },
+        options.maxThreads);
+}
+
+/**
+ * @brief 合成到 YUV 4:2:0 目标
+ *
+ * 每个色度块内：未覆盖或 alpha 为 0 的像素保持原 Y；其余像素解码为 RGB 后混合，
+ * 写回 Y，并以块内 4 个像素混合结果的平均值重新计算色度。
+ */
+void CompositeYUV(const ImageDataDesc& overlay, const ImageDataDesc& target, const ImagePlaneLayout& layout,
+                  const CompositeRegion& region, uint32_t opacity, const CompositeOptions& options) {
+    const BlendPixelFunc blend = GetBlendPixel(options.mode);
+    const YUVToRGBMatrix toRGB = MakeYUVToRGBMatrix(target.colorSpace, target.range);
+    const RGBToYUVMatrix toYUV = MakeRGBToYUVMatrix(target.colorSpace, target.range);
+    const bool swapRB = overlay.format == ImageFormat::BGRA8;
+    const bool planar = target.format == ImageFormat::YUV420P;
+    const int uIndex = target.format == ImageFormat::NV21 ? 1 : 0;
+
+    const uint32_t width = region.x1 - region.x0;
+    const size_t overlayStride = RowStride(overlay);
+    const uint8_t* overlayBase = static_cast<const uint8_t*>(overlay.planes[0].data);
+    uint8_t* lumaBase = static_cast<uint8_t*>(const_cast<void*>(target.planes[0].data));
+    uint8_t* uBase = static_cast<uint8_t*>(const_cast<void*>(target.planes[1].data));
+    uint8_t* vBase = planar ? static_cast<uint8_t*>(const_cast<void*>(target.planes[2].data)) : uBase;
+    const size_t lumaStride = GetPlaneStride(target, layout, 0);
+    const size_t uStride = GetPlaneStride(target, layout, 1);
+    const size_t vStride = planar ? GetPlaneStride(target, layout, 2) : uStride;
+    const uint32_t chromaStep = planar ? 1 : 2;
+    const uint32_t uOffset = planar ? 0 : uIndex;
+    const uint32_t vOffset = planar ? 0 : 1 - uIndex;
+
+    // 色度平面按向下取整的尺寸存储：奇数宽/高时最后一列/行色度块额外覆盖边缘的一列/行亮度
+    const uint32_t chromaWidth = target.width >> 1;
+    const uint32_t chromaHeight = target.height >> 1;
+    if (chromaWidth == 0 || chromaHeight == 0) {
+        return;
+    }
+    const uint32_t cx0 = std::min(region.x0 >> 1, chromaWidth - 1);
+    const uint32_t cx1 = std::min((region.x1 + 1) >> 1, chromaWidth);
+    const uint32_t cy0 = std::min(region.y0 >> 1, chromaHeight - 1);
+    const uint32_t cy1 = std::min((region.y1 + 1) >> 1, chromaHeight);
+
+    ParallelFor(
+        cy1 - cy0,
+        [&](uint32_t index) {
+            const uint32_t cy = cy0 + index;
+            const uint32_t yBegin = cy * 2;
+            const uint32_t yEnd = cy == chromaHeight - 1 ? target.height : yBegin + 2;
+
+            // 本色度行覆盖的（最多）三行叠加图，预乘后按目标坐标对齐
+            thread_local std::vector<uint8_t> prepared;
+            prepared.resize(static_cast<size_t>(width) * 12);
+            const uint8_t* rows[3] = {nullptr, nullptr, nullptr};
+            for (uint32_t y = yBegin; y < yEnd; ++y) {
+                if (y < region.y0 || y >= region.y1) {
+                    continue;
+                }
+                uint8_t* dst = prepared.data() + static_cast<size_t>(width) * 4 * (y - yBegin);
+                PrepareRow(overlayBase + overlayStride * (region.overlayY + y - region.y0) +
+                               static_cast<size_t>(region.overlayX) * 4,
+                           dst, width, opacity, options.premultiplied, swapRB);
+                rows[y - yBegin] = dst;
+            }
+
+            uint8_t* uRow = uBase + uStride * cy;
+            uint8_t* vRow = vBase + vStride * cy;
+            for (uint32_t cx = cx0; cx < cx1; ++cx) {
+                uint8_t& u = uRow[cx * chromaStep + uOffset];
+                uint8_t& v = vRow[cx * chromaStep + vOffset];
+                const uint32_t xBegin = cx * 2;
+                const uint32_t xEnd = cx == chromaWidth - 1 ? target.width : xBegin + 2;
+
+                // 块内全部透明时色度与亮度都不变
+                bool touched = false;
+                for (uint32_t y = yBegin; y < yEnd && !touched; ++y) {
+                    const uint8_t* row = rows[y - yBegin];
+                    for (uint32_t x = xBegin; x < xEnd && row; ++x) {
+                        if (x >= region.x0 && x < region.x1 && row[(x - region.x0) * 4 + 3] != 0) {
+                            touched = true;
+                            break;
+                        }
+                    }
+                }
+                if (!touched) {
+                    continue;
+                }
+
+                uint32_t sum[3] = {0, 0, 0};
+                uint32_t samples = 0;
+                for (uint32_t y = yBegin; y < yEnd; ++y) {
+                    const uint8_t* row = rows[y - yBegin];
+                    uint8_t* lumaRow = lumaBase + lumaStride * y;
+                    for (uint32_t x = xBegin; x < xEnd; ++x) {
+                        uint8_t pixel[4];
+                        YUVToRGBPixel(toRGB, lumaRow[x], u, v, pixel);
+                        pixel[3] = 255;
+
+                        if (row && x >= region.x0 && x < region.x1) {
+                            const uint8_t* s = row + (x - region.x0) * 4;
+                            if (s[3] != 0) {
+                                blend(s, pixel);
+                                lumaRow[x] = RGBToLuma(toYUV, pixel[0], pixel[1], pixel[2]);
+                            }
+                        }
+                        sum[0] += pixel[0];
+                        sum[1] += pixel[1];
+                        sum[2] += pixel[2];
+                        ++samples;
+                    }
+                }
+
+                const uint32_t half = samples / 2;
+                RGBToChroma(toYUV, static_cast<int32_t>((sum[0] + half) / samples),
+                            static_cast<int32_t>((sum[1] + half) / samples),
+                            static_cast<int32_t>((sum[2] + half) / samples), u, v);
+            }
+        },
+        options.maxThreads);
+}
+
+} // namespace
+
+bool PremultiplyAlpha(const ImageDataDesc& image) {
+    return ForEachRGBARow(image, [](uint8_t* row, uint32_t width) { PrepareRow(row, row, width, 255, false, false); });
+}
+
+bool UnpremultiplyAlpha(const ImageDataDesc& image) {
+    return ForEachRGBARow(image, [](uint8_t* row, uint32_t width) { UnpremultiplyRow(row, width); });
+}
+
+bool CompositeImage(const ImageDataDesc& overlay, const ImageDataDesc& target, const CompositeOptions& options) {
+    if (!IsRGBA(overlay.format) || overlay.planes.empty() || !overlay.planes[0].data) {
+        return false;
+    }
+
+    ImagePlaneLayout layout;
+    const bool yuvTarget = target.format == ImageFormat::NV12 || target.format == ImageFormat::NV21 ||
+                           target.format == ImageFormat::YUV420P;
+    if ((!yuvTarget && !IsRGBA(target.format)) || !GetImagePlaneLayout(target.format, layout) ||
+        !HasPlaneData(target, layout)) {
+        return false;
+    }
+
+    const uint32_t opacity =
+        static_cast<uint32_t>(std::lround(std::min(std::max(options.opacity, 0.0f), 1.0f) * 255.0f));
+    CompositeRegion region;
+    if (opacity == 0 || !ComputeRegion(overlay, target, options.x, options.y, region)) {
+        return true;
+    }
+
+    if (yuvTarget) {
+        CompositeYUV(overlay, target, layout, region, opacity, options);
+    } else {
+        CompositeRGBA(overlay, target, region, opacity, options);
+    }
+    return true;
+}
+
+bool CompositeImage(const ImageDataDesc& overlay, ImageBuffer* target, const CompositeOptions& options) {
+    if (!target || !target->Lock(false)) {
+        return false;
+    }
+    const bool result = CompositeImage(overlay, target->GetImageDesc(), options);
+    target->Unlock();
+    return result;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,512 @@
+/**
+ * @file ImageConvert.cpp
+ * @brief 10 位 / 半精度图像格式转换实现
+ */
+
+#include "lrengine/utils/ImageConvert.h"
+#include "ImageLayout.h"
+#include "SimdConfig.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+constexpr float kInv1023 = 1.0f / 1023.0f;
+constexpr float kInv65535 = 1.0f / 65535.0f;
+
+// NaN 视为溢出，与 SIMD 路径一致钳制为 1
+inline float Clamp01(float x) {
+    return x < 1.0f ? (x > 0.0f ? x : 0.0f) : 1.0f;
+}
+
+// 归一化浮点转无符号整数（钳制后四舍五入）
+inline uint32_t ToUnorm(float x, float scale) {
+    return static_cast<uint32_t>(Clamp01(x) * scale + 0.5f);
+}
+
+inline uint8_t U16ToU8(uint16_t v) {
+    return static_cast<uint8_t>((v - (v >> 8) + 128) >> 8);
+}
+
+inline uint32_t Unorm10ToUnorm8(uint32_t v) {
+    return (v - (v >> 8) + 2) >> 2;
+}
+
+inline uint32_t Unorm8ToUnorm10(uint32_t v) {
+    return (v << 2) | (v >> 6);
+}
+
+#if defined(LR_SIMD_SSE2)
+
+// 非负有限单精度 [0, 65504] → 半精度（结果位于每个 32 位通道的低 16 位）
+inline __m128i FloatToHalfSSE2(__m128 x) {
+    const __m128i bits = _mm_castps_si128(x);
+    __m128i normal = _mm_sub_epi32(bits, _mm_set1_epi32(0x38000000 - 0xFFF));
+    normal = _mm_add_epi32(normal, _mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(1)));
+    normal = _mm_srli_epi32(normal, 13);
+    // 小于 2^-14 时为非规格化数，单位为 2^-24
+    const __m128i denormal = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(16777216.0f)));
+    const __m128i isDenormal = _mm_cmplt_epi32(bits, _mm_set1_epi32(0x38800000));
+    return _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+}
+
+// 半精度（32 位通道低 16 位）→ 单精度，负数返回 0
+inline __m128 HalfToFloatSSE2(__m128i h) {
+    const __m128i negative = _mm_cmpgt_epi32(h, _mm_set1_epi32(0x7FFF));
+    h = _mm_andnot_si128(negative, h);
+    const __m128 normal =
+        _mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(h, 13), _mm_set1_epi32(0x38000000)));
+    const __m128 denormal = _mm_mul_ps(_mm_cvtepi32_ps(h), _mm_set1_ps(1.0f / 16777216.0f));
+    const __m128 isDenormal = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(0x400)));
+    return _mm_or_ps(_mm_and_ps(isDenormal, denormal), _mm_andnot_ps(isDenormal, normal));
+}
+
+inline __m128i ToUnormSSE2(__m128 x, float scale) {
+    x = _mm_min_ps(_mm_max_ps(x, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+    return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(scale)), _mm_set1_ps(0.5f)));
+}
+
+#elif defined(LR_SIMD_NEON_FP16)
+
+inline uint32x4_t ToUnormNEON(float32x4_t x, float scale) {
+    x = vmaxnmq_f32(vminnmq_f32(x, vdupq_n_f32(1.0f)), vdupq_n_f32(0.0f));
+    return vcvtq_u32_f32(vmlaq_n_f32(vdupq_n_f32(0.5f), x, scale));
+}
+
+inline uint16x4_t FloatToHalfNEON(float32x4_t x) {
+    return vreinterpret_u16_f16(vcvt_f16_f32(x));
+}
+
+inline float32x4_t HalfToFloatNEON(uint16x4_t h) {
+    return vcvt_f32_f16(vreinterpret_f16_u16(h));
+}
+
+#endif
+
+bool Is16BitYUV(ImageFormat format) {
+    return format == ImageFormat::P010 || format == ImageFormat::P016;
+}
+
+} // namespace
+
+// =============================================================================
+// 标量辅助
+// =============================================================================
+
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    bits &= 0x7FFFFFFF;
+
+    if (bits >= 0x7F800000) {
+        // Inf / NaN
+        return sign | 0x7C00 | (bits > 0x7F800000 ? 0x200 : 0);
+    }
+    if (bits >= 0x477FF000) {
+        // 舍入后超过 65504
+        return sign | 0x7C00;
+    }
+    if (bits < 0x38800000) {
+        float magnitude;
+        std::memcpy(&magnitude, &bits, sizeof(magnitude));
+        return sign | static_cast<uint16_t>(std::nearbyint(magnitude * 16777216.0f));
+    }
+    return sign | static_cast<uint16_t>((bits - 0x38000000 + 0xFFF + ((bits >> 13) & 1)) >> 13);
+}
+
+float HalfToFloat(uint16_t value) {
+    const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1F;
+    const uint32_t mantissa = value & 0x3FF;
+
+    uint32_t bits;
+    if (exponent == 0) {
+        const float magnitude = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+        return sign ? -magnitude : magnitude;
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+// =============================================================================
+// 行转换内核
+// =============================================================================
+
+void ConvertU16ToU8(const uint16_t* src, uint8_t* dst, size_t count) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i bias = _mm_set1_epi16(128);
+    for (; i + 16 <= count; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        a = _mm_srli_epi16(_mm_add_epi16(_mm_sub_epi16(a, _mm_srli_epi16(a, 8)), bias), 8);
+        b = _mm_srli_epi16(_mm_add_epi16(_mm_sub_epi16(b, _mm_srli_epi16(b, 8)), bias), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+    }
+#elif defined(LR_SIMD_NEON)
+    const uint16x8_t bias = vdupq_n_u16(128);
+    for (; i + 16 <= count; i += 16) {
+        uint16x8_t a = vld1q_u16(src + i);
+        uint16x8_t b = vld1q_u16(src + i + 8);
+        a = vaddq_u16(vsubq_u16(a, vshrq_n_u16(a, 8)), bias);
+        b = vaddq_u16(vsubq_u16(b, vshrq_n_u16(b, 8)), bias);
+        vst1q_u8(dst + i, vcombine_u8(vshrn_n_u16(a, 8), vshrn_n_u16(b, 8)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = U16ToU8(src[i]);
+    }
+}
+
+void ConvertU8ToU16(const uint8_t* src, uint16_t* dst, size_t count, uint32_t bitDepth) {
+    // x * 257 的高 bitDepth 位即 x * (2^bitDepth - 1) / 255 的位复制近似
+    const uint16_t mask =
+        bitDepth >= 16 ? 0xFFFF : static_cast<uint16_t>(0xFFFF << (16 - bitDepth));
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i maskVec = _mm_set1_epi16(static_cast<short>(mask));
+    for (; i + 16 <= count; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_and_si128(_mm_unpacklo_epi8(x, x), maskVec));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8),
+                         _mm_and_si128(_mm_unpackhi_epi8(x, x), maskVec));
+    }
+#elif defined(LR_SIMD_NEON)
+    const uint16x8_t maskVec = vdupq_n_u16(mask);
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t x = vld1q_u8(src + i);
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(x));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(x));
+        vst1q_u16(dst + i, vandq_u16(vorrq_u16(vshlq_n_u16(lo, 8), lo), maskVec));
+        vst1q_u16(dst + i + 8, vandq_u16(vorrq_u16(vshlq_n_u16(hi, 8), hi), maskVec));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = static_cast<uint16_t>((src[i] * 257u) & mask);
+    }
+}
+
+void ConvertU16ToHalf(const uint16_t* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(kInv65535);
+    for (; i + 8 <= count; i += 8) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128 lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale);
+        const __m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale);
+        // 结果不超过 0x3C00，有符号饱和打包不会截断
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_packs_epi32(FloatToHalfSSE2(lo), FloatToHalfSSE2(hi)));
+    }
+#elif defined(LR_SIMD_NEON_FP16)
+    for (; i + 8 <= count; i += 8) {
+        const uint16x8_t v = vld1q_u16(src + i);
+        const float32x4_t lo = vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(v))), kInv65535);
+        const float32x4_t hi = vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v))), kInv65535);
+        vst1q_u16(dst + i, vcombine_u16(FloatToHalfNEON(lo), FloatToHalfNEON(hi)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = FloatToHalf(static_cast<float>(src[i]) * kInv65535);
+    }
+}
+
+void ConvertHalfToU16(const uint16_t* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i offset32 = _mm_set1_epi32(32768);
+    const __m128i offset16 = _mm_set1_epi16(static_cast<short>(0x8000));
+    for (; i + 8 <= count; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i lo = ToUnormSSE2(HalfToFloatSSE2(_mm_unpacklo_epi16(h, zero)), 65535.0f);
+        __m128i hi = ToUnormSSE2(HalfToFloatSSE2(_mm_unpackhi_epi16(h, zero)), 65535.0f);
+        // SSE2 没有无符号 32→16 打包，偏移到有符号范围后再还原
+        lo = _mm_sub_epi32(lo, offset32);
+        hi = _mm_sub_epi32(hi, offset32);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                         _mm_xor_si128(_mm_packs_epi32(lo, hi), offset16));
+    }
+#elif defined(LR_SIMD_NEON_FP16)
+    for (; i + 8 <= count; i += 8) {
+        const uint16x8_t h = vld1q_u16(src + i);
+        const uint32x4_t lo = ToUnormNEON(HalfToFloatNEON(vget_low_u16(h)), 65535.0f);
+        const uint32x4_t hi = ToUnormNEON(HalfToFloatNEON(vget_high_u16(h)), 65535.0f);
+        vst1q_u16(dst + i, vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] = static_cast<uint16_t>(ToUnorm(HalfToFloat(src[i]), 65535.0f));
+    }
+}
+
+void ConvertRGB10A2ToRGBA8(const uint32_t* src, uint8_t* dst, size_t pixelCount) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i mask10 = _mm_set1_epi32(0x3FF);
+    const __m128i two = _mm_set1_epi32(2);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i r = _mm_and_si128(v, mask10);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(v, 10), mask10);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(v, 20), mask10);
+        __m128i a = _mm_srli_epi32(v, 30);
+        r = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(r, _mm_srli_epi32(r, 8)), two), 2);
+        g = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(g, _mm_srli_epi32(g, 8)), two), 2);
+        b = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(b, _mm_srli_epi32(b, 8)), two), 2);
+        // 2 位 alpha 复制到 8 位（a * 85）
+        a = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(a, 6), _mm_slli_epi32(a, 4)),
+                         _mm_or_si128(_mm_slli_epi32(a, 2), a));
+        const __m128i out = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                         _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), out);
+    }
+#elif defined(LR_SIMD_NEON)
+    const uint32x4_t mask10 = vdupq_n_u32(0x3FF);
+    const uint32x4_t two = vdupq_n_u32(2);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const uint32x4_t v = vld1q_u32(src + i);
+        uint32x4_t r = vandq_u32(v, mask10);
+        uint32x4_t g = vandq_u32(vshrq_n_u32(v, 10), mask10);
+        uint32x4_t b = vandq_u32(vshrq_n_u32(v, 20), mask10);
+        uint32x4_t a = vmulq_n_u32(vshrq_n_u32(v, 30), 85);
+        r = vshrq_n_u32(vaddq_u32(vsubq_u32(r, vshrq_n_u32(r, 8)), two), 2);
+        g = vshrq_n_u32(vaddq_u32(vsubq_u32(g, vshrq_n_u32(g, 8)), two), 2);
+        b = vshrq_n_u32(vaddq_u32(vsubq_u32(b, vshrq_n_u32(b, 8)), two), 2);
+        const uint32x4_t out = vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 8)),
+                                         vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(a, 24)));
+        vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(out));
+    }
+#endif
+    for (; i < pixelCount; ++i) {
+        const uint32_t v = src[i];
+        dst[i * 4 + 0] = static_cast<uint8_t>(Unorm10ToUnorm8(v & 0x3FF));
+        dst[i * 4 + 1] = static_cast<uint8_t>(Unorm10ToUnorm8((v >> 10) & 0x3FF));
+        dst[i * 4 + 2] = static_cast<uint8_t>(Unorm10ToUnorm8((v >> 20) & 0x3FF));
+        dst[i * 4 + 3] = static_cast<uint8_t>((v >> 30) * 85);
+    }
+}
+
+void ConvertRGBA8ToRGB10A2(const uint8_t* src, uint32_t* dst, size_t pixelCount) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i mask8 = _mm_set1_epi32(0xFF);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        __m128i r = _mm_and_si128(v, mask8);
+        __m128i g = _mm_and_si128(_mm_srli_epi32(v, 8), mask8);
+        __m128i b = _mm_and_si128(_mm_srli_epi32(v, 16), mask8);
+        const __m128i a = _mm_srli_epi32(v, 30);
+        r = _mm_or_si128(_mm_slli_epi32(r, 2), _mm_srli_epi32(r, 6));
+        g = _mm_or_si128(_mm_slli_epi32(g, 2), _mm_srli_epi32(g, 6));
+        b = _mm_or_si128(_mm_slli_epi32(b, 2), _mm_srli_epi32(b, 6));
+        const __m128i out = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 10)),
+                                         _mm_or_si128(_mm_slli_epi32(b, 20), _mm_slli_epi32(a, 30)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+    }
+#elif defined(LR_SIMD_NEON)
+    const uint32x4_t mask8 = vdupq_n_u32(0xFF);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const uint32x4_t v = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        uint32x4_t r = vandq_u32(v, mask8);
+        uint32x4_t g = vandq_u32(vshrq_n_u32(v, 8), mask8);
+        uint32x4_t b = vandq_u32(vshrq_n_u32(v, 16), mask8);
+        const uint32x4_t a = vshrq_n_u32(v, 30);
+        r = vorrq_u32(vshlq_n_u32(r, 2), vshrq_n_u32(r, 6));
+        g = vorrq_u32(vshlq_n_u32(g, 2), vshrq_n_u32(g, 6));
+        b = vorrq_u32(vshlq_n_u32(b, 2), vshrq_n_u32(b, 6));
+        vst1q_u32(dst + i, vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 10)),
+                                     vorrq_u32(vshlq_n_u32(b, 20), vshlq_n_u32(a, 30))));
+    }
+#endif
+    for (; i < pixelCount; ++i) {
+        const uint8_t* p = src + i * 4;
+        dst[i] = Unorm8ToUnorm10(p[0]) | (Unorm8ToUnorm10(p[1]) << 10) |
+                 (Unorm8ToUnorm10(p[2]) << 20) | (static_cast<uint32_t>(p[3] >> 6) << 30);
+    }
+}
+
+void ConvertRGB10A2ToRGBA16F(const uint32_t* src, uint16_t* dst, size_t pixelCount) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i mask10 = _mm_set1_epi32(0x3FF);
+    const __m128 scale = _mm_set1_ps(kInv1023);
+    const __m128 alphaScale = _mm_set1_ps(1.0f / 3.0f);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i r = FloatToHalfSSE2(_mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(v, mask10)), scale));
+        const __m128i g = FloatToHalfSSE2(
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 10), mask10)), scale));
+        const __m128i b = FloatToHalfSSE2(
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(v, 20), mask10)), scale));
+        const __m128i a =
+            FloatToHalfSSE2(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(v, 30)), alphaScale));
+        // 每通道 (lo16, hi16) = (R, G) / (B, A)，按像素交织后即 RGBA 顺序
+        const __m128i rg = _mm_or_si128(r, _mm_slli_epi32(g, 16));
+        const __m128i ba = _mm_or_si128(b, _mm_slli_epi32(a, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_unpacklo_epi32(rg, ba));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4 + 8), _mm_unpackhi_epi32(rg, ba));
+    }
+#elif defined(LR_SIMD_NEON_FP16)
+    const uint32x4_t mask10 = vdupq_n_u32(0x3FF);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const uint32x4_t v = vld1q_u32(src + i);
+        uint16x4x4_t out;
+        out.val[0] = FloatToHalfNEON(vmulq_n_f32(vcvtq_f32_u32(vandq_u32(v, mask10)), kInv1023));
+        out.val[1] = FloatToHalfNEON(
+            vmulq_n_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(v, 10), mask10)), kInv1023));
+        out.val[2] = FloatToHalfNEON(
+            vmulq_n_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(v, 20), mask10)), kInv1023));
+        out.val[3] = FloatToHalfNEON(vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(v, 30)), 1.0f / 3.0f));
+        vst4_u16(dst + i * 4, out);
+    }
+#endif
+    for (; i < pixelCount; ++i) {
+        const uint32_t v = src[i];
+        dst[i * 4 + 0] = FloatToHalf(static_cast<float>(v & 0x3FF) * kInv1023);
+        dst[i * 4 + 1] = FloatToHalf(static_cast<float>((v >> 10) & 0x3FF) * kInv1023);
+        dst[i * 4 + 2] = FloatToHalf(static_cast<float>((v >> 20) & 0x3FF) * kInv1023);
+        dst[i * 4 + 3] = FloatToHalf(static_cast<float>(v >> 30) * (1.0f / 3.0f));
+    }
+}
+
+void ConvertRGBA16FToRGB10A2(const uint16_t* src, uint32_t* dst, size_t pixelCount) {
+    size_t i = 0;
+#if defined(LR_SIMD_SSE2)
+    const __m128i mask16 = _mm_set1_epi32(0xFFFF);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const __m128 p01 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4)));
+        const __m128 p23 = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4 + 8)));
+        // 每个 32 位通道为一个像素的 (R, G) 或 (B, A)
+        const __m128i rg = _mm_castps_si128(_mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i ba = _mm_castps_si128(_mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128i r = ToUnormSSE2(HalfToFloatSSE2(_mm_and_si128(rg, mask16)), 1023.0f);
+        const __m128i g = ToUnormSSE2(HalfToFloatSSE2(_mm_srli_epi32(rg, 16)), 1023.0f);
+        const __m128i b = ToUnormSSE2(HalfToFloatSSE2(_mm_and_si128(ba, mask16)), 1023.0f);
+        const __m128i a = ToUnormSSE2(HalfToFloatSSE2(_mm_srli_epi32(ba, 16)), 3.0f);
+        const __m128i out = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 10)),
+                                         _mm_or_si128(_mm_slli_epi32(b, 20), _mm_slli_epi32(a, 30)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+    }
+#elif defined(LR_SIMD_NEON_FP16)
+    for (; i + 4 <= pixelCount; i += 4) {
+        const uint16x4x4_t h = vld4_u16(src + i * 4);
+        const uint32x4_t r = ToUnormNEON(HalfToFloatNEON(h.val[0]), 1023.0f);
+        const uint32x4_t g = ToUnormNEON(HalfToFloatNEON(h.val[1]), 1023.0f);
+        const uint32x4_t b = ToUnormNEON(HalfToFloatNEON(h.val[2]), 1023.0f);
+        const uint32x4_t a = ToUnormNEON(HalfToFloatNEON(h.val[3]), 3.0f);
+        vst1q_u32(dst + i, vorrq_u32(vorrq_u32(r, vshlq_n_u32(g, 10)),
+                                     vorrq_u32(vshlq_n_u32(b, 20), vshlq_n_u32(a, 30))));
+    }
+#endif
+    for (; i < pixelCount; ++i) {
+        const uint16_t* p = src + i * 4;
+        dst[i] = ToUnorm(HalfToFloat(p[0]), 1023.0f) | (ToUnorm(HalfToFloat(p[1]), 1023.0f) << 10) |
+                 (ToUnorm(HalfToFloat(p[2]), 1023.0f) << 20) | (ToUnorm(HalfToFloat(p[3]), 3.0f) << 30);
+    }
+}
+
+// =============================================================================
+// 整图转换
+// =============================================================================
+
+bool IsConversionSupported(ImageFormat srcFormat, ImageFormat dstFormat) {
+    ImagePlaneLayout layout;
+    if (srcFormat == dstFormat) {
+        return GetImagePlaneLayout(srcFormat, layout);
+    }
+    if (Is16BitYUV(srcFormat)) {
+        return dstFormat == ImageFormat::NV12;
+    }
+    if (Is16BitYUV(dstFormat)) {
+        return srcFormat == ImageFormat::NV12;
+    }
+    if (srcFormat == ImageFormat::RGB10A2) {
+        return dstFormat == ImageFormat::RGBA8 || dstFormat == ImageFormat::RGBA16F;
+    }
+    if (dstFormat == ImageFormat::RGB10A2) {
+        return srcFormat == ImageFormat::RGBA8 || srcFormat == ImageFormat::RGBA16F;
+    }
+    return false;
+}
+
+bool ConvertImage(const ImageDataDesc& src, const ImageDataDesc& dst) {
+    if (src.width == 0 || src.height == 0 || src.width != dst.width || src.height != dst.height ||
+        !IsConversionSupported(src.format, dst.format)) {
+        return false;
+    }
+
+    ImagePlaneLayout srcLayout;
+    ImagePlaneLayout dstLayout;
+    GetImagePlaneLayout(src.format, srcLayout);
+    GetImagePlaneLayout(dst.format, dstLayout);
+    if (src.planes.size() < static_cast<size_t>(srcLayout.count) ||
+        dst.planes.size() < static_cast<size_t>(dstLayout.count)) {
+        return false;
+    }
+
+    for (int plane = 0; plane < srcLayout.count; ++plane) {
+        const uint8_t* srcRow = static_cast<const uint8_t*>(src.planes[plane].data);
+        uint8_t* dstRow = static_cast<uint8_t*>(const_cast<void*>(dst.planes[plane].data));
+        if (!srcRow || !dstRow) {
+            return false;
+        }
+
+        const uint32_t shift = GetPlaneShift(srcLayout, plane);
+        const uint32_t width = src.width >> shift;
+        const uint32_t height = src.height >> shift;
+        const size_t srcRowBytes = static_cast<size_t>(width) * srcLayout.bytesPerPixel[plane];
+        const size_t dstRowBytes = static_cast<size_t>(width) * dstLayout.bytesPerPixel[plane];
+        const size_t srcStride = src.planes[plane].stride ? src.planes[plane].stride : srcRowBytes;
+        const size_t dstStride = dst.planes[plane].stride ? dst.planes[plane].stride : dstRowBytes;
+        // 交织色度平面每像素两个样本
+        const size_t samples = static_cast<size_t>(width) * (plane > 0 ? 2 : 1);
+
+        for (uint32_t y = 0; y < height; ++y, srcRow += srcStride, dstRow += dstStride) {
+            if (src.format == dst.format) {
+                std::memcpy(dstRow, srcRow, srcRowBytes);
+            } else if (Is16BitYUV(src.format)) {
+                ConvertU16ToU8(reinterpret_cast<const uint16_t*>(srcRow), dstRow, samples);
+            } else if (Is16BitYUV(dst.format)) {
+                ConvertU8ToU16(srcRow, reinterpret_cast<uint16_t*>(dstRow), samples,
+                               dst.format == ImageFormat::P010 ? 10 : 16);
+            } else if (dst.format == ImageFormat::RGBA8) {
+                ConvertRGB10A2ToRGBA8(reinterpret_cast<const uint32_t*>(srcRow), dstRow, width);
+            } else if (dst.format == ImageFormat::RGBA16F) {
+                ConvertRGB10A2ToRGBA16F(reinterpret_cast<const uint32_t*>(srcRow),
+                                        reinterpret_cast<uint16_t*>(dstRow), width);
+            } else if (src.format == ImageFormat::RGBA8) {
+                ConvertRGBA8ToRGB10A2(srcRow, reinterpret_cast<uint32_t*>(dstRow), width);
+            } else {
+                ConvertRGBA16FToRGB10A2(reinterpret_cast<const uint16_t*>(srcRow),
+                                        reinterpret_cast<uint32_t*>(dstRow), width);
+            }
+        }
+    }
+    return true;
+}
+
+bool ConvertImage(const ImageDataDesc& src, ImageBuffer* dst) {
+    if (!dst || !dst->Lock(false)) {
+        return false;
+    }
+    const bool result = ConvertImage(src, dst->GetImageDesc());
+    dst->Unlock();
+    return result;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,398 @@
+/**
+ * @file ImageHash.cpp
+ * @brief 图像内容哈希与分块差异检测实现
+ */
+
+#include "lrengine/utils/ImageHash.h"
+#include "ImageLayout.h"
+#include "SimdConfig.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+constexpr uint64_t kPrime32_1 = 0x9E3779B1ULL;
+constexpr uint64_t kPrime32_2 = 0x85EBCA77ULL;
+constexpr uint64_t kPrime32_3 = 0xC2B2AE3DULL;
+constexpr uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t kPrime64_5 = 0x27D4EB2F165667C5ULL;
+
+constexpr size_t kStripeSize = 64;       // 每条带 8 路 × 8 字节
+constexpr size_t kStripesPerBlock = 16;  // 每 1KB 扰乱一次累加器
+
+// 密钥：条带 n 使用 [n, n + 8)，扰乱使用 [16, 24)
+constexpr uint64_t kSecret[24] = {
+    0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL, 0x1F67B3B7A4A44072ULL,
+    0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL, 0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL,
+    0xCB00C391BB52283CULL, 0xA32E531B8B65D088ULL, 0x4EF90DA297486471ULL, 0xD8ACDEA946EF1938ULL,
+    0x3F349CE33F76FAA8ULL, 0x1D4F0BC7C7BBDCF9ULL, 0x3159B4CD4BE0518AULL, 0x647378D9C97E9FC8ULL,
+    0xC3EBD33483ACC5EAULL, 0xEB6313FAFFA081C5ULL, 0x49DAF0B751DD0D17ULL, 0x9E68D429265516D3ULL,
+    0xFCA1477D58BE162BULL, 0xCE31D07AD1B8F88FULL, 0x280416958F3ACB45ULL, 0x7E404BBBCAFBD7AFULL,
+};
+
+inline uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// 64×64 → 128 位乘法，高低 64 位异或折叠
+inline uint64_t Mul128Fold64(uint64_t a, uint64_t b) {
+    const uint64_t loLo = (a & 0xFFFFFFFFULL) * (b & 0xFFFFFFFFULL);
+    const uint64_t hiLo = (a >> 32) * (b & 0xFFFFFFFFULL);
+    const uint64_t loHi = (a & 0xFFFFFFFFULL) * (b >> 32);
+    const uint64_t hiHi = (a >> 32) * (b >> 32);
+    const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFULL) + loHi;
+    const uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    const uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFFULL);
+    return lower ^ upper;
+}
+
+inline uint64_t Avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+// 累加 count 个连续条带，条带 n 使用密钥 key + n
+void AccumulateStripes(uint64_t* acc, const uint8_t* data, size_t count, const uint64_t* key) {
+#if defined(LR_SIMD_SSE2)
+    __m128i a[4];
+    for (int i = 0; i < 4; ++i) {
+        a[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i * 2));
+    }
+    for (size_t n = 0; n < count; ++n, data += kStripeSize) {
+        const uint64_t* stripeKey = key + n;
+        for (int i = 0; i < 4; ++i) {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i * 16));
+            const __m128i keyed = _mm_xor_si128(
+                value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripeKey + i * 2)));
+            // 每路：低 32 位 × 高 32 位，相邻路交换累加原始数据
+            const __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            a[i] = _mm_add_epi64(a[i], _mm_add_epi64(product, swapped));
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i * 2), a[i]);
+    }
+#elif defined(LR_SIMD_NEON)
+    uint64x2_t a[4];
+    for (int i = 0; i < 4; ++i) {
+        a[i] = vld1q_u64(acc + i * 2);
+    }
+    for (size_t n = 0; n < count; ++n, data += kStripeSize) {
+        const uint64_t* stripeKey = key + n;
+        for (int i = 0; i < 4; ++i) {
+            const uint64x2_t value = vreinterpretq_u64_u8(vld1q_u8(data + i * 16));
+            const uint64x2_t keyed = veorq_u64(value, vld1q_u64(stripeKey + i * 2));
+            a[i] = vaddq_u64(a[i], vextq_u64(value, value, 1));
+            a[i] = vmlal_u32(a[i], vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+        }
+    }
+    for (int i = 0; i < 4; ++i) {
+        vst1q_u64(acc + i * 2, a[i]);
+    }
+#else
+    for (size_t n = 0; n < count; ++n, data += kStripeSize) {
+        for (int i = 0; i < 8; ++i) {
+            const uint64_t value = Read64(data + i * 8);
+            const uint64_t keyed = value ^ key[n + i];
+            acc[i ^ 1] += value;
+            acc[i] += (keyed & 0xFFFFFFFFULL) * (keyed >> 32);
+        }
+    }
+#endif
+}
+
+void ScrambleAccumulators(uint64_t* acc) {
+    for (int i = 0; i < 8; ++i) {
+        uint64_t value = acc[i];
+        value ^= value >> 47;
+        value ^= kSecret[16 + i];
+        acc[i] = value * kPrime32_1;
+    }
+}
+
+/**
+ * @brief 流式哈希状态（可跨不连续的行累加）
+ */
+class StreamHasher {
+public:
+    explicit StreamHasher(uint64_t seed = 0) { Reset(seed); }
+
+    void Reset(uint64_t seed) {
+        mAcc[0] = kPrime32_3;
+        mAcc[1] = kPrime64_1;
+        mAcc[2] = kPrime64_2;
+        mAcc[3] = kPrime64_3;
+        mAcc[4] = kPrime64_4;
+        mAcc[5] = kPrime32_2;
+        mAcc[6] = kPrime64_5;
+        mAcc[7] = kPrime32_1;
+        for (int i = 0; i < 8; i += 2) {
+            mAcc[i] += seed;
+            mAcc[i + 1] -= seed;
+        }
+        mBuffered = 0;
+        mStripeInBlock = 0;
+        mTotalLength = 0;
+    }
+
+    void Update(const void* data, size_t size) {
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        mTotalLength += size;
+
+        if (mBuffered > 0) {
+            const size_t take = std::min(size, kStripeSize - mBuffered);
+            std::memcpy(mBuffer + mBuffered, p, take);
+            mBuffered += take;
+            p += take;
+            size -= take;
+            if (mBuffered < kStripeSize) {
+                return;
+            }
+            consumeStripes(mBuffer, 1);
+            mBuffered = 0;
+        }
+
+        const size_t stripes = size / kStripeSize;
+        consumeStripes(p, stripes);
+        p += stripes * kStripeSize;
+        size -= stripes * kStripeSize;
+
+        if (size > 0) {
+            std::memcpy(mBuffer, p, size);
+            mBuffered = size;
+        }
+    }
+
+    uint64_t Finalize() {
+        if (mBuffered > 0) {
+            std::memset(mBuffer + mBuffered, 0, kStripeSize - mBuffered);
+            consumeStripes(mBuffer, 1);
+            mBuffered = 0;
+        }
+
+        uint64_t result = mTotalLength * kPrime64_1;
+        for (int i = 0; i < 8; i += 2) {
+            result += Mul128Fold64(mAcc[i] ^ kSecret[i + 3], mAcc[i + 1] ^ kSecret[i + 4]);
+        }
+        return Avalanche(result);
+    }
+
+private:
+    void consumeStripes(const uint8_t* data, size_t count) {
+        while (count > 0) {
+            const size_t take = std::min(count, kStripesPerBlock - mStripeInBlock);
+            AccumulateStripes(mAcc, data, take, kSecret + mStripeInBlock);
+            mStripeInBlock += take;
+            if (mStripeInBlock == kStripesPerBlock) {
+                ScrambleAccumulators(mAcc);
+                mStripeInBlock = 0;
+            }
+            data += take * kStripeSize;
+            count -= take;
+        }
+    }
+
+    uint64_t mAcc[8];
+    uint8_t mBuffer[kStripeSize];
+    size_t mBuffered;
+    size_t mStripeInBlock;
+    uint64_t mTotalLength;
+};
+
+// 尺寸与格式参与哈希，避免不同布局的相同字节流碰撞
+void HashHeader(StreamHasher& hasher, const ImageDataDesc& image, uint32_t extra) {
+    const uint32_t header[4] = {image.width, image.height, static_cast<uint32_t>(image.format), extra};
+    hasher.Update(header, sizeof(header));
+}
+
+} // namespace
+
+void BlockHashGrid::Clear() {
+    width = height = 0;
+    format = ImageFormat::Unknown;
+    blockSize = columns = rows = 0;
+    hashes.clear();
+}
+
+uint64_t HashBytes(const void* data, size_t size, uint64_t seed) {
+    StreamHasher hasher(seed);
+    if (data && size > 0) {
+        hasher.Update(data, size);
+    }
+    return hasher.Finalize();
+}
+
+bool HashImage(const ImageDataDesc& image, uint64_t& out, const ImageHashOptions& options) {
+    ImagePlaneLayout layout;
+    if (!GetImagePlaneLayout(image.format, layout) || !HasPlaneData(image, layout)) {
+        return false;
+    }
+
+    const uint32_t rowStep = std::max(1u, options.rowStep);
+    StreamHasher hasher(options.seed);
+    HashHeader(hasher, image, rowStep);
+
+    for (int plane = 0; plane < layout.count; ++plane) {
+        const uint32_t shift = GetPlaneShift(layout, plane);
+        const uint32_t planeHeight = image.height >> shift;
+        const size_t rowBytes = static_cast<size_t>(image.width >> shift) * layout.bytesPerPixel[plane];
+        const size_t stride = GetPlaneStride(image, layout, plane);
+        const uint8_t* base = static_cast<const uint8_t*>(image.planes[plane].data);
+
+        if (rowStep == 1 && stride == rowBytes) {
+            hasher.Update(base, rowBytes * planeHeight);
+            continue;
+        }
+        for (uint32_t y = 0; y < planeHeight; y += rowStep) {
+            hasher.Update(base + stride * y, rowBytes);
+        }
+    }
+
+    out = hasher.Finalize();
+    return true;
+}
+
+bool HashImage(ImageBuffer* buffer, uint64_t& out, const ImageHashOptions& options) {
+    if (!buffer || !buffer->Lock(true)) {
+        return false;
+    }
+    const bool result = HashImage(buffer->GetImageDesc(), out, options);
+    buffer->Unlock();
+    return result;
+}
+
+bool ComputeBlockHashes(const ImageDataDesc& image, uint32_t blockSize, BlockHashGrid& out) {
+    out.Clear();
+    ImagePlaneLayout layout;
+    if (blockSize == 0 || !GetImagePlaneLayout(image.format, layout) || !HasPlaneData(image, layout)) {
+        return false;
+    }
+    if (layout.chromaSubsampled && (blockSize & 1)) {
+        return false;
+    }
+
+    out.width = image.width;
+    out.height = image.height;
+    out.format = image.format;
+    out.blockSize = blockSize;
+    out.columns = (image.width + blockSize - 1) / blockSize;
+    out.rows = (image.height + blockSize - 1) / blockSize;
+    out.hashes.resize(static_cast<size_t>(out.columns) * out.rows);
+
+    // 逐块行处理：同一块行内每个块一个流式状态，按行把各块的行段送入
+    std::vector<StreamHasher> hashers(out.columns);
+    for (uint32_t by = 0; by < out.rows; ++by) {
+        for (StreamHasher& hasher : hashers) {
+            hasher.Reset(0);
+        }
+
+        for (int plane = 0; plane < layout.count; ++plane) {
+            const uint32_t shift = GetPlaneShift(layout, plane);
+            const uint32_t planeWidth = image.width >> shift;
+            const uint32_t planeHeight = image.height >> shift;
+            const uint32_t planeBlock = blockSize >> shift;
+            const uint32_t bytesPerPixel = layout.bytesPerPixel[plane];
+            const size_t stride = GetPlaneStride(image, layout, plane);
+            const uint8_t* base = static_cast<const uint8_t*>(image.planes[plane].data);
+
+            const uint32_t yBegin = by * planeBlock;
+            const uint32_t yEnd = std::min(planeHeight, yBegin + planeBlock);
+            for (uint32_t y = yBegin; y < yEnd; ++y) {
+                const uint8_t* row = base + stride * y;
+                for (uint32_t bx = 0; bx < out.columns; ++bx) {
+                    const uint32_t xBegin = bx * planeBlock;
+                    if (xBegin >= planeWidth) {
+                        break;
+                    }
+                    const uint32_t xEnd = std::min(planeWidth, xBegin + planeBlock);
+                    hashers[bx].Update(row + static_cast<size_t>(xBegin) * bytesPerPixel,
+                                       static_cast<size_t>(xEnd - xBegin) * bytesPerPixel);
+                }
+            }
+        }
+
+        for (uint32_t bx = 0; bx < out.columns; ++bx) {
+            out.hashes[static_cast<size_t>(by) * out.columns + bx] = hashers[bx].Finalize();
+        }
+    }
+    return true;
+}
+
+uint32_t DiffBlockHashes(const BlockHashGrid& previous, const BlockHashGrid& current,
+                         std::vector<uint8_t>* changedMask) {
+    const size_t count = current.hashes.size();
+    const bool comparable = previous.width == current.width && previous.height == current.height &&
+                            previous.format == current.format &&
+                            previous.blockSize == current.blockSize && previous.hashes.size() == count;
+
+    if (changedMask) {
+        changedMask->assign(count, comparable ? 0 : 1);
+    }
+    if (!comparable) {
+        return static_cast<uint32_t>(count);
+    }
+
+    uint32_t changed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (previous.hashes[i] != current.hashes[i]) {
+            ++changed;
+            if (changedMask) {
+                (*changedMask)[i] = 1;
+            }
+        }
+    }
+    return changed;
+}
+
+// ============================================================================
+// FrameDeduplicator
+// ============================================================================
+
+FrameDeduplicator::FrameDeduplicator(uint32_t blockSize)
+    : mBlockSize(std::max(2u, (blockSize + 1) & ~1u)) {}
+
+bool FrameDeduplicator::Update(const ImageDataDesc& image) {
+    mPrevious.hashes.swap(mCurrent.hashes);
+    mPrevious.width = mCurrent.width;
+    mPrevious.height = mCurrent.height;
+    mPrevious.format = mCurrent.format;
+    mPrevious.blockSize = mCurrent.blockSize;
+    mPrevious.columns = mCurrent.columns;
+    mPrevious.rows = mCurrent.rows;
+
+    if (!ComputeBlockHashes(image, mBlockSize, mCurrent)) {
+        // 无法检测时按变化处理，保证调用方不会错误跳过
+        Reset();
+        return true;
+    }
+
+    mChangedBlocks = DiffBlockHashes(mPrevious, mCurrent, &mChangedMask);
+    const uint64_t header[2] = {(static_cast<uint64_t>(image.width) << 32) | image.height,
+                                static_cast<uint64_t>(image.format)};
+    mFrameHash = HashBytes(mCurrent.hashes.data(), mCurrent.hashes.size() * sizeof(uint64_t),
+                           HashBytes(header, sizeof(header)));
+    return mChangedBlocks > 0;
+}
+
+void FrameDeduplicator::Reset() {
+    mPrevious.Clear();
+    mCurrent.Clear();
+    mChangedMask.clear();
+    mFrameHash = 0;
+    mChangedBlocks = 0;
+}
+
+} // namespace utils
+} // namespace lrengine
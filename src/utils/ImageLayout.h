@@ -0,0 +1,95 @@
+/**
+ * @file ImageLayout.h
+ * @brief 图像格式平面布局（内部头文件）
+ *
+ * 供逐平面处理图像数据的工具（哈希、差异检测、分块等）共用。
+ */
+
+#pragma once
+
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief 图像格式的平面布局
+ */
+struct ImagePlaneLayout {
+    int count = 0;                          ///< 平面数
+    uint32_t bytesPerPixel[3] = {0, 0, 0};  ///< 各平面每像素字节数（交织色度按色度像素计）
+    bool chromaSubsampled = false;          ///< 平面 1、2 宽高减半（4:2:0）
+};
+
+/**
+ * @brief 获取格式的平面布局
+ * @return 格式已知返回true
+ */
+inline bool GetImagePlaneLayout(ImageFormat format, ImagePlaneLayout& out) {
+    switch (format) {
+        case ImageFormat::YUV420P:
+            out = {3, {1, 1, 1}, true};
+            return true;
+        case ImageFormat::NV12:
+        case ImageFormat::NV21:
+            out = {2, {1, 2, 0}, true};
+            return true;
+        case ImageFormat::P010:
+        case ImageFormat::P016:
+            out = {2, {2, 4, 0}, true};
+            return true;
+        case ImageFormat::RGBA8:
+        case ImageFormat::BGRA8:
+        case ImageFormat::RGB10A2:
+            out = {1, {4, 0, 0}, false};
+            return true;
+        case ImageFormat::RGB8:
+            out = {1, {3, 0, 0}, false};
+            return true;
+        case ImageFormat::GRAY8:
+            out = {1, {1, 0, 0}, false};
+            return true;
+        case ImageFormat::RGBA16F:
+            out = {1, {8, 0, 0}, false};
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief 平面内的坐标缩放（色度平面为 1，其余为 0）
+ */
+inline uint32_t GetPlaneShift(const ImagePlaneLayout& layout, int plane) {
+    return plane > 0 && layout.chromaSubsampled ? 1u : 0u;
+}
+
+/**
+ * @brief 平面行距（stride 为 0 时按紧密排列计算）
+ */
+inline size_t GetPlaneStride(const ImageDataDesc& image, const ImagePlaneLayout& layout, int plane) {
+    const uint32_t stride = image.planes[plane].stride;
+    return stride ? stride
+                  : static_cast<size_t>(image.width >> GetPlaneShift(layout, plane)) * layout.bytesPerPixel[plane];
+}
+
+/**
+ * @brief 检查图像描述与布局是否匹配（平面数足够且数据非空）
+ */
+inline bool HasPlaneData(const ImageDataDesc& image, const ImagePlaneLayout& layout) {
+    if (image.width == 0 || image.height == 0 || image.planes.size() < static_cast<size_t>(layout.count)) {
+        return false;
+    }
+    for (int plane = 0; plane < layout.count; ++plane) {
+        if (!image.planes[plane].data) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,368 @@
+/**
+ * @file ImagePipeline.cpp
+ * @brief 融合的 CPU 图像处理流水线实现
+ */
+
+#include "lrengine/utils/ImagePipeline.h"
+#include "lrengine/utils/ParallelFor.h"
+#include "ImageLayout.h"
+#include "YUVMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+/**
+ * @brief 输出坐标到源坐标的一维映射（双线性两个采样点与 8 位权重）
+ */
+struct AxisSample {
+    uint32_t i0;
+    uint32_t i1;
+    uint32_t weight;  ///< i1 的权重，0-256
+};
+
+/**
+ * @brief 一次流水线执行的共享状态
+ */
+struct PipelineContext {
+    const ImageDataDesc* src;
+    const ImageDataDesc* dst;
+    ImagePlaneLayout layout;
+    YUVToRGBMatrix yuv;
+    std::vector<AxisSample> columns;   ///< 输出 x 对应的源轴
+    std::vector<AxisSample> rows;      ///< 输出 y 对应的源轴
+    bool swapAxes;                     ///< 旋转 90/270：输出 x 对应源 y
+    bool nearest;
+    const uint8_t* curves;
+    const ColorLut3D* lut;
+    uint32_t dstBytesPerPixel;
+    bool dstBGRA;
+    uint32_t tileSize;
+    uint32_t tileColumns;
+};
+
+/**
+ * @brief 计算一维映射
+ * @param outSize 输出长度
+ * @param extent 旋转后对应的裁剪长度
+ * @param reversed 旋转后方向相反
+ * @param offset 裁剪起点
+ */
+void BuildAxis(uint32_t outSize, uint32_t extent, bool reversed, uint32_t offset, bool nearest,
+               std::vector<AxisSample>& out) {
+    out.resize(outSize);
+    const double scale = static_cast<double>(extent) / outSize;
+    const double last = static_cast<double>(extent - 1);
+    for (uint32_t i = 0; i < outSize; ++i) {
+        double c = (i + 0.5) * scale - 0.5;
+        c = std::min(std::max(c, 0.0), last);
+        if (reversed) {
+            c = last - c;
+        }
+
+        AxisSample& sample = out[i];
+        if (nearest) {
+            sample.i0 = static_cast<uint32_t>(std::min(std::floor(c + 0.5), last));
+            sample.i1 = sample.i0;
+            sample.weight = 0;
+        } else {
+            const double base = std::floor(c);
+            sample.i0 = static_cast<uint32_t>(base);
+            sample.i1 = std::min(sample.i0 + 1, extent - 1);
+            sample.weight = static_cast<uint32_t>(std::lround((c - base) * 256.0));
+            if (sample.weight == 256) {
+                sample.i0 = sample.i1;
+                sample.weight = 0;
+            }
+        }
+        sample.i0 += offset;
+        sample.i1 += offset;
+    }
+}
+
+/**
+ * @brief 把源图 [x0, x1) × [y0, y1) 转换为紧密排列的 RGBA
+ */
+void ConvertRegion(const PipelineContext& ctx, uint32_t x0, uint32_t x1, uint32_t y0, uint32_t y1,
+                   uint8_t* scratch) {
+    const ImageDataDesc& src = *ctx.src;
+    const uint32_t width = x1 - x0;
+    const size_t stride0 = GetPlaneStride(src, ctx.layout, 0);
+    const uint8_t* plane0 = static_cast<const uint8_t*>(src.planes[0].data);
+
+    // 色度平面按向下取整的尺寸存储：奇数宽/高时边缘的列/行沿用最后一个色度样本
+    const uint32_t chromaLastX = (src.width >> 1) - 1;
+    const uint32_t chromaLastY = (src.height >> 1) - 1;
+
+    for (uint32_t y = y0; y < y1; ++y) {
+        uint8_t* out = scratch + static_cast<size_t>(y - y0) * width * 4;
+        const uint8_t* row = plane0 + stride0 * y;
+
+        switch (src.format) {
+            case ImageFormat::RGBA8:
+                std::memcpy(out, row + static_cast<size_t>(x0) * 4, static_cast<size_t>(width) * 4);
+                break;
+            case ImageFormat::BGRA8:
+                for (uint32_t x = x0; x < x1; ++x, out += 4) {
+                    const uint8_t* p = row + static_cast<size_t>(x) * 4;
+                    out[0] = p[2];
+                    out[1] = p[1];
+                    out[2] = p[0];
+                    out[3] = p[3];
+                }
+                break;
+            case ImageFormat::RGB8:
+                for (uint32_t x = x0; x < x1; ++x, out += 4) {
+                    const uint8_t* p = row + static_cast<size_t>(x) * 3;
+                    out[0] = p[0];
+                    out[1] = p[1];
+                    out[2] = p[2];
+                    out[3] = 255;
+                }
+                break;
+            case ImageFormat::GRAY8:
+                for (uint32_t x = x0; x < x1; ++x, out += 4) {
+                    out[0] = out[1] = out[2] = row[x];
+                    out[3] = 255;
+                }
+                break;
+            case ImageFormat::NV12:
+            case ImageFormat::NV21: {
+                const uint8_t* chroma = static_cast<const uint8_t*>(src.planes[1].data) +
+                                        GetPlaneStride(src, ctx.layout, 1) * std::min(y >> 1, chromaLastY);
+                const int uIndex = src.format == ImageFormat::NV12 ? 0 : 1;
+                for (uint32_t x = x0; x < x1; ++x, out += 4) {
+                    const uint8_t* uv = chroma + std::min(x >> 1, chromaLastX) * 2;
+                    YUVToRGBPixel(ctx.yuv, row[x], uv[uIndex], uv[1 - uIndex], out);
+                    out[3] = 255;
+                }
+                break;
+            }
+            case ImageFormat::YUV420P: {
+                const uint32_t cy = std::min(y >> 1, chromaLastY);
+                const uint8_t* uRow = static_cast<const uint8_t*>(src.planes[1].data) +
+                                      GetPlaneStride(src, ctx.layout, 1) * cy;
+                const uint8_t* vRow = static_cast<const uint8_t*>(src.planes[2].data) +
+                                      GetPlaneStride(src, ctx.layout, 2) * cy;
+                for (uint32_t x = x0; x < x1; ++x, out += 4) {
+                    const uint32_t cx = std::min(x >> 1, chromaLastX);
+                    YUVToRGBPixel(ctx.yuv, row[x], uRow[cx], vRow[cx], out);
+                    out[3] = 255;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief 套用曲线与 3D LUT 后按目标格式写出一行 RGBA
+ */
+void StoreRow(const PipelineContext& ctx, uint8_t* rgba, uint32_t count, uint8_t* out) {
+    if (ctx.curves) {
+        for (uint32_t x = 0; x < count; ++x) {
+            uint8_t* p = rgba + static_cast<size_t>(x) * 4;
+            p[0] = ctx.curves[p[0]];
+            p[1] = ctx.curves[256 + p[1]];
+            p[2] = ctx.curves[512 + p[2]];
+        }
+    }
+    if (ctx.lut) {
+        ApplyColorLut3DToRGBA(*ctx.lut, rgba, count);
+    }
+
+    if (ctx.dstBytesPerPixel == 4 && !ctx.dstBGRA) {
+        std::memcpy(out, rgba, static_cast<size_t>(count) * 4);
+        return;
+    }
+    for (uint32_t x = 0; x < count; ++x, rgba += 4, out += ctx.dstBytesPerPixel) {
+        out[0] = ctx.dstBGRA ? rgba[2] : rgba[0];
+        out[1] = rgba[1];
+        out[2] = ctx.dstBGRA ? rgba[0] : rgba[2];
+        if (ctx.dstBytesPerPixel == 4) {
+            out[3] = rgba[3];
+        }
+    }
+}
+
+/**
+ * @brief 每线程暂存
+ */
+struct TileScratch {
+    std::vector<uint8_t> source;    ///< 本块覆盖的源区域（RGBA）
+    std::vector<uint8_t> row;       ///< 重采样后的一行输出（RGBA）
+};
+
+void ProcessTile(const PipelineContext& ctx, uint32_t tileIndex, TileScratch& scratch) {
+    const ImageDataDesc& dst = *ctx.dst;
+    const uint32_t ox0 = (tileIndex % ctx.tileColumns) * ctx.tileSize;
+    const uint32_t oy0 = (tileIndex / ctx.tileColumns) * ctx.tileSize;
+    const uint32_t ox1 = std::min(dst.width, ox0 + ctx.tileSize);
+    const uint32_t oy1 = std::min(dst.height, oy0 + ctx.tileSize);
+
+    // 本块覆盖的源区域（映射单调，端点即可，但反向时端点互换，统一取最值）
+    auto range = [](const std::vector<AxisSample>& axis, uint32_t begin, uint32_t end, uint32_t& lo,
+                    uint32_t& hi) {
+        const AxisSample& a = axis[begin];
+        const AxisSample& b = axis[end - 1];
+        lo = std::min(std::min(a.i0, a.i1), std::min(b.i0, b.i1));
+        hi = std::max(std::max(a.i0, a.i1), std::max(b.i0, b.i1)) + 1;
+    };
+    uint32_t colLo, colHi, rowLo, rowHi;
+    range(ctx.columns, ox0, ox1, colLo, colHi);
+    range(ctx.rows, oy0, oy1, rowLo, rowHi);
+    const uint32_t sx0 = ctx.swapAxes ? rowLo : colLo;
+    const uint32_t sx1 = ctx.swapAxes ? rowHi : colHi;
+    const uint32_t sy0 = ctx.swapAxes ? colLo : rowLo;
+    const uint32_t sy1 = ctx.swapAxes ? colHi : rowHi;
+
+    const size_t scratchStride = static_cast<size_t>(sx1 - sx0) * 4;
+    scratch.source.resize(scratchStride * (sy1 - sy0));
+    scratch.row.resize(static_cast<size_t>(ox1 - ox0) * 4);
+    ConvertRegion(ctx, sx0, sx1, sy0, sy1, scratch.source.data());
+    const uint8_t* source = scratch.source.data();
+
+    const size_t dstStride =
+        dst.planes[0].stride ? dst.planes[0].stride : static_cast<size_t>(dst.width) * ctx.dstBytesPerPixel;
+    uint8_t* dstBase = static_cast<uint8_t*>(const_cast<void*>(dst.planes[0].data));
+
+    for (uint32_t oy = oy0; oy < oy1; ++oy) {
+        const AxisSample& rowSample = ctx.rows[oy];
+        uint8_t* pixel = scratch.row.data();
+
+        for (uint32_t ox = ox0; ox < ox1; ++ox, pixel += 4) {
+            const AxisSample& colSample = ctx.columns[ox];
+            const AxisSample& xs = ctx.swapAxes ? rowSample : colSample;
+            const AxisSample& ys = ctx.swapAxes ? colSample : rowSample;
+
+            const uint8_t* r0 = source + scratchStride * (ys.i0 - sy0);
+            const uint8_t* p00 = r0 + static_cast<size_t>(xs.i0 - sx0) * 4;
+            if (ctx.nearest) {
+                std::memcpy(pixel, p00, 4);
+                continue;
+            }
+
+            const uint8_t* r1 = source + scratchStride * (ys.i1 - sy0);
+            const uint8_t* p01 = r0 + static_cast<size_t>(xs.i1 - sx0) * 4;
+            const uint8_t* p10 = r1 + static_cast<size_t>(xs.i0 - sx0) * 4;
+            const uint8_t* p11 = r1 + static_cast<size_t>(xs.i1 - sx0) * 4;
+            const uint32_t wx = xs.weight;
+            const uint32_t wy = ys.weight;
+
+            for (int c = 0; c < 4; ++c) {
+                const uint32_t top = p00[c] * (256 - wx) + p01[c] * wx;
+                const uint32_t bottom = p10[c] * (256 - wx) + p11[c] * wx;
+                pixel[c] = static_cast<uint8_t>((top * (256 - wy) + bottom * wy + 32768) >> 16);
+            }
+        }
+
+        StoreRow(ctx, scratch.row.data(), ox1 - ox0,
+                 dstBase + dstStride * oy + static_cast<size_t>(ox0) * ctx.dstBytesPerPixel);
+    }
+}
+
+} // namespace
+
+bool IsImagePipelineSupported(ImageFormat srcFormat, ImageFormat dstFormat) {
+    switch (srcFormat) {
+        case ImageFormat::YUV420P:
+        case ImageFormat::NV12:
+        case ImageFormat::NV21:
+        case ImageFormat::RGBA8:
+        case ImageFormat::BGRA8:
+        case ImageFormat::RGB8:
+        case ImageFormat::GRAY8:
+            break;
+        default:
+            return false;
+    }
+    return dstFormat == ImageFormat::RGBA8 || dstFormat == ImageFormat::BGRA8 || dstFormat == ImageFormat::RGB8;
+}
+
+bool RunImagePipeline(const ImageDataDesc& src, const ImageDataDesc& dst, const ImagePipelineOptions& options) {
+    PipelineContext ctx;
+    if (!IsImagePipelineSupported(src.format, dst.format) || !GetImagePlaneLayout(src.format, ctx.layout) ||
+        !HasPlaneData(src, ctx.layout) || dst.width == 0 || dst.height == 0 || dst.planes.empty() ||
+        !dst.planes[0].data) {
+        return false;
+    }
+    // 4:2:0 源至少需要一个色度样本
+    if (ctx.layout.chromaSubsampled && (src.width < 2 || src.height < 2)) {
+        return false;
+    }
+
+    const uint32_t cropWidth = options.cropWidth ? options.cropWidth : src.width - std::min(options.cropX, src.width);
+    const uint32_t cropHeight =
+        options.cropHeight ? options.cropHeight : src.height - std::min(options.cropY, src.height);
+    if (cropWidth == 0 || cropHeight == 0 || options.cropX + cropWidth > src.width ||
+        options.cropY + cropHeight > src.height) {
+        return false;
+    }
+
+    ctx.src = &src;
+    ctx.dst = &dst;
+    ctx.yuv = MakeYUVToRGBMatrix(src.colorSpace, src.range);
+    ctx.nearest = options.filter == ResampleFilter::Nearest;
+    ctx.curves = options.curves;
+    ctx.lut = options.lut;
+    ctx.dstBytesPerPixel = dst.format == ImageFormat::RGB8 ? 3 : 4;
+    ctx.dstBGRA = dst.format == ImageFormat::BGRA8;
+    ctx.tileSize = std::max(options.tileSize, 8u);
+    ctx.tileColumns = (dst.width + ctx.tileSize - 1) / ctx.tileSize;
+
+    // 旋转后输出 x 沿哪条源轴、方向是否相反
+    const uint32_t x = options.cropX;
+    const uint32_t y = options.cropY;
+    switch (options.rotation) {
+        case ImageRotation::Rotate90:
+            ctx.swapAxes = true;
+            BuildAxis(dst.width, cropHeight, true, y, ctx.nearest, ctx.columns);
+            BuildAxis(dst.height, cropWidth, false, x, ctx.nearest, ctx.rows);
+            break;
+        case ImageRotation::Rotate180:
+            ctx.swapAxes = false;
+            BuildAxis(dst.width, cropWidth, true, x, ctx.nearest, ctx.columns);
+            BuildAxis(dst.height, cropHeight, true, y, ctx.nearest, ctx.rows);
+            break;
+        case ImageRotation::Rotate270:
+            ctx.swapAxes = true;
+            BuildAxis(dst.width, cropHeight, false, y, ctx.nearest, ctx.columns);
+            BuildAxis(dst.height, cropWidth, true, x, ctx.nearest, ctx.rows);
+            break;
+        default:
+            ctx.swapAxes = false;
+            BuildAxis(dst.width, cropWidth, false, x, ctx.nearest, ctx.columns);
+            BuildAxis(dst.height, cropHeight, false, y, ctx.nearest, ctx.rows);
+            break;
+    }
+
+    const uint32_t tileRows = (dst.height + ctx.tileSize - 1) / ctx.tileSize;
+    ParallelFor(
+        ctx.tileColumns * tileRows,
+        [&ctx](uint32_t tile) {
+            thread_local TileScratch scratch;
+            ProcessTile(ctx, tile, scratch);
+        },
+        options.maxThreads);
+    return true;
+}
+
+bool RunImagePipeline(const ImageDataDesc& src, ImageBuffer* dst, const ImagePipelineOptions& options) {
+    if (!dst || !dst->Lock(false)) {
+        return false;
+    }
+    const bool result = RunImagePipeline(src, dst->GetImageDesc(), options);
+    dst->Unlock();
+    return result;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,549 @@
+/**
+ * @file ImageStatistics.cpp
+ * @brief 图像统计实现
+ */
+
+#include "lrengine/utils/ImageStatistics.h"
+#include "lrengine/utils/ImageConvert.h"
+#include "SimdConfig.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+// BT.709 亮度权重（8 位定点，和为 256）
+constexpr uint8_t kLumaWeightR = 54;
+constexpr uint8_t kLumaWeightG = 183;
+constexpr uint8_t kLumaWeightB = 19;
+
+/**
+ * @brief 单通道累加器（直方图使用 4 张子表以减少相邻样本写冲突）
+ */
+struct SampleAccumulator {
+    uint32_t histogram[4][256] = {};
+    uint64_t sum = 0;
+    uint64_t count = 0;
+    uint8_t minValue = 255;
+    uint8_t maxValue = 0;
+};
+
+/**
+ * @brief 四通道交织像素累加器
+ */
+struct QuadAccumulator {
+    uint64_t sum[4] = {};
+    uint64_t count = 0;
+    uint8_t minValue[4] = {255, 255, 255, 255};
+    uint8_t maxValue[4] = {};
+};
+
+inline uint8_t ScalarLuma(const uint8_t* p, const uint8_t* weights) {
+    return static_cast<uint8_t>((p[0] * weights[0] + p[1] * weights[1] + p[2] * weights[2] + 128) >> 8);
+}
+
+// 单通道样本的最小/最大/求和及直方图
+void AccumulateSamples(const uint8_t* src, size_t count, SampleAccumulator& acc, bool histogram) {
+    size_t i = 0;
+    uint8_t minValue = acc.minValue;
+    uint8_t maxValue = acc.maxValue;
+    uint64_t sum = 0;
+
+#if defined(LR_SIMD_SSE2)
+    if (count >= 16) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i vmin = _mm_set1_epi8(-1);
+        __m128i vmax = zero;
+        __m128i vsum = zero;
+        for (; i + 16 <= count; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            vmin = _mm_min_epu8(vmin, v);
+            vmax = _mm_max_epu8(vmax, v);
+            vsum = _mm_add_epi64(vsum, _mm_sad_epu8(v, zero));
+        }
+        uint8_t mins[16];
+        uint8_t maxs[16];
+        uint64_t sums[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mins), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(maxs), vmax);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(sums), vsum);
+        for (int lane = 0; lane < 16; ++lane) {
+            minValue = std::min(minValue, mins[lane]);
+            maxValue = std::max(maxValue, maxs[lane]);
+        }
+        sum += sums[0] + sums[1];
+    }
+#elif defined(LR_SIMD_NEON)
+    if (count >= 16) {
+        uint8x16_t vmin = vdupq_n_u8(255);
+        uint8x16_t vmax = vdupq_n_u8(0);
+        uint32x4_t vsum = vdupq_n_u32(0);
+        for (; i + 16 <= count; i += 16) {
+            const uint8x16_t v = vld1q_u8(src + i);
+            vmin = vminq_u8(vmin, v);
+            vmax = vmaxq_u8(vmax, v);
+            vsum = vpadalq_u16(vsum, vpaddlq_u8(v));
+        }
+        uint8_t mins[16];
+        uint8_t maxs[16];
+        uint32_t sums[4];
+        vst1q_u8(mins, vmin);
+        vst1q_u8(maxs, vmax);
+        vst1q_u32(sums, vsum);
+        for (int lane = 0; lane < 16; ++lane) {
+            minValue = std::min(minValue, mins[lane]);
+            maxValue = std::max(maxValue, maxs[lane]);
+        }
+        sum += static_cast<uint64_t>(sums[0]) + sums[1] + sums[2] + sums[3];
+    }
+#endif
+
+    for (; i < count; ++i) {
+        minValue = std::min(minValue, src[i]);
+        maxValue = std::max(maxValue, src[i]);
+        sum += src[i];
+    }
+
+    if (histogram) {
+        size_t j = 0;
+        for (; j + 4 <= count; j += 4) {
+            ++acc.histogram[0][src[j]];
+            ++acc.histogram[1][src[j + 1]];
+            ++acc.histogram[2][src[j + 2]];
+            ++acc.histogram[3][src[j + 3]];
+        }
+        for (; j < count; ++j) {
+            ++acc.histogram[0][src[j]];
+        }
+    }
+
+    acc.minValue = minValue;
+    acc.maxValue = maxValue;
+    acc.sum += sum;
+    acc.count += count;
+}
+
+// 四通道交织像素（RGBA8/BGRA8）的逐通道最小/最大/求和
+void AccumulateQuads(const uint8_t* src, size_t pixelCount, QuadAccumulator& acc) {
+    size_t i = 0;
+    uint64_t sum[4] = {};
+
+#if defined(LR_SIMD_SSE2)
+    if (pixelCount >= 4) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i vmin = _mm_set1_epi8(-1);
+        __m128i vmax = zero;
+        __m128i sumEven = zero;  // 32 位通道 0-3：偶数像素的 4 个通道
+        __m128i sumOdd = zero;   // 32 位通道 0-3：奇数像素的 4 个通道
+        while (i + 4 <= pixelCount) {
+            // 16 位累加每次最多 +510，128 次迭代后转存到 32 位
+            const size_t blockEnd = std::min(pixelCount, i + 4 * 128);
+            __m128i sum16 = zero;
+            for (; i + 4 <= blockEnd; i += 4) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+                vmin = _mm_min_epu8(vmin, v);
+                vmax = _mm_max_epu8(vmax, v);
+                sum16 = _mm_add_epi16(sum16, _mm_add_epi16(_mm_unpacklo_epi8(v, zero),
+                                                           _mm_unpackhi_epi8(v, zero)));
+            }
+            sumEven = _mm_add_epi32(sumEven, _mm_unpacklo_epi16(sum16, zero));
+            sumOdd = _mm_add_epi32(sumOdd, _mm_unpackhi_epi16(sum16, zero));
+        }
+        uint8_t mins[16];
+        uint8_t maxs[16];
+        uint32_t evens[4];
+        uint32_t odds[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mins), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(maxs), vmax);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(evens), sumEven);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(odds), sumOdd);
+        for (int c = 0; c < 4; ++c) {
+            for (int lane = c; lane < 16; lane += 4) {
+                acc.minValue[c] = std::min(acc.minValue[c], mins[lane]);
+                acc.maxValue[c] = std::max(acc.maxValue[c], maxs[lane]);
+            }
+            sum[c] += static_cast<uint64_t>(evens[c]) + odds[c];
+        }
+    }
+#elif defined(LR_SIMD_NEON)
+    if (pixelCount >= 8) {
+        uint8x8_t vmin[4];
+        uint8x8_t vmax[4];
+        uint32x4_t vsum[4];
+        for (int c = 0; c < 4; ++c) {
+            vmin[c] = vdup_n_u8(255);
+            vmax[c] = vdup_n_u8(0);
+            vsum[c] = vdupq_n_u32(0);
+        }
+        while (i + 8 <= pixelCount) {
+            // 16 位累加每次最多 +255，256 次迭代后转存到 32 位
+            const size_t blockEnd = std::min(pixelCount, i + 8 * 256);
+            uint16x8_t sum16[4] = {vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0)};
+            for (; i + 8 <= blockEnd; i += 8) {
+                const uint8x8x4_t px = vld4_u8(src + i * 4);
+                for (int c = 0; c < 4; ++c) {
+                    vmin[c] = vmin_u8(vmin[c], px.val[c]);
+                    vmax[c] = vmax_u8(vmax[c], px.val[c]);
+                    sum16[c] = vaddw_u8(sum16[c], px.val[c]);
+                }
+            }
+            for (int c = 0; c < 4; ++c) {
+                vsum[c] = vpadalq_u16(vsum[c], sum16[c]);
+            }
+        }
+        for (int c = 0; c < 4; ++c) {
+            uint8_t mins[8];
+            uint8_t maxs[8];
+            uint32_t sums[4];
+            vst1_u8(mins, vmin[c]);
+            vst1_u8(maxs, vmax[c]);
+            vst1q_u32(sums, vsum[c]);
+            for (int lane = 0; lane < 8; ++lane) {
+                acc.minValue[c] = std::min(acc.minValue[c], mins[lane]);
+                acc.maxValue[c] = std::max(acc.maxValue[c], maxs[lane]);
+            }
+            sum[c] += static_cast<uint64_t>(sums[0]) + sums[1] + sums[2] + sums[3];
+        }
+    }
+#endif
+
+    for (; i < pixelCount; ++i) {
+        const uint8_t* p = src + i * 4;
+        for (int c = 0; c < 4; ++c) {
+            acc.minValue[c] = std::min(acc.minValue[c], p[c]);
+            acc.maxValue[c] = std::max(acc.maxValue[c], p[c]);
+            sum[c] += p[c];
+        }
+    }
+
+    for (int c = 0; c < 4; ++c) {
+        acc.sum[c] += sum[c];
+    }
+    acc.count += pixelCount;
+}
+
+// 四通道交织像素计算 8 位亮度，weights 按内存中前三个通道的顺序给出
+void ComputeLumaRow(const uint8_t* src, uint8_t* dst, size_t pixelCount, const uint8_t* weights) {
+    size_t i = 0;
+
+#if defined(LR_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i w = _mm_setr_epi16(weights[0], weights[1], weights[2], 0,
+                                     weights[0], weights[1], weights[2], 0);
+    const __m128i round = _mm_set1_epi32(128);
+    for (; i + 4 <= pixelCount; i += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        // 每个像素得到两个部分和 (w0*c0 + w1*c1, w2*c2)，相邻相加后位于偶数通道
+        __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi8(v, zero), w);
+        __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi8(v, zero), w);
+        lo = _mm_add_epi32(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+        hi = _mm_add_epi32(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1)));
+        __m128i luma = _mm_unpacklo_epi64(_mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0)),
+                                          _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0)));
+        luma = _mm_srli_epi32(_mm_add_epi32(luma, round), 8);
+        luma = _mm_packs_epi32(luma, luma);
+        luma = _mm_packus_epi16(luma, luma);
+        const int32_t packed = _mm_cvtsi128_si32(luma);
+        std::memcpy(dst + i, &packed, sizeof(packed));
+    }
+#elif defined(LR_SIMD_NEON)
+    const uint8x8_t w0 = vdup_n_u8(weights[0]);
+    const uint8x8_t w1 = vdup_n_u8(weights[1]);
+    const uint8x8_t w2 = vdup_n_u8(weights[2]);
+    for (; i + 8 <= pixelCount; i += 8) {
+        const uint8x8x4_t px = vld4_u8(src + i * 4);
+        uint16x8_t acc = vmull_u8(px.val[0], w0);
+        acc = vmlal_u8(acc, px.val[1], w1);
+        acc = vmlal_u8(acc, px.val[2], w2);
+        vst1_u8(dst + i, vrshrn_n_u16(acc, 8));
+    }
+#endif
+
+    for (; i < pixelCount; ++i) {
+        dst[i] = ScalarLuma(src + i * 4, weights);
+    }
+}
+
+// 计算平面第 y 行的起始地址
+inline const uint8_t* PlaneRow(const ImageDataDesc& image, size_t plane, uint32_t y, size_t rowBytes) {
+    const uint8_t* base = static_cast<const uint8_t*>(image.planes[plane].data);
+    const size_t stride = image.planes[plane].stride ? image.planes[plane].stride : rowBytes;
+    return base + stride * y;
+}
+
+inline uint32_t GridCount(uint32_t size, uint32_t step) {
+    return (size + step - 1) / step;
+}
+
+template <typename T>
+void GatherSamples(const T* row, uint32_t count, uint32_t step, T* dst) {
+    for (uint32_t i = 0; i < count; ++i) {
+        dst[i] = row[static_cast<size_t>(i) * step];
+    }
+}
+
+inline float Normalized(uint64_t sum, uint64_t count) {
+    return count ? static_cast<float>(static_cast<double>(sum) / (static_cast<double>(count) * 255.0)) : 0.0f;
+}
+
+void FinalizeLuma(const SampleAccumulator& luma, ImageStatistics& out) {
+    for (int bin = 0; bin < 256; ++bin) {
+        out.lumaHistogram[bin] = luma.histogram[0][bin] + luma.histogram[1][bin] +
+                                 luma.histogram[2][bin] + luma.histogram[3][bin];
+    }
+    out.sampleCount = static_cast<uint32_t>(luma.count);
+    out.meanLuma = Normalized(luma.sum, luma.count);
+}
+
+void FinalizeWhiteBalance(ImageStatistics& out) {
+    constexpr float kEpsilon = 1.0f / 1024.0f;
+    const float green = out.meanRGB[1];
+    out.whiteBalanceGains[0] = out.meanRGB[0] > kEpsilon ? green / out.meanRGB[0] : 1.0f;
+    out.whiteBalanceGains[1] = 1.0f;
+    out.whiteBalanceGains[2] = out.meanRGB[2] > kEpsilon ? green / out.meanRGB[2] : 1.0f;
+}
+
+// 平均 YUV 换算为 RGB
+void YUVToRGB(float y, float u, float v, ColorSpace colorSpace, ColorRange range, float* rgb) {
+    float cb = u - 128.0f / 255.0f;
+    float cr = v - 128.0f / 255.0f;
+    if (range != ColorRange::Full) {
+        y = (y - 16.0f / 255.0f) * (255.0f / 219.0f);
+        cb *= 255.0f / 224.0f;
+        cr *= 255.0f / 224.0f;
+    }
+
+    float kr = 1.5748f, kgb = 0.187324f, kgr = 0.468124f, kb = 1.8556f;
+    if (colorSpace == ColorSpace::BT601) {
+        kr = 1.402f; kgb = 0.344136f; kgr = 0.714136f; kb = 1.772f;
+    } else if (colorSpace == ColorSpace::BT2020) {
+        kr = 1.4746f; kgb = 0.164553f; kgr = 0.571353f; kb = 1.8814f;
+    }
+
+    rgb[0] = std::min(1.0f, std::max(0.0f, y + kr * cr));
+    rgb[1] = std::min(1.0f, std::max(0.0f, y - kgb * cb - kgr * cr));
+    rgb[2] = std::min(1.0f, std::max(0.0f, y + kb * cb));
+}
+
+bool ComputeYUVStatistics(const ImageDataDesc& image, uint32_t step, bool histogram, ImageStatistics& out) {
+    const bool wide = image.format == ImageFormat::P010 || image.format == ImageFormat::P016;
+    const bool planar = image.format == ImageFormat::YUV420P;
+    const size_t planeCount = image.format == ImageFormat::GRAY8 ? 1 : (planar ? 3 : 2);
+    if (image.planes.size() < planeCount) {
+        return false;
+    }
+    for (size_t plane = 0; plane < planeCount; ++plane) {
+        if (!image.planes[plane].data) {
+            return false;
+        }
+    }
+
+    const size_t bytesPerSample = wide ? 2 : 1;
+    const uint32_t lumaCount = GridCount(image.width, step);
+    std::vector<uint8_t> samples8(lumaCount * 2);
+    std::vector<uint16_t> samples16(wide ? lumaCount * 2 : 0);
+
+    SampleAccumulator luma;
+    for (uint32_t y = 0; y < image.height; y += step) {
+        const uint8_t* row = PlaneRow(image, 0, y, image.width * bytesPerSample);
+        const uint8_t* values = row;
+        if (wide) {
+            const uint16_t* row16 = reinterpret_cast<const uint16_t*>(row);
+            if (step > 1) {
+                GatherSamples(row16, lumaCount, step, samples16.data());
+                row16 = samples16.data();
+            }
+            ConvertU16ToU8(row16, samples8.data(), lumaCount);
+            values = samples8.data();
+        } else if (step > 1) {
+            GatherSamples(row, lumaCount, step, samples8.data());
+            values = samples8.data();
+        }
+        AccumulateSamples(values, lumaCount, luma, histogram);
+    }
+
+    FinalizeLuma(luma, out);
+    out.channelMin[0] = luma.minValue / 255.0f;
+    out.channelMax[0] = luma.maxValue / 255.0f;
+    out.channelMean[0] = out.meanLuma;
+
+    const uint32_t chromaWidth = image.width / 2;
+    const uint32_t chromaHeight = image.height / 2;
+    if (image.format == ImageFormat::GRAY8 || chromaWidth == 0 || chromaHeight == 0) {
+        out.meanRGB[0] = out.meanRGB[1] = out.meanRGB[2] = out.meanLuma;
+        FinalizeWhiteBalance(out);
+        return true;
+    }
+
+    // 色度在自身分辨率上按相同步长采样，交织平面先拆分为 U / V 两行
+    const uint32_t chromaCount = GridCount(chromaWidth, step);
+    std::vector<uint8_t> uRow(chromaCount);
+    std::vector<uint8_t> vRow(chromaCount);
+    const bool swapUV = image.format == ImageFormat::NV21;
+    SampleAccumulator chroma[2];
+
+    for (uint32_t y = 0; y < chromaHeight; y += step) {
+        if (planar) {
+            GatherSamples(PlaneRow(image, 1, y, chromaWidth), chromaCount, step, uRow.data());
+            GatherSamples(PlaneRow(image, 2, y, chromaWidth), chromaCount, step, vRow.data());
+        } else {
+            const uint8_t* row = PlaneRow(image, 1, y, chromaWidth * 2 * bytesPerSample);
+            const uint8_t* pairs = row;
+            if (wide) {
+                const uint16_t* row16 = reinterpret_cast<const uint16_t*>(row);
+                for (uint32_t i = 0; i < chromaCount; ++i) {
+                    samples16[i * 2] = row16[static_cast<size_t>(i) * step * 2];
+                    samples16[i * 2 + 1] = row16[static_cast<size_t>(i) * step * 2 + 1];
+                }
+                ConvertU16ToU8(samples16.data(), samples8.data(), chromaCount * 2);
+                pairs = samples8.data();
+                for (uint32_t i = 0; i < chromaCount; ++i) {
+                    uRow[i] = pairs[i * 2];
+                    vRow[i] = pairs[i * 2 + 1];
+                }
+            } else {
+                for (uint32_t i = 0; i < chromaCount; ++i) {
+                    uRow[i] = pairs[static_cast<size_t>(i) * step * 2];
+                    vRow[i] = pairs[static_cast<size_t>(i) * step * 2 + 1];
+                }
+            }
+            if (swapUV) {
+                uRow.swap(vRow);
+            }
+        }
+        AccumulateSamples(uRow.data(), chromaCount, chroma[0], false);
+        AccumulateSamples(vRow.data(), chromaCount, chroma[1], false);
+    }
+
+    for (int c = 0; c < 2; ++c) {
+        out.channelMin[c + 1] = chroma[c].minValue / 255.0f;
+        out.channelMax[c + 1] = chroma[c].maxValue / 255.0f;
+        out.channelMean[c + 1] = Normalized(chroma[c].sum, chroma[c].count);
+    }
+    YUVToRGB(out.channelMean[0], out.channelMean[1], out.channelMean[2],
+             image.colorSpace, image.range, out.meanRGB);
+    FinalizeWhiteBalance(out);
+    return true;
+}
+
+bool ComputeRGBStatistics(const ImageDataDesc& image, uint32_t step, bool histogram, ImageStatistics& out) {
+    if (image.planes.empty() || !image.planes[0].data) {
+        return false;
+    }
+
+    const bool bgra = image.format == ImageFormat::BGRA8;
+    const size_t bytesPerPixel = image.format == ImageFormat::RGB8 ? 3 : 4;
+    const uint8_t rgbWeights[3] = {kLumaWeightR, kLumaWeightG, kLumaWeightB};
+    const uint8_t bgrWeights[3] = {kLumaWeightB, kLumaWeightG, kLumaWeightR};
+    const uint8_t* weights = bgra ? bgrWeights : rgbWeights;
+
+    const uint32_t count = GridCount(image.width, step);
+    std::vector<uint8_t> pixels(static_cast<size_t>(count) * 4);
+    std::vector<uint32_t> packed(image.format == ImageFormat::RGB10A2 ? count : 0);
+    std::vector<uint8_t> lumaRow(count);
+
+    QuadAccumulator quads;
+    SampleAccumulator luma;
+    for (uint32_t y = 0; y < image.height; y += step) {
+        const uint8_t* row = PlaneRow(image, 0, y, image.width * bytesPerPixel);
+        const uint8_t* values = pixels.data();
+        if (image.format == ImageFormat::RGB8) {
+            for (uint32_t i = 0; i < count; ++i) {
+                const uint8_t* p = row + static_cast<size_t>(i) * step * 3;
+                pixels[i * 4] = p[0];
+                pixels[i * 4 + 1] = p[1];
+                pixels[i * 4 + 2] = p[2];
+                pixels[i * 4 + 3] = 255;
+            }
+        } else if (image.format == ImageFormat::RGB10A2) {
+            const uint32_t* row32 = reinterpret_cast<const uint32_t*>(row);
+            if (step > 1) {
+                GatherSamples(row32, count, step, packed.data());
+                row32 = packed.data();
+            }
+            ConvertRGB10A2ToRGBA8(row32, pixels.data(), count);
+        } else if (step > 1) {
+            GatherSamples(reinterpret_cast<const uint32_t*>(row), count, step,
+                          reinterpret_cast<uint32_t*>(pixels.data()));
+        } else {
+            values = row;
+        }
+
+        AccumulateQuads(values, count, quads);
+        ComputeLumaRow(values, lumaRow.data(), count, weights);
+        AccumulateSamples(lumaRow.data(), count, luma, histogram);
+    }
+
+    FinalizeLuma(luma, out);
+    static const int kRGBAOrder[4] = {0, 1, 2, 3};
+    static const int kBGRAOrder[4] = {2, 1, 0, 3};
+    const int* order = bgra ? kBGRAOrder : kRGBAOrder;
+    for (int c = 0; c < 4; ++c) {
+        const int src = order[c];
+        out.channelMin[c] = quads.minValue[src] / 255.0f;
+        out.channelMax[c] = quads.maxValue[src] / 255.0f;
+        out.channelMean[c] = Normalized(quads.sum[src], quads.count);
+    }
+    out.meanRGB[0] = out.channelMean[0];
+    out.meanRGB[1] = out.channelMean[1];
+    out.meanRGB[2] = out.channelMean[2];
+    FinalizeWhiteBalance(out);
+    return true;
+}
+
+} // namespace
+
+bool ComputeImageStatistics(const ImageDataDesc& image, ImageStatistics& out,
+                            const ImageStatisticsOptions& options) {
+    out = ImageStatistics();
+    if (image.width == 0 || image.height == 0) {
+        return false;
+    }
+
+    const uint32_t step = std::max(1u, options.gridStep);
+    switch (image.format) {
+        case ImageFormat::GRAY8:
+        case ImageFormat::NV12:
+        case ImageFormat::NV21:
+        case ImageFormat::YUV420P:
+        case ImageFormat::P010:
+        case ImageFormat::P016:
+            return ComputeYUVStatistics(image, step, options.computeHistogram, out);
+        case ImageFormat::RGBA8:
+        case ImageFormat::BGRA8:
+        case ImageFormat::RGB8:
+        case ImageFormat::RGB10A2:
+            return ComputeRGBStatistics(image, step, options.computeHistogram, out);
+        default:
+            return false;
+    }
+}
+
+float GetLumaPercentile(const ImageStatistics& stats, float percentile) {
+    uint64_t total = 0;
+    for (uint32_t bin = 0; bin < 256; ++bin) {
+        total += stats.lumaHistogram[bin];
+    }
+    if (total == 0) {
+        return 0.0f;
+    }
+
+    const float p = std::min(1.0f, std::max(0.0f, percentile));
+    const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p * total)));
+    uint64_t cumulative = 0;
+    for (uint32_t bin = 0; bin < 256; ++bin) {
+        cumulative += stats.lumaHistogram[bin];
+        if (cumulative >= target) {
+            return bin / 255.0f;
+        }
+    }
+    return 1.0f;
+}
+
+} // namespace utils
+} // namespace lrengine
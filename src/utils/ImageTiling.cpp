@@ -0,0 +1,138 @@
+/**
+ * @file ImageTiling.cpp
+ * @brief 大图分块实现
+ */
+
+#include "lrengine/utils/ImageTiling.h"
+#include "ImageLayout.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+// 单平面格式的每像素字节数，不支持时返回 0
+uint32_t GetTileBytesPerPixel(ImageFormat format) {
+    ImagePlaneLayout layout;
+    if (!GetImagePlaneLayout(format, layout) || layout.count != 1) {
+        return 0;
+    }
+    return layout.bytesPerPixel[0];
+}
+
+// 把一维范围切成尽量均匀的段，返回段长
+uint32_t SplitExtent(uint32_t extent, uint32_t maxSegment, uint32_t& count) {
+    count = (extent + maxSegment - 1) / maxSegment;
+    const uint32_t segment = (extent + count - 1) / count;
+    count = (extent + segment - 1) / segment;
+    return segment;
+}
+
+// 以 pixel 为单位重复填充
+void FillPixels(uint8_t* dst, const uint8_t* pixel, uint32_t count, uint32_t bytesPerPixel) {
+    for (uint32_t i = 0; i < count; ++i) {
+        std::memcpy(dst + static_cast<size_t>(i) * bytesPerPixel, pixel, bytesPerPixel);
+    }
+}
+
+} // namespace
+
+bool ComputeImageTiles(uint32_t width, uint32_t height, uint32_t maxTileSize, uint32_t guardBand,
+                       ImageTileGrid& out) {
+    out = ImageTileGrid();
+    if (width == 0 || height == 0 || maxTileSize <= guardBand * 2) {
+        return false;
+    }
+
+    const uint32_t maxCore = maxTileSize - guardBand * 2;
+    out.imageWidth = width;
+    out.imageHeight = height;
+    out.guardBand = guardBand;
+    out.tileWidth = SplitExtent(width, maxCore, out.columns);
+    out.tileHeight = SplitExtent(height, maxCore, out.rows);
+    out.paddedWidth = out.tileWidth + guardBand * 2;
+    out.paddedHeight = out.tileHeight + guardBand * 2;
+
+    out.tiles.reserve(static_cast<size_t>(out.columns) * out.rows);
+    for (uint32_t row = 0; row < out.rows; ++row) {
+        for (uint32_t column = 0; column < out.columns; ++column) {
+            ImageTile tile;
+            tile.x = column * out.tileWidth;
+            tile.y = row * out.tileHeight;
+            tile.width = std::min(out.tileWidth, width - tile.x);
+            tile.height = std::min(out.tileHeight, height - tile.y);
+            out.tiles.push_back(tile);
+        }
+    }
+    return true;
+}
+
+bool ExtractImageTile(const ImageDataDesc& image, const ImageTileGrid& grid, uint32_t index, void* dst,
+                      uint32_t dstStride) {
+    const uint32_t bytesPerPixel = GetTileBytesPerPixel(image.format);
+    if (!dst || bytesPerPixel == 0 || index >= grid.tiles.size() || image.planes.empty() ||
+        !image.planes[0].data || image.width != grid.imageWidth || image.height != grid.imageHeight) {
+        return false;
+    }
+
+    const ImageTile& tile = grid.tiles[index];
+    const size_t srcStride = image.planes[0].stride ? image.planes[0].stride
+                                                    : static_cast<size_t>(image.width) * bytesPerPixel;
+    const size_t rowBytes = static_cast<size_t>(grid.paddedWidth) * bytesPerPixel;
+    const size_t stride = dstStride ? dstStride : rowBytes;
+
+    // 水平方向：左侧填充、图像内拷贝、右侧填充
+    const int64_t left = static_cast<int64_t>(tile.x) - grid.guardBand;
+    const uint32_t copyBegin = static_cast<uint32_t>(std::max<int64_t>(left, 0));
+    const uint32_t copyEnd = static_cast<uint32_t>(
+        std::min<int64_t>(left + grid.paddedWidth, static_cast<int64_t>(image.width)));
+    const uint32_t padBefore = static_cast<uint32_t>(copyBegin - left);
+    const uint32_t copyCount = copyEnd - copyBegin;
+    const uint32_t padAfter = grid.paddedWidth - padBefore - copyCount;
+
+    const uint8_t* srcBase = static_cast<const uint8_t*>(image.planes[0].data);
+    uint8_t* dstRow = static_cast<uint8_t*>(dst);
+    const int64_t top = static_cast<int64_t>(tile.y) - grid.guardBand;
+    for (uint32_t row = 0; row < grid.paddedHeight; ++row, dstRow += stride) {
+        const int64_t y = std::min<int64_t>(std::max<int64_t>(top + row, 0), image.height - 1);
+        const uint8_t* srcRow = srcBase + srcStride * static_cast<size_t>(y);
+
+        FillPixels(dstRow, srcRow + static_cast<size_t>(copyBegin) * bytesPerPixel, padBefore, bytesPerPixel);
+        std::memcpy(dstRow + static_cast<size_t>(padBefore) * bytesPerPixel,
+                    srcRow + static_cast<size_t>(copyBegin) * bytesPerPixel,
+                    static_cast<size_t>(copyCount) * bytesPerPixel);
+        FillPixels(dstRow + static_cast<size_t>(padBefore + copyCount) * bytesPerPixel,
+                   srcRow + static_cast<size_t>(copyEnd - 1) * bytesPerPixel, padAfter, bytesPerPixel);
+    }
+    return true;
+}
+
+bool StoreImageTile(const void* src, uint32_t srcStride, const ImageTileGrid& grid, uint32_t index,
+                    const ImageDataDesc& dst) {
+    const uint32_t bytesPerPixel = GetTileBytesPerPixel(dst.format);
+    if (!src || bytesPerPixel == 0 || index >= grid.tiles.size() || dst.planes.empty() || !dst.planes[0].data ||
+        dst.width != grid.imageWidth || dst.height != grid.imageHeight) {
+        return false;
+    }
+
+    const ImageTile& tile = grid.tiles[index];
+    const size_t stride = srcStride ? srcStride : static_cast<size_t>(grid.paddedWidth) * bytesPerPixel;
+    const size_t dstStride = dst.planes[0].stride ? dst.planes[0].stride
+                                                  : static_cast<size_t>(dst.width) * bytesPerPixel;
+    const size_t rowBytes = static_cast<size_t>(tile.width) * bytesPerPixel;
+
+    const uint8_t* srcRow = static_cast<const uint8_t*>(src) + stride * grid.guardBand +
+                            static_cast<size_t>(grid.guardBand) * bytesPerPixel;
+    uint8_t* dstRow = static_cast<uint8_t*>(const_cast<void*>(dst.planes[0].data)) + dstStride * tile.y +
+                      static_cast<size_t>(tile.x) * bytesPerPixel;
+    for (uint32_t row = 0; row < tile.height; ++row, srcRow += stride, dstRow += dstStride) {
+        std::memcpy(dstRow, srcRow, rowBytes);
+    }
+    return true;
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,177 @@
+/**
+ * @file MappedFile.cpp
+ * @brief 只读内存映射文件实现
+ */
+
+#include "lrengine/utils/MappedFile.h"
+#include "lrengine/utils/LRLog.h"
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace lrengine {
+namespace utils {
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        mData = other.mData;
+        mSize = other.mSize;
+#ifdef _WIN32
+        mFileHandle = other.mFileHandle;
+        mMappingHandle = other.mMappingHandle;
+#else
+        mFileDescriptor = other.mFileDescriptor;
+#endif
+        other.Reset();
+    }
+    return *this;
+}
+
+void MappedFile::Reset() {
+    mData = nullptr;
+    mSize = 0;
+#ifdef _WIN32
+    mFileHandle = nullptr;
+    mMappingHandle = nullptr;
+#else
+    mFileDescriptor = -1;
+#endif
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LR_LOG_ERROR_F("MappedFile: failed to open %s", path.c_str());
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        LR_LOG_ERROR_F("MappedFile: empty or unreadable file %s", path.c_str());
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        LR_LOG_ERROR_F("MappedFile: CreateFileMapping failed for %s", path.c_str());
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        LR_LOG_ERROR_F("MappedFile: MapViewOfFile failed for %s", path.c_str());
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mData = static_cast<const uint8_t*>(view);
+    mSize = static_cast<size_t>(size.QuadPart);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mData) {
+        UnmapViewOfFile(mData);
+    }
+    if (mMappingHandle) {
+        CloseHandle(static_cast<HANDLE>(mMappingHandle));
+    }
+    if (mFileHandle) {
+        CloseHandle(static_cast<HANDLE>(mFileHandle));
+    }
+    Reset();
+}
+
+void MappedFile::Prefetch(size_t offset, size_t size) const {
+    LR_UNUSED(offset);
+    LR_UNUSED(size);
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LR_LOG_ERROR_F("MappedFile: failed to open %s", path.c_str());
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        LR_LOG_ERROR_F("MappedFile: empty or unreadable file %s", path.c_str());
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+        LR_LOG_ERROR_F("MappedFile: mmap failed for %s", path.c_str());
+        ::close(fd);
+        return false;
+    }
+
+    mFileDescriptor = fd;
+    mData = static_cast<const uint8_t*>(addr);
+    mSize = size;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (mData) {
+        munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+    if (mFileDescriptor >= 0) {
+        ::close(mFileDescriptor);
+    }
+    Reset();
+}
+
+void MappedFile::Prefetch(size_t offset, size_t size) const {
+    if (!mData || offset >= mSize) {
+        return;
+    }
+    // madvise要求页对齐的起始地址
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t alignedOffset = offset & ~(pageSize - 1);
+    size_t length = std::min(mSize, offset + size) - alignedOffset;
+    madvise(const_cast<uint8_t*>(mData) + alignedOffset, length, MADV_WILLNEED);
+}
+
+#endif
+
+} // namespace utils
+} // namespace lrengine
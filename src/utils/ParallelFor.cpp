@@ -0,0 +1,149 @@
+/**
+ * @file ParallelFor.cpp
+ * @brief 轻量并行循环实现
+ */
+
+#include "lrengine/utils/ParallelFor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lrengine {
+namespace utils {
+
+namespace {
+
+// 当前线程正在执行并行循环体（嵌套调用退化为串行）
+thread_local bool t_insideParallelFor = false;
+
+/**
+ * @brief 常驻工作线程池
+ */
+class WorkerPool {
+public:
+    static WorkerPool& Get() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(mThreads.size()) + 1; }
+
+    void Run(uint32_t count, const std::function<void(uint32_t)>& body, uint32_t maxThreads) {
+        uint32_t threads = maxThreads ? std::min(maxThreads, GetThreadCount()) : GetThreadCount();
+        threads = std::min(threads, count);
+
+        std::unique_lock<std::mutex> runLock(mRunMutex, std::defer_lock);
+        if (threads <= 1 || t_insideParallelFor || !runLock.try_lock()) {
+            for (uint32_t i = 0; i < count; ++i) {
+                body(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBody = &body;
+            mCount = count;
+            mNext.store(0, std::memory_order_relaxed);
+            mParticipants = threads - 1;
+            mPending = threads - 1;
+            ++mGeneration;
+        }
+        mWake.notify_all();
+
+        execute(body, count);
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDone.wait(lock, [this] { return mPending == 0; });
+        mBody = nullptr;
+    }
+
+private:
+    WorkerPool() {
+        const uint32_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        for (uint32_t i = 0; i + 1 < hardware; ++i) {
+            mThreads.emplace_back(&WorkerPool::workerLoop, this, i);
+        }
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mWake.notify_all();
+        for (std::thread& thread : mThreads) {
+            thread.join();
+        }
+    }
+
+    void execute(const std::function<void(uint32_t)>& body, uint32_t count) {
+        t_insideParallelFor = true;
+        for (uint32_t i = mNext.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = mNext.fetch_add(1, std::memory_order_relaxed)) {
+            body(i);
+        }
+        t_insideParallelFor = false;
+    }
+
+    void workerLoop(uint32_t workerIndex) {
+        uint64_t seenGeneration = 0;
+        for (;;) {
+            const std::function<void(uint32_t)>* body = nullptr;
+            uint32_t count = 0;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mWake.wait(lock, [&] { return mStop || mGeneration != seenGeneration; });
+                if (mStop) {
+                    return;
+                }
+                seenGeneration = mGeneration;
+                if (workerIndex >= mParticipants) {
+                    continue;
+                }
+                body = mBody;
+                count = mCount;
+            }
+
+            execute(*body, count);
+
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                --mPending;
+            }
+            mDone.notify_one();
+        }
+    }
+
+    std::vector<std::thread> mThreads;
+    std::mutex mRunMutex;                   ///< 串行化并行循环
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::condition_variable mDone;
+
+    const std::function<void(uint32_t)>* mBody = nullptr;
+    uint32_t mCount = 0;
+    std::atomic<uint32_t> mNext{0};
+    uint32_t mParticipants = 0;             ///< 参与本次循环的工作线程数
+    uint32_t mPending = 0;                  ///< 尚未完成的参与线程数
+    uint64_t mGeneration = 0;
+    bool mStop = false;
+};
+
+} // namespace
+
+void ParallelFor(uint32_t count, const std::function<void(uint32_t index)>& body, uint32_t maxThreads) {
+    if (count == 0 || !body) {
+        return;
+    }
+    WorkerPool::Get().Run(count, body, maxThreads);
+}
+
+uint32_t GetParallelThreadCount() { return WorkerPool::Get().GetThreadCount(); }
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,22 @@
+/**
+ * @file SimdConfig.h
+ * @brief 图像处理 SIMD 指令集检测（内部头文件）
+ *
+ * x86-64 默认启用 SSE2，ARM 在编译器开启 NEON 时启用；
+ * 其余平台只编译标量路径。
+ */
+
+#pragma once
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LR_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LR_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+// AArch64 的 NEON 必然支持半精度与单精度互转及就近取整
+#if defined(LR_SIMD_NEON) && defined(__aarch64__)
+#define LR_SIMD_NEON_FP16 1
+#endif
@@ -0,0 +1,119 @@
+/**
+ * @file YUVMatrix.h
+ * @brief 8 位 YUV ↔ RGB 定点换算（内部头文件）
+ *
+ * 供 CPU 流水线与合成等逐像素处理 YUV 的工具共用，系数按图像的 colorSpace/range 选择，
+ * 小数部分 16 位。
+ */
+
+#pragma once
+
+#include "lrengine/utils/ImageBuffer.h"
+
+#include <cmath>
+#include <cstdint>
+
+namespace lrengine {
+namespace utils {
+
+/**
+ * @brief YUV → RGB 定点系数
+ */
+struct YUVToRGBMatrix {
+    int32_t yScale;
+    int32_t yOffset;
+    int32_t rv;
+    int32_t gu;
+    int32_t gv;
+    int32_t bu;
+};
+
+/**
+ * @brief RGB → YUV 定点系数
+ */
+struct RGBToYUVMatrix {
+    int32_t yr, yg, yb;
+    int32_t ur, ug, ub;
+    int32_t vr, vg, vb;
+    int32_t yOffset;
+};
+
+inline uint8_t ClampToByte(int32_t value) {
+    return static_cast<uint8_t>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+inline YUVToRGBMatrix MakeYUVToRGBMatrix(ColorSpace colorSpace, ColorRange range) {
+    float kr = 1.5748f, kgb = 0.187324f, kgr = 0.468124f, kb = 1.8556f;
+    if (colorSpace == ColorSpace::BT601) {
+        kr = 1.402f; kgb = 0.344136f; kgr = 0.714136f; kb = 1.772f;
+    } else if (colorSpace == ColorSpace::BT2020) {
+        kr = 1.4746f; kgb = 0.164553f; kgr = 0.571353f; kb = 1.8814f;
+    }
+
+    const bool full = range == ColorRange::Full;
+    const float yScale = full ? 1.0f : 255.0f / 219.0f;
+    const float cScale = full ? 1.0f : 255.0f / 224.0f;
+    const float one = 65536.0f;
+
+    YUVToRGBMatrix out;
+    out.yScale = static_cast<int32_t>(std::lround(yScale * one));
+    out.yOffset = full ? 0 : 16;
+    out.rv = static_cast<int32_t>(std::lround(kr * cScale * one));
+    out.gu = static_cast<int32_t>(std::lround(kgb * cScale * one));
+    out.gv = static_cast<int32_t>(std::lround(kgr * cScale * one));
+    out.bu = static_cast<int32_t>(std::lround(kb * cScale * one));
+    return out;
+}
+
+inline RGBToYUVMatrix MakeRGBToYUVMatrix(ColorSpace colorSpace, ColorRange range) {
+    float kr = 0.2126f, kb = 0.0722f;
+    if (colorSpace == ColorSpace::BT601) {
+        kr = 0.299f; kb = 0.114f;
+    } else if (colorSpace == ColorSpace::BT2020) {
+        kr = 0.2627f; kb = 0.0593f;
+    }
+    const float kg = 1.0f - kr - kb;
+
+    const bool full = range == ColorRange::Full;
+    const float yScale = (full ? 1.0f : 219.0f / 255.0f) * 65536.0f;
+    const float cScale = (full ? 1.0f : 224.0f / 255.0f) * 65536.0f;
+    const float cb = 0.5f / (1.0f - kb);
+    const float cr = 0.5f / (1.0f - kr);
+
+    RGBToYUVMatrix out;
+    out.yr = static_cast<int32_t>(std::lround(kr * yScale));
+    out.yg = static_cast<int32_t>(std::lround(kg * yScale));
+    out.yb = static_cast<int32_t>(std::lround(kb * yScale));
+    out.ur = static_cast<int32_t>(std::lround(-kr * cb * cScale));
+    out.ug = static_cast<int32_t>(std::lround(-kg * cb * cScale));
+    out.ub = static_cast<int32_t>(std::lround((1.0f - kb) * cb * cScale));
+    out.vr = static_cast<int32_t>(std::lround((1.0f - kr) * cr * cScale));
+    out.vg = static_cast<int32_t>(std::lround(-kg * cr * cScale));
+    out.vb = static_cast<int32_t>(std::lround(-kb * cr * cScale));
+    out.yOffset = full ? 0 : 16;
+    return out;
+}
+
+/**
+ * @brief 一个 YUV 像素转换为 RGB（写入 3 字节）
+ */
+inline void YUVToRGBPixel(const YUVToRGBMatrix& k, int32_t y, int32_t u, int32_t v, uint8_t* rgb) {
+    const int32_t luma = (y - k.yOffset) * k.yScale + 32768;
+    u -= 128;
+    v -= 128;
+    rgb[0] = ClampToByte((luma + k.rv * v) >> 16);
+    rgb[1] = ClampToByte((luma - k.gu * u - k.gv * v) >> 16);
+    rgb[2] = ClampToByte((luma + k.bu * u) >> 16);
+}
+
+inline uint8_t RGBToLuma(const RGBToYUVMatrix& k, int32_t r, int32_t g, int32_t b) {
+    return ClampToByte(((k.yr * r + k.yg * g + k.yb * b + 32768) >> 16) + k.yOffset);
+}
+
+inline void RGBToChroma(const RGBToYUVMatrix& k, int32_t r, int32_t g, int32_t b, uint8_t& u, uint8_t& v) {
+    u = ClampToByte(((k.ur * r + k.ug * g + k.ub * b + 32768) >> 16) + 128);
+    v = ClampToByte(((k.vr * r + k.vg * g + k.vb * b + 32768) >> 16) + 128);
+}
+
+} // namespace utils
+} // namespace lrengine
@@ -0,0 +1,456 @@
+/**
+ * @file MockBackend.h
+ * @brief 测试用的记录型后端
+ *
+ * 实现全部平台接口但不访问任何图形API：资源数据保存在内存中，绑定、上传、
+ * 回收等调用记录到 MockStats，供测试检查前端逻辑。通过
+ * LRDeviceFactory::RegisterFactory 注册，需要 ${CMAKE_SOURCE_DIR}/src 头文件目录。
+ */
+
+#pragma once
+
+#include "lrengine/core/LRRenderContext.h"
+#include "lrengine/core/LRResource.h"
+#include "lrengine/factory/LRDeviceFactory.h"
+#include "platform/interface/IRenderContextImpl.h"
+#include "platform/interface/IBufferImpl.h"
+#include "platform/interface/IShaderImpl.h"
+#include "platform/interface/ITextureImpl.h"
+#include "platform/interface/IFrameBufferImpl.h"
+#include "platform/interface/IPipelineStateImpl.h"
+#include "platform/interface/IFenceImpl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace lrengine {
+namespace render {
+namespace mock {
+
+/**
+ * @brief 纹理上传记录
+ */
+struct TextureUpload {
+    const void* texture = nullptr;  ///< 上传目标（MockTexture 指针）
+    uint32_t mipLevel = 0;
+    bool hasRegion = false;
+    TextureRegion region;
+    std::vector<uint8_t> data;      ///< 上传数据（按区域或整层大小拷贝）
+};
+
+/**
+ * @brief 栅栏调用记录
+ */
+struct FenceEvent {
+    enum Type { Signal, Wait, Reset };
+    Type type = Signal;
+    uint64_t fence = 0;             ///< 栅栏句柄
+};
+
+/**
+ * @brief 后端调用记录
+ */
+struct MockStats {
+    // 上下文绑定调用
+    uint32_t pipelineBinds = 0;
+    uint32_t programUses = 0;
+    uint32_t vertexBufferBinds = 0;
+    uint32_t drawsWithoutVertexInput = 0;
+    uint32_t indexBufferBinds = 0;
+    uint32_t uniformBufferBinds = 0;
+    uint32_t textureBinds = 0;
+
+    // 资源
+    uint32_t liveBuffers = 0;
+    uint32_t liveTextures = 0;
+    uint32_t liveFrameBuffers = 0;
+    std::vector<TextureUpload> textureUploads;
+    std::vector<MemoryTrimLevel> trimRequests;
+    std::vector<const char*> compiledShaderSources;   ///< 后端每次编译收到的源码（SPIR-V为字节码）
+    std::vector<ShaderLanguage> compiledShaderLanguages;
+    std::vector<FenceEvent> fenceEvents;   ///< 每次编译实际使用的源码（SPIR-V为字节码）
+
+    // 行为开关
+    bool vertexStatePerBuffer = false;      ///< 模拟 OpenGL 的 VAO 语义
+    bool textureBindToEdit = false;         ///< 纹理更新时上报 Texture 范围的绑定变化（模拟非DSA路径）
+    bool supportsMultiview = true;          ///< 帧缓冲是否支持多视图（否则按单视图创建，如 Metal）
+    bool supportsSPIRV = false;             ///< MockShader::SupportsSPIRV 的返回值
+    size_t trimResult = 0;                  ///< TrimMemory 的返回值
+    bool fencesCompleteOnSignal = true;     ///< 否则栅栏在 Wait 时才完成（模拟 GPU 仍在使用）
+    bool fenceWaitSucceeds = true;          ///< Wait 是否在超时前完成
+
+    void Reset() { *this = MockStats(); }
+};
+
+inline MockStats& Stats() {
+    static MockStats stats;
+    return stats;
+}
+
+inline uint64_t NextHandle() {
+    static uint64_t handle = 0;
+    return ++handle;
+}
+
+// =============================================================================
+// 资源
+// =============================================================================
+
+class MockBuffer : public IBufferImpl {
+public:
+    explicit MockBuffer(BufferType type) : mType(type) {}
+    ~MockBuffer() override { Destroy(); }
+
+    bool Create(const BufferDescriptor& desc) override {
+        mData.assign(desc.size, 0);
+        if (desc.data) {
+            std::memcpy(mData.data(), desc.data, desc.size);
+        }
+        mUsage = desc.usage;
+        mHandle = NextHandle();
+        Stats().liveBuffers++;
+        return true;
+    }
+    void Destroy() override {
+        if (mHandle != 0) {
+            Stats().liveBuffers--;
+            mHandle = 0;
+        }
+    }
+    void UpdateData(const void* data, size_t size, size_t offset) override {
+        if (data && offset + size <= mData.size()) {
+            std::memcpy(mData.data() + offset, data, size);
+        }
+    }
+    void* Map(MemoryAccess) override { return mData.data(); }
+    void Unmap() override {}
+    void Bind() override {}
+    void Unbind() override {}
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+    size_t GetSize() const override { return mData.size(); }
+    BufferUsage GetUsage() const override { return mUsage; }
+    BufferType GetType() const override { return mType; }
+
+    const std::vector<uint8_t>& GetData() const { return mData; }
+
+private:
+    BufferType mType;
+    BufferUsage mUsage = BufferUsage::Static;
+    std::vector<uint8_t> mData;
+    uint64_t mHandle = 0;
+};
+
+class MockTexture : public ITextureImpl {
+public:
+    ~MockTexture() override { Destroy(); }
+
+    bool Create(const TextureDescriptor& desc) override {
+        mDesc = desc;
+        if (mDesc.mipLevels == 0) {
+            mDesc.mipLevels = 1;
+            for (uint32_t size = std::max(desc.width, desc.height); size > 1; size >>= 1) {
+                mDesc.mipLevels++;
+            }
+        }
+        mHandle = NextHandle();
+        Stats().liveTextures++;
+        return true;
+    }
+    void Destroy() override {
+        if (mHandle != 0) {
+            Stats().liveTextures--;
+            mHandle = 0;
+        }
+    }
+    void UpdateData(const void* data, uint32_t mipLevel, const TextureRegion* region) override {
+        TextureUpload upload;
+        upload.texture = this;
+        upload.mipLevel = mipLevel;
+        upload.hasRegion = region != nullptr;
+        size_t size = 0;
+        if (region) {
+            upload.region = *region;
+            size = static_cast<size_t>(region->width) * region->height * std::max(1u, region->depth);
+        } else {
+            size = static_cast<size_t>(std::max(1u, mDesc.width >> mipLevel)) *
+                   std::max(1u, mDesc.height >> mipLevel) * std::max(1u, mDesc.depth);
+        }
+        size *= GetPixelFormatSize(mDesc.format);
+        if (data) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            upload.data.assign(bytes, bytes + size);
+        }
+        Stats().textureUploads.push_back(std::move(upload));
+        if (Stats().textureBindToEdit) {
+            LRResource::InvalidateBindings(BindingScope::Texture);
+        }
+    }
+    void GenerateMipmaps() override {}
+    void Bind(uint32_t) override {}
+    void Unbind(uint32_t) override {}
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+    uint32_t GetWidth() const override { return mDesc.width; }
+    uint32_t GetHeight() const override { return mDesc.height; }
+    uint32_t GetDepth() const override { return mDesc.depth; }
+    TextureType GetType() const override { return mDesc.type; }
+    PixelFormat GetFormat() const override { return mDesc.format; }
+    uint32_t GetMipLevels() const override { return mDesc.mipLevels; }
+
+private:
+    TextureDescriptor mDesc;
+    uint64_t mHandle = 0;
+};
+
+class MockShader : public IShaderImpl {
+public:
+    bool Compile(const ShaderDescriptor& desc) override {
+        mStage = desc.stage;
+        mCompiled = desc.source != nullptr;
+        if (mCompiled) {
+            Stats().compiledShaderSources.push_back(desc.source);
+            Stats().compiledShaderLanguages.push_back(desc.language);
+        }
+        return mCompiled;
+    }
+    bool SupportsSPIRV() const override { return Stats().supportsSPIRV; }
+    void Destroy() override { mCompiled = false; }
+    bool IsCompiled() const override { return mCompiled; }
+    const char* GetCompileError() const override { return mCompiled ? "" : "no source"; }
+    ShaderStage GetStage() const override { return mStage; }
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+
+private:
+    ShaderStage mStage = ShaderStage::Vertex;
+    bool mCompiled = false;
+    uint64_t mHandle = NextHandle();
+};
+
+class MockShaderProgram : public IShaderProgramImpl {
+public:
+    bool Link(IShaderImpl**, uint32_t count) override {
+        mLinked = count > 0;
+        return mLinked;
+    }
+    void Destroy() override { mLinked = false; }
+    bool IsLinked() const override { return mLinked; }
+    const char* GetLinkError() const override { return ""; }
+    void Use() override { Stats().programUses++; }
+    int32_t GetUniformLocation(const char*) override { return -1; }
+    void SetUniform1i(int32_t, int32_t) override {}
+    void SetUniform1f(int32_t, float) override {}
+    void SetUniform2f(int32_t, float, float) override {}
+    void SetUniform3f(int32_t, float, float, float) override {}
+    void SetUniform4f(int32_t, float, float, float, float) override {}
+    void SetUniformMatrix3fv(int32_t, const float*, bool) override {}
+    void SetUniformMatrix4fv(int32_t, const float*, bool) override {}
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+
+private:
+    bool mLinked = false;
+    uint64_t mHandle = NextHandle();
+};
+
+class MockFrameBuffer : public IFrameBufferImpl {
+public:
+    ~MockFrameBuffer() override { Destroy(); }
+
+    bool Create(const FrameBufferDescriptor& desc) override {
+        mWidth = desc.width;
+        mHeight = desc.height;
+        mViewCount = Stats().supportsMultiview ? std::max(1u, desc.viewCount) : 1;
+        mHandle = NextHandle();
+        Stats().liveFrameBuffers++;
+        return true;
+    }
+    void Destroy() override {
+        if (mHandle != 0) {
+            Stats().liveFrameBuffers--;
+            mHandle = 0;
+        }
+    }
+    bool AttachColorTexture(ITextureImpl* texture, uint32_t index, uint32_t) override {
+        if (index >= mColorAttachments.size()) {
+            mColorAttachments.resize(index + 1, nullptr);
+        }
+        mColorAttachments[index] = texture;
+        return true;
+    }
+    bool AttachDepthTexture(ITextureImpl*, uint32_t) override { return true; }
+    bool AttachStencilTexture(ITextureImpl*, uint32_t) override { return true; }
+    bool AttachDepthStencilTexture(ITextureImpl*, uint32_t) override { return true; }
+    bool IsComplete() const override { return true; }
+    void Bind() override {}
+    void Unbind() override {}
+    void Clear(uint32_t, const float*, float, uint8_t) override {}
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+    uint32_t GetWidth() const override { return mWidth; }
+    uint32_t GetHeight() const override { return mHeight; }
+    uint32_t GetColorAttachmentCount() const override {
+        return static_cast<uint32_t>(mColorAttachments.size());
+    }
+    uint32_t GetViewCount() const override { return mViewCount; }
+
+private:
+    uint32_t mWidth = 0;
+    uint32_t mHeight = 0;
+    uint32_t mViewCount = 1;
+    std::vector<ITextureImpl*> mColorAttachments;
+    uint64_t mHandle = 0;
+};
+
+class MockPipelineState : public IPipelineStateImpl {
+public:
+    bool Create(const PipelineStateDescriptor& desc) override {
+        mPrimitiveType = desc.primitiveType;
+        return true;
+    }
+    void Destroy() override {}
+    void Apply() override {}
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+    PrimitiveType GetPrimitiveType() const override { return mPrimitiveType; }
+
+private:
+    PrimitiveType mPrimitiveType = PrimitiveType::Triangles;
+    uint64_t mHandle = NextHandle();
+};
+
+class MockFence : public IFenceImpl {
+public:
+    bool Create() override { return true; }
+    void Destroy() override {}
+    void Signal() override {
+        record(FenceEvent::Signal);
+        mPending = true;
+        if (Stats().fencesCompleteOnSignal) {
+            mStatus = FenceStatus::Signaled;
+        }
+    }
+    bool Wait(uint64_t) override {
+        record(FenceEvent::Wait);
+        if (mPending && Stats().fenceWaitSucceeds) {
+            mStatus = FenceStatus::Signaled;
+        }
+        return mStatus == FenceStatus::Signaled;
+    }
+    FenceStatus GetStatus() const override { return mStatus; }
+    void Reset() override {
+        record(FenceEvent::Reset);
+        mPending = false;
+        mStatus = FenceStatus::Unsignaled;
+    }
+    ResourceHandle GetNativeHandle() const override { return ResourceHandle(mHandle); }
+
+private:
+    void record(FenceEvent::Type type) {
+        FenceEvent event;
+        event.type = type;
+        event.fence = mHandle;
+        Stats().fenceEvents.push_back(event);
+    }
+
+    FenceStatus mStatus = FenceStatus::Unsignaled;
+    bool mPending = false;
+    uint64_t mHandle = NextHandle();
+};
+
+// =============================================================================
+// 上下文与工厂
+// =============================================================================
+
+class MockRenderContext : public IRenderContextImpl {
+public:
+    explicit MockRenderContext(Backend backend) : mBackend(backend) {}
+
+    bool Initialize(const RenderContextDescriptor&) override { return true; }
+    void Shutdown() override {}
+    void MakeCurrent() override {}
+    void SwapBuffers() override {}
+    Backend GetBackend() const override { return mBackend; }
+
+    IBufferImpl* CreateBufferImpl(BufferType type) override { return new MockBuffer(type); }
+    IShaderImpl* CreateShaderImpl() override { return new MockShader(); }
+    IShaderProgramImpl* CreateShaderProgramImpl() override { return new MockShaderProgram(); }
+    ITextureImpl* CreateTextureImpl() override { return new MockTexture(); }
+    IFrameBufferImpl* CreateFrameBufferImpl() override { return new MockFrameBuffer(); }
+    IPipelineStateImpl* CreatePipelineStateImpl() override { return new MockPipelineState(); }
+    IFenceImpl* CreateFenceImpl() override { return new MockFence(); }
+
+    void SetViewport(int32_t, int32_t, int32_t, int32_t) override {}
+    void SetScissor(int32_t, int32_t, int32_t, int32_t) override {}
+    void Clear(uint8_t, const float*, float, uint8_t) override {}
+
+    void BindPipelineState(IPipelineStateImpl*) override { Stats().pipelineBinds++; }
+    void BindVertexBuffer(IBufferImpl*, uint32_t) override { Stats().vertexBufferBinds++; }
+    void BindIndexBuffer(IBufferImpl*) override { Stats().indexBufferBinds++; }
+    void BindUniformBuffer(IBufferImpl*, uint32_t) override { Stats().uniformBufferBinds++; }
+    void BindTexture(ITextureImpl*, uint32_t) override { Stats().textureBinds++; }
+
+    void DrawArrays(PrimitiveType, uint32_t, uint32_t) override {}
+    void DrawArraysWithoutVertexInput(PrimitiveType, uint32_t, uint32_t) override {
+        Stats().drawsWithoutVertexInput++;
+    }
+    void DrawElements(PrimitiveType, uint32_t, IndexType, size_t) override {}
+    void DrawArraysInstanced(PrimitiveType, uint32_t, uint32_t, uint32_t) override {}
+    void DrawElementsInstanced(PrimitiveType, uint32_t, IndexType, size_t, uint32_t) override {}
+
+    void WaitIdle() override {}
+    void Flush() override {}
+
+    bool IsVertexStatePerBuffer() const override { return Stats().vertexStatePerBuffer; }
+
+    size_t TrimMemory(MemoryTrimLevel level) override {
+        Stats().trimRequests.push_back(level);
+        return Stats().trimResult;
+    }
+
+private:
+    Backend mBackend;
+};
+
+class MockDeviceFactory : public LRDeviceFactory {
+public:
+    explicit MockDeviceFactory(Backend backend) : mBackend(backend) {}
+
+    IRenderContextImpl* CreateRenderContextImpl() override { return new MockRenderContext(mBackend); }
+    Backend GetBackend() const override { return mBackend; }
+    bool IsAvailable() const override { return true; }
+
+private:
+    Backend mBackend;
+};
+
+/**
+ * @brief 在作用域内把某一后端替换为 Mock 后端，并清空调用记录
+ */
+class ScopedMockBackend {
+public:
+    explicit ScopedMockBackend(Backend backend = Backend::Vulkan)
+        : mBackend(backend), mFactory(backend) {
+        Stats().Reset();
+        LRDeviceFactory::RegisterFactory(mBackend, &mFactory);
+    }
+    ~ScopedMockBackend() { LRDeviceFactory::RegisterFactory(mBackend, nullptr); }
+
+    ScopedMockBackend(const ScopedMockBackend&) = delete;
+    ScopedMockBackend& operator=(const ScopedMockBackend&) = delete;
+
+    /**
+     * @brief 创建使用 Mock 后端的渲染上下文
+     */
+    LRRenderContext* CreateContext(uint32_t width = 64, uint32_t height = 64) const {
+        RenderContextDescriptor desc;
+        desc.backend = mBackend;
+        desc.width = width;
+        desc.height = height;
+        return LRRenderContext::Create(desc);
+    }
+
+private:
+    Backend mBackend;
+    MockDeviceFactory mFactory;
+};
+
+} // namespace mock
+} // namespace render
+} // namespace lrengine
@@ -0,0 +1,236 @@
+/**
+ * @file TestAssetPackage.cpp
+ * @brief AssetPackage 资源包与 LZ4 块编解码单元测试
+ */
+
+#include "lrengine/utils/AssetPackage.h"
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cstdint>
+
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static const char* s_packagePath = "test_asset_package.lrpk";
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestLZ4RoundTrip() {
+    std::cout << "\n=== Test: LZ4 Round Trip ===" << std::endl;
+
+    // 高度重复的数据
+    std::vector<uint8_t> repetitive(10000);
+    for (size_t i = 0; i < repetitive.size(); ++i) {
+        repetitive[i] = static_cast<uint8_t>(i % 17);
+    }
+    std::vector<uint8_t> compressed;
+    LZ4CompressBlock(repetitive.data(), repetitive.size(), compressed);
+    TEST_ASSERT(compressed.size() < repetitive.size() / 10, "Repetitive data compresses");
+
+    std::vector<uint8_t> decompressed(repetitive.size());
+    TEST_ASSERT(LZ4DecompressBlock(compressed.data(), compressed.size(),
+                                   decompressed.data(), decompressed.size()),
+                "Decompress succeeds");
+    TEST_ASSERT(decompressed == repetitive, "Decompressed data matches");
+
+    // 伪随机数据
+    std::vector<uint8_t> noise(4097);
+    uint32_t state = 12345;
+    for (auto& b : noise) {
+        state = state * 1664525u + 1013904223u;
+        b = static_cast<uint8_t>(state >> 24);
+    }
+    LZ4CompressBlock(noise.data(), noise.size(), compressed);
+    std::vector<uint8_t> noiseOut(noise.size());
+    TEST_ASSERT(LZ4DecompressBlock(compressed.data(), compressed.size(),
+                                   noiseOut.data(), noiseOut.size()) && noiseOut == noise,
+                "Incompressible data round trips");
+
+    // 短输入
+    const char shortText[] = "abc";
+    LZ4CompressBlock(shortText, 3, compressed);
+    char shortOut[3];
+    TEST_ASSERT(LZ4DecompressBlock(compressed.data(), compressed.size(), shortOut, 3) &&
+                std::memcmp(shortOut, shortText, 3) == 0, "Short input round trips");
+
+    // 截断输入
+    LZ4CompressBlock(repetitive.data(), repetitive.size(), compressed);
+    TEST_ASSERT(!LZ4DecompressBlock(compressed.data(), compressed.size() / 2,
+                                    decompressed.data(), decompressed.size()),
+                "Truncated block rejected");
+}
+
+void TestPackageRoundTrip() {
+    std::cout << "\n=== Test: Package Round Trip ===" << std::endl;
+
+    const std::string shaderSource = "#version 330 core\nvoid main() {}\n";
+    std::vector<uint8_t> meshData(8192);
+    for (size_t i = 0; i < meshData.size(); ++i) {
+        meshData[i] = static_cast<uint8_t>(i & 0x3F);
+    }
+
+    AssetPackageWriter writer;
+    AssetPackageWriter::AddOptions shaderOptions;
+    shaderOptions.type = AssetType::Shader;
+    TEST_ASSERT(writer.AddAsset("shaders/blit.vert", shaderSource.data(), shaderSource.size(),
+                                shaderOptions), "Add shader");
+
+    AssetPackageWriter::AddOptions meshOptions;
+    meshOptions.type = AssetType::Mesh;
+    meshOptions.alignment = 4096;
+    meshOptions.params[0] = 42;
+    TEST_ASSERT(writer.AddAsset("meshes/cube", meshData.data(), meshData.size(), meshOptions),
+                "Add mesh");
+
+    AssetPackageWriter::AddOptions compressedOptions;
+    compressedOptions.compress = true;
+    TEST_ASSERT(writer.AddAsset("meshes/cube.lz4", meshData.data(), meshData.size(),
+                                compressedOptions), "Add compressed asset");
+
+    TEST_ASSERT(!writer.AddAsset("meshes/cube", meshData.data(), meshData.size()),
+                "Duplicate name rejected");
+    TEST_ASSERT(writer.Write(s_packagePath), "Write package");
+
+    AssetPackage package;
+    TEST_ASSERT(package.Open(s_packagePath), "Open package");
+    TEST_ASSERT(package.GetEntryCount() == 3, "Entry count");
+
+    const AssetEntry* shader = package.Find("shaders/blit.vert");
+    TEST_ASSERT(shader && shader->type == AssetType::Shader, "Find shader");
+    AssetView shaderView = package.GetView(shader);
+    TEST_ASSERT(shaderView.size == shaderSource.size() &&
+                std::memcmp(shaderView.data, shaderSource.data(), shaderView.size) == 0,
+                "Shader zero-copy view");
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(shaderView.data) % 64 == 0, "Shader blob 64-byte aligned");
+
+    const AssetEntry* mesh = package.Find("meshes/cube");
+    AssetView meshView = package.GetView(mesh);
+    TEST_ASSERT(mesh && mesh->params[0] == 42, "Mesh params preserved");
+    TEST_ASSERT(reinterpret_cast<uintptr_t>(meshView.data) % 4096 == 0, "Mesh blob 4096-byte aligned");
+    TEST_ASSERT(meshView.size == meshData.size() &&
+                std::memcmp(meshView.data, meshData.data(), meshData.size()) == 0,
+                "Mesh data matches");
+
+    const AssetEntry* compressed = package.Find("meshes/cube.lz4");
+    TEST_ASSERT(compressed && compressed->compression == AssetCompression::LZ4, "Compressed entry");
+    TEST_ASSERT(package.GetView(compressed).data == nullptr, "No zero-copy view for compressed entry");
+    std::vector<uint8_t> decompressed;
+    TEST_ASSERT(package.Read(compressed, decompressed) && decompressed == meshData,
+                "Compressed entry decompresses");
+
+    TEST_ASSERT(package.Find("missing") == nullptr, "Missing asset returns null");
+    TEST_ASSERT(package.GetName(mesh) == "meshes/cube", "Entry name");
+
+    package.Close();
+    std::remove(s_packagePath);
+}
+
+void TestInvalidPackage() {
+    std::cout << "\n=== Test: Invalid Package ===" << std::endl;
+
+    FILE* file = std::fopen(s_packagePath, "wb");
+    const char garbage[128] = "not a package";
+    std::fwrite(garbage, 1, sizeof(garbage), file);
+    std::fclose(file);
+
+    AssetPackage package;
+    TEST_ASSERT(!package.Open(s_packagePath), "Garbage file rejected");
+    TEST_ASSERT(!package.Open("does_not_exist.lrpk"), "Missing file rejected");
+    std::remove(s_packagePath);
+}
+
+// 写出只含一个未压缩资源的包，按 patch 修改其目录条目后重新写回
+static void WritePatchedPackage(void (*patch)(AssetEntry&)) {
+    const uint8_t data[16] = {1, 2, 3, 4};
+    AssetPackageWriter writer;
+    writer.AddAsset("blob", data, sizeof(data));
+    writer.Write(s_packagePath);
+
+    FILE* file = std::fopen(s_packagePath, "rb");
+    std::fseek(file, 0, SEEK_END);
+    std::vector<uint8_t> bytes(static_cast<size_t>(std::ftell(file)));
+    std::fseek(file, 0, SEEK_SET);
+    std::fread(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+
+    AssetPackageHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    for (uint32_t i = 0; i < header.bucketCount; ++i) {
+        uint8_t* slot = bytes.data() + header.tocOffset + i * sizeof(AssetEntry);
+        AssetEntry entry;
+        std::memcpy(&entry, slot, sizeof(entry));
+        if (entry.nameHash != 0) {
+            patch(entry);
+            std::memcpy(slot, &entry, sizeof(entry));
+        }
+    }
+
+    file = std::fopen(s_packagePath, "wb");
+    std::fwrite(bytes.data(), 1, bytes.size(), file);
+    std::fclose(file);
+}
+
+void TestCorruptEntries() {
+    std::cout << "\n=== Test: Corrupt Entries ===" << std::endl;
+
+    AssetPackage package;
+    WritePatchedPackage([](AssetEntry&) {});
+    TEST_ASSERT(package.Open(s_packagePath), "Unpatched package opens");
+    package.Close();
+
+    // 存储大小大于数据大小：Read 只检查 size，会写出调用方缓冲区
+    WritePatchedPackage([](AssetEntry& entry) { entry.size = entry.storedSize - 8; });
+    TEST_ASSERT(!package.Open(s_packagePath), "Uncompressed storedSize != size rejected");
+
+    // offset + storedSize 回绕
+    WritePatchedPackage([](AssetEntry& entry) { entry.offset = UINT64_MAX - 4; });
+    TEST_ASSERT(!package.Open(s_packagePath), "Wrapping data range rejected");
+
+    WritePatchedPackage([](AssetEntry& entry) { entry.nameOffset = UINT32_MAX; });
+    TEST_ASSERT(!package.Open(s_packagePath), "Name outside string table rejected");
+
+    WritePatchedPackage([](AssetEntry& entry) { entry.compression = static_cast<AssetCompression>(7); });
+    TEST_ASSERT(!package.Open(s_packagePath), "Unknown compression rejected");
+    std::remove(s_packagePath);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "AssetPackage Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestLZ4RoundTrip();
+    TestPackageRoundTrip();
+    TestInvalidPackage();
+    TestCorruptEntries();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
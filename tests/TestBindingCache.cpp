@@ -0,0 +1,252 @@
+/**
+ * @file TestBindingCache.cpp
+ * @brief LRRenderContext 绑定缓存单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRBuffer.h"
+#include "lrengine/core/LRPipelineState.h"
+#include "lrengine/core/LRTexture.h"
+
+#include <iostream>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+static LRVertexBuffer* MakeVertexBuffer(LRRenderContext* context) {
+    float vertices[6] = {};
+    BufferDescriptor desc;
+    desc.size = sizeof(vertices);
+    desc.data = vertices;
+    desc.stride = sizeof(float) * 2;
+    return context->CreateVertexBuffer(desc);
+}
+
+static LRIndexBuffer* MakeIndexBuffer(LRRenderContext* context) {
+    uint16_t indices[3] = {0, 1, 2};
+    BufferDescriptor desc;
+    desc.size = sizeof(indices);
+    desc.data = indices;
+    desc.type = BufferType::Index;
+    desc.indexType = IndexType::UInt16;
+    return context->CreateIndexBuffer(desc);
+}
+
+static LRTexture* MakeTexture(LRRenderContext* context) {
+    TextureDescriptor desc;
+    desc.width = 4;
+    desc.height = 4;
+    return context->CreateTexture(desc);
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestRedundantBindsSkipped() {
+    std::cout << "\n=== Test: Redundant Binds Skipped ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    TEST_ASSERT(context != nullptr, "Mock context created");
+    if (!context) {
+        return;
+    }
+
+    LRTexture* texture = MakeTexture(context);
+    LRVertexBuffer* vertices = MakeVertexBuffer(context);
+    LRPipelineState* pipeline = context->CreatePipelineState(PipelineStateDescriptor());
+
+    context->SetTexture(texture, 0);
+    context->SetTexture(texture, 0);
+    context->SetVertexBuffer(vertices, 0);
+    context->SetVertexBuffer(vertices, 0);
+    context->SetPipelineState(pipeline);
+    context->SetPipelineState(pipeline);
+    TEST_ASSERT(Stats().textureBinds == 1, "Same texture on same slot is bound once");
+    TEST_ASSERT(Stats().vertexBufferBinds == 1, "Same vertex buffer is bound once");
+    TEST_ASSERT(Stats().pipelineBinds == 1, "Same pipeline state is bound once");
+
+    context->BeginFrame();
+    context->SetTexture(texture, 0);
+    TEST_ASSERT(Stats().textureBinds == 2, "BeginFrame clears the cache");
+
+    pipeline->Release();
+    vertices->Release();
+    texture->Release();
+    LRRenderContext::Destroy(context);
+}
+
+void TestUpdatesKeepCache() {
+    std::cout << "\n=== Test: Updates Keep Cache ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    LRTexture* texture = MakeTexture(context);
+    LRVertexBuffer* vertices = MakeVertexBuffer(context);
+    LRIndexBuffer* indices = MakeIndexBuffer(context);
+
+    context->SetTexture(texture, 0);
+    context->SetVertexBuffer(vertices, 0);
+    context->SetIndexBuffer(indices);
+
+    // 后端没有上报绑定变化：更新、创建资源都不应让缓存失效
+    uint8_t pixels[4 * 4 * 4] = {};
+    texture->UpdateData(pixels);
+    float data[6] = {1.0f};
+    vertices->UpdateData(data, sizeof(data), 0);
+    LRTexture* other = MakeTexture(context);
+
+    context->SetTexture(texture, 0);
+    context->SetVertexBuffer(vertices, 0);
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().textureBinds == 1, "Texture update keeps texture binding cached");
+    TEST_ASSERT(Stats().vertexBufferBinds == 1, "Buffer update keeps vertex binding cached");
+    TEST_ASSERT(Stats().indexBufferBinds == 1, "Index binding stays cached");
+
+    // 后端上报纹理绑定被改写（bind-to-edit）：只有纹理缓存失效
+    Stats().textureBindToEdit = true;
+    texture->UpdateData(pixels);
+    context->SetTexture(texture, 0);
+    context->SetVertexBuffer(vertices, 0);
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().textureBinds == 2, "Backend-reported texture change forces rebind");
+    TEST_ASSERT(Stats().vertexBufferBinds == 1, "Vertex binding unaffected by texture scope");
+    TEST_ASSERT(Stats().indexBufferBinds == 1, "Index binding unaffected by texture scope");
+
+    // 直接 Bind 会改变绑定
+    texture->Bind(0);
+    context->SetTexture(texture, 0);
+    TEST_ASSERT(Stats().textureBinds == 3, "Direct texture Bind invalidates texture scope");
+
+    other->Release();
+    indices->Release();
+    vertices->Release();
+    texture->Release();
+    LRRenderContext::Destroy(context);
+}
+
+void TestPerSlotVertexCache() {
+    std::cout << "\n=== Test: Per-Slot Vertex Cache ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    LRVertexBuffer* a = MakeVertexBuffer(context);
+    LRVertexBuffer* b = MakeVertexBuffer(context);
+    LRIndexBuffer* indices = MakeIndexBuffer(context);
+
+    context->SetVertexBuffer(a, 0);
+    context->SetIndexBuffer(indices);
+    context->SetVertexBuffer(b, 1);
+    context->SetVertexBuffer(a, 0);
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().vertexBufferBinds == 2, "Slots are cached independently");
+    TEST_ASSERT(Stats().indexBufferBinds == 1, "Index binding survives vertex binds");
+
+    indices->Release();
+    b->Release();
+    a->Release();
+    LRRenderContext::Destroy(context);
+}
+
+void TestPerBufferVertexCache() {
+    std::cout << "\n=== Test: Per-Buffer Vertex Cache (VAO) ===" << std::endl;
+
+    ScopedMockBackend backend;
+    Stats().vertexStatePerBuffer = true;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    LRVertexBuffer* a = MakeVertexBuffer(context);
+    LRVertexBuffer* b = MakeVertexBuffer(context);
+    LRIndexBuffer* indices = MakeIndexBuffer(context);
+
+    // 绑定 b 会替换 a 的 VAO，即使槽位不同，再次设置 a 也必须重新绑定
+    context->SetVertexBuffer(a, 0);
+    context->SetIndexBuffer(indices);
+    context->SetVertexBuffer(b, 1);
+    context->SetVertexBuffer(a, 0);
+    TEST_ASSERT(Stats().vertexBufferBinds == 3, "Switching VAO rebinds regardless of slot");
+
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().indexBufferBinds == 2, "Index buffer rebound after VAO switch");
+
+    context->SetVertexBuffer(a, 3);
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().vertexBufferBinds == 3, "Current VAO is cached across slots");
+    TEST_ASSERT(Stats().indexBufferBinds == 2, "Index binding kept while VAO unchanged");
+
+    // 后端上报顶点输入被改写（如非DSA路径编辑索引缓冲）
+    LRResource::InvalidateBindings(BindingScope::VertexInput);
+    context->SetVertexBuffer(a, 0);
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().vertexBufferBinds == 4, "VertexInput scope invalidation rebinds VAO");
+    TEST_ASSERT(Stats().indexBufferBinds == 3, "VertexInput scope invalidation rebinds index");
+
+    // 无顶点输入的绘制会切换到默认VAO
+    context->DrawWithoutVertexInput(0, 3);
+    TEST_ASSERT(Stats().drawsWithoutVertexInput == 1, "Attribute-less draw routed to backend");
+    context->SetVertexBuffer(a, 0);
+    context->SetIndexBuffer(indices);
+    TEST_ASSERT(Stats().vertexBufferBinds == 5, "VAO rebound after attribute-less draw");
+    TEST_ASSERT(Stats().indexBufferBinds == 4, "Index rebound after attribute-less draw");
+
+    indices->Release();
+    b->Release();
+    a->Release();
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Binding Cache Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestRedundantBindsSkipped();
+    TestUpdatesKeepCache();
+    TestPerSlotVertexCache();
+    TestPerBufferVertexCache();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
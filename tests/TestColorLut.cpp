@@ -0,0 +1,207 @@
+/**
+ * @file TestColorLut.cpp
+ * @brief CPU 3D LUT 单元测试
+ */
+
+#include "lrengine/utils/ColorLut.h"
+#include "lrengine/utils/ImagePipeline.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// 按 .cube 顺序生成格点数据
+template <typename Fn>
+static std::vector<float> MakeCube(uint32_t size, Fn fn) {
+    std::vector<float> data;
+    data.reserve(static_cast<size_t>(size) * size * size * 3);
+    for (uint32_t b = 0; b < size; ++b) {
+        for (uint32_t g = 0; g < size; ++g) {
+            for (uint32_t r = 0; r < size; ++r) {
+                float rgb[3] = {r / float(size - 1), g / float(size - 1), b / float(size - 1)};
+                fn(rgb);
+                data.insert(data.end(), rgb, rgb + 3);
+            }
+        }
+    }
+    return data;
+}
+
+static ImageDataDesc MakeDesc(uint32_t width, uint32_t height, ImageFormat format, const void* data) {
+    ImageDataDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    desc.planes.push_back({data, 0});
+    return desc;
+}
+
+// 以步长 5 遍历 RGB 立方体（52³ 种颜色，含 0 与 255）
+static std::vector<uint8_t> MakeColorSweep() {
+    std::vector<uint8_t> pixels;
+    for (uint32_t b = 0; b < 256; b += 5) {
+        for (uint32_t g = 0; g < 256; g += 5) {
+            for (uint32_t r = 0; r < 256; r += 5) {
+                pixels.push_back(static_cast<uint8_t>(r));
+                pixels.push_back(static_cast<uint8_t>(g));
+                pixels.push_back(static_cast<uint8_t>(b));
+                pixels.push_back(static_cast<uint8_t>(r ^ g));
+            }
+        }
+    }
+    return pixels;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestIdentity() {
+    std::cout << "\n=== Test: Identity LUT ===" << std::endl;
+
+    const uint32_t sizes[] = {17, 33, 65};
+    for (uint32_t size : sizes) {
+        ColorLut3D lut;
+        TEST_ASSERT(CreateColorLut3D(size, MakeCube(size, [](float*) {}).data(), lut), "Identity LUT created");
+
+        std::vector<uint8_t> pixels = MakeColorSweep();
+        const std::vector<uint8_t> original = pixels;
+        ApplyColorLut3DToRGBA(lut, pixels.data(), static_cast<uint32_t>(pixels.size() / 4));
+        TEST_ASSERT(pixels == original, "Identity LUT preserves every color and alpha");
+    }
+
+    ColorLut3D bad;
+    TEST_ASSERT(!CreateColorLut3D(20, MakeCube(20, [](float*) {}).data(), bad), "Unsupported size rejected");
+    std::vector<uint8_t> rgb(12);
+    TEST_ASSERT(!ApplyColorLut3D(MakeDesc(2, 2, ImageFormat::RGB8, rgb.data()),
+                                 MakeDesc(2, 2, ImageFormat::RGB8, rgb.data()), bad),
+                "Empty LUT rejected");
+}
+
+void TestLinearTransform() {
+    std::cout << "\n=== Test: Linear Transform ===" << std::endl;
+
+    // 仿射变换在四面体插值下是精确的：交换 R/B 并反相 G
+    ColorLut3D lut;
+    CreateColorLut3D(33, MakeCube(33, [](float* c) {
+        const float r = c[0];
+        c[0] = c[2];
+        c[1] = 1.0f - c[1];
+        c[2] = r;
+    }).data(), lut);
+
+    std::vector<uint8_t> pixels = MakeColorSweep();
+    const std::vector<uint8_t> original = pixels;
+    const uint32_t width = 64;
+    const uint32_t height = static_cast<uint32_t>(pixels.size() / 4 / width);
+    const ImageDataDesc desc = MakeDesc(width, height, ImageFormat::RGBA8, pixels.data());
+    TEST_ASSERT(ApplyColorLut3D(desc, desc, lut), "In-place RGBA8 apply");
+
+    bool exact = true;
+    for (size_t i = 0; i < static_cast<size_t>(width) * height * 4; i += 4) {
+        exact = exact && pixels[i] == original[i + 2] && pixels[i + 1] == 255 - original[i + 1] &&
+                pixels[i + 2] == original[i] && pixels[i + 3] == original[i + 3];
+    }
+    TEST_ASSERT(exact, "Affine LUT reproduced exactly");
+
+    // BGRA8 与 RGB8 的通道顺序
+    uint8_t bgra[4] = {10, 20, 200, 77};
+    ApplyColorLut3D(MakeDesc(1, 1, ImageFormat::BGRA8, bgra), MakeDesc(1, 1, ImageFormat::BGRA8, bgra), lut);
+    TEST_ASSERT(bgra[0] == 200 && bgra[1] == 235 && bgra[2] == 10 && bgra[3] == 77, "BGRA8 channel order");
+
+    const uint8_t rgbIn[3] = {10, 20, 200};
+    uint8_t rgbOut[3] = {};
+    ApplyColorLut3D(MakeDesc(1, 1, ImageFormat::RGB8, rgbIn), MakeDesc(1, 1, ImageFormat::RGB8, rgbOut), lut);
+    TEST_ASSERT(rgbOut[0] == 200 && rgbOut[1] == 235 && rgbOut[2] == 10, "RGB8 out-of-place apply");
+}
+
+void TestNonLinear() {
+    std::cout << "\n=== Test: Non-linear LUT Accuracy ===" << std::endl;
+
+    // 伽马曲线 + 饱和度混合，与直接计算的结果比较
+    auto grade = [](float* c) {
+        const float luma = 0.2126f * c[0] + 0.7152f * c[1] + 0.0722f * c[2];
+        for (int i = 0; i < 3; ++i) {
+            c[i] = std::pow(luma + (c[i] - luma) * 1.3f < 0 ? 0.0f : std::min(1.0f, luma + (c[i] - luma) * 1.3f),
+                            0.8f);
+        }
+    };
+    ColorLut3D lut;
+    CreateColorLut3D(65, MakeCube(65, grade).data(), lut);
+
+    std::vector<uint8_t> pixels = MakeColorSweep();
+    const std::vector<uint8_t> original = pixels;
+    ApplyColorLut3DToRGBA(lut, pixels.data(), static_cast<uint32_t>(pixels.size() / 4));
+
+    int maxError = 0;
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        float c[3] = {original[i] / 255.0f, original[i + 1] / 255.0f, original[i + 2] / 255.0f};
+        grade(c);
+        for (int k = 0; k < 3; ++k) {
+            maxError = std::max(maxError, std::abs(pixels[i + k] - static_cast<int>(std::lround(c[k] * 255.0f))));
+        }
+    }
+    TEST_ASSERT(maxError <= 3, "65-point LUT within 3 levels of direct evaluation");
+}
+
+void TestPipelineStage() {
+    std::cout << "\n=== Test: Pipeline LUT Stage ===" << std::endl;
+
+    ColorLut3D lut;
+    CreateColorLut3D(17, MakeCube(17, [](float* c) { c[0] = c[0] * c[0]; }).data(), lut);
+
+    std::vector<uint8_t> source = MakeColorSweep();
+    const uint32_t width = 64;
+    const uint32_t height = static_cast<uint32_t>(source.size() / 4 / width);
+
+    std::vector<uint8_t> fused(source.size());
+    ImagePipelineOptions options;
+    options.lut = &lut;
+    RunImagePipeline(MakeDesc(width, height, ImageFormat::RGBA8, source.data()),
+                     MakeDesc(width, height, ImageFormat::RGBA8, fused.data()), options);
+
+    std::vector<uint8_t> separate = source;
+    ApplyColorLut3DToRGBA(lut, separate.data(), width * height);
+    TEST_ASSERT(fused == separate, "Fused pipeline LUT matches standalone apply");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ColorLut Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestIdentity();
+    TestLinearTransform();
+    TestNonLinear();
+    TestPipelineStage();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file TestDirtyRegion.cpp
+ * @brief 分块变化检测与脏矩形合并单元测试
+ */
+
+#include "lrengine/utils/DirtyRegion.h"
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static ImageDataDesc MakeImage(ImageFormat format, uint32_t width, uint32_t height,
+                               std::vector<uint8_t>& plane0, uint32_t stride0,
+                               std::vector<uint8_t>* plane1 = nullptr, uint32_t stride1 = 0) {
+    ImageDataDesc image;
+    image.width = width;
+    image.height = height;
+    image.format = format;
+    image.planes.push_back({plane0.data(), stride0});
+    if (plane1) {
+        image.planes.push_back({plane1->data(), stride1});
+    }
+    return image;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestDetect() {
+    std::cout << "\n=== Test: Detect Dirty Tiles ===" << std::endl;
+
+    const uint32_t width = 200;
+    const uint32_t height = 130;
+    std::vector<uint8_t> a(width * height * 4, 7);
+    // 不同行距的相同内容
+    const uint32_t stride = width * 4 + 32;
+    std::vector<uint8_t> b(stride * height, 7);
+
+    ImageDataDesc previous = MakeImage(ImageFormat::RGBA8, width, height, a, 0);
+    ImageDataDesc current = MakeImage(ImageFormat::RGBA8, width, height, b, stride);
+
+    DirtyTileMap tiles;
+    TEST_ASSERT(DetectDirtyTiles(previous, current, 64, tiles), "RGBA8 detected");
+    TEST_ASSERT(tiles.columns == 4 && tiles.rows == 3 && tiles.dirtyCount == 0, "Identical frames clean");
+
+    // 最后一个字节（右下角边缘块）
+    b[stride * (height - 1) + width * 4 - 1] = 0;
+    // 第二块行第二列
+    b[stride * 70 + 100 * 4] = 0;
+    DetectDirtyTiles(previous, current, 64, tiles);
+    TEST_ASSERT(tiles.dirtyCount == 2 && tiles.dirty[11] == 1 && tiles.dirty[5] == 1, "Changed tiles found");
+
+    std::vector<uint8_t> y(64 * 64, 16);
+    std::vector<uint8_t> uv(64 * 32, 128);
+    std::vector<uint8_t> y2(y);
+    std::vector<uint8_t> uv2(uv);
+    ImageDataDesc nv12a = MakeImage(ImageFormat::NV12, 64, 64, y, 0, &uv, 0);
+    ImageDataDesc nv12b = MakeImage(ImageFormat::NV12, 64, 64, y2, 0, &uv2, 0);
+    uv2[64 * 1 + 40] = 0;  // 色度第 1 行第 20 个像素 → 亮度块 (1, 0)
+    DetectDirtyTiles(nv12a, nv12b, 32, tiles);
+    TEST_ASSERT(tiles.dirtyCount == 1 && tiles.dirty[1] == 1, "Chroma change maps to luma tile");
+
+    ImageDataDesc mismatched = MakeImage(ImageFormat::RGBA8, width - 1, height, b, stride);
+    TEST_ASSERT(!DetectDirtyTiles(previous, mismatched, 64, tiles), "Size mismatch rejected");
+}
+
+void TestMerge() {
+    std::cout << "\n=== Test: Merge Dirty Tiles ===" << std::endl;
+
+    // 5×4 块，块边长 10，图像 45×38
+    DirtyTileMap tiles;
+    tiles.tileSize = 10;
+    tiles.columns = 5;
+    tiles.rows = 4;
+    tiles.dirty = {
+        1, 1, 0, 0, 0,
+        1, 1, 0, 0, 1,
+        0, 0, 0, 1, 1,
+        0, 0, 0, 1, 1,
+    };
+
+    std::vector<DirtyRect> rects;
+    MergeDirtyTiles(tiles, 45, 38, rects);
+    TEST_ASSERT(rects.size() == 3, "Three rectangles");
+    TEST_ASSERT(rects.size() == 3 && rects[0].x == 0 && rects[0].y == 0 && rects[0].width == 20 &&
+                    rects[0].height == 20,
+                "2x2 block merged vertically");
+    TEST_ASSERT(rects.size() == 3 && rects[1].x == 40 && rects[1].y == 10 && rects[1].width == 5 &&
+                    rects[1].height == 10,
+                "Edge tile clipped");
+    TEST_ASSERT(rects.size() == 3 && rects[2].x == 30 && rects[2].y == 20 && rects[2].width == 15 &&
+                    rects[2].height == 18,
+                "Bottom-right rectangle clipped");
+    TEST_ASSERT(GetDirtyArea(rects) == 400 + 50 + 270, "Dirty area");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "DirtyRegion Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestDetect();
+    TestMerge();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file TestFrameBuffer.cpp
+ * @brief LRFrameBuffer 单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRError.h"
+#include "lrengine/core/LRFrameBuffer.h"
+
+#include <iostream>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestMultiviewSupport() {
+    std::cout << "\n=== Test: Multiview Support ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    FrameBufferDescriptor desc;
+    desc.width = 32;
+    desc.height = 32;
+    desc.viewCount = 2;
+
+    LRFrameBuffer* multiview = context->CreateFrameBuffer(desc);
+    TEST_ASSERT(multiview != nullptr, "Multiview framebuffer created when supported");
+    TEST_ASSERT(multiview && multiview->GetViewCount() == 2, "View count recorded");
+    if (multiview) {
+        multiview->Release();
+    }
+
+    // 后端按单视图创建时不能返回一个"多视图"帧缓冲
+    Stats().supportsMultiview = false;
+    LRError::ClearError();
+    LRFrameBuffer* rejected = context->CreateFrameBuffer(desc);
+    TEST_ASSERT(rejected == nullptr, "Multiview framebuffer rejected when unsupported");
+    TEST_ASSERT(LRError::GetLastError() == ErrorCode::NotSupported, "Rejection reports NotSupported");
+    TEST_ASSERT(Stats().liveFrameBuffers == 0, "Rejected backend framebuffer destroyed");
+
+    desc.viewCount = 1;
+    LRFrameBuffer* single = context->CreateFrameBuffer(desc);
+    TEST_ASSERT(single != nullptr, "Single-view framebuffer unaffected");
+    if (single) {
+        single->Release();
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "FrameBuffer Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestMultiviewSupport();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file TestFrameQueue.cpp
+ * @brief 有界帧队列与缓冲池背压单元测试
+ */
+
+#include "lrengine/utils/FrameQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static ImageDataDesc MakeDesc(uint32_t width, uint32_t height) {
+    ImageDataDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = ImageFormat::RGBA8;
+    return desc;
+}
+
+static ImageBufferPool::PoolOptions MakePoolOptions(size_t maxPoolSize) {
+    ImageBufferPool::PoolOptions options;
+    options.maxPoolSize = maxPoolSize;
+    options.initialPoolSize = 0;
+    return options;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestDropOldest() {
+    std::cout << "\n=== Test: DropOldest ===" << std::endl;
+
+    ImageBufferPool pool(MakePoolOptions(8));
+    FrameQueueOptions options;
+    options.capacity = 2;
+    FrameQueue queue(options);
+
+    for (int64_t i = 0; i < 4; ++i) {
+        TEST_ASSERT(queue.Push(pool.Acquire(MakeDesc(4, 4)), i * 1000), "Push accepted");
+    }
+    TEST_ASSERT(queue.GetSize() == 2, "Queue stays bounded");
+    TEST_ASSERT(pool.GetInUseCount() == 2, "Evicted frames returned to the pool");
+
+    QueuedFrame frame;
+    TEST_ASSERT(queue.TryPop(frame) && frame.timestampUs == 2000 && frame.sequence == 2, "Oldest surviving frame first");
+    TEST_ASSERT(queue.TryPop(frame) && frame.timestampUs == 3000, "Newest frame last");
+    TEST_ASSERT(!queue.TryPop(frame), "Empty queue returns false");
+    TEST_ASSERT(frame.buffer == nullptr, "Failed pop releases the previous frame");
+
+    const FrameQueueStats stats = queue.GetStats();
+    TEST_ASSERT(stats.pushedFrames == 4 && stats.droppedFrames == 2 && stats.poppedFrames == 2, "Stats counted");
+}
+
+void TestDropNewest() {
+    std::cout << "\n=== Test: DropNewest ===" << std::endl;
+
+    ImageBufferPool pool(MakePoolOptions(8));
+    FrameQueueOptions options;
+    options.capacity = 1;
+    options.dropPolicy = FrameDropPolicy::DropNewest;
+    FrameQueue queue(options);
+
+    TEST_ASSERT(queue.Push(pool.Acquire(MakeDesc(4, 4)), 1), "First frame queued");
+    TEST_ASSERT(!queue.Push(pool.Acquire(MakeDesc(4, 4)), 2), "Second frame dropped");
+    TEST_ASSERT(pool.GetInUseCount() == 1, "Dropped frame returned to the pool");
+
+    QueuedFrame frame;
+    TEST_ASSERT(queue.TryPop(frame) && frame.timestampUs == 1, "Queued frame kept");
+    TEST_ASSERT(queue.GetStats().droppedFrames == 1, "Drop counted");
+}
+
+void TestBlockAndLatency() {
+    std::cout << "\n=== Test: Block / Latency ===" << std::endl;
+
+    ImageBufferPool pool(MakePoolOptions(8));
+    FrameQueueOptions options;
+    options.capacity = 1;
+    options.dropPolicy = FrameDropPolicy::Block;
+    options.blockTimeoutMs = 20;
+    FrameQueue queue(options);
+
+    TEST_ASSERT(queue.Push(pool.Acquire(MakeDesc(4, 4)), 1), "First frame queued");
+    TEST_ASSERT(!queue.Push(pool.Acquire(MakeDesc(4, 4)), 2), "Blocked push times out");
+
+    // 消费者稍后取走帧，生产者在等待后入队成功
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        QueuedFrame frame;
+        queue.Pop(frame, 100);
+    });
+    TEST_ASSERT(queue.Push(pool.Acquire(MakeDesc(4, 4)), 3), "Blocked push succeeds once space frees");
+    consumer.join();
+
+    QueuedFrame frame;
+    TEST_ASSERT(queue.Pop(frame, 100) && frame.timestampUs == 3, "Blocked frame delivered");
+    const FrameQueueStats stats = queue.GetStats();
+    TEST_ASSERT(stats.maxLatencyUs >= 4000, "Queue latency measured");
+    TEST_ASSERT(stats.averageLatencyUs > 0.0 && stats.lastLatencyUs <= stats.maxLatencyUs, "Latency stats consistent");
+
+    queue.Close();
+    TEST_ASSERT(!queue.Push(pool.Acquire(MakeDesc(4, 4)), 4), "Push fails after close");
+    TEST_ASSERT(!queue.Pop(frame, 100), "Pop on closed empty queue returns immediately");
+}
+
+void TestPoolBackPressure() {
+    std::cout << "\n=== Test: Pool Back-pressure ===" << std::endl;
+
+    ImageBufferPool pool(MakePoolOptions(2));
+    FrameQueueOptions options;
+    options.capacity = 4;
+    FrameQueue queue(options);
+
+    TEST_ASSERT(queue.Push(pool.AcquireWait(MakeDesc(4, 4), 0), 0), "First buffer");
+    TEST_ASSERT(queue.Push(pool.AcquireWait(MakeDesc(4, 4), 0), 1), "Second buffer");
+    TEST_ASSERT(!pool.AcquireWait(MakeDesc(4, 4), 10), "Exhausted pool times out instead of allocating");
+    TEST_ASSERT(pool.GetCapacity() == 2, "Pool did not grow");
+
+    // 消费者归还一帧后，等待中的生产者被唤醒
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        QueuedFrame frame;
+        queue.Pop(frame, 100);
+    });
+    auto buffer = pool.AcquireWait(MakeDesc(4, 4), 1000);
+    consumer.join();
+    TEST_ASSERT(buffer != nullptr && pool.GetCapacity() == 2, "Producer resumes with a recycled buffer");
+
+    // 分辨率切换：淘汰不兼容的空闲缓冲区而不是永久等待
+    queue.Clear();
+    auto resized = pool.AcquireWait(MakeDesc(8, 8), 0);
+    TEST_ASSERT(resized && resized->GetImageDesc().width == 8 && pool.GetCapacity() == 2,
+                "Idle incompatible buffer evicted for new size");
+}
+
+void TestMultiProducer() {
+    std::cout << "\n=== Test: Multiple Producers ===" << std::endl;
+
+    ImageBufferPool pool(MakePoolOptions(6));
+    FrameQueueOptions options;
+    options.capacity = 2;
+    options.dropPolicy = FrameDropPolicy::Block;
+    options.blockTimeoutMs = 0;
+    FrameQueue queue(options);
+
+    const int producers = 3;
+    const int framesPerProducer = 50;
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&pool, &queue, p, framesPerProducer]() {
+            for (int i = 0; i < framesPerProducer; ++i) {
+                queue.Push(pool.AcquireWait(MakeDesc(4, 4), 1000), p * 1000 + i);
+            }
+        });
+    }
+
+    int received = 0;
+    QueuedFrame frame;
+    while (received < producers * framesPerProducer && queue.Pop(frame, 1000)) {
+        received++;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    frame.buffer.reset();
+
+    TEST_ASSERT(received == producers * framesPerProducer, "Every frame delivered under Block policy");
+    TEST_ASSERT(queue.GetStats().droppedFrames == 0, "No frames dropped");
+    TEST_ASSERT(pool.GetCapacity() <= 6 && pool.GetInUseCount() == 0, "Pool bounded and fully returned");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "FrameQueue Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestDropOldest();
+    TestDropNewest();
+    TestBlockAndLatency();
+    TestPoolBackPressure();
+    TestMultiProducer();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
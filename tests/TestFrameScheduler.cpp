@@ -0,0 +1,189 @@
+/**
+ * @file TestFrameScheduler.cpp
+ * @brief 截止时间感知帧调度器单元测试
+ */
+
+#include "lrengine/utils/FrameScheduler.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static FrameStageDesc MakeStage(const char* name, bool optional, uint32_t priority,
+                                std::vector<float> cpuCostUs, std::vector<float> gpuCostUs = {}) {
+    FrameStageDesc desc;
+    desc.name = name;
+    desc.optional = optional;
+    desc.priority = priority;
+    desc.cpuCostUs = std::move(cpuCostUs);
+    desc.gpuCostUs = std::move(gpuCostUs);
+    return desc;
+}
+
+static FrameSchedulerOptions MakeOptions() {
+    FrameSchedulerOptions options;
+    options.safetyMarginUs = 0;
+    options.costSmoothing = 1.0f;
+    options.upgradeHeadroom = 0.1f;
+    options.upgradeStableFrames = 3;
+    return options;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestStageRegistration() {
+    std::cout << "\n=== Test: Stage Registration ===" << std::endl;
+
+    FrameScheduler scheduler(MakeOptions());
+    TEST_ASSERT(scheduler.AddStage(MakeStage("empty", true, 0, {})) == UINT32_MAX, "Stage without levels rejected");
+    const uint32_t convert = scheduler.AddStage(MakeStage("convert", false, 10, {2000.0f}));
+    const uint32_t beauty = scheduler.AddStage(MakeStage("beauty", true, 5, {3000.0f, 8000.0f}, {1000.0f, 2000.0f}));
+    TEST_ASSERT(convert == 0 && beauty == 1 && scheduler.GetStageCount() == 2, "Stages indexed in order");
+    TEST_ASSERT(scheduler.GetTargetLevel(beauty) == 2, "Stages start at their highest level");
+    TEST_ASSERT(scheduler.GetEstimatedCostUs(beauty, 2) == 10000.0f, "Estimate sums CPU and GPU cost");
+    TEST_ASSERT(scheduler.GetEstimatedCostUs(beauty, 0) == 0.0f, "Skipped level costs nothing");
+
+    FramePlan plan = scheduler.PlanFrame(0, 33000);
+    TEST_ASSERT(!plan.drop && !plan.degraded, "Ample budget keeps full quality");
+    TEST_ASSERT(plan.stageLevels[beauty] == 2 && plan.IsStageEnabled(convert), "Full levels planned");
+    TEST_ASSERT(plan.estimatedCostUs == 12000.0f, "Plan cost estimated");
+}
+
+void TestDegradeOrder() {
+    std::cout << "\n=== Test: Degrade Order ===" << std::endl;
+
+    FrameScheduler scheduler(MakeOptions());
+    const uint32_t convert = scheduler.AddStage(MakeStage("convert", false, 10, {2000.0f}));
+    const uint32_t resample = scheduler.AddStage(MakeStage("resample", true, 8, {1000.0f, 4000.0f}));
+    const uint32_t beauty = scheduler.AddStage(MakeStage("beauty", true, 5, {3000.0f, 8000.0f}));
+
+    // 满配 14000：先降低优先级的美颜，再降重采样
+    FramePlan plan = scheduler.PlanFrame(0, 9000);
+    TEST_ASSERT(!plan.drop && plan.degraded, "Tight budget degrades");
+    TEST_ASSERT(plan.stageLevels[beauty] == 1 && plan.stageLevels[resample] == 2, "Lowest priority degraded first");
+    TEST_ASSERT(plan.estimatedCostUs <= 9000.0f, "Degraded plan fits the budget");
+
+    // 所有阶段最低质量 6000 仍超出：跳过可选阶段
+    plan = scheduler.PlanFrame(100000, 104000);
+    TEST_ASSERT(!plan.drop && !plan.IsStageEnabled(beauty), "Optional stage skipped after degrading everything");
+    TEST_ASSERT(plan.stageLevels[resample] == 1 && plan.stageLevels[convert] == 1, "Higher priority stages kept");
+
+    // 必需阶段也来不及：丢帧，且不影响目标等级
+    const uint32_t targetBefore = scheduler.GetTargetLevel(resample);
+    plan = scheduler.PlanFrame(200000, 201000);
+    TEST_ASSERT(plan.drop && !plan.IsStageEnabled(convert), "Frame dropped when mandatory work misses deadline");
+    TEST_ASSERT(scheduler.GetTargetLevel(resample) == targetBefore, "Drop does not lower targets");
+
+    const FrameSchedulerStats stats = scheduler.GetStats();
+    TEST_ASSERT(stats.plannedFrames == 3 && stats.droppedFrames == 1 && stats.degradedFrames == 2, "Stats counted");
+}
+
+void TestLearnedCostAndRecovery() {
+    std::cout << "\n=== Test: Learned Cost / Recovery ===" << std::endl;
+
+    FrameScheduler scheduler(MakeOptions());
+    const uint32_t beauty = scheduler.AddStage(MakeStage("beauty", true, 0, {2000.0f, 6000.0f, 10000.0f}));
+
+    // 降频：最高等级实测翻倍，未执行过的等级按同一比例推算
+    scheduler.ReportCpuTime(beauty, 3, 20000.0f);
+    TEST_ASSERT(scheduler.GetEstimatedCostUs(beauty, 3) == 20000.0f, "Measured cost replaces declaration");
+    TEST_ASSERT(std::fabs(scheduler.GetEstimatedCostUs(beauty, 2) - 12000.0f) < 1.0f, "Unmeasured level scaled");
+
+    FramePlan plan = scheduler.PlanFrame(0, 16000);
+    TEST_ASSERT(plan.stageLevels[beauty] == 2, "Throttled device planned one level lower");
+    TEST_ASSERT(scheduler.GetTargetLevel(beauty) == 2, "Degrade is sticky");
+
+    // GPU 耗时单独上报并计入估计
+    scheduler.ReportGpuTime(beauty, 2, 3000.0f);
+    TEST_ASSERT(std::fabs(scheduler.GetEstimatedCostUs(beauty, 2) - 15000.0f) < 1.0f, "GPU time added to estimate");
+
+    // 设备恢复：实测回落后，需要连续若干帧留有余量才升级
+    scheduler.ReportCpuTime(beauty, 3, 10000.0f);
+    scheduler.ReportCpuTime(beauty, 2, 6000.0f);
+    scheduler.ReportGpuTime(beauty, 2, 0.0f);
+    int64_t now = 0;
+    for (int i = 0; i < 2; ++i, now += 33000) {
+        scheduler.PlanFrame(now, now + 33000);
+    }
+    TEST_ASSERT(scheduler.GetTargetLevel(beauty) == 2, "No upgrade before the stability window");
+    scheduler.PlanFrame(now, now + 33000);
+    TEST_ASSERT(scheduler.GetTargetLevel(beauty) == 3, "Upgrade after stable headroom");
+
+    // 错过截止时间会统计并重置稳定计数
+    plan = scheduler.PlanFrame(now, now + 33000);
+    scheduler.CompleteFrame(plan, now + 40000);
+    const FrameSchedulerStats stats = scheduler.GetStats();
+    TEST_ASSERT(stats.completedFrames == 1 && stats.missedDeadlines == 1, "Missed deadline counted");
+    TEST_ASSERT(stats.lastLatenessUs == 7000 && stats.maxLatenessUs == 7000, "Lateness recorded");
+}
+
+void TestCoolDownRecovery() {
+    std::cout << "\n=== Test: Cool-down Recovery ===" << std::endl;
+
+    FrameSchedulerOptions options = MakeOptions();
+    options.costSmoothing = 0.2f;
+    FrameScheduler scheduler(options);
+    const uint32_t stage = scheduler.AddStage(MakeStage("beauty", true, 0, {2000.0f, 6000.0f}));
+
+    // 降频期间高等级实测 12000，预算 10000 放不下，降到等级 1
+    for (int i = 0; i < 50; ++i) {
+        scheduler.ReportCpuTime(stage, 2, 12000.0f);
+    }
+    int64_t now = 0;
+    FramePlan plan = scheduler.PlanFrame(now, now + 10000);
+    TEST_ASSERT(plan.stageLevels[stage] == 1 && scheduler.GetTargetLevel(stage) == 1, "Throttled stage degraded");
+    TEST_ASSERT(scheduler.GetEstimatedCostUs(stage, 2) > 11000.0f, "Throttled sample dominates estimate");
+
+    // 设备恢复：等级 1 回到声明值，等级 2 的旧实测随整体比例回落，最终恢复高质量
+    for (int i = 0; i < 500; ++i) {
+        now += 10000;
+        plan = scheduler.PlanFrame(now, now + 10000);
+        const uint32_t level = plan.stageLevels[stage];
+        scheduler.ReportCpuTime(stage, level, level == 1 ? 2000.0f : 6000.0f);
+    }
+    TEST_ASSERT(std::fabs(scheduler.GetEstimatedCostUs(stage, 2) - 6000.0f) < 100.0f,
+                "Stale throttled sample rescaled after cool-down");
+    TEST_ASSERT(scheduler.GetTargetLevel(stage) == 2, "Quality recovers after cool-down");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "FrameScheduler Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestStageRegistration();
+    TestDegradeOrder();
+    TestLearnedCostAndRecovery();
+    TestCoolDownRecovery();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
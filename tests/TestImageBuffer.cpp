@@ -0,0 +1,173 @@
+/**
+ * @file TestImageBuffer.cpp
+ * @brief 外部内存包装、共享视图与缓冲池归还单元测试
+ */
+
+#include "lrengine/utils/ImageBufferPool.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// 模拟解码器输出的 NV12 帧（行尾带填充）
+struct ForeignFrame {
+    static constexpr uint32_t kWidth = 8;
+    static constexpr uint32_t kHeight = 4;
+    static constexpr uint32_t kStride = 16;
+
+    std::vector<uint8_t> luma = std::vector<uint8_t>(kStride * kHeight);
+    std::vector<uint8_t> chroma = std::vector<uint8_t>(kStride * kHeight / 2);
+
+    ForeignFrame() {
+        for (size_t i = 0; i < luma.size(); ++i) {
+            luma[i] = static_cast<uint8_t>(i);
+        }
+        for (size_t i = 0; i < chroma.size(); ++i) {
+            chroma[i] = static_cast<uint8_t>(200 + i);
+        }
+    }
+
+    ImageDataDesc Desc() const {
+        ImageDataDesc desc;
+        desc.width = kWidth;
+        desc.height = kHeight;
+        desc.format = ImageFormat::NV12;
+        desc.planes.push_back({luma.data(), kStride});
+        desc.planes.push_back({chroma.data(), kStride});
+        return desc;
+    }
+};
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestExternalHostMemory() {
+    std::cout << "\n=== Test: External HostMemoryBuffer ===" << std::endl;
+
+    ForeignFrame frame;
+    int released = 0;
+    {
+        HostMemoryBuffer buffer(frame.Desc(), [&released]() { released++; });
+        TEST_ASSERT(buffer.IsExternal(), "Wrapped buffer reports external memory");
+        TEST_ASSERT(buffer.GetPlaneData(0) == frame.luma.data(), "Luma plane is not copied");
+        TEST_ASSERT(buffer.GetPlaneData(1) == frame.chroma.data(), "Chroma plane is not copied");
+        TEST_ASSERT(buffer.GetImageDesc().planes[1].stride == ForeignFrame::kStride, "Foreign stride preserved");
+        TEST_ASSERT(buffer.GetNativeBuffer() == frame.luma.data(), "Native buffer is the first plane");
+        TEST_ASSERT(released == 0, "Release callback not called while alive");
+    }
+    TEST_ASSERT(released == 1, "Release callback called exactly once on destruction");
+
+    // 未指定 stride 时按紧密排列补全
+    std::vector<uint8_t> rgba(4 * 3 * 2);
+    ImageDataDesc desc;
+    desc.width = 3;
+    desc.height = 2;
+    desc.format = ImageFormat::RGBA8;
+    desc.planes.push_back({rgba.data(), 0});
+    HostMemoryBuffer tight(desc, nullptr);
+    TEST_ASSERT(tight.GetImageDesc().planes[0].stride == 12, "Missing stride filled as tightly packed");
+
+    HostMemoryBuffer owned(desc);
+    TEST_ASSERT(!owned.IsExternal() && owned.GetPlaneData(0) != rgba.data(), "Default constructor still allocates");
+}
+
+void TestSharedImageView() {
+    std::cout << "\n=== Test: SharedImageView ===" << std::endl;
+
+    ForeignFrame frame;
+    int released = 0;
+    std::shared_ptr<ImageBuffer> buffer =
+        std::make_shared<HostMemoryBuffer>(frame.Desc(), [&released]() { released++; });
+
+    auto full = SharedImageView::Create(buffer);
+    auto crop = SharedImageView::Create(buffer, 2, 2, 4, 2);
+    TEST_ASSERT(full && crop, "Views created");
+    TEST_ASSERT(full->GetImageDesc().width == 8 && full->GetImageDesc().height == 4, "Full view keeps size");
+
+    const auto& cropDesc = crop->GetImageDesc();
+    const auto* cropLuma = static_cast<const uint8_t*>(cropDesc.planes[0].data);
+    const auto* cropChroma = static_cast<const uint8_t*>(cropDesc.planes[1].data);
+    TEST_ASSERT(cropDesc.width == 4 && cropDesc.height == 2, "Crop view size");
+    TEST_ASSERT(cropLuma == frame.luma.data() + 2 * ForeignFrame::kStride + 2, "Crop luma offset");
+    TEST_ASSERT(cropChroma == frame.chroma.data() + 1 * ForeignFrame::kStride + 2, "Crop chroma offset (one UV pair)");
+    TEST_ASSERT(cropDesc.planes[0].stride == ForeignFrame::kStride, "Crop keeps source stride");
+
+    TEST_ASSERT(!SharedImageView::Create(buffer, 1, 0, 2, 2), "Odd NV12 crop origin rejected");
+    TEST_ASSERT(!SharedImageView::Create(buffer, 4, 0, 8, 2), "Out-of-bounds crop rejected");
+    TEST_ASSERT(!SharedImageView::Create(nullptr), "Null source rejected");
+
+    // 视图持有底层缓冲区：最后一个引用释放时才归还
+    buffer.reset();
+    full.reset();
+    TEST_ASSERT(released == 0, "Source alive while a view remains");
+    TEST_ASSERT(crop->Lock(false) && crop->IsLocked(), "Lock forwarded to source");
+    crop->Unlock();
+    crop.reset();
+    TEST_ASSERT(released == 1, "Source released with the last view");
+}
+
+void TestPoolWrapExternal() {
+    std::cout << "\n=== Test: ImageBufferPool::WrapExternal ===" << std::endl;
+
+    ImageBufferPool pool;
+    ForeignFrame frame;
+    int returned = 0;
+
+    auto pooled = pool.Acquire(frame.Desc());
+    auto external = pool.WrapExternal(frame.Desc(), [&returned]() { returned++; });
+    TEST_ASSERT(external && external->GetImageDesc().planes[0].data == frame.luma.data(),
+                "Wrapped frame points at foreign memory");
+    TEST_ASSERT(pool.GetInUseCount() == 2, "In-use count covers pooled and external frames");
+    TEST_ASSERT(pool.GetExternalInUseCount() == 1, "External in-use count");
+    TEST_ASSERT(pool.GetCapacity() == 1, "External frame does not occupy pool capacity");
+
+    auto view = SharedImageView::Create(external, 0, 2);
+    external.reset();
+    TEST_ASSERT(returned == 0 && pool.GetExternalInUseCount() == 1, "View keeps external frame in flight");
+    view.reset();
+    TEST_ASSERT(returned == 1, "External frame returned to its origin");
+    TEST_ASSERT(pool.GetExternalInUseCount() == 0 && pool.GetInUseCount() == 1, "Counts updated on return");
+
+    pooled.reset();
+    TEST_ASSERT(pool.GetAvailableCount() == 1, "Pooled buffer returns to the pool");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImageBuffer Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestExternalHostMemory();
+    TestSharedImageView();
+    TestPoolWrapExternal();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
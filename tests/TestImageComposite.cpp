@@ -0,0 +1,278 @@
+/**
+ * @file TestImageComposite.cpp
+ * @brief CPU 图像合成单元测试
+ */
+
+#include "lrengine/utils/ImageComposite.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static ImageDataDesc MakeDesc(uint32_t width, uint32_t height, ImageFormat format, const void* data) {
+    ImageDataDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    desc.planes.push_back({data, 0});
+    return desc;
+}
+
+static uint32_t RoundDiv255(uint32_t x) { return (x * 2 + 255) / 510; }
+
+// 伪随机 RGBA 数据
+static std::vector<uint8_t> MakeNoise(size_t pixels, uint32_t seed) {
+    std::vector<uint8_t> data(pixels * 4);
+    for (size_t i = 0; i < data.size(); ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = static_cast<uint8_t>(seed >> 24);
+    }
+    return data;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestPremultiply() {
+    std::cout << "\n=== Test: Premultiply / Unpremultiply ===" << std::endl;
+
+    // 覆盖全部 (颜色, alpha) 组合
+    std::vector<uint8_t> pixels(256 * 256 * 4);
+    for (uint32_t a = 0; a < 256; ++a) {
+        for (uint32_t c = 0; c < 256; ++c) {
+            uint8_t* p = &pixels[(a * 256 + c) * 4];
+            p[0] = static_cast<uint8_t>(c);
+            p[1] = static_cast<uint8_t>(255 - c);
+            p[2] = static_cast<uint8_t>(c / 2);
+            p[3] = static_cast<uint8_t>(a);
+        }
+    }
+    const std::vector<uint8_t> original = pixels;
+    const ImageDataDesc desc = MakeDesc(256, 256, ImageFormat::RGBA8, pixels.data());
+    TEST_ASSERT(PremultiplyAlpha(desc), "Premultiply runs");
+
+    bool exact = true;
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        const uint32_t a = original[i + 3];
+        for (int c = 0; c < 3; ++c) {
+            exact = exact && pixels[i + c] == RoundDiv255(original[i + c] * a);
+        }
+        exact = exact && pixels[i + 3] == a;
+    }
+    TEST_ASSERT(exact, "Premultiply rounds exactly for every color/alpha pair");
+
+    // 反预乘：c × 255 / a 四舍五入
+    std::vector<uint8_t> premultiplied = pixels;
+    TEST_ASSERT(UnpremultiplyAlpha(desc), "Unpremultiply runs");
+    exact = true;
+    for (size_t i = 0; i < pixels.size(); i += 4) {
+        const uint32_t a = premultiplied[i + 3];
+        for (int c = 0; c < 3; ++c) {
+            const uint32_t expected = a == 0 ? 0 : std::min(255u, (premultiplied[i + c] * 255 + a / 2) / a);
+            exact = exact && pixels[i + c] == expected;
+        }
+    }
+    TEST_ASSERT(exact, "Unpremultiply rounds exactly");
+
+    std::vector<uint8_t> rgb(12);
+    TEST_ASSERT(!PremultiplyAlpha(MakeDesc(2, 2, ImageFormat::RGB8, rgb.data())), "RGB8 rejected");
+}
+
+void TestBlendModes() {
+    std::cout << "\n=== Test: RGBA Blend Modes ===" << std::endl;
+
+    const uint32_t width = 37;
+    const uint32_t height = 5;
+    std::vector<uint8_t> overlay = MakeNoise(width * height, 7);
+    const std::vector<uint8_t> base = MakeNoise(width * height, 99);
+
+    // 预乘后的源（不透明度 50%）作为参考输入
+    const uint32_t opacity = 128;
+    std::vector<uint8_t> source(overlay.size());
+    for (size_t i = 0; i < overlay.size(); i += 4) {
+        const uint32_t a = RoundDiv255(overlay[i + 3] * opacity);
+        for (int c = 0; c < 3; ++c) {
+            source[i + c] = static_cast<uint8_t>(RoundDiv255(overlay[i + c] * a));
+        }
+        source[i + 3] = static_cast<uint8_t>(a);
+    }
+
+    const CompositeBlendMode modes[] = {CompositeBlendMode::SourceOver, CompositeBlendMode::Add,
+                                        CompositeBlendMode::Multiply, CompositeBlendMode::Screen};
+    const char* names[] = {"SourceOver", "Add", "Multiply", "Screen"};
+    for (int m = 0; m < 4; ++m) {
+        std::vector<uint8_t> target = base;
+        CompositeOptions options;
+        options.mode = modes[m];
+        options.opacity = opacity / 255.0f;
+        CompositeImage(MakeDesc(width, height, ImageFormat::RGBA8, overlay.data()),
+                       MakeDesc(width, height, ImageFormat::RGBA8, target.data()), options);
+
+        bool exact = true;
+        for (size_t i = 0; i < target.size(); i += 4) {
+            const uint32_t sa = source[i + 3];
+            const uint32_t da = base[i + 3];
+            for (int c = 0; c < 4; ++c) {
+                const uint32_t s = source[i + c];
+                const uint32_t d = base[i + c];
+                uint32_t expected = 0;
+                switch (modes[m]) {
+                    case CompositeBlendMode::SourceOver: expected = s + RoundDiv255(d * (255 - sa)); break;
+                    case CompositeBlendMode::Add: expected = s + d; break;
+                    case CompositeBlendMode::Multiply:
+                        expected = RoundDiv255(s * d) + RoundDiv255(s * (255 - da)) + RoundDiv255(d * (255 - sa));
+                        break;
+                    case CompositeBlendMode::Screen: expected = s + d - RoundDiv255(s * d); break;
+                }
+                exact = exact && target[i + c] == std::min(expected, 255u);
+            }
+        }
+        TEST_ASSERT(exact, std::string(names[m]) + " matches reference (SIMD and tail)");
+    }
+}
+
+void TestPlacementAndSwizzle() {
+    std::cout << "\n=== Test: Placement / Channel Order ===" << std::endl;
+
+    // 2×2 不透明红色叠加到 4×4 BGRA 的 (-1, 3)：只覆盖目标像素 (0, 3)
+    const uint8_t red[16] = {255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255};
+    std::vector<uint8_t> target(4 * 4 * 4, 0);
+    CompositeOptions options;
+    options.x = -1;
+    options.y = 3;
+    TEST_ASSERT(CompositeImage(MakeDesc(2, 2, ImageFormat::RGBA8, red),
+                               MakeDesc(4, 4, ImageFormat::BGRA8, target.data()), options),
+                "Partially visible overlay composited");
+    const size_t hit = (3 * 4 + 0) * 4;
+    TEST_ASSERT(target[hit] == 0 && target[hit + 2] == 255 && target[hit + 3] == 255, "RGBA overlay swizzled to BGRA");
+    size_t touched = 0;
+    for (size_t i = 0; i < target.size(); ++i) {
+        touched += target[i] != 0;
+    }
+    TEST_ASSERT(touched == 2, "Only the clipped pixel changed");
+
+    options.x = 10;
+    TEST_ASSERT(CompositeImage(MakeDesc(2, 2, ImageFormat::RGBA8, red),
+                               MakeDesc(4, 4, ImageFormat::BGRA8, target.data()), options),
+                "Fully clipped overlay is a no-op");
+}
+
+void TestNV12() {
+    std::cout << "\n=== Test: NV12 Target ===" << std::endl;
+
+    // 8×4 的中灰 NV12（视频范围），左上 4×2 叠加不透明白色，右侧透明
+    const uint32_t width = 8;
+    const uint32_t height = 4;
+    std::vector<uint8_t> luma(width * height, 126);
+    std::vector<uint8_t> chroma(width * height / 2, 128);
+    ImageDataDesc target = MakeDesc(width, height, ImageFormat::NV12, luma.data());
+    target.planes.push_back({chroma.data(), 0});
+
+    std::vector<uint8_t> overlay(8 * 2 * 4, 0);
+    for (uint32_t y = 0; y < 2; ++y) {
+        for (uint32_t x = 0; x < 4; ++x) {
+            uint8_t* p = &overlay[(y * 8 + x) * 4];
+            p[0] = p[1] = p[2] = p[3] = 255;
+        }
+    }
+    TEST_ASSERT(CompositeImage(MakeDesc(8, 2, ImageFormat::RGBA8, overlay.data()), target), "NV12 composite runs");
+    TEST_ASSERT(luma[0] == 235 && luma[width + 3] == 235, "Opaque white writes video-range white luma");
+    TEST_ASSERT(luma[4] == 126 && luma[2 * width] == 126, "Transparent and uncovered luma unchanged");
+    TEST_ASSERT(chroma[0] == 128 && chroma[1] == 128, "Neutral chroma stays neutral");
+
+    // 半透明红色只覆盖块内一个像素：色度按块平均向红色偏移
+    std::fill(luma.begin(), luma.end(), 126);
+    const uint8_t red[4] = {255, 0, 0, 255};
+    CompositeOptions options;
+    options.x = 7;
+    options.y = 3;
+    CompositeImage(MakeDesc(1, 1, ImageFormat::RGBA8, red), target, options);
+    const uint8_t v = chroma[(1 * width / 2 + 3) * 2 + 1];
+    TEST_ASSERT(v > 140 && v < 200, "Single-pixel red shifts block V by a quarter");
+    TEST_ASSERT(chroma[(1 * width / 2 + 2) * 2 + 1] == 128, "Neighbouring chroma block untouched");
+}
+
+void TestOddSizeYUV() {
+    std::cout << "\n=== Test: Odd-size YUV Target ===" << std::endl;
+
+    // 7×5 目标：色度平面按向下取整为 3×2，边缘的列/行归入最后一个色度块
+    const uint32_t width = 7;
+    const uint32_t height = 5;
+    std::vector<uint8_t> overlay(width * height * 4, 255);
+
+    std::vector<uint8_t> luma(width * height, 126);
+    std::vector<uint8_t> chroma((width / 2) * 2 * (height / 2), 128);
+    ImageDataDesc nv12 = MakeDesc(width, height, ImageFormat::NV12, luma.data());
+    nv12.planes.push_back({chroma.data(), 0});
+    TEST_ASSERT(CompositeImage(MakeDesc(width, height, ImageFormat::RGBA8, overlay.data()), nv12),
+                "Odd-size NV12 composite runs");
+    TEST_ASSERT(std::all_of(luma.begin(), luma.end(), [](uint8_t y) { return y == 235; }),
+                "Edge column and row luma composited");
+    TEST_ASSERT(std::all_of(chroma.begin(), chroma.end(), [](uint8_t c) { return c == 128; }),
+                "Chroma stays inside the plane");
+
+    std::vector<uint8_t> y420(width * height, 126);
+    std::vector<uint8_t> u420((width / 2) * (height / 2), 128);
+    std::vector<uint8_t> v420((width / 2) * (height / 2), 128);
+    ImageDataDesc planar = MakeDesc(width, height, ImageFormat::YUV420P, y420.data());
+    planar.planes.push_back({u420.data(), 0});
+    planar.planes.push_back({v420.data(), 0});
+    const uint8_t red[4] = {255, 0, 0, 255};
+    CompositeOptions options;
+    options.x = 6;
+    options.y = 4;
+    TEST_ASSERT(CompositeImage(MakeDesc(1, 1, ImageFormat::RGBA8, red), planar, options),
+                "Corner pixel composite runs");
+    TEST_ASSERT(y420[width * height - 1] != 126 && v420.back() > 128, "Corner pixel updates the last chroma block");
+
+    // 宽或高为 1 时没有色度样本，不做任何写入
+    std::vector<uint8_t> thin(height, 126);
+    ImageDataDesc column = MakeDesc(1, height, ImageFormat::NV12, thin.data());
+    column.planes.push_back({chroma.data(), 0});
+    TEST_ASSERT(CompositeImage(MakeDesc(1, 1, ImageFormat::RGBA8, red), column) && thin[0] == 126,
+                "Target without chroma samples left unchanged");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImageComposite Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestPremultiply();
+    TestBlendModes();
+    TestPlacementAndSwizzle();
+    TestNV12();
+    TestOddSizeYUV();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
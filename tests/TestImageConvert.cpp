@@ -0,0 +1,246 @@
+/**
+ * @file TestImageConvert.cpp
+ * @brief 10 位 / 半精度图像格式转换单元测试
+ */
+
+#include "lrengine/utils/ImageConvert.h"
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestHalfScalar() {
+    std::cout << "\n=== Test: Half Scalar ===" << std::endl;
+
+    TEST_ASSERT(FloatToHalf(1.0f) == 0x3C00, "1.0 -> 0x3C00");
+    TEST_ASSERT(FloatToHalf(0.5f) == 0x3800, "0.5 -> 0x3800");
+    TEST_ASSERT(FloatToHalf(-2.0f) == 0xC000, "-2.0 -> 0xC000");
+    TEST_ASSERT(FloatToHalf(65504.0f) == 0x7BFF, "Max half");
+    TEST_ASSERT(FloatToHalf(1.0e6f) == 0x7C00, "Overflow -> Inf");
+    TEST_ASSERT(FloatToHalf(std::ldexp(1.0f, -24)) == 0x0001, "Smallest denormal");
+
+    bool roundTrip = true;
+    for (uint32_t h = 0; h < 0x7C00; ++h) {
+        roundTrip &= FloatToHalf(HalfToFloat(static_cast<uint16_t>(h))) == h;
+    }
+    TEST_ASSERT(roundTrip, "All finite halves round trip");
+}
+
+void TestSampleDepth() {
+    std::cout << "\n=== Test: 16-bit <-> 8-bit Samples ===" << std::endl;
+
+    std::vector<uint16_t> wide(65536);
+    for (uint32_t i = 0; i < wide.size(); ++i) {
+        wide[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<uint8_t> narrow(wide.size());
+    ConvertU16ToU8(wide.data(), narrow.data(), wide.size());
+
+    bool rounded = true;
+    for (uint32_t i = 0; i < wide.size(); ++i) {
+        rounded &= std::abs(int(narrow[i]) - int(std::lround(i / 257.0))) <= 1;
+    }
+    TEST_ASSERT(rounded, "U16 -> U8 within 1 of v / 257");
+
+    std::vector<uint8_t> bytes(259);
+    for (uint32_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint16_t> p016(bytes.size());
+    std::vector<uint16_t> p010(bytes.size());
+    ConvertU8ToU16(bytes.data(), p016.data(), bytes.size(), 16);
+    ConvertU8ToU16(bytes.data(), p010.data(), bytes.size(), 10);
+
+    bool expand = true;
+    for (uint32_t i = 0; i < bytes.size(); ++i) {
+        expand &= p016[i] == bytes[i] * 257;
+        expand &= (p010[i] & 0x3F) == 0 && (p010[i] >> 6) == ((bytes[i] << 2) | (bytes[i] >> 6));
+    }
+    TEST_ASSERT(expand, "U8 -> P016/P010 bit replication");
+
+    std::vector<uint8_t> back(bytes.size());
+    ConvertU16ToU8(p010.data(), back.data(), p010.size());
+    TEST_ASSERT(back == bytes, "U8 -> P010 -> U8 is lossless");
+}
+
+void TestHalfKernels() {
+    std::cout << "\n=== Test: Half Kernels ===" << std::endl;
+
+    std::vector<uint16_t> unorm(65536);
+    for (uint32_t i = 0; i < unorm.size(); ++i) {
+        unorm[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<uint16_t> half(unorm.size());
+    ConvertU16ToHalf(unorm.data(), half.data(), unorm.size());
+
+    bool matches = true;
+    for (uint32_t i = 0; i < unorm.size(); ++i) {
+        matches &= half[i] == FloatToHalf(i / 65535.0f);
+    }
+    TEST_ASSERT(matches, "U16 -> half matches scalar reference");
+
+    std::vector<uint16_t> halves(0x7C00);
+    for (uint32_t i = 0; i < halves.size(); ++i) {
+        halves[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<uint16_t> restored(halves.size());
+    ConvertHalfToU16(halves.data(), restored.data(), halves.size());
+
+    bool clamped = true;
+    for (uint32_t i = 0; i < halves.size(); ++i) {
+        float f = std::min(1.0f, HalfToFloat(halves[i]));
+        clamped &= restored[i] == static_cast<uint16_t>(f * 65535.0f + 0.5f);
+    }
+    TEST_ASSERT(clamped, "Half -> U16 clamps and rounds");
+}
+
+void TestRGB10A2() {
+    std::cout << "\n=== Test: RGB10A2 ===" << std::endl;
+
+    // 覆盖所有 8 位取值
+    std::vector<uint8_t> rgba8(256 * 4 + 12);
+    for (size_t i = 0; i < rgba8.size(); ++i) {
+        rgba8[i] = static_cast<uint8_t>((i * 7) ^ (i >> 2));
+    }
+    const size_t pixelCount = rgba8.size() / 4;
+
+    std::vector<uint32_t> packed(pixelCount);
+    ConvertRGBA8ToRGB10A2(rgba8.data(), packed.data(), pixelCount);
+    TEST_ASSERT((packed[0] & 0x3FF) == static_cast<uint32_t>((rgba8[0] << 2) | (rgba8[0] >> 6)),
+                "Red channel expands");
+
+    std::vector<uint8_t> back(rgba8.size());
+    ConvertRGB10A2ToRGBA8(packed.data(), back.data(), pixelCount);
+    bool colorLossless = true;
+    bool alphaQuantized = true;
+    for (size_t i = 0; i < pixelCount; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            colorLossless &= back[i * 4 + c] == rgba8[i * 4 + c];
+        }
+        alphaQuantized &= back[i * 4 + 3] == (rgba8[i * 4 + 3] >> 6) * 85;
+    }
+    TEST_ASSERT(colorLossless, "RGBA8 -> RGB10A2 -> RGBA8 color is lossless");
+    TEST_ASSERT(alphaQuantized, "Alpha quantized to 2 bits");
+
+    std::vector<uint16_t> half(pixelCount * 4);
+    ConvertRGB10A2ToRGBA16F(packed.data(), half.data(), pixelCount);
+    bool halfMatches = true;
+    for (size_t i = 0; i < pixelCount; ++i) {
+        halfMatches &= half[i * 4 + 1] == FloatToHalf(((packed[i] >> 10) & 0x3FF) / 1023.0f);
+        halfMatches &= half[i * 4 + 3] == FloatToHalf((packed[i] >> 30) / 3.0f);
+    }
+    TEST_ASSERT(halfMatches, "RGB10A2 -> RGBA16F matches scalar reference");
+
+    std::vector<uint32_t> repacked(pixelCount);
+    ConvertRGBA16FToRGB10A2(half.data(), repacked.data(), pixelCount);
+    TEST_ASSERT(repacked == packed, "RGB10A2 -> RGBA16F -> RGB10A2 is lossless");
+
+    uint16_t hdr[4] = {FloatToHalf(4.0f), FloatToHalf(-1.0f), 0x7E00, FloatToHalf(1.0f)};
+    uint32_t clamped = 0;
+    ConvertRGBA16FToRGB10A2(hdr, &clamped, 1);
+    TEST_ASSERT(clamped == (1023u | (0u << 10) | (1023u << 20) | (3u << 30)),
+                "Out-of-range and NaN values clamp");
+}
+
+void TestImageConversion() {
+    std::cout << "\n=== Test: Image Conversion ===" << std::endl;
+
+    TEST_ASSERT(IsConversionSupported(ImageFormat::P010, ImageFormat::NV12), "P010 -> NV12 supported");
+    TEST_ASSERT(IsConversionSupported(ImageFormat::RGBA16F, ImageFormat::RGB10A2),
+                "RGBA16F -> RGB10A2 supported");
+    TEST_ASSERT(!IsConversionSupported(ImageFormat::P010, ImageFormat::RGBA8),
+                "P010 -> RGBA8 not supported");
+
+    const uint32_t width = 34;
+    const uint32_t height = 6;
+
+    ImageDataDesc srcDesc;
+    srcDesc.width = width;
+    srcDesc.height = height;
+    srcDesc.format = ImageFormat::P010;
+    HostMemoryBuffer src(srcDesc);
+    const ImageDataDesc& p010 = src.GetImageDesc();
+    TEST_ASSERT(p010.planes.size() == 2, "P010 has two planes");
+    TEST_ASSERT(p010.planes[0].stride == width * 2 && p010.planes[1].stride == width * 2,
+                "P010 default strides");
+
+    uint16_t* luma = static_cast<uint16_t*>(src.GetPlaneData(0));
+    uint16_t* chroma = static_cast<uint16_t*>(src.GetPlaneData(1));
+    for (uint32_t i = 0; i < width * height; ++i) {
+        luma[i] = static_cast<uint16_t>((i * 37) << 6);
+    }
+    for (uint32_t i = 0; i < width * height / 2; ++i) {
+        chroma[i] = static_cast<uint16_t>((512 + i) << 6);
+    }
+
+    ImageDataDesc dstDesc;
+    dstDesc.width = width;
+    dstDesc.height = height;
+    dstDesc.format = ImageFormat::NV12;
+    HostMemoryBuffer dst(dstDesc);
+    TEST_ASSERT(ConvertImage(p010, &dst), "P010 -> NV12 converts");
+
+    const uint8_t* y8 = static_cast<const uint8_t*>(dst.GetPlaneData(0));
+    const uint8_t* uv8 = static_cast<const uint8_t*>(dst.GetPlaneData(1));
+    bool planesMatch = true;
+    for (uint32_t i = 0; i < width * height; ++i) {
+        uint8_t expected;
+        ConvertU16ToU8(&luma[i], &expected, 1);
+        planesMatch &= y8[i] == expected;
+    }
+    for (uint32_t i = 0; i < width * height / 2; ++i) {
+        uint8_t expected;
+        ConvertU16ToU8(&chroma[i], &expected, 1);
+        planesMatch &= uv8[i] == expected;
+    }
+    TEST_ASSERT(planesMatch, "Both planes converted");
+
+    dstDesc.width = width / 2;
+    HostMemoryBuffer wrongSize(dstDesc);
+    TEST_ASSERT(!ConvertImage(p010, &wrongSize), "Size mismatch rejected");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImageConvert Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestHalfScalar();
+    TestSampleDepth();
+    TestHalfKernels();
+    TestRGB10A2();
+    TestImageConversion();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
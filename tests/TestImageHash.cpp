@@ -0,0 +1,166 @@
+/**
+ * @file TestImageHash.cpp
+ * @brief 图像内容哈希与重复帧检测单元测试
+ */
+
+#include "lrengine/utils/ImageHash.h"
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestHashBytes() {
+    std::cout << "\n=== Test: HashBytes ===" << std::endl;
+
+    std::vector<uint8_t> data(4099);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 31 + (i >> 7));
+    }
+
+    const uint64_t hash = HashBytes(data.data(), data.size());
+    TEST_ASSERT(hash == HashBytes(data.data(), data.size()), "Deterministic");
+    TEST_ASSERT(hash != HashBytes(data.data(), data.size(), 1), "Seed changes hash");
+    TEST_ASSERT(hash != HashBytes(data.data(), data.size() - 1), "Length changes hash");
+    TEST_ASSERT(HashBytes(nullptr, 0) != HashBytes("\0", 1), "Empty differs from zero byte");
+
+    // 每个位置翻转一位都应改变哈希（覆盖条带、1KB 块和尾部）
+    bool sensitive = true;
+    for (size_t i = 0; i < data.size(); i += 61) {
+        data[i] ^= 0x10;
+        sensitive &= HashBytes(data.data(), data.size()) != hash;
+        data[i] ^= 0x10;
+    }
+    TEST_ASSERT(sensitive, "Single-bit flips detected");
+}
+
+void TestHashImage() {
+    std::cout << "\n=== Test: HashImage ===" << std::endl;
+
+    const uint32_t width = 40;
+    const uint32_t height = 6;
+    const uint32_t stride = width + 24;
+    std::vector<uint8_t> luma(stride * height, 0);
+    std::vector<uint8_t> chroma(stride * height / 2, 128);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            luma[y * stride + x] = static_cast<uint8_t>(x + y * 9);
+        }
+    }
+
+    ImageDataDesc image;
+    image.width = width;
+    image.height = height;
+    image.format = ImageFormat::NV12;
+    image.planes.push_back({luma.data(), stride});
+    image.planes.push_back({chroma.data(), stride});
+
+    uint64_t padded = 0;
+    TEST_ASSERT(HashImage(image, padded), "NV12 hashed");
+
+    // 行尾填充不参与哈希
+    for (uint32_t y = 0; y < height; ++y) {
+        luma[y * stride + width] = 0xFF;
+    }
+    uint64_t repadded = 0;
+    HashImage(image, repadded);
+    TEST_ASSERT(padded == repadded, "Row padding ignored");
+
+    // 紧密排列的相同像素哈希一致
+    std::vector<uint8_t> tightLuma(width * height);
+    std::vector<uint8_t> tightChroma(width * height / 2, 128);
+    for (uint32_t y = 0; y < height; ++y) {
+        std::copy(&luma[y * stride], &luma[y * stride + width], &tightLuma[y * width]);
+    }
+    ImageDataDesc tight = image;
+    tight.planes[0] = {tightLuma.data(), 0};
+    tight.planes[1] = {tightChroma.data(), 0};
+    uint64_t tightHash = 0;
+    HashImage(tight, tightHash);
+    TEST_ASSERT(tightHash == padded, "Stride independent");
+
+    chroma[stride + 3] = 0;
+    uint64_t changed = 0;
+    HashImage(image, changed);
+    TEST_ASSERT(changed != padded, "Chroma change detected");
+}
+
+void TestBlockDiff() {
+    std::cout << "\n=== Test: Block Diff ===" << std::endl;
+
+    const uint32_t width = 100;
+    const uint32_t height = 70;
+    std::vector<uint8_t> pixels(width * height * 4, 0x40);
+
+    ImageDataDesc image;
+    image.width = width;
+    image.height = height;
+    image.format = ImageFormat::RGBA8;
+    image.planes.push_back({pixels.data(), 0});
+
+    BlockHashGrid first;
+    TEST_ASSERT(ComputeBlockHashes(image, 32, first), "Block hashes computed");
+    TEST_ASSERT(first.columns == 4 && first.rows == 3 && first.hashes.size() == 12, "Grid covers edges");
+
+    // 改动右下角边缘块内的一个像素
+    pixels[(65 * width + 99) * 4 + 1] = 0;
+    BlockHashGrid second;
+    ComputeBlockHashes(image, 32, second);
+    std::vector<uint8_t> mask;
+    TEST_ASSERT(DiffBlockHashes(first, second, &mask) == 1 && mask[11] == 1, "Only edge block changed");
+
+    BlockHashGrid other;
+    ComputeBlockHashes(image, 16, other);
+    TEST_ASSERT(DiffBlockHashes(first, other) == other.hashes.size(), "Incompatible grids all changed");
+
+    FrameDeduplicator dedup(32);
+    TEST_ASSERT(dedup.Update(image), "First frame is new");
+    const uint64_t frameHash = dedup.GetFrameHash();
+    TEST_ASSERT(!dedup.Update(image) && dedup.GetChangedBlockCount() == 0, "Repeated frame skipped");
+    TEST_ASSERT(dedup.GetFrameHash() == frameHash, "Frame hash stable");
+
+    pixels[0] = 0;
+    TEST_ASSERT(dedup.Update(image) && dedup.GetChangedBlockCount() == 1 && dedup.GetChangedMask()[0] == 1,
+                "Changed block reported");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImageHash Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestHashBytes();
+    TestHashImage();
+    TestBlockDiff();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/**
+ * @file TestImagePipeline.cpp
+ * @brief 融合 CPU 图像流水线单元测试
+ */
+
+#include "lrengine/utils/ImagePipeline.h"
+#include "lrengine/utils/ParallelFor.h"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static ImageDataDesc MakeDesc(uint32_t width, uint32_t height, ImageFormat format, const void* data,
+                              uint32_t stride = 0) {
+    ImageDataDesc desc;
+    desc.width = width;
+    desc.height = height;
+    desc.format = format;
+    desc.planes.push_back({data, stride});
+    return desc;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestParallelFor() {
+    std::cout << "\n=== Test: ParallelFor ===" << std::endl;
+
+    std::vector<uint32_t> hits(1000, 0);
+    ParallelFor(static_cast<uint32_t>(hits.size()), [&hits](uint32_t i) { hits[i] += 1; });
+    bool once = true;
+    for (uint32_t value : hits) {
+        once = once && value == 1;
+    }
+    TEST_ASSERT(once, "Every index runs exactly once");
+
+    // 嵌套调用退化为串行，不会死锁
+    std::atomic<uint32_t> total{0};
+    ParallelFor(8, [&total](uint32_t) {
+        ParallelFor(10, [&total](uint32_t j) { total += j; });
+    });
+    TEST_ASSERT(total == 8 * 45, "Nested ParallelFor completes");
+    TEST_ASSERT(GetParallelThreadCount() >= 1, "Thread count reported");
+}
+
+void TestIdentityAndSwizzle() {
+    std::cout << "\n=== Test: Identity / Swizzle ===" << std::endl;
+
+    const uint32_t width = 70;
+    const uint32_t height = 45;
+    std::vector<uint8_t> source(width * height * 4);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* p = &source[(y * width + x) * 4];
+            p[0] = static_cast<uint8_t>(x);
+            p[1] = static_cast<uint8_t>(y);
+            p[2] = static_cast<uint8_t>(x + y);
+            p[3] = 200;
+        }
+    }
+
+    std::vector<uint8_t> output(width * height * 4);
+    ImagePipelineOptions options;
+    TEST_ASSERT(RunImagePipeline(MakeDesc(width, height, ImageFormat::RGBA8, source.data()),
+                                 MakeDesc(width, height, ImageFormat::RGBA8, output.data()), options),
+                "Identity pipeline runs");
+    TEST_ASSERT(output == source, "Identity output matches input");
+
+    std::vector<uint8_t> bgr(width * height * 3);
+    RunImagePipeline(MakeDesc(width, height, ImageFormat::RGBA8, source.data()),
+                     MakeDesc(width, height, ImageFormat::RGB8, bgr.data()), options);
+    const size_t i = (10 * width + 20) * 3;
+    TEST_ASSERT(bgr[i] == 20 && bgr[i + 1] == 10 && bgr[i + 2] == 30, "RGB8 output packs channels");
+
+    TEST_ASSERT(!IsImagePipelineSupported(ImageFormat::RGBA8, ImageFormat::NV12), "YUV output rejected");
+}
+
+void TestCropRotate() {
+    std::cout << "\n=== Test: Crop + Rotate ===" << std::endl;
+
+    // 灰度图像素值编码坐标：value = y * 16 + x
+    const uint32_t width = 16;
+    const uint32_t height = 12;
+    std::vector<uint8_t> source(width * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            source[y * width + x] = static_cast<uint8_t>(y * 16 + x);
+        }
+    }
+
+    // 裁剪 (2, 3) 起 6 × 4，顺时针旋转 90° 后为 4 × 6
+    ImagePipelineOptions options;
+    options.cropX = 2;
+    options.cropY = 3;
+    options.cropWidth = 6;
+    options.cropHeight = 4;
+    options.rotation = ImageRotation::Rotate90;
+    options.filter = ResampleFilter::Nearest;
+
+    std::vector<uint8_t> output(4 * 6 * 4);
+    TEST_ASSERT(RunImagePipeline(MakeDesc(width, height, ImageFormat::GRAY8, source.data()),
+                                 MakeDesc(4, 6, ImageFormat::RGBA8, output.data()), options),
+                "Rotated crop runs");
+    // 输出左上角 = 裁剪区域左下角 (2, 6)；输出右上角 = 裁剪区域左上角 (2, 3)
+    TEST_ASSERT(output[0] == 6 * 16 + 2, "Top-left maps to crop bottom-left");
+    TEST_ASSERT(output[3 * 4] == 3 * 16 + 2, "Top-right maps to crop top-left");
+    // 输出左下角 = 裁剪区域右下角 (7, 6)
+    TEST_ASSERT(output[(5 * 4) * 4] == 6 * 16 + 7, "Bottom-left maps to crop bottom-right");
+
+    options.rotation = ImageRotation::Rotate180;
+    std::vector<uint8_t> flipped(6 * 4 * 4);
+    RunImagePipeline(MakeDesc(width, height, ImageFormat::GRAY8, source.data()),
+                     MakeDesc(6, 4, ImageFormat::RGBA8, flipped.data()), options);
+    TEST_ASSERT(flipped[0] == 6 * 16 + 7, "Rotate180 top-left is crop bottom-right");
+
+    options.cropWidth = 20;
+    TEST_ASSERT(!RunImagePipeline(MakeDesc(width, height, ImageFormat::GRAY8, source.data()),
+                                  MakeDesc(4, 6, ImageFormat::RGBA8, output.data()), options),
+                "Crop outside source rejected");
+}
+
+void TestYUVAndResize() {
+    std::cout << "\n=== Test: NV12 Convert + Resize ===" << std::endl;
+
+    // 左半 Y=16（黑），右半 Y=235（白），色度中性
+    const uint32_t width = 64;
+    const uint32_t height = 32;
+    std::vector<uint8_t> luma(width * height);
+    std::vector<uint8_t> chroma(width * height / 2, 128);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            luma[y * width + x] = x < width / 2 ? 16 : 235;
+        }
+    }
+    ImageDataDesc src = MakeDesc(width, height, ImageFormat::NV12, luma.data());
+    src.planes.push_back({chroma.data(), 0});
+
+    std::vector<uint8_t> output(16 * 8 * 4);
+    ImagePipelineOptions options;
+    TEST_ASSERT(RunImagePipeline(src, MakeDesc(16, 8, ImageFormat::RGBA8, output.data()), options),
+                "NV12 downscale runs");
+    TEST_ASSERT(output[0] == 0 && output[1] == 0 && output[2] == 0, "Video-range black maps to 0");
+    const size_t white = (7 * 16 + 15) * 4;
+    TEST_ASSERT(output[white] == 255 && output[white + 1] == 255 && output[white + 2] == 255,
+                "Video-range white maps to 255");
+
+    // 曲线反相
+    std::vector<uint8_t> curves(768);
+    for (int i = 0; i < 768; ++i) {
+        curves[i] = static_cast<uint8_t>(255 - (i & 255));
+    }
+    options.curves = curves.data();
+    RunImagePipeline(src, MakeDesc(16, 8, ImageFormat::BGRA8, output.data()), options);
+    TEST_ASSERT(output[0] == 255 && output[white] == 0 && output[3] == 255, "Curves applied after resize");
+}
+
+void TestOddSizeYUV() {
+    std::cout << "\n=== Test: Odd-size 4:2:0 Source ===" << std::endl;
+
+    // 7×5 源：色度平面按向下取整为 3×2，边缘的列/行沿用最后一个色度样本
+    const uint32_t width = 7;
+    const uint32_t height = 5;
+    std::vector<uint8_t> luma(width * height, 235);
+    std::vector<uint8_t> chroma((width / 2) * 2 * (height / 2), 128);
+    ImageDataDesc nv12 = MakeDesc(width, height, ImageFormat::NV12, luma.data());
+    nv12.planes.push_back({chroma.data(), 0});
+
+    std::vector<uint8_t> output(width * height * 4, 0);
+    ImagePipelineOptions options;
+    options.filter = ResampleFilter::Nearest;
+    TEST_ASSERT(RunImagePipeline(nv12, MakeDesc(width, height, ImageFormat::RGBA8, output.data()), options),
+                "Odd-size NV12 converts");
+    const size_t corner = (static_cast<size_t>(width) * height - 1) * 4;
+    TEST_ASSERT(output[corner] == 255 && output[corner + 1] == 255 && output[corner + 2] == 255,
+                "Edge pixel uses the last chroma sample");
+
+    std::vector<uint8_t> u420((width / 2) * (height / 2), 128);
+    std::vector<uint8_t> v420((width / 2) * (height / 2), 128);
+    ImageDataDesc planar = MakeDesc(width, height, ImageFormat::YUV420P, luma.data());
+    planar.planes.push_back({u420.data(), 0});
+    planar.planes.push_back({v420.data(), 0});
+    TEST_ASSERT(RunImagePipeline(planar, MakeDesc(width, height, ImageFormat::RGBA8, output.data()), options) &&
+                    output[corner] == 255,
+                "Odd-size YUV420P converts");
+
+    ImageDataDesc column = MakeDesc(1, height, ImageFormat::NV12, luma.data());
+    column.planes.push_back({chroma.data(), 0});
+    TEST_ASSERT(!RunImagePipeline(column, MakeDesc(1, height, ImageFormat::RGBA8, output.data()), options),
+                "4:2:0 source without chroma samples rejected");
+}
+
+void TestThreadingDeterministic() {
+    std::cout << "\n=== Test: Multi-threaded Output ===" << std::endl;
+
+    const uint32_t width = 301;
+    const uint32_t height = 203;
+    std::vector<uint8_t> source(width * height * 3);
+    for (size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<uint8_t>(i * 7 + (i >> 5));
+    }
+
+    ImagePipelineOptions options;
+    options.rotation = ImageRotation::Rotate270;
+    options.tileSize = 16;
+    std::vector<uint8_t> serial(150 * 220 * 4);
+    std::vector<uint8_t> parallel(serial.size());
+
+    options.maxThreads = 1;
+    RunImagePipeline(MakeDesc(width, height, ImageFormat::RGB8, source.data()),
+                     MakeDesc(150, 220, ImageFormat::RGBA8, serial.data()), options);
+    options.maxThreads = 0;
+    RunImagePipeline(MakeDesc(width, height, ImageFormat::RGB8, source.data()),
+                     MakeDesc(150, 220, ImageFormat::RGBA8, parallel.data()), options);
+    TEST_ASSERT(serial == parallel, "Parallel output equals serial output");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImagePipeline Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestParallelFor();
+    TestIdentityAndSwizzle();
+    TestCropRotate();
+    TestYUVAndResize();
+    TestOddSizeYUV();
+    TestThreadingDeterministic();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file TestImageStatistics.cpp
+ * @brief 图像统计单元测试
+ */
+
+#include "lrengine/utils/ImageStatistics.h"
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static bool Near(float a, float b, float epsilon = 1.0e-4f) {
+    return std::fabs(a - b) <= epsilon;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestRGBA() {
+    std::cout << "\n=== Test: RGBA8 Statistics ===" << std::endl;
+
+    // 奇数宽度覆盖 SIMD 尾部，行距带填充
+    const uint32_t width = 37;
+    const uint32_t height = 5;
+    const uint32_t stride = width * 4 + 12;
+    std::vector<uint8_t> pixels(stride * height, 0xEE);
+
+    uint64_t sums[4] = {};
+    uint32_t histogram[256] = {};
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* p = &pixels[y * stride + x * 4];
+            p[0] = static_cast<uint8_t>(x * 7 + y);
+            p[1] = static_cast<uint8_t>(200 - x * 3);
+            p[2] = static_cast<uint8_t>(x * y);
+            p[3] = 255;
+            for (int c = 0; c < 4; ++c) {
+                sums[c] += p[c];
+            }
+            ++histogram[(p[0] * 54 + p[1] * 183 + p[2] * 19 + 128) >> 8];
+        }
+    }
+
+    ImageDataDesc image;
+    image.width = width;
+    image.height = height;
+    image.format = ImageFormat::RGBA8;
+    image.planes.push_back({pixels.data(), stride});
+
+    ImageStatistics stats;
+    ImageStatisticsOptions options;
+    options.gridStep = 1;
+    TEST_ASSERT(ComputeImageStatistics(image, stats, options), "RGBA8 supported");
+    TEST_ASSERT(stats.sampleCount == width * height, "Full grid sample count");
+
+    bool meansMatch = true;
+    for (int c = 0; c < 4; ++c) {
+        meansMatch &= Near(stats.channelMean[c], sums[c] / (255.0f * width * height));
+    }
+    TEST_ASSERT(meansMatch, "Channel means match reference");
+    TEST_ASSERT(stats.channelMin[1] == (200 - 36 * 3) / 255.0f && stats.channelMax[1] == 200 / 255.0f,
+                "Green min/max");
+
+    bool histogramMatches = true;
+    for (int bin = 0; bin < 256; ++bin) {
+        histogramMatches &= stats.lumaHistogram[bin] == histogram[bin];
+    }
+    TEST_ASSERT(histogramMatches, "Luma histogram matches reference");
+
+    // BGRA8 重排后结果一致
+    std::vector<uint8_t> swapped(pixels);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            std::swap(swapped[y * stride + x * 4], swapped[y * stride + x * 4 + 2]);
+        }
+    }
+    image.format = ImageFormat::BGRA8;
+    image.planes[0].data = swapped.data();
+    ImageStatistics bgra;
+    ComputeImageStatistics(image, bgra, options);
+    TEST_ASSERT(Near(bgra.channelMean[0], stats.channelMean[0]) && Near(bgra.meanLuma, stats.meanLuma),
+                "BGRA8 channels reordered");
+
+    // 子采样网格：第 0、4 行 x 的 0、4、8 ... 36 列
+    options.gridStep = 4;
+    ComputeImageStatistics(image, bgra, options);
+    TEST_ASSERT(bgra.sampleCount == 10 * 2, "Subsampled grid sample count");
+}
+
+void TestNV12() {
+    std::cout << "\n=== Test: NV12 Statistics ===" << std::endl;
+
+    const uint32_t width = 64;
+    const uint32_t height = 8;
+    std::vector<uint8_t> luma(width * height, 126);
+    std::vector<uint8_t> chroma(width * height / 2);
+    for (size_t i = 0; i < chroma.size(); i += 2) {
+        chroma[i] = 128;      // U
+        chroma[i + 1] = 160;  // V：偏红
+    }
+
+    ImageDataDesc image;
+    image.width = width;
+    image.height = height;
+    image.format = ImageFormat::NV12;
+    image.range = ColorRange::Full;
+    image.planes.push_back({luma.data(), 0});
+    image.planes.push_back({chroma.data(), 0});
+
+    ImageStatistics stats;
+    TEST_ASSERT(ComputeImageStatistics(image, stats), "NV12 supported");
+    TEST_ASSERT(stats.lumaHistogram[126] == stats.sampleCount && stats.sampleCount == 16 * 2,
+                "Flat luma histogram");
+    TEST_ASSERT(Near(stats.channelMean[2], 160 / 255.0f), "V mean");
+    TEST_ASSERT(stats.meanRGB[0] > stats.meanRGB[1] && stats.whiteBalanceGains[0] < 1.0f,
+                "Red cast lowers red gain");
+    TEST_ASSERT(Near(GetLumaPercentile(stats, 0.5f), 126 / 255.0f), "Median luma");
+
+    image.format = ImageFormat::NV21;
+    ImageStatistics swapped;
+    ComputeImageStatistics(image, swapped);
+    TEST_ASSERT(Near(swapped.channelMean[1], 160 / 255.0f), "NV21 swaps U and V");
+
+    image.format = ImageFormat::RGBA16F;
+    TEST_ASSERT(!ComputeImageStatistics(image, stats), "RGBA16F rejected");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImageStatistics Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestRGBA();
+    TestNV12();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file TestImageTiling.cpp
+ * @brief 大图分块单元测试
+ */
+
+#include "lrengine/utils/ImageTiling.h"
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace lrengine;
+using namespace lrengine::utils;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestGrid() {
+    std::cout << "\n=== Test: Tile Grid ===" << std::endl;
+
+    // 12000 × 9000 的照片，设备上限 4096，保护带 32
+    ImageTileGrid grid;
+    TEST_ASSERT(ComputeImageTiles(12000, 9000, 4096, 32, grid), "Grid computed");
+    TEST_ASSERT(grid.columns == 3 && grid.rows == 3, "3x3 tiles");
+    TEST_ASSERT(grid.tileWidth == 4000 && grid.tileHeight == 3000, "Tiles split evenly");
+    TEST_ASSERT(grid.paddedWidth <= 4096 && grid.paddedHeight <= 4096, "Padded tiles fit max size");
+
+    uint64_t area = 0;
+    for (const ImageTile& tile : grid.tiles) {
+        area += static_cast<uint64_t>(tile.width) * tile.height;
+    }
+    TEST_ASSERT(area == 12000ull * 9000ull, "Tiles cover image exactly");
+
+    TEST_ASSERT(ComputeImageTiles(1000, 10, 4096, 32, grid) && grid.tiles.size() == 1, "Small image single tile");
+    TEST_ASSERT(!ComputeImageTiles(1000, 1000, 64, 32, grid), "Guard band too large rejected");
+}
+
+void TestRoundTrip() {
+    std::cout << "\n=== Test: Extract / Store Round Trip ===" << std::endl;
+
+    const uint32_t width = 37;
+    const uint32_t height = 23;
+    const uint32_t stride = width * 4 + 12;
+    std::vector<uint8_t> source(stride * height);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* pixel = &source[y * stride + x * 4];
+            pixel[0] = static_cast<uint8_t>(x);
+            pixel[1] = static_cast<uint8_t>(y);
+            pixel[2] = static_cast<uint8_t>(x ^ y);
+            pixel[3] = 255;
+        }
+    }
+
+    ImageDataDesc input;
+    input.width = width;
+    input.height = height;
+    input.format = ImageFormat::RGBA8;
+    input.planes.push_back({source.data(), stride});
+
+    std::vector<uint8_t> result(width * height * 4, 0);
+    ImageDataDesc output = input;
+    output.planes[0] = {result.data(), 0};
+
+    ImageTileGrid grid;
+    ComputeImageTiles(width, height, 20, 3, grid);
+    TEST_ASSERT(grid.columns == 3 && grid.rows == 2, "Small grid");
+
+    std::vector<uint8_t> tile(grid.paddedWidth * grid.paddedHeight * 4);
+    bool ok = true;
+    for (uint32_t i = 0; i < grid.tiles.size(); ++i) {
+        ok = ok && ExtractImageTile(input, grid, i, tile.data());
+        ok = ok && StoreImageTile(tile.data(), 0, grid, i, output);
+    }
+    TEST_ASSERT(ok, "All tiles extracted and stored");
+
+    bool same = true;
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width * 4; ++x) {
+            same = same && result[y * width * 4 + x] == source[y * stride + x];
+        }
+    }
+    TEST_ASSERT(same, "Stitched output matches input");
+
+    // 左上角块的保护带按边缘像素填充
+    ExtractImageTile(input, grid, 0, tile.data());
+    const uint32_t padded = grid.paddedWidth * 4;
+    TEST_ASSERT(tile[0] == 0 && tile[1] == 0, "Corner guard clamps to (0, 0)");
+    TEST_ASSERT(tile[3 * padded + 5 * 4] == 2 && tile[3 * padded + 5 * 4 + 1] == 0, "Core starts after guard");
+
+    // 右下角块超出图像的部分复制最后一行/列
+    const uint32_t last = static_cast<uint32_t>(grid.tiles.size()) - 1;
+    ExtractImageTile(input, grid, last, tile.data());
+    const size_t corner = (grid.paddedHeight - 1) * padded + (grid.paddedWidth - 1) * 4;
+    TEST_ASSERT(tile[corner] == width - 1 && tile[corner + 1] == height - 1, "Far guard clamps to last pixel");
+
+    input.format = ImageFormat::NV12;
+    TEST_ASSERT(!ExtractImageTile(input, grid, 0, tile.data()), "Planar format rejected");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "ImageTiling Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestGrid();
+    TestRoundTrip();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file TestLRStaticBatch.cpp
+ * @brief LRStaticBatcher 静态合批单元测试
+ */
+
+#include "lrengine/core/LRStaticBatch.h"
+
+#include <iostream>
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+using namespace lrengine::render;
+using namespace lrengine::math;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+struct Vertex {
+    float position[3];
+    float normal[3];
+};
+
+static StaticBatchOptions MakeOptions(uint32_t maxChunkVertices) {
+    StaticBatchOptions options;
+    VertexAttribute pos;
+    pos.location = 0;
+    pos.format = VertexFormat::Float3;
+    pos.offset = 0;
+    VertexAttribute nrm;
+    nrm.location = 1;
+    nrm.format = VertexFormat::Float3;
+    nrm.offset = 12;
+    options.layout.attributes = {pos, nrm};
+    options.layout.stride = sizeof(Vertex);
+    options.normalLocation = 1;
+    options.maxChunkVertices = maxChunkVertices;
+    return options;
+}
+
+static Mat4f MakeTranslation(float x, float y, float z) {
+    Mat4f m = Mat4f::identity();
+    m.m30 = x;
+    m.m31 = y;
+    m.m32 = z;
+    return m;
+}
+
+static const Vertex s_triangle[3] = {
+    {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+    {{1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+    {{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},
+};
+static const uint16_t s_indices[3] = {0, 1, 2};
+
+static StaticMeshInstance MakeInstance(float x, uint32_t material) {
+    StaticMeshInstance instance;
+    instance.vertexData = s_triangle;
+    instance.vertexCount = 3;
+    instance.indexData = s_indices;
+    instance.indexCount = 3;
+    instance.indexType = IndexType::UInt16;
+    instance.worldMatrix = MakeTranslation(x, 0.0f, 0.0f);
+    instance.materialID = material;
+    return instance;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestSingleChunkMaterialRanges() {
+    std::cout << "\n=== Test: Single Chunk Material Ranges ===" << std::endl;
+
+    LRStaticBatcher batcher(MakeOptions(1024));
+    batcher.AddInstance(MakeInstance(0.0f, 2));
+    batcher.AddInstance(MakeInstance(5.0f, 1));
+    batcher.AddInstance(MakeInstance(10.0f, 2));
+
+    TEST_ASSERT(batcher.Build(), "Build succeeds");
+
+    const auto& chunks = batcher.GetChunks();
+    TEST_ASSERT(chunks.size() == 1, "All instances fit in one chunk");
+    TEST_ASSERT(chunks[0].vertexCount == 9, "Chunk vertex count");
+    TEST_ASSERT(chunks[0].indexCount == 9, "Chunk index count");
+    TEST_ASSERT(chunks[0].indexType == IndexType::UInt16, "Small chunk uses 16-bit indices");
+    TEST_ASSERT(chunks[0].ranges.size() == 2, "One range per material");
+    TEST_ASSERT(chunks[0].ranges[0].materialID == 1 && chunks[0].ranges[0].indexCount == 3,
+                "Material 1 range");
+    TEST_ASSERT(chunks[0].ranges[1].materialID == 2 && chunks[0].ranges[1].indexCount == 6,
+                "Material 2 ranges merged");
+    TEST_ASSERT(chunks[0].ranges[1].indexStart == 3, "Material 2 range follows material 1");
+
+    const uint16_t* indices = reinterpret_cast<const uint16_t*>(chunks[0].indexData.data());
+    bool remapped = true;
+    for (uint32_t i = 0; i < chunks[0].indexCount; ++i) {
+        remapped = remapped && indices[i] < chunks[0].vertexCount;
+    }
+    TEST_ASSERT(remapped, "Indices remapped into chunk vertex range");
+}
+
+void TestWorldSpaceTransform() {
+    std::cout << "\n=== Test: World Space Transform ===" << std::endl;
+
+    LRStaticBatcher batcher(MakeOptions(1024));
+    batcher.AddInstance(MakeInstance(10.0f, 0));
+    batcher.Build();
+
+    const auto& chunk = batcher.GetChunks()[0];
+    Vertex v[3];
+    std::memcpy(v, chunk.vertexData.data(), sizeof(v));
+
+    TEST_ASSERT(std::fabs(v[1].position[0] - 11.0f) < 1e-5f, "Position pre-transformed");
+    TEST_ASSERT(std::fabs(v[1].normal[2] - 1.0f) < 1e-5f, "Normal unaffected by translation");
+    TEST_ASSERT(std::fabs(chunk.bounds.min.x - 10.0f) < 1e-5f &&
+                std::fabs(chunk.bounds.max.x - 11.0f) < 1e-5f, "Chunk bounds in world space");
+}
+
+void TestChunkSplitting() {
+    std::cout << "\n=== Test: Chunk Splitting ===" << std::endl;
+
+    LRStaticBatcher batcher(MakeOptions(6));
+    for (int i = 0; i < 5; ++i) {
+        batcher.AddInstance(MakeInstance(static_cast<float>(i) * 100.0f, 0));
+    }
+    batcher.Build();
+
+    const auto& chunks = batcher.GetChunks();
+    TEST_ASSERT(chunks.size() == 3, "Chunks split by max vertex count");
+
+    bool withinLimit = true;
+    uint32_t totalIndices = 0;
+    for (const auto& chunk : chunks) {
+        withinLimit = withinLimit && chunk.vertexCount <= 6;
+        totalIndices += chunk.indexCount;
+    }
+    TEST_ASSERT(withinLimit, "No chunk exceeds configured size");
+    TEST_ASSERT(totalIndices == 15, "All indices preserved");
+    TEST_ASSERT(chunks[0].bounds.max.x < chunks[2].bounds.min.x, "Chunks are spatially coherent");
+}
+
+void TestInvalidLayout() {
+    std::cout << "\n=== Test: Invalid Layout ===" << std::endl;
+
+    StaticBatchOptions options = MakeOptions(1024);
+    options.positionLocation = 7;
+    LRStaticBatcher batcher(options);
+    batcher.AddInstance(MakeInstance(0.0f, 0));
+    TEST_ASSERT(!batcher.Build(), "Build fails without position attribute");
+
+    StaticMeshInstance empty;
+    TEST_ASSERT(!batcher.AddInstance(empty), "Empty instance rejected");
+}
+
+void TestOutOfRangeIndices() {
+    std::cout << "\n=== Test: Out Of Range Indices ===" << std::endl;
+
+    LRStaticBatcher batcher(MakeOptions(1024));
+    static const uint16_t badIndices[3] = {0, 1, 3};
+    StaticMeshInstance instance = MakeInstance(0.0f, 0);
+    instance.indexData = badIndices;
+    TEST_ASSERT(!batcher.AddInstance(instance), "Index past vertex count rejected");
+    TEST_ASSERT(batcher.GetInstanceCount() == 0, "Rejected instance not added");
+
+    static const uint32_t wideIndices[3] = {2, 1, 0};
+    instance.indexData = wideIndices;
+    instance.indexType = IndexType::UInt32;
+    TEST_ASSERT(batcher.AddInstance(instance), "Valid UInt32 indices accepted");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "LRStaticBatch Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestSingleChunkMaterialRanges();
+    TestWorldSpaceTransform();
+    TestChunkSplitting();
+    TestInvalidLayout();
+    TestOutOfRangeIndices();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,276 @@
+/**
+ * @file TestMemoryTrim.cpp
+ * @brief LRRenderContext::TrimMemory 内存回收单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRRenderTargetPool.h"
+#include "lrengine/core/LRStreamingPlanarTexture.h"
+#include "lrengine/core/LRTextureArray.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestHandlersAndBackend() {
+    std::cout << "\n=== Test: Handlers And Backend ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    std::vector<MemoryTrimLevel> seen;
+    uint32_t id = context->RegisterMemoryTrimHandler([&seen](MemoryTrimLevel level) {
+        seen.push_back(level);
+        return size_t(2);
+    });
+    Stats().trimResult = 3;
+
+    size_t released = context->TrimMemory(MemoryTrimLevel::Moderate);
+    TEST_ASSERT(released == 5, "Handler and backend counts are summed");
+    TEST_ASSERT(seen.size() == 1 && seen[0] == MemoryTrimLevel::Moderate, "Handler receives the level");
+    TEST_ASSERT(Stats().trimRequests.size() == 1 && Stats().trimRequests[0] == MemoryTrimLevel::Moderate,
+                "Backend receives the level");
+
+    context->UnregisterMemoryTrimHandler(id);
+    released = context->TrimMemory(MemoryTrimLevel::Low);
+    TEST_ASSERT(released == 3 && seen.size() == 1, "Unregistered handler is not called");
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestDeferredTrimRequest() {
+    std::cout << "\n=== Test: Deferred Trim Request ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    std::vector<MemoryTrimLevel> seen;
+    uint32_t id = context->RegisterMemoryTrimHandler([&seen](MemoryTrimLevel level) {
+        seen.push_back(level);
+        return size_t(0);
+    });
+
+    // 其他线程只记录请求，不直接执行回调
+    std::thread([context]() {
+        context->RequestMemoryTrim(MemoryTrimLevel::Moderate);
+        context->RequestMemoryTrim(MemoryTrimLevel::Low);
+    }).join();
+    TEST_ASSERT(seen.empty() && Stats().trimRequests.empty(), "Request does not trim immediately");
+
+    context->BeginFrame();
+    TEST_ASSERT(seen.size() == 1 && seen[0] == MemoryTrimLevel::Moderate, "BeginFrame applies the highest level");
+    TEST_ASSERT(Stats().trimRequests.size() == 1, "Backend trimmed once");
+    context->EndFrame();
+
+    context->BeginFrame();
+    TEST_ASSERT(seen.size() == 1, "Request consumed by one frame");
+    context->EndFrame();
+
+    context->UnregisterMemoryTrimHandler(id);
+    LRRenderContext::Destroy(context);
+}
+
+void TestUnregisterDuringTrim() {
+    std::cout << "\n=== Test: Unregister During Trim ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    // 第一个回调注销第二个与自身，第二个不应再被调用
+    int secondCalls = 0;
+    uint32_t second = 0;
+    uint32_t first = 0;
+    first = context->RegisterMemoryTrimHandler([&](MemoryTrimLevel) {
+        context->UnregisterMemoryTrimHandler(second);
+        context->UnregisterMemoryTrimHandler(first);
+        return size_t(1);
+    });
+    second = context->RegisterMemoryTrimHandler([&secondCalls](MemoryTrimLevel) {
+        ++secondCalls;
+        return size_t(1);
+    });
+
+    TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Complete) == 1, "Only the first handler ran");
+    TEST_ASSERT(secondCalls == 0, "Handler unregistered mid-trim is skipped");
+    TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Complete) == 0, "Self-unregistered handler removed");
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestRenderTargetPoolTrim() {
+    std::cout << "\n=== Test: Render Target Pool Trim ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRRenderTargetPool pool;
+        pool.Initialize(context);
+        PooledRenderTarget* a = pool.Acquire(16, 16, PixelFormat::RGBA8);
+        PooledRenderTarget* b = pool.Acquire(16, 16, PixelFormat::RGBA8);
+        pool.Recycle(a);
+
+        size_t released = context->TrimMemory(MemoryTrimLevel::Moderate);
+        TEST_ASSERT(released == 1, "Context trim releases the idle pooled target");
+        TEST_ASSERT(pool.GetTargetCount() == 1, "Target in use is kept");
+
+        pool.Recycle(b);
+    }
+    TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Complete) == 0, "Destroyed pool is unregistered");
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestTextureArrayTrim() {
+    std::cout << "\n=== Test: Texture Array Trim ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRTextureArrayAllocator allocator;
+        TextureArrayAllocatorDescriptor desc;
+        desc.layersPerPage = 4;
+        allocator.Initialize(context, desc);
+
+        TextureArrayLayer small;
+        TextureArrayLayer large;
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, small);
+        allocator.Allocate(16, 16, PixelFormat::RGBA8, nullptr, large);
+        TEST_ASSERT(allocator.GetPageCount() == 2 && Stats().liveTextures == 2, "Two pages allocated");
+
+        allocator.Free(small);
+        TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Low) == 0, "Low keeps empty pages");
+        TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Moderate) == 1, "Moderate releases the empty page");
+        TEST_ASSERT(allocator.GetPageCount() == 1 && Stats().liveTextures == 1, "Only the used page remains");
+
+        // 其余层的页编号保持有效
+        uint8_t pixels[16 * 16 * 4] = {};
+        Stats().textureUploads.clear();
+        allocator.Update(large, pixels);
+        TEST_ASSERT(Stats().textureUploads.size() == 1 && Stats().textureUploads[0].texture != nullptr,
+                    "Surviving layer still updates after trim");
+
+        TextureArrayLayer again;
+        TEST_ASSERT(allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, again) && again.page == small.page,
+                    "Trimmed page slot is reused");
+        TEST_ASSERT(allocator.GetPageCount() == 2, "Page recreated on demand");
+    }
+    TEST_ASSERT(Stats().liveTextures == 0, "Allocator releases its pages");
+    TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Complete) == 0, "Destroyed allocator is unregistered");
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestStreamingTextureTrim() {
+    std::cout << "\n=== Test: Streaming Texture Trim ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    const uint32_t width = 8;
+    const uint32_t height = 4;
+    std::vector<uint8_t> frame(width * height * 3 / 2, 0x80);
+    ImageDataDesc image;
+    image.width = width;
+    image.height = height;
+    image.format = ImageFormat::NV12;
+    image.planes = {{frame.data(), 0}, {frame.data() + width * height, 0}};
+
+    {
+        StreamingPlanarTextureDescriptor desc;
+        desc.planar.width = width;
+        desc.planar.height = height;
+        desc.planar.format = PlanarFormat::NV12;
+        desc.ringSize = 3;
+
+        LRStreamingPlanarTexture stream;
+        stream.Initialize(context, desc);
+        stream.UpdateFromImage(image);
+        stream.UpdateFromImage(image);
+        LRPlanarTexture* current = stream.GetCurrent();
+        const int texturesPerFrame = 2;
+        TEST_ASSERT(Stats().liveTextures == 3 * texturesPerFrame, "Ring textures created");
+
+        TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Low) == 0, "Low keeps the ring");
+        TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Moderate) == 2, "Moderate releases idle ring textures");
+        TEST_ASSERT(Stats().liveTextures == texturesPerFrame, "Current texture kept");
+        TEST_ASSERT(stream.GetCurrent() == current, "Current frame unaffected");
+
+        TEST_ASSERT(stream.UpdateFromImage(image), "Upload after trim succeeds");
+        TEST_ASSERT(Stats().liveTextures == 2 * texturesPerFrame, "Released texture recreated on demand");
+    }
+    TEST_ASSERT(context->TrimMemory(MemoryTrimLevel::Complete) == 0, "Destroyed stream is unregistered");
+
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Memory Trim Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestHandlersAndBackend();
+    TestDeferredTrimRequest();
+    TestUnregisterDuringTrim();
+    TestRenderTargetPoolTrim();
+    TestTextureArrayTrim();
+    TestStreamingTextureTrim();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
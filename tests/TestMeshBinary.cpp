@@ -0,0 +1,179 @@
+/**
+ * @file TestMeshBinary.cpp
+ * @brief LRMeshBinary 序列化与解析单元测试
+ */
+
+#include "lrengine/core/LRMeshBinary.h"
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace lrengine::render;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+// 四个顶点：位置 (float3) + 纹理坐标 (float2)
+static const float s_vertices[4 * 5] = {
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    1.0f, 0.0f, 0.0f, 1.0f, 0.0f,
+    1.0f, 1.0f, 0.0f, 1.0f, 1.0f,
+    0.0f, 1.0f, 0.0f, 0.0f, 1.0f,
+};
+static const uint16_t s_indices[6] = {0, 1, 2, 2, 3, 0};
+
+static MeshBinarySource MakeQuadSource() {
+    MeshBinarySource source;
+    source.layout.stride = sizeof(float) * 5;
+    source.layout.attributes.resize(2);
+    source.layout.attributes[0].location = 0;
+    source.layout.attributes[0].format = VertexFormat::Float3;
+    source.layout.attributes[0].offset = 0;
+    source.layout.attributes[1].location = 1;
+    source.layout.attributes[1].format = VertexFormat::Float2;
+    source.layout.attributes[1].offset = sizeof(float) * 3;
+    source.vertexData = s_vertices;
+    source.vertexCount = 4;
+    source.indexData = s_indices;
+    source.indexCount = 6;
+    source.indexType = IndexType::UInt16;
+    source.boundsMax[0] = 1.0f;
+    source.boundsMax[1] = 1.0f;
+    return source;
+}
+
+// 修改已序列化数据中第 index 个属性
+static MeshBinaryAttribute* AttributeAt(std::vector<uint8_t>& bytes, uint32_t index) {
+    const MeshBinaryHeader* header = reinterpret_cast<const MeshBinaryHeader*>(bytes.data());
+    return reinterpret_cast<MeshBinaryAttribute*>(bytes.data() + header->attributesOffset) + index;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestRoundTrip() {
+    std::cout << "\n=== Test: Serialize / Parse Round Trip ===" << std::endl;
+
+    MeshBinarySource source = MakeQuadSource();
+    std::vector<uint8_t> bytes;
+    TEST_ASSERT(LRMeshBinary::Serialize(source, bytes), "Serialize succeeds");
+
+    MeshBinaryView view;
+    TEST_ASSERT(LRMeshBinary::Parse(bytes.data(), bytes.size(), view), "Parse succeeds");
+    if (!view.header) {
+        return;
+    }
+
+    TEST_ASSERT(view.header->vertexCount == 4 && view.header->indexCount == 6, "Counts preserved");
+    TEST_ASSERT(view.GetIndexType() == IndexType::UInt16, "Index type preserved");
+    TEST_ASSERT(view.header->vertexDataOffset % LRMeshBinary::kDataAlignment == 0 &&
+                view.header->indexDataOffset % LRMeshBinary::kDataAlignment == 0,
+                "Data sections are aligned");
+    TEST_ASSERT(std::memcmp(view.vertexData, s_vertices, sizeof(s_vertices)) == 0, "Vertex data preserved");
+    TEST_ASSERT(std::memcmp(view.indexData, s_indices, sizeof(s_indices)) == 0, "Index data preserved");
+
+    VertexLayoutDescriptor layout = view.GetVertexLayout();
+    TEST_ASSERT(layout.stride == source.layout.stride && layout.attributes.size() == 2,
+                "Layout stride and attribute count preserved");
+    TEST_ASSERT(layout.attributes.size() == 2 && layout.attributes[1].format == VertexFormat::Float2 &&
+                layout.attributes[1].offset == sizeof(float) * 3 && layout.attributes[1].location == 1,
+                "Attribute fields preserved");
+
+    TEST_ASSERT(view.header->subMeshCount == 1 && view.subMeshes[0].indexStart == 0 &&
+                view.subMeshes[0].indexCount == 6, "Default sub-mesh covers all indices");
+    TEST_ASSERT(view.header->boundsMax[0] == 1.0f && view.subMeshes[0].boundsMax[1] == 1.0f,
+                "Bounds preserved");
+}
+
+void TestParseRejectsInvalidAttributes() {
+    std::cout << "\n=== Test: Parse Rejects Invalid Attributes ===" << std::endl;
+
+    std::vector<uint8_t> valid;
+    LRMeshBinary::Serialize(MakeQuadSource(), valid);
+    MeshBinaryView view;
+
+    std::vector<uint8_t> bytes = valid;
+    AttributeAt(bytes, 0)->format = 0xFF;
+    TEST_ASSERT(!LRMeshBinary::Parse(bytes.data(), bytes.size(), view), "Unknown vertex format rejected");
+
+    bytes = valid;
+    AttributeAt(bytes, 1)->offset = sizeof(float) * 4;
+    TEST_ASSERT(!LRMeshBinary::Parse(bytes.data(), bytes.size(), view), "Attribute past vertex stride rejected");
+
+    bytes = valid;
+    AttributeAt(bytes, 1)->stride = sizeof(float);
+    TEST_ASSERT(!LRMeshBinary::Parse(bytes.data(), bytes.size(), view), "Attribute past its own stride rejected");
+
+    bytes = valid;
+    reinterpret_cast<MeshBinaryHeader*>(bytes.data())->attributeCount = 0;
+    TEST_ASSERT(!LRMeshBinary::Parse(bytes.data(), bytes.size(), view), "Mesh without attributes rejected");
+
+    TEST_ASSERT(!LRMeshBinary::Parse(valid.data(), valid.size() - 1, view), "Truncated data rejected");
+    TEST_ASSERT(view.header == nullptr, "Failed parse leaves view empty");
+}
+
+void TestSerializeRejectsInvalidSource() {
+    std::cout << "\n=== Test: Serialize Rejects Invalid Source ===" << std::endl;
+
+    std::vector<uint8_t> bytes;
+
+    MeshBinarySource source = MakeQuadSource();
+    source.layout.attributes[1].offset = sizeof(float) * 4;
+    TEST_ASSERT(!LRMeshBinary::Serialize(source, bytes), "Attribute past stride rejected");
+
+    source = MakeQuadSource();
+    MeshBinarySubMesh sub;
+    sub.indexStart = 3;
+    sub.indexCount = 6;
+    source.subMeshes.push_back(sub);
+    TEST_ASSERT(!LRMeshBinary::Serialize(source, bytes), "Sub-mesh past index range rejected");
+
+    // 顶点数据超过 32 位偏移范围（只检查大小，不读取数据）
+    source = MakeQuadSource();
+    source.vertexCount = 0x40000000u;
+    TEST_ASSERT(!LRMeshBinary::Serialize(source, bytes), "Oversized vertex data rejected");
+
+    source = MakeQuadSource();
+    source.indexCount = 0xFFFFFFF0u;
+    source.indexType = IndexType::UInt32;
+    TEST_ASSERT(!LRMeshBinary::Serialize(source, bytes), "Oversized index data rejected");
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Mesh Binary Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestRoundTrip();
+    TestParseRejectsInvalidAttributes();
+    TestSerializeRejectsInvalidSource();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
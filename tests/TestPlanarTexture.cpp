@@ -0,0 +1,234 @@
+/**
+ * @file TestPlanarTexture.cpp
+ * @brief LRPlanarTexture 上传路径单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRPlanarTexture.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static const uint32_t kWidth = 8;
+static const uint32_t kHeight = 4;
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+static LRPlanarTexture* MakePackedTexture(LRRenderContext* context) {
+    PlanarTextureDescriptor desc;
+    desc.width = kWidth;
+    desc.height = kHeight;
+    desc.format = PlanarFormat::NV12;
+    desc.layout = PlanarTextureLayout::Packed;
+    return context->CreatePlanarTexture(desc);
+}
+
+// 连续紧密排列的 NV12 帧：Y 行之后紧跟 UV 行
+static std::vector<uint8_t> MakeFrame() {
+    std::vector<uint8_t> frame(kWidth * (kHeight + kHeight / 2));
+    for (size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<uint8_t>(i + 1);
+    }
+    return frame;
+}
+
+// 把紧密帧的行拷贝到带填充的行中
+static std::vector<uint8_t> MakeStrided(const uint8_t* rows, uint32_t rowCount, uint32_t stride) {
+    std::vector<uint8_t> strided(static_cast<size_t>(stride) * rowCount, 0xEE);
+    for (uint32_t y = 0; y < rowCount; ++y) {
+        std::memcpy(strided.data() + static_cast<size_t>(stride) * y, rows + kWidth * y, kWidth);
+    }
+    return strided;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestPackedContiguousUpload() {
+    std::cout << "\n=== Test: Packed Contiguous Upload ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    LRPlanarTexture* texture = context ? MakePackedTexture(context) : nullptr;
+    TEST_ASSERT(texture != nullptr, "Packed NV12 texture created");
+    if (!texture) {
+        LRRenderContext::Destroy(context);
+        return;
+    }
+
+    std::vector<uint8_t> frame = MakeFrame();
+    ImageDataDesc image;
+    image.width = kWidth;
+    image.height = kHeight;
+    image.format = ImageFormat::NV12;
+    image.planes = {{frame.data(), 0}, {frame.data() + kWidth * kHeight, 0}};
+
+    Stats().textureUploads.clear();
+    TEST_ASSERT(texture->UpdateFromImage(image), "UpdateFromImage succeeds");
+    TEST_ASSERT(Stats().textureUploads.size() == 1, "Contiguous frame uploads once");
+    TEST_ASSERT(!Stats().textureUploads.empty() && !Stats().textureUploads[0].hasRegion &&
+                Stats().textureUploads[0].data == frame, "Whole frame uploaded as-is");
+
+    texture->Release();
+    LRRenderContext::Destroy(context);
+}
+
+void TestPackedStridedUpload() {
+    std::cout << "\n=== Test: Packed Strided Upload ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    LRPlanarTexture* texture = context ? MakePackedTexture(context) : nullptr;
+    if (!texture) {
+        TEST_ASSERT(false, "Packed NV12 texture created");
+        LRRenderContext::Destroy(context);
+        return;
+    }
+
+    std::vector<uint8_t> frame = MakeFrame();
+    const uint32_t stride = kWidth + 8;
+    std::vector<uint8_t> y = MakeStrided(frame.data(), kHeight, stride);
+    std::vector<uint8_t> uv = MakeStrided(frame.data() + kWidth * kHeight, kHeight / 2, stride);
+
+    ImageDataDesc image;
+    image.width = kWidth;
+    image.height = kHeight;
+    image.format = ImageFormat::NV12;
+    image.planes = {{y.data(), stride}, {uv.data(), stride}};
+
+    Stats().textureUploads.clear();
+    TEST_ASSERT(texture->UpdateFromImage(image), "UpdateFromImage with strides succeeds");
+    TEST_ASSERT(Stats().textureUploads.size() == 1, "Strided frame still uploads once");
+    TEST_ASSERT(!Stats().textureUploads.empty() && Stats().textureUploads[0].data == frame,
+                "Strided rows compacted into packed layout");
+
+    texture->Release();
+    LRRenderContext::Destroy(context);
+}
+
+void TestPackedUpdateAllPlanes() {
+    std::cout << "\n=== Test: Packed UpdateAllPlanes ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    LRPlanarTexture* texture = context ? MakePackedTexture(context) : nullptr;
+    if (!texture) {
+        TEST_ASSERT(false, "Packed NV12 texture created");
+        LRRenderContext::Destroy(context);
+        return;
+    }
+
+    std::vector<uint8_t> frame = MakeFrame();
+    const uint8_t* uvRows = frame.data() + kWidth * kHeight;
+    const uint32_t stride = kWidth + 4;
+    std::vector<uint8_t> y = MakeStrided(frame.data(), kHeight, stride);
+    std::vector<uint8_t> uv = MakeStrided(uvRows, kHeight / 2, stride);
+
+    // Y 与 UV 同时更新：一次整帧上传
+    Stats().textureUploads.clear();
+    texture->UpdateAllPlanes({y.data(), uv.data()}, {stride, stride});
+    TEST_ASSERT(Stats().textureUploads.size() == 1, "Both planes uploaded in a single call");
+    TEST_ASSERT(!Stats().textureUploads.empty() && Stats().textureUploads[0].data == frame,
+                "Y and UV rows both present in upload");
+
+    // 只更新 UV：按区域上传到 Y 区域之下
+    Stats().textureUploads.clear();
+    texture->UpdateAllPlanes({nullptr, uv.data()}, {0, stride});
+    TEST_ASSERT(Stats().textureUploads.size() == 1, "UV-only update uploads once");
+    if (Stats().textureUploads.size() == 1) {
+        const TextureUpload& upload = Stats().textureUploads[0];
+        TEST_ASSERT(upload.hasRegion && upload.region.y == kHeight && upload.region.height == kHeight / 2,
+                    "UV region follows Y rows");
+        TEST_ASSERT(upload.data == std::vector<uint8_t>(uvRows, uvRows + kWidth * kHeight / 2),
+                    "UV rows compacted from strided source");
+    }
+
+    // 按逻辑平面单独更新 UV
+    Stats().textureUploads.clear();
+    texture->UpdatePlaneData(1, uvRows);
+    TEST_ASSERT(Stats().textureUploads.size() == 1 && Stats().textureUploads[0].region.y == kHeight,
+                "UpdatePlaneData accepts logical UV plane");
+
+    texture->Release();
+    LRRenderContext::Destroy(context);
+}
+
+void TestSinglePlaneRejectsMissingData() {
+    std::cout << "\n=== Test: Single Plane Rejects Missing Data ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    PlanarTextureDescriptor desc;
+    desc.width = kWidth;
+    desc.height = kHeight;
+    desc.format = PlanarFormat::RGB10A2;
+    LRPlanarTexture* texture = context ? context->CreatePlanarTexture(desc) : nullptr;
+    if (!texture) {
+        TEST_ASSERT(false, "RGB10A2 texture created");
+        LRRenderContext::Destroy(context);
+        return;
+    }
+
+    ImageDataDesc image;
+    image.width = kWidth;
+    image.height = kHeight;
+    image.format = ImageFormat::RGB10A2;
+
+    Stats().textureUploads.clear();
+    TEST_ASSERT(!texture->UpdateFromImage(image), "Image without planes rejected");
+    image.planes = {{nullptr, 0}};
+    TEST_ASSERT(!texture->UpdateFromImage(image), "Plane with null data rejected");
+    TEST_ASSERT(Stats().textureUploads.empty(), "Nothing uploaded for invalid images");
+
+    std::vector<uint32_t> pixels(kWidth * kHeight, 0xC0000000u);
+    image.planes = {{pixels.data(), 0}};
+    TEST_ASSERT(texture->UpdateFromImage(image) && Stats().textureUploads.size() == 1,
+                "Valid RGB10A2 image uploads once");
+
+    texture->Release();
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Planar Texture Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestPackedContiguousUpload();
+    TestPackedStridedUpload();
+    TestPackedUpdateAllPlanes();
+    TestSinglePlaneRejectsMissingData();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
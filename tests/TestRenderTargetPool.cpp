@@ -0,0 +1,154 @@
+/**
+ * @file TestRenderTargetPool.cpp
+ * @brief LRRenderTargetPool 复用与回收、LRImagePyramid 层数选择单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRError.h"
+#include "lrengine/core/LRImagePyramid.h"
+#include "lrengine/core/LRRenderTargetPool.h"
+
+#include <iostream>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestSelectLevelCount() {
+    std::cout << "\n=== Test: Pyramid SelectLevelCount ===" << std::endl;
+
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(64, 64, 8, 0) == 4, "64 down to 8 gives 4 levels");
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(64, 64, 8, 2) == 2, "maxLevels caps the count");
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(100, 50, 8, 0) == 3, "Shorter side rounds up when halving");
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(4, 4, 8, 0) == 1, "Source below minimum keeps level 0");
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(8, 8, 0, 0) == 4, "Zero minimum halves down to 1 pixel");
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(1, 1, 0, 0) == 1, "1x1 source has a single level");
+    TEST_ASSERT(LRImagePyramid::SelectLevelCount(0, 0, 8, 0) == 1, "Empty source still reports one level");
+}
+
+void TestAcquireAndRecycle() {
+    std::cout << "\n=== Test: Pool Acquire And Recycle ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRRenderTargetPool pool;
+        TEST_ASSERT(pool.Acquire(16, 16, PixelFormat::RGBA8) == nullptr, "Acquire before Initialize fails");
+        pool.Initialize(context);
+        TEST_ASSERT(pool.Acquire(0, 16, PixelFormat::RGBA8) == nullptr, "Zero size rejected");
+
+        PooledRenderTarget* a = pool.Acquire(16, 16, PixelFormat::RGBA8);
+        PooledRenderTarget* b = pool.Acquire(16, 16, PixelFormat::RGBA8);
+        TEST_ASSERT(a && b && a != b, "Targets in use are not shared");
+        TEST_ASSERT(a && a->texture && a->frameBuffer && a->width == 16 && a->format == PixelFormat::RGBA8,
+                    "Target carries texture, frame buffer and size");
+        TEST_ASSERT(pool.GetTargetCount() == 2 && pool.GetIdleCount() == 0, "Two targets in use");
+        TEST_ASSERT(Stats().liveTextures == 2 && Stats().liveFrameBuffers == 2, "One texture and FBO per target");
+
+        pool.Recycle(a);
+        TEST_ASSERT(pool.GetIdleCount() == 1, "Recycled target becomes idle");
+        TEST_ASSERT(pool.Acquire(16, 16, PixelFormat::RGBA8) == a && pool.GetTargetCount() == 2,
+                    "Matching idle target is reused");
+
+        pool.Recycle(a);
+        PooledRenderTarget* other = pool.Acquire(16, 16, PixelFormat::RGBA16F);
+        TEST_ASSERT(other != a && pool.GetTargetCount() == 3, "Different format allocates a new target");
+        PooledRenderTarget* resized = pool.Acquire(8, 16, PixelFormat::RGBA8);
+        TEST_ASSERT(resized != a && pool.GetTargetCount() == 4, "Different size allocates a new target");
+
+        PooledRenderTarget foreign;
+        LRError::ClearError();
+        pool.Recycle(&foreign);
+        TEST_ASSERT(LRError::GetLastError() == ErrorCode::InvalidArgument, "Foreign target rejected");
+
+        pool.Release();
+        TEST_ASSERT(pool.GetTargetCount() == 0 && Stats().liveTextures == 0 && Stats().liveFrameBuffers == 0,
+                    "Release destroys every target");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestTrimLevels() {
+    std::cout << "\n=== Test: Pool Trim Levels ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRRenderTargetPool pool;
+        pool.Initialize(context);
+        PooledRenderTarget* a = pool.Acquire(16, 16, PixelFormat::RGBA8);
+        PooledRenderTarget* b = pool.Acquire(32, 32, PixelFormat::RGBA8);
+        PooledRenderTarget* c = pool.Acquire(64, 64, PixelFormat::RGBA8);
+        pool.Recycle(a);
+        pool.Recycle(b);
+
+        // 自上次回收后用过的空闲目标在 Low 级别下保留一轮
+        TEST_ASSERT(pool.Trim(MemoryTrimLevel::Low) == 0, "Low keeps recently used targets");
+        TEST_ASSERT(pool.GetTargetCount() == 3, "All targets kept after first Low trim");
+
+        TEST_ASSERT(pool.Acquire(16, 16, PixelFormat::RGBA8) == a, "Reacquire marks target as used");
+        pool.Recycle(a);
+        TEST_ASSERT(pool.Trim(MemoryTrimLevel::Low) == 1, "Second Low trim releases the unused idle target");
+        TEST_ASSERT(pool.GetTargetCount() == 2 && pool.GetIdleCount() == 1, "Reused and in-use targets remain");
+
+        TEST_ASSERT(pool.Trim(MemoryTrimLevel::Complete) == 1, "Complete releases every idle target");
+        TEST_ASSERT(pool.GetTargetCount() == 1 && pool.GetIdleCount() == 0, "Only the in-use target remains");
+        TEST_ASSERT(Stats().liveTextures == 1 && Stats().liveFrameBuffers == 1, "Trimmed resources destroyed");
+
+        pool.Recycle(c);
+        TEST_ASSERT(pool.Trim(MemoryTrimLevel::Moderate) == 1 && pool.GetTargetCount() == 0,
+                    "Moderate releases idle targets regardless of recent use");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Render Target Pool Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestSelectLevelCount();
+    TestAcquireAndRecycle();
+    TestTrimLevels();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file TestShaderFallback.cpp
+ * @brief LRShader 在后端不支持 SPIR-V 时改用 GLSL 回退源码的单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRError.h"
+#include "lrengine/core/LRShader.h"
+
+#include <iostream>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+// SPIR-V 魔数 + 版本字，内容不被模拟后端解析
+static const uint32_t s_spirv[2] = {0x07230203u, 0x00010000u};
+
+static const char* s_vertexFallback = "void main() { gl_Position = vec4(0.0); }";
+static const char* s_fragmentFallback = "out vec4 color; void main() { color = vec4(1.0); }";
+
+static ShaderDescriptor MakeSPIRVDesc(ShaderStage stage, const char* fallback) {
+    ShaderDescriptor desc;
+    desc.stage = stage;
+    desc.language = ShaderLanguage::SPIRV;
+    desc.source = reinterpret_cast<const char*>(s_spirv);
+    desc.sourceLength = sizeof(s_spirv);
+    desc.fallbackSource = fallback;
+    return desc;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestFallbackCompiled() {
+    std::cout << "\n=== Test: Fallback Source Compiled ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    LRShader* vertex = context->CreateShader(MakeSPIRVDesc(ShaderStage::Vertex, s_vertexFallback));
+    LRShader* fragment = context->CreateShader(MakeSPIRVDesc(ShaderStage::Fragment, s_fragmentFallback));
+    TEST_ASSERT(vertex && vertex->IsCompiled() && fragment && fragment->IsCompiled(),
+                "SPIR-V shaders compile from fallback when unsupported");
+    TEST_ASSERT(Stats().compiledShaderSources.size() == 2 &&
+                Stats().compiledShaderSources[0] == s_vertexFallback &&
+                Stats().compiledShaderSources[1] == s_fragmentFallback,
+                "Backend receives the GLSL fallback sources");
+    TEST_ASSERT(Stats().compiledShaderLanguages.size() == 2 &&
+                Stats().compiledShaderLanguages[0] == ShaderLanguage::GLSL &&
+                Stats().compiledShaderLanguages[1] == ShaderLanguage::GLSL,
+                "Fallback is compiled as GLSL");
+
+    LRShaderProgram* program = context->CreateShaderProgram(vertex, fragment);
+    TEST_ASSERT(program && program->IsLinked(), "Fallback stages link into a program");
+
+    if (program) {
+        program->Release();
+    }
+    if (vertex) {
+        vertex->Release();
+    }
+    if (fragment) {
+        fragment->Release();
+    }
+    LRRenderContext::Destroy(context);
+}
+
+void TestMissingFallback() {
+    std::cout << "\n=== Test: Missing Fallback ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    LRError::ClearError();
+    LRShader* shader = context->CreateShader(MakeSPIRVDesc(ShaderStage::Vertex, nullptr));
+    TEST_ASSERT(shader == nullptr, "SPIR-V without fallback fails when unsupported");
+    TEST_ASSERT(LRError::GetLastError() == ErrorCode::NotSupported, "NotSupported reported");
+    TEST_ASSERT(Stats().compiledShaderSources.empty(), "Backend compile not attempted");
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestSPIRVPreferred() {
+    std::cout << "\n=== Test: SPIR-V Preferred When Supported ===" << std::endl;
+
+    ScopedMockBackend backend;
+    Stats().supportsSPIRV = true;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    LRShader* shader = context->CreateShader(MakeSPIRVDesc(ShaderStage::Vertex, s_vertexFallback));
+    TEST_ASSERT(shader && shader->IsCompiled(), "SPIR-V shader compiles");
+    TEST_ASSERT(Stats().compiledShaderSources.size() == 1 &&
+                Stats().compiledShaderSources[0] == reinterpret_cast<const char*>(s_spirv),
+                "Binary used instead of fallback");
+    TEST_ASSERT(Stats().compiledShaderLanguages.size() == 1 &&
+                Stats().compiledShaderLanguages[0] == ShaderLanguage::SPIRV,
+                "Backend receives SPIR-V");
+
+    if (shader) {
+        shader->Release();
+    }
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Shader Fallback Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestFallbackCompiled();
+    TestMissingFallback();
+    TestSPIRVPreferred();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file TestStaticBatchBuffers.cpp
+ * @brief LRStaticBatcher GPU 缓冲创建单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRStaticBatch.h"
+
+#include <iostream>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+static const float s_triangle[3 * 3] = {
+    0.0f, 0.0f, 0.0f,
+    1.0f, 0.0f, 0.0f,
+    0.0f, 1.0f, 0.0f,
+};
+static const uint16_t s_indices[3] = {0, 1, 2};
+
+static StaticBatchOptions MakeOptions() {
+    StaticBatchOptions options;
+    VertexAttribute pos;
+    pos.location = 0;
+    pos.format = VertexFormat::Float3;
+    options.layout.attributes = {pos};
+    options.layout.stride = sizeof(float) * 3;
+    return options;
+}
+
+static StaticMeshInstance MakeInstance() {
+    StaticMeshInstance instance;
+    instance.vertexData = s_triangle;
+    instance.vertexCount = 3;
+    instance.indexData = s_indices;
+    instance.indexCount = 3;
+    instance.indexType = IndexType::UInt16;
+    return instance;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestRepeatedCreateBuffers() {
+    std::cout << "\n=== Test: Repeated CreateBuffers ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRStaticBatcher batcher(MakeOptions());
+        batcher.AddInstance(MakeInstance());
+        batcher.Build();
+
+        TEST_ASSERT(batcher.CreateBuffers(context), "First CreateBuffers succeeds");
+        LRVertexBuffer* vertexBuffer = batcher.GetChunks()[0].vertexBuffer;
+        TEST_ASSERT(vertexBuffer != nullptr && Stats().liveBuffers == 2, "Vertex and index buffers created");
+
+        TEST_ASSERT(batcher.CreateBuffers(context), "Second CreateBuffers after CPU release succeeds");
+        TEST_ASSERT(batcher.GetChunks()[0].vertexBuffer == vertexBuffer && Stats().liveBuffers == 2,
+                    "Existing buffers kept");
+
+        batcher.ReleaseBuffers();
+        TEST_ASSERT(!batcher.CreateBuffers(context), "Rebuild without CPU data fails");
+        TEST_ASSERT(Stats().liveBuffers == 0, "Failed rebuild creates nothing");
+    }
+
+    {
+        LRStaticBatcher batcher(MakeOptions());
+        batcher.AddInstance(MakeInstance());
+        batcher.Build();
+        batcher.CreateBuffers(context, false);
+        batcher.ReleaseBuffers();
+        TEST_ASSERT(batcher.CreateBuffers(context) && Stats().liveBuffers == 2,
+                    "Rebuild with retained CPU data succeeds");
+    }
+    TEST_ASSERT(Stats().liveBuffers == 0, "Batcher releases its buffers");
+
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Static Batch Buffer Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestRepeatedCreateBuffers();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
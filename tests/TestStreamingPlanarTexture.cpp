@@ -0,0 +1,237 @@
+/**
+ * @file TestStreamingPlanarTexture.cpp
+ * @brief LRStreamingPlanarTexture 纹理环轮转与栅栏同步单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRError.h"
+#include "lrengine/core/LRStreamingPlanarTexture.h"
+
+#include <iostream>
+#include <vector>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+static const uint32_t kWidth = 8;
+static const uint32_t kHeight = 4;
+static const int kTexturesPerFrame = 2;    // NV12 分离布局：Y + UV
+
+// ============================================================================
+// 辅助函数
+// ============================================================================
+
+struct Frame {
+    std::vector<uint8_t> bytes = std::vector<uint8_t>(kWidth * kHeight * 3 / 2, 0x80);
+    ImageDataDesc image;
+
+    Frame() {
+        image.width = kWidth;
+        image.height = kHeight;
+        image.format = ImageFormat::NV12;
+        image.planes = {{bytes.data(), 0}, {bytes.data() + kWidth * kHeight, 0}};
+    }
+};
+
+static StreamingPlanarTextureDescriptor MakeDesc(uint32_t ringSize) {
+    StreamingPlanarTextureDescriptor desc;
+    desc.planar.width = kWidth;
+    desc.planar.height = kHeight;
+    desc.planar.format = PlanarFormat::NV12;
+    desc.ringSize = ringSize;
+    return desc;
+}
+
+static bool IsEvent(const FenceEvent& event, FenceEvent::Type type, uint64_t fence) {
+    return event.type == type && event.fence == fence;
+}
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestInvalidUsage() {
+    std::cout << "\n=== Test: Invalid Usage ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        Frame frame;
+        LRStreamingPlanarTexture stream;
+        LRError::ClearError();
+        TEST_ASSERT(!stream.UpdateFromImage(frame.image), "Upload before Initialize fails");
+        TEST_ASSERT(LRError::GetLastError() == ErrorCode::NotInitialized, "NotInitialized reported");
+        TEST_ASSERT(!stream.Initialize(context, MakeDesc(1)), "Ring of one texture rejected");
+        TEST_ASSERT(!stream.Initialize(context, MakeDesc(9)), "Ring larger than 8 rejected");
+        TEST_ASSERT(stream.GetCurrent() == nullptr && Stats().liveTextures == 0, "Nothing created");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestRingRotation() {
+    std::cout << "\n=== Test: Ring Rotation ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        Frame frame;
+        LRStreamingPlanarTexture stream;
+        TEST_ASSERT(stream.Initialize(context, MakeDesc(3)), "Ring of three created");
+        TEST_ASSERT(stream.GetRingSize() == 3 && Stats().liveTextures == 3 * kTexturesPerFrame,
+                    "All ring textures allocated up front");
+        TEST_ASSERT(stream.GetCurrent() == nullptr, "No current texture before first upload");
+
+        std::vector<LRPlanarTexture*> current;
+        for (int i = 0; i < 4; ++i) {
+            stream.UpdateFromImage(frame.image);
+            current.push_back(stream.GetCurrent());
+        }
+        TEST_ASSERT(current[0] && current[0] != current[1] && current[1] != current[2] && current[0] != current[2],
+                    "Consecutive frames use different textures");
+        TEST_ASSERT(current[3] == current[0], "Ring wraps to the first texture");
+        TEST_ASSERT(stream.GetFrameCount() == 4, "Frame count tracks uploads");
+        TEST_ASSERT(stream.GetStallCount() == 0, "No stall when fences complete in time");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestFenceOrderingAndStalls() {
+    std::cout << "\n=== Test: Fence Ordering And Stalls ===" << std::endl;
+
+    ScopedMockBackend backend;
+    Stats().fencesCompleteOnSignal = false;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        Frame frame;
+        LRStreamingPlanarTexture stream;
+        stream.Initialize(context, MakeDesc(3));
+
+        stream.UpdateFromImage(frame.image);
+        TEST_ASSERT(Stats().fenceEvents.empty(), "First upload inserts no fence");
+
+        // 第二帧：为第一帧的纹理插入栅栏，下一槽位从未使用，无需等待
+        stream.UpdateFromImage(frame.image);
+        TEST_ASSERT(Stats().fenceEvents.size() == 1 && Stats().fenceEvents[0].type == FenceEvent::Signal,
+                    "Previous texture fenced before switching");
+        const uint64_t firstFence = Stats().fenceEvents.empty() ? 0 : Stats().fenceEvents[0].fence;
+
+        stream.UpdateFromImage(frame.image);
+        TEST_ASSERT(stream.GetStallCount() == 0, "Unused slots never stall");
+
+        // 第四帧回到第一个槽位，其栅栏仍未完成，须先等待
+        Stats().fenceEvents.clear();
+        stream.UpdateFromImage(frame.image);
+        const std::vector<FenceEvent>& events = Stats().fenceEvents;
+        TEST_ASSERT(events.size() == 3 && events[0].type == FenceEvent::Signal && events[0].fence != firstFence,
+                    "Current texture fenced first");
+        TEST_ASSERT(events.size() == 3 && IsEvent(events[1], FenceEvent::Wait, firstFence) &&
+                    IsEvent(events[2], FenceEvent::Reset, firstFence),
+                    "Reused slot waits on its own fence, then resets it");
+        TEST_ASSERT(stream.GetStallCount() == 1, "Pending fence counted as a stall");
+
+        // 等待超时仍然上传
+        Stats().fenceWaitSucceeds = false;
+        TEST_ASSERT(stream.UpdateFromImage(frame.image), "Upload proceeds after wait timeout");
+        TEST_ASSERT(stream.GetStallCount() == 2 && stream.GetFrameCount() == 5, "Timed-out wait still counted");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestTrimAndRecreate() {
+    std::cout << "\n=== Test: Trim And Recreate ===" << std::endl;
+
+    ScopedMockBackend backend;
+    Stats().fencesCompleteOnSignal = false;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        Frame frame;
+        LRStreamingPlanarTexture stream;
+        stream.Initialize(context, MakeDesc(3));
+        for (int i = 0; i < 3; ++i) {
+            stream.UpdateFromImage(frame.image);
+        }
+        LRPlanarTexture* current = stream.GetCurrent();
+
+        TEST_ASSERT(stream.Trim(MemoryTrimLevel::Low) == 0, "Low keeps the ring");
+        TEST_ASSERT(stream.Trim(MemoryTrimLevel::Moderate) == 0, "Moderate keeps textures the GPU still uses");
+
+        Stats().fenceEvents.clear();
+        TEST_ASSERT(stream.Trim(MemoryTrimLevel::Complete) == 2, "Complete releases all non-current textures");
+        TEST_ASSERT(Stats().liveTextures == kTexturesPerFrame && stream.GetCurrent() == current,
+                    "Current texture kept");
+        size_t waits = 0;
+        for (const FenceEvent& event : Stats().fenceEvents) {
+            waits += event.type == FenceEvent::Wait ? 1 : 0;
+        }
+        TEST_ASSERT(waits == 2, "Complete waits for pending fences before releasing");
+
+        const uint64_t stalls = stream.GetStallCount();
+        TEST_ASSERT(stream.UpdateFromImage(frame.image), "Upload into a trimmed slot succeeds");
+        TEST_ASSERT(Stats().liveTextures == 2 * kTexturesPerFrame, "Trimmed texture recreated on demand");
+        TEST_ASSERT(stream.GetCurrent() != nullptr && stream.GetCurrent() != current, "Recreated texture is current");
+        TEST_ASSERT(stream.GetStallCount() == stalls, "Slot already waited by trim does not stall again");
+    }
+    TEST_ASSERT(Stats().liveTextures == 0, "Stream releases its textures");
+
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Streaming Planar Texture Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestInvalidUsage();
+    TestRingRotation();
+    TestFenceOrderingAndStalls();
+    TestTrimAndRecreate();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}
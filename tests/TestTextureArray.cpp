@@ -0,0 +1,139 @@
+/**
+ * @file TestTextureArray.cpp
+ * @brief LRTextureArrayAllocator 分配与释放单元测试
+ */
+
+#include "MockBackend.h"
+
+#include "lrengine/core/LRError.h"
+#include "lrengine/core/LRTextureArray.h"
+
+#include <iostream>
+
+using namespace lrengine::render;
+using namespace lrengine::render::mock;
+
+// 测试计数器
+static int s_tests_passed = 0;
+static int s_tests_failed = 0;
+
+#define TEST_ASSERT(condition, msg) \
+    do { \
+        if (condition) { \
+            s_tests_passed++; \
+            std::cout << "[PASS] " << msg << std::endl; \
+        } else { \
+            s_tests_failed++; \
+            std::cerr << "[FAIL] " << msg << " (line " << __LINE__ << ")" << std::endl; \
+        } \
+    } while(0)
+
+// ============================================================================
+// 测试用例
+// ============================================================================
+
+void TestAllocateAndReuse() {
+    std::cout << "\n=== Test: Allocate And Reuse ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRTextureArrayAllocator allocator;
+        TextureArrayAllocatorDescriptor desc;
+        desc.layersPerPage = 2;
+        allocator.Initialize(context, desc);
+
+        TextureArrayLayer a, b, c;
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, a);
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, b);
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, c);
+        TEST_ASSERT(a.texture == b.texture && a.layer != b.layer, "Same page fills distinct layers");
+        TEST_ASSERT(c.page != a.page && allocator.GetPageCount() == 2, "Full page opens a new one");
+        TEST_ASSERT(allocator.GetAllocatedLayerCount() == 3, "Three layers allocated");
+
+        const uint32_t freedLayer = a.layer;
+        allocator.Free(a);
+        TEST_ASSERT(!a.IsValid() && allocator.GetAllocatedLayerCount() == 2, "Free releases the layer");
+
+        TextureArrayLayer d;
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, d);
+        TEST_ASSERT(d.texture == b.texture && d.layer == freedLayer, "Freed layer is reused");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+void TestInvalidFree() {
+    std::cout << "\n=== Test: Invalid Free ===" << std::endl;
+
+    ScopedMockBackend backend;
+    LRRenderContext* context = backend.CreateContext();
+    if (!context) {
+        TEST_ASSERT(false, "Mock context created");
+        return;
+    }
+
+    {
+        LRTextureArrayAllocator allocator;
+        TextureArrayAllocatorDescriptor desc;
+        desc.layersPerPage = 4;
+        allocator.Initialize(context, desc);
+
+        TextureArrayLayer a;
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, a);
+        TextureArrayLayer copy = a;
+        allocator.Free(a);
+
+        // 同一层的副本再次释放
+        LRError::ClearError();
+        allocator.Free(copy);
+        TEST_ASSERT(LRError::GetLastError() == ErrorCode::InvalidArgument, "Double free reports an error");
+        TEST_ASSERT(copy.IsValid(), "Rejected layer is left untouched");
+
+        TextureArrayLayer b;
+        TextureArrayLayer c;
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, b);
+        allocator.Allocate(8, 8, PixelFormat::RGBA8, nullptr, c);
+        TEST_ASSERT(b.layer != c.layer, "Double free does not hand out a layer twice");
+
+        // 从未分配过的层
+        TextureArrayLayer forged = b;
+        forged.layer = 3;
+        LRError::ClearError();
+        allocator.Free(forged);
+        TEST_ASSERT(LRError::GetLastError() == ErrorCode::InvalidArgument, "Unallocated layer rejected");
+
+        forged.layer = 100;
+        LRError::ClearError();
+        allocator.Free(forged);
+        TEST_ASSERT(LRError::GetLastError() == ErrorCode::InvalidArgument, "Out-of-range layer rejected");
+
+        TEST_ASSERT(allocator.GetAllocatedLayerCount() == 2, "Allocated count unaffected by invalid frees");
+    }
+
+    LRRenderContext::Destroy(context);
+}
+
+// ============================================================================
+// 主函数
+// ============================================================================
+
+int main() {
+    std::cout << "========================================" << std::endl;
+    std::cout << "Texture Array Unit Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    TestAllocateAndReuse();
+    TestInvalidFree();
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Results: " << s_tests_passed << " passed, " << s_tests_failed << " failed" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    return s_tests_failed > 0 ? 1 : 0;
+}